@@ -25,6 +25,7 @@ namespace
         void* user = nullptr;
         WfsBridgeOutboundFn       onOutbound    = nullptr;
         WfsBridgeOutbound3fFn     onOutbound3f  = nullptr;
+        WfsBridgeOutboundTimedFn  onOutboundTimed = nullptr;
         WfsBridgeTrackLifecycleFn onLifecycle   = nullptr;
     };
 
@@ -291,4 +292,31 @@ void wfs_bridge_track_send_outbound_3f (WfsBridgeTrackHandle* handle,
         masterCopy.onOutbound3f (masterCopy.user, oscPath, v1, v2, v3);
 }
 
+// ── Timetagged variants ──
+
+void wfs_bridge_master_set_outbound_timed (WfsBridgeMasterHandle* /*handle*/,
+                                           WfsBridgeOutboundTimedFn onOutboundTimed)
+{
+    auto& r = getRegistry();
+    std::lock_guard<std::mutex> sl (r.lock);
+    if (r.master != nullptr)
+        r.master->onOutboundTimed = onOutboundTimed;
+}
+
+void wfs_bridge_track_send_outbound_timed (WfsBridgeTrackHandle* handle,
+                                           const char* oscPath,
+                                           int channelId,
+                                           double value,
+                                           unsigned long long ntpTimeTag)
+{
+    if (handle == nullptr)
+        return;
+    auto& r = getRegistry();
+    auto masterCopy = snapshotMaster (r);
+    if (masterCopy.onOutboundTimed)
+        masterCopy.onOutboundTimed (masterCopy.user, oscPath, channelId, value, ntpTimeTag);
+    else if (masterCopy.onOutbound)
+        masterCopy.onOutbound (masterCopy.user, oscPath, channelId, value);
+}
+
 }
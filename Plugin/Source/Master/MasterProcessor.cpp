@@ -94,6 +94,30 @@ namespace wfs::plugin
             self->dispatchOutEvent (e);
     }
 
+    void MasterProcessor::bridgeOutboundTimedCallback (void* user, const char* oscPath, int channelId,
+                                                       double value, unsigned long long ntpTimeTag)
+    {
+        if (user == nullptr)
+            return;
+        auto* self = static_cast<MasterProcessor*> (user);
+        if (! self->isConnected())
+            return;
+
+        std::vector<OutEvent> events;
+        events.reserve (4);
+        self->translator.translate1f (juce::String::fromUTF8 (oscPath), channelId,
+                                      static_cast<float> (value), events);
+        for (const auto& e : events)
+        {
+            // Profiles that fold the sample into a 3f message lose the
+            // timetag; the app applies those on arrival.
+            if (e.isThreeFloat)
+                self->dispatchOutEvent (e);
+            else
+                self->timedQueue.post (e.path, e.channelId, e.v1, static_cast<uint64_t> (ntpTimeTag));
+        }
+    }
+
     void MasterProcessor::bridgeLifecycleCallback (void* user, int inputId,
                                                    const char* variantTag, int isRegister)
     {
@@ -123,7 +147,11 @@ namespace wfs::plugin
     {
         rateLimiter.setSendFunction ([this] (const juce::String& path, int chan, float value)
         {
-            transport.sendFloat (path, chan, value);
+            sendRateLimited (path, chan, value);
+        });
+        timedQueue.setSendFunction ([this] (uint64_t timeTag, const std::vector<TimedBundleQueue::Item>& items)
+        {
+            sendTimedGroup (timeTag, items);
         });
         query.setOscCallback ([this] (const juce::String& path, float value)
         {
@@ -146,6 +174,8 @@ namespace wfs::plugin
                                                   &bridgeLifecycleCallback);
             if (bridgeHandle != nullptr && loader.masterSetOutbound3f != nullptr)
                 loader.masterSetOutbound3f (bridgeHandle, &bridgeOutbound3fCallback);
+            if (bridgeHandle != nullptr && loader.masterSetOutboundTimed != nullptr)
+                loader.masterSetOutboundTimed (bridgeHandle, &bridgeOutboundTimedCallback);
         }
     }
 
@@ -226,6 +256,9 @@ namespace wfs::plugin
                          + ") - skipping OSCQuery handshake");
         }
 
+        if (wantOscQuery)
+            openLocalControlRing (host);
+
         // ADM-OSC isn't exposed over OSCQuery, so we need a dedicated UDP
         // receiver for inbound /adm/obj/N/... messages from the app. For
         // SendOnly profiles this is opt-in via TargetProfile::admEchoEnabled.
@@ -274,10 +307,74 @@ namespace wfs::plugin
             admReceiver.disconnect();
             admReceiverOpen = false;
         }
+        localRing.close();
         query.disconnect();
         transport.disconnect();
     }
 
+    void MasterProcessor::openLocalControlRing (const juce::String& host)
+    {
+        // Only an app on this computer can share memory with us.
+        const juce::IPAddress address (host);
+        const bool local = host.equalsIgnoreCase ("localhost")
+                        || address == juce::IPAddress::local()
+                        || address == juce::IPAddress::local (true)
+                        || juce::IPAddress::getAllAddresses().contains (address)
+                        || juce::IPAddress::getAllAddresses (true).contains (address);
+        if (! local)
+            return;
+
+        const auto info = juce::JSON::parse (query.getLastHostInfo()).getProperty ("LOCAL_CONTROL", {});
+        const auto path = info.getProperty ("PATH", {}).toString();
+        const auto session = static_cast<uint32_t> (static_cast<juce::int64> (info.getProperty ("SESSION", 0)));
+        if (path.isEmpty())
+            return;
+
+        if (localRing.open (juce::File (path), session))
+            diagLog.add ("Local transport: shared-memory ring " + path);
+        else
+            diagLog.add ("Local transport unavailable (" + path + ") - using UDP");
+    }
+
+    void MasterProcessor::sendRateLimited (const juce::String& path, int channelId, float value)
+    {
+        // Parameters the ring has no handle for, a full ring or a restarted
+        // app all fall through to the UDP send.
+        if (localRing.isOpen()
+            && localRing.push (channelId, LocalControlRing::findParamHandle (path), value))
+            return;
+        transport.sendFloat (path, channelId, value);
+    }
+
+    void MasterProcessor::sendTimedGroup (uint64_t timeTag, const std::vector<TimedBundleQueue::Item>& items)
+    {
+        // Keeps each datagram well under a typical MTU (~36 bytes a message).
+        constexpr int maxMessagesPerBundle = 24;
+
+        juce::OSCBundle bundle { juce::OSCTimeTag (timeTag) };
+        auto flush = [this, &bundle, timeTag]
+        {
+            if (bundle.size() > 0)
+                transport.sendBundle (bundle);
+            bundle = juce::OSCBundle { juce::OSCTimeTag (timeTag) };
+        };
+
+        for (const auto& item : items)
+        {
+            if (localRing.isOpen()
+                && localRing.push (item.channelId, LocalControlRing::findParamHandle (item.path),
+                                   item.value, 0.0f, timeTag))
+                continue;
+
+            bundle.addElement (juce::OSCMessage (juce::OSCAddressPattern (item.path),
+                                                 static_cast<juce::int32> (item.channelId),
+                                                 item.value));
+            if (bundle.size() >= maxMessagesPerBundle)
+                flush();
+        }
+        flush();
+    }
+
     bool MasterProcessor::isConnected() const
     {
         return transport.isConnected();
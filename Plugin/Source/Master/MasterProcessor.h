@@ -8,8 +8,10 @@
 #include "../Shared/OscTransport.h"
 #include "../Shared/OscQueryClient.h"
 #include "../Shared/RateLimiter.h"
+#include "../Shared/TimedBundleQueue.h"
 #include "../Shared/DiagnosticLog.h"
 #include "../Shared/TargetProfile.h"
+#include "LocalControlRing.h"
 
 namespace wfs::plugin
 {
@@ -60,11 +62,17 @@ namespace wfs::plugin
     private:
         static void bridgeOutboundCallback   (void* user, const char* oscPath, int channelId, double value);
         static void bridgeOutbound3fCallback (void* user, const char* oscPath, double v1, double v2, double v3);
+        static void bridgeOutboundTimedCallback (void* user, const char* oscPath, int channelId,
+                                                 double value, unsigned long long ntpTimeTag);
         static void bridgeLifecycleCallback  (void* user, int inputId, const char* variantTag, int isRegister);
 
         void oscMessageReceived (const juce::OSCMessage& message) override;
         void dispatchAdmInbound (const juce::OSCMessage& msg);
 
+        void openLocalControlRing (const juce::String& host);
+        void sendRateLimited (const juce::String& path, int channelId, float value);
+        void sendTimedGroup (uint64_t timeTag, const std::vector<TimedBundleQueue::Item>& items);
+
         void onQueryOscPush (const juce::String& oscPath, float value);
         void onTrackRegistered (int inputId, const juce::String& variantTag);
         void onTrackUnregistered (int inputId);
@@ -77,8 +85,10 @@ namespace wfs::plugin
 
         juce::AudioProcessorValueTreeState state;
         OscTransport    transport;
+        LocalControlRing::Producer localRing;   // Same-host app only; UDP otherwise
         OscQueryClient  query;
         RateLimiter     rateLimiter;
+        TimedBundleQueue timedQueue;   // Timetagged automation samples from the Tracks
         juce::OSCReceiver admReceiver;
         bool              admReceiverOpen = false;
         WfsBridgeMasterHandle* bridgeHandle = nullptr;
@@ -46,6 +46,14 @@ extern "C" {
                                          int channelId,
                                          double v1, double v2, double v3);
 
+    // Timetagged outbound: a value sampled on the Track's audio timeline,
+    // with the OSC/NTP timetag of the block it was sampled in.
+    typedef void (*WfsBridgeOutboundTimedFn)(void* masterUser,
+                                             const char* oscPath,
+                                             int channelId,
+                                             double value,
+                                             unsigned long long ntpTimeTag);
+
     WFS_BRIDGE_API int                     wfs_bridge_abi_version();
 
     WFS_BRIDGE_API WfsBridgeMasterHandle*  wfs_bridge_master_register (void* user,
@@ -85,6 +93,17 @@ extern "C" {
     WFS_BRIDGE_API void                    wfs_bridge_track_send_outbound_3f (WfsBridgeTrackHandle* handle,
                                                                                const char* oscPath,
                                                                                double v1, double v2, double v3);
+
+    // ── Timetagged variants (automation sampled in processBlock) ──
+    // A Master that never sets the timed callback still receives these
+    // through its plain outbound callback, untimed.
+    WFS_BRIDGE_API void                    wfs_bridge_master_set_outbound_timed (WfsBridgeMasterHandle* handle,
+                                                                                 WfsBridgeOutboundTimedFn onOutboundTimed);
+    WFS_BRIDGE_API void                    wfs_bridge_track_send_outbound_timed (WfsBridgeTrackHandle* handle,
+                                                                                  const char* oscPath,
+                                                                                  int channelId,
+                                                                                  double value,
+                                                                                  unsigned long long ntpTimeTag);
 }
 
 namespace wfs::plugin
@@ -29,6 +29,9 @@ namespace wfs::plugin
         decltype(&wfs_bridge_track_set_inbound_3f)         trackSetInbound3f   = nullptr;
         decltype(&wfs_bridge_track_send_outbound_3f)       trackSendOutbound3f = nullptr;
 
+        decltype(&wfs_bridge_master_set_outbound_timed)    masterSetOutboundTimed = nullptr;
+        decltype(&wfs_bridge_track_send_outbound_timed)    trackSendOutboundTimed = nullptr;
+
     private:
         BridgeLoader() = default;
         ~BridgeLoader();
@@ -228,12 +228,7 @@ namespace wfs::plugin
 
     void OscQueryClient::dataReceived (const juce::MemoryBlock& data)
     {
-        juce::String path;
-        float value = 0.0f;
-        if (! decodeOscPacket (data, path, value))
-            return;
-        if (oscCallback)
-            oscCallback (path, value);
+        dispatchOscPacket (static_cast<const uint8_t*> (data.getData()), data.getSize(), 0);
     }
 
     void OscQueryClient::connectionClosed (int /*status*/, const juce::String& /*reason*/)
@@ -273,12 +268,40 @@ namespace wfs::plugin
         }
     }
 
-    bool OscQueryClient::decodeOscPacket (const juce::MemoryBlock& data,
+    void OscQueryClient::dispatchOscPacket (const uint8_t* bytes, size_t size, int depth)
+    {
+        // The server batches each flush into one bundle per connection
+        // ("#bundle\0", 8-byte time tag, then [int32 size][element]...).
+        // Time tags are ignored: every push applies on arrival.
+        static constexpr char bundleTag[] = "#bundle";
+        if (bytes != nullptr && size >= 16 && std::memcmp (bytes, bundleTag, sizeof (bundleTag)) == 0)
+        {
+            if (depth > 4)
+                return;
+            for (size_t pos = 16; pos + 4 <= size;)
+            {
+                const size_t elementSize = readBigEndianU32 (bytes + pos);
+                pos += 4;
+                if (elementSize > size - pos)
+                    return;
+                dispatchOscPacket (bytes + pos, elementSize, depth + 1);
+                pos += elementSize;
+            }
+            return;
+        }
+
+        juce::String path;
+        float value = 0.0f;
+        if (! decodeOscPacket (bytes, size, path, value))
+            return;
+        if (oscCallback)
+            oscCallback (path, value);
+    }
+
+    bool OscQueryClient::decodeOscPacket (const uint8_t* bytes, size_t size,
                                           juce::String& outPath,
                                           float& outValue)
     {
-        const auto* bytes = static_cast<const uint8_t*> (data.getData());
-        const size_t size = data.getSize();
         if (bytes == nullptr || size < 8)
             return false;
 
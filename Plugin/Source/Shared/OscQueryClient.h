@@ -46,7 +46,8 @@ namespace wfs::plugin
 
         bool httpGet (const juce::String& pathAndQuery, juce::String& outBody);
         void sendCommand (const juce::String& command, const juce::String& path);
-        bool decodeOscPacket (const juce::MemoryBlock& data,
+        void dispatchOscPacket (const uint8_t* bytes, size_t size, int depth);
+        bool decodeOscPacket (const uint8_t* bytes, size_t size,
                               juce::String& outPath,
                               float& outValue);
 
@@ -61,4 +61,12 @@ namespace wfs::plugin
             return false;
         return sender.send (juce::OSCAddressPattern (oscPath), v1, v2, v3);
     }
+
+    bool OscTransport::sendBundle (const juce::OSCBundle& bundle)
+    {
+        std::lock_guard<std::mutex> sl (lock);
+        if (! connected.load())
+            return false;
+        return sender.send (bundle);
+    }
 }
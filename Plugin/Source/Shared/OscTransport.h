@@ -25,6 +25,8 @@ namespace wfs::plugin
             the channel is embedded in the address path). */
         bool sendFloats3 (const juce::String& oscPath, float v1, float v2, float v3);
 
+        bool sendBundle (const juce::OSCBundle& bundle);
+
     private:
         std::mutex lock;
         juce::OSCSender sender;
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <juce_core/juce_core.h>
+
+namespace wfs::plugin
+{
+    // OSC timetags are NTP: seconds since 1900 in the high word, fraction in
+    // the low word.
+    inline uint64_t toNtpTimeTag (double unixSeconds) noexcept
+    {
+        constexpr double ntpEpochOffset = 2208988800.0;   // 1900-01-01 -> 1970-01-01
+        const double ntp = unixSeconds + ntpEpochOffset;
+        const double whole = std::floor (ntp);
+        const auto frac = static_cast<uint64_t> ((ntp - whole) * 4294967296.0);
+        return (static_cast<uint64_t> (whole) << 32) | (frac & 0xffffffffull);
+    }
+
+    // Maps the host playhead's sample position to wall-clock timetags.
+    // The clock is anchored to the wall clock when playback starts or jumps
+    // (seek, loop); between anchors every stamp is derived from the sample
+    // position alone. Two blocks N samples apart are therefore always
+    // stamped exactly N / sampleRate apart, whatever the callback jitter.
+    // Audio thread only.
+    class PlayheadClock
+    {
+    public:
+        void reset() noexcept { anchored = false; }
+
+        uint64_t stamp (int64_t timeInSamples, int numSamples, double sampleRate) noexcept
+        {
+            const double nowUnix = static_cast<double> (juce::Time::currentTimeMillis()) * 0.001;
+
+            if (anchored && timeInSamples != expectedSample)
+                anchored = false;   // Seek or loop
+
+            double t = anchorUnix + static_cast<double> (timeInSamples - anchorSample) / sampleRate;
+
+            // Audio and wall clocks drift apart over long takes; hosts that
+            // render ahead (anticipative FX) stay well inside this bound.
+            if (! anchored || std::abs (t - nowUnix) > maxDriftSeconds)
+            {
+                anchorUnix = nowUnix;
+                anchorSample = timeInSamples;
+                anchored = true;
+                t = nowUnix;
+            }
+
+            expectedSample = timeInSamples + numSamples;
+            return toNtpTimeTag (t);
+        }
+
+    private:
+        static constexpr double maxDriftSeconds = 0.5;
+
+        bool    anchored = false;
+        double  anchorUnix = 0.0;
+        int64_t anchorSample = 0;
+        int64_t expectedSample = 0;
+    };
+
+    // One automation value sampled on the audio thread.
+    struct TimedSample
+    {
+        int      param = 0;      // Index into the processor's sampled-parameter table
+        float    value = 0.0f;
+        uint64_t timeTag = 0;
+    };
+
+    // Single-producer (audio thread) / single-consumer (message thread) queue
+    // of TimedSample. A full queue drops the newest sample; the next change
+    // of that parameter supersedes it anyway.
+    template <int Capacity>
+    class TimedSampleFifo
+    {
+    public:
+        bool push (const TimedSample& s) noexcept
+        {
+            int start1, size1, start2, size2;
+            fifo.prepareToWrite (1, start1, size1, start2, size2);
+            if (size1 + size2 < 1)
+                return false;
+            buffer[static_cast<size_t> (size1 > 0 ? start1 : start2)] = s;
+            fifo.finishedWrite (1);
+            return true;
+        }
+
+        template <typename Fn>
+        int drain (Fn&& fn)
+        {
+            int start1, size1, start2, size2;
+            fifo.prepareToRead (fifo.getNumReady(), start1, size1, start2, size2);
+            for (int i = 0; i < size1; ++i) fn (buffer[static_cast<size_t> (start1 + i)]);
+            for (int i = 0; i < size2; ++i) fn (buffer[static_cast<size_t> (start2 + i)]);
+            fifo.finishedRead (size1 + size2);
+            return size1 + size2;
+        }
+
+    private:
+        juce::AbstractFifo fifo { Capacity };
+        std::array<TimedSample, Capacity> buffer {};
+    };
+}
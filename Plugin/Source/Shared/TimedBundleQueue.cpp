@@ -0,0 +1,60 @@
+#include "TimedBundleQueue.h"
+
+#include <algorithm>
+
+namespace wfs::plugin
+{
+    TimedBundleQueue::TimedBundleQueue() = default;
+
+    TimedBundleQueue::~TimedBundleQueue()
+    {
+        stopTimer();
+    }
+
+    void TimedBundleQueue::setSendFunction (SendFn fn)
+    {
+        std::lock_guard<std::mutex> sl (lock);
+        sendFn = std::move (fn);
+    }
+
+    void TimedBundleQueue::post (const juce::String& path, int channelId, float value, uint64_t timeTag)
+    {
+        {
+            std::lock_guard<std::mutex> sl (lock);
+            if (pending.size() >= kMaxPending)
+                return;   // Transport stalled; the trajectory resumes with the next samples
+            pending.push_back ({ timeTag, { path, channelId, value } });
+        }
+
+        // Lazy start, as in RateLimiter: no timer during a host scan.
+        if (! isTimerRunning())
+            startTimerHz (kFlushHz);
+    }
+
+    void TimedBundleQueue::timerCallback()
+    {
+        std::vector<Pending> batch;
+        SendFn fn;
+        {
+            std::lock_guard<std::mutex> sl (lock);
+            batch.swap (pending);
+            fn = sendFn;
+        }
+        if (batch.empty() || ! fn)
+            return;
+
+        // Samples of one Track block share a timetag: one group per block.
+        std::stable_sort (batch.begin(), batch.end(),
+                          [] (const Pending& a, const Pending& b) { return a.timeTag < b.timeTag; });
+
+        std::vector<Item> group;
+        for (size_t i = 0; i < batch.size();)
+        {
+            const auto tag = batch[i].timeTag;
+            group.clear();
+            for (; i < batch.size() && batch[i].timeTag == tag; ++i)
+                group.push_back (std::move (batch[i].item));
+            fn (tag, group);
+        }
+    }
+}
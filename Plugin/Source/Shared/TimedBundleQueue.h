@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+#include <juce_core/juce_core.h>
+#include <juce_events/juce_events.h>
+
+namespace wfs::plugin
+{
+    // Collects timetagged single-float sends from the Tracks' processBlock
+    // sampling and hands them to the transport in timetag groups, one
+    // group per flush and timetag, oldest first. Unlike RateLimiter
+    // nothing is coalesced: every sample is a point on a trajectory the
+    // app replays at its timetag.
+    class TimedBundleQueue : private juce::Timer
+    {
+    public:
+        struct Item
+        {
+            juce::String path;
+            int   channelId = 0;
+            float value = 0.0f;
+        };
+
+        using SendFn = std::function<void (uint64_t /*timeTag*/, const std::vector<Item>&)>;
+
+        TimedBundleQueue();
+        ~TimedBundleQueue() override;
+
+        void setSendFunction (SendFn fn);
+
+        void post (const juce::String& path, int channelId, float value, uint64_t timeTag);
+
+    private:
+        void timerCallback() override;
+
+        static constexpr int kFlushHz = 100;
+        static constexpr size_t kMaxPending = 8192;   // ~1 s of 64 moving tracks
+
+        struct Pending
+        {
+            uint64_t timeTag = 0;
+            Item item;
+        };
+
+        SendFn sendFn;
+        std::mutex lock;
+        std::vector<Pending> pending;
+    };
+}
@@ -119,10 +119,17 @@ namespace wfs::plugin
         if (variant.positionsWired)
             for (const auto& pos : variant.positions)
                 state.addParameterListener (pos.paramID, this);
+
+        const auto& specs = getSharedTrackParams();
+        for (size_t i = 0; i < specs.size(); ++i)
+            timedRaw[i] = state.getRawParameterValue (specs[i].paramID);
+        for (size_t i = 0; i < 3 && i < variant.positions.size(); ++i)
+            timedRaw[(size_t) kTimedPositionX + i] = state.getRawParameterValue (variant.positions[i].paramID);
     }
 
     TrackProcessor::~TrackProcessor()
     {
+        stopTimer();
         state.removeParameterListener ("inputId", this);
 
         for (const auto& spec : getSharedTrackParams())
@@ -133,8 +140,16 @@ namespace wfs::plugin
                 state.removeParameterListener (pos.paramID, this);
     }
 
-    void TrackProcessor::prepareToPlay (double, int)
+    void TrackProcessor::prepareToPlay (double sampleRate, int)
     {
+        currentSampleRate = sampleRate > 0.0 ? sampleRate : 44100.0;
+        playheadClock.reset();
+        timedLastGrid = -1;
+
+        // Started here rather than in the constructor: no timer runs while
+        // a host only scans the plugin.
+        startTimerHz (100);
+
         auto& loader = BridgeLoader::getInstance();
         if (loader.ensureLoaded() && bridgeHandle == nullptr)
         {
@@ -149,6 +164,14 @@ namespace wfs::plugin
 
     void TrackProcessor::releaseResources()
     {
+        // Hosts may call this off the message thread, where stopTimer() does
+        // not wait for a callback already running: forward and unregister
+        // under the drain lock so the FIFO keeps a single consumer.
+        stopTimer();
+
+        const juce::ScopedLock sl (timedDrainLock);
+        forwardTimedSamples();   // What the last blocks queued
+        timedPlaying.store (false);
         auto& loader = BridgeLoader::getInstance();
         if (bridgeHandle != nullptr && loader.isLoaded())
             loader.trackUnregister (bridgeHandle);
@@ -165,9 +188,152 @@ namespace wfs::plugin
             || in == juce::AudioChannelSet::stereo();
     }
 
-    void TrackProcessor::processBlock (juce::AudioBuffer<float>& /*buffer*/, juce::MidiBuffer&)
+    void TrackProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
     {
         // Audio passes through unchanged — plugin is a control surface, not a DSP.
+        sampleAutomation (buffer.getNumSamples());
+    }
+
+    void TrackProcessor::sampleAutomation (int numSamples)
+    {
+        juce::Optional<juce::AudioPlayHead::PositionInfo> position;
+        if (auto* playHead = getPlayHead())
+            position = playHead->getPosition();
+
+        const bool playing = bridgeHandle != nullptr && position.hasValue()
+                          && position->getIsPlaying() && position->getTimeInSamples().hasValue();
+        if (! playing)
+        {
+            if (timedPlaying.exchange (false))
+                playheadClock.reset();
+            return;
+        }
+
+        const auto timeInSamples = *position->getTimeInSamples();
+        const auto timeTag = playheadClock.stamp (timeInSamples, numSamples, currentSampleRate);
+
+        if (! timedPlaying.exchange (true))
+        {
+            // Playback (re)started: send the whole automated state once.
+            timedLastSent.fill (std::numeric_limits<float>::quiet_NaN());
+            timedLastGrid = -1;
+            timedLastLaw = -1;
+        }
+
+        // Automation values are per block; sample them on a fixed grid of
+        // the host timeline so the rate does not follow the buffer size.
+        const auto period = juce::jmax (1.0, currentSampleRate / kTimedSampleHz);
+        const auto grid = static_cast<int64_t> (std::floor (static_cast<double> (timeInSamples) / period));
+        if (grid == timedLastGrid)
+            return;
+        timedLastGrid = grid;
+
+        // Only the distance dial matching the law is live at the app side
+        // (2 = distanceAttenuation, 3 = distanceRatio in getSharedTrackParams);
+        // a law flip resends the newly active one.
+        const int law = getAttenuationLaw();
+        if (law != timedLastLaw)
+        {
+            timedLastSent[2] = std::numeric_limits<float>::quiet_NaN();
+            timedLastSent[3] = std::numeric_limits<float>::quiet_NaN();
+            timedLastLaw = law;
+        }
+
+        for (int i = 0; i < kTimedPositionX; ++i)
+        {
+            if ((i == 2 && law != 0) || (i == 3 && law != 1))
+                continue;
+            if (auto* raw = timedRaw[(size_t) i])
+                sampleTimedParam (i, raw->load(), timeTag);
+        }
+
+        if (variant.positionsWired && ! isAdmVariant())
+        {
+            float d[3] = { 0.0f, 0.0f, 0.0f };
+            for (int i = 0; i < 3; ++i)
+                if (auto* raw = timedRaw[(size_t) (kTimedPositionX + i)])
+                    d[i] = raw->load();
+            float xyz[3] = { 0.0f, 0.0f, 0.0f };
+            displayToCartesian (d[0], d[1], d[2], xyz[0], xyz[1], xyz[2]);
+            for (int i = 0; i < 3; ++i)
+                sampleTimedParam (kTimedPositionX + i, xyz[i], timeTag);
+        }
+    }
+
+    bool TrackProcessor::sampleTimedParam (int index, float value, uint64_t timeTag)
+    {
+        auto& last = timedLastSent[(size_t) index];
+
+        // The app just wrote this parameter (inbound callback): take its
+        // value as sent rather than echoing it back.
+        if (timedAdopt[(size_t) index].load() > 0)
+        {
+            timedAdopt[(size_t) index].fetch_sub (1);
+            last = value;
+            return false;
+        }
+
+        if (! std::isnan (last) && std::abs (value - last) < kInboundApplyEpsilon)
+            return false;
+
+        if (! timedFifo.push ({ index, value, timeTag }))
+            return false;   // Retried on the next grid tick
+        last = value;
+        return true;
+    }
+
+    void TrackProcessor::timerCallback()
+    {
+        // releaseResources() is draining (or just did): nothing to do this tick
+        const juce::ScopedTryLock sl (timedDrainLock);
+        if (sl.isLocked())
+            forwardTimedSamples();
+    }
+
+    void TrackProcessor::forwardTimedSamples()
+    {
+        auto& loader = BridgeLoader::getInstance();
+        const bool canSend = bridgeHandle != nullptr && loader.isLoaded() && loader.trackSendOutbound != nullptr;
+        const int id = getInputId();
+        static const char* const axisPaths[3] = { "/wfs/input/positionX", "/wfs/input/positionY", "/wfs/input/positionZ" };
+
+        timedFifo.drain ([&] (const TimedSample& sample)
+        {
+            if (! canSend)
+                return;
+
+            const char* path = nullptr;
+            if (sample.param >= kTimedPositionX)
+            {
+                const int axis = sample.param - kTimedPositionX;
+                path = axisPaths[axis];
+                (axis == 0 ? cachedX : axis == 1 ? cachedY : cachedZ).store (sample.value);
+            }
+            else
+            {
+                path = getSharedTrackParams()[(size_t) sample.param].oscPath.toRawUTF8();
+            }
+
+            // An older bridge without the timed export still gets the value.
+            if (loader.trackSendOutboundTimed != nullptr)
+                loader.trackSendOutboundTimed (bridgeHandle, path, id,
+                                               static_cast<double> (sample.value), sample.timeTag);
+            else
+                loader.trackSendOutbound (bridgeHandle, path, id, static_cast<double> (sample.value));
+        });
+    }
+
+    bool TrackProcessor::isTimedParam (const juce::String& paramID) const
+    {
+        for (const auto& spec : getSharedTrackParams())
+            if (paramID == spec.paramID)
+                return true;
+
+        if (variant.positionsWired && ! isAdmVariant())
+            for (const auto& pos : variant.positions)
+                if (paramID == pos.paramID)
+                    return true;
+        return false;
     }
 
     juce::AudioProcessorEditor* TrackProcessor::createEditor()
@@ -283,6 +449,8 @@ namespace wfs::plugin
         // Batch the in-flight guard around the whole set so async listener
         // callbacks can't slip through in the gap between axis updates.
         isApplyingRemoteChange.store (true);
+        for (int i = 0; i < 3; ++i)
+            adoptRemoteValue (kTimedPositionX + i);
         for (int i = 0; i < 3; ++i)
         {
             auto* param = state.getParameter (variant.positions[(size_t) i].paramID);
@@ -450,6 +618,10 @@ namespace wfs::plugin
         if (bridgeHandle == nullptr)
             return;
 
+        // During playback processBlock samples these with timetags.
+        if (timedPlaying.load() && isTimedParam (paramID))
+            return;
+
         auto& loader = BridgeLoader::getInstance();
         if (! loader.isLoaded() || loader.trackSendOutbound == nullptr)
             return;
@@ -541,11 +713,13 @@ namespace wfs::plugin
             }
         };
 
-        for (const auto& spec : getSharedTrackParams())
+        const auto& specs = getSharedTrackParams();
+        for (size_t i = 0; i < specs.size(); ++i)
         {
-            if (path == spec.oscPath)
+            if (path == specs[i].oscPath)
             {
-                applyParam (spec.paramID, value);
+                self->adoptRemoteValue (static_cast<int> (i));
+                applyParam (specs[i].paramID, value);
                 return;
             }
         }
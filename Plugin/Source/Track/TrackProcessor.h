@@ -5,6 +5,7 @@
 #include "../Shared/BridgeLoader.h"
 #include "../Shared/VariantConfig.h"
 #include "../Shared/DiagnosticLog.h"
+#include "../Shared/TimedAutomation.h"
 
 namespace wfs::plugin
 {
@@ -35,7 +36,8 @@ namespace wfs::plugin
     const std::array<NonPositionParamSpec, 10>& getSharedTrackParams();
 
     class TrackProcessor  : public juce::AudioProcessor,
-                            private juce::AudioProcessorValueTreeState::Listener
+                            private juce::AudioProcessorValueTreeState::Listener,
+                            private juce::Timer
     {
     public:
         explicit TrackProcessor (VariantConfig cfg);
@@ -116,6 +118,36 @@ namespace wfs::plugin
         static void inboundCallback (void* user, const char* oscPath, int channelId, double value);
         juce::AudioProcessorValueTreeState::ParameterLayout buildLayout() const;
 
+        // Timed automation: while the host plays, processBlock samples the
+        // shared parameters and the Cartesian position on a kTimedSampleHz
+        // grid of the host timeline and queues every change with the
+        // timetag of its block. The timer forwards the queue to Master,
+        // which sends timetagged bundles; the app replays them on its own
+        // clock. parameterChanged stays quiet for those parameters
+        // meanwhile, so each change goes out once. ADM positions keep the
+        // untimed 3f path.
+        static constexpr int kTimedSampleHz  = 50;
+        static constexpr int kTimedPositionX = 10;   // After the shared params
+        static constexpr int kNumTimedParams = 13;
+
+        void sampleAutomation (int numSamples);
+        bool sampleTimedParam (int index, float value, uint64_t timeTag);
+        void timerCallback() override;
+        void forwardTimedSamples();   // The FIFO's only consumer; caller holds timedDrainLock
+        bool isTimedParam (const juce::String& paramID) const;
+        void adoptRemoteValue (int index) noexcept { timedAdopt[(size_t) index].store (2); }
+
+        std::array<std::atomic<float>*, kNumTimedParams> timedRaw {};   // Shared params, then the 3 display axes
+        PlayheadClock playheadClock;
+        TimedSampleFifo<1024> timedFifo;
+        juce::CriticalSection timedDrainLock;                           // Timer vs releaseResources()
+        std::array<float, kNumTimedParams> timedLastSent {};            // Audio thread
+        std::array<std::atomic<int>, kNumTimedParams> timedAdopt {};    // Grid ticks to adopt an app write
+        std::atomic<bool> timedPlaying { false };
+        int64_t timedLastGrid = -1;
+        int     timedLastLaw = -1;
+        double  currentSampleRate = 44100.0;
+
         VariantConfig variant;
         juce::AudioProcessorValueTreeState state;
         WfsBridgeTrackHandle* bridgeHandle = nullptr;
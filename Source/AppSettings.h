@@ -206,6 +206,124 @@ struct AppSettings
         props.saveIfNeeded();
     }
 
+    /** Clock of the control-rate worker that recalculates the DSP matrices
+        (50, 100 or 200 Hz; other values snap to the nearest). Machine-local:
+        how much CPU the host can spare for faster position updates is a
+        property of this computer. No UI — edit WFS-DIY.settings directly;
+        read once at startup. */
+    static int getControlRateHz()
+    {
+        juce::PropertiesFile props (getOptions());
+        return props.getIntValue ("controlRateHz", 50);
+    }
+
+    static void setControlRateHz (int hz)
+    {
+        juce::PropertiesFile props (getOptions());
+        props.setValue ("controlRateHz", hz);
+        props.saveIfNeeded();
+    }
+
+    /** Extrapolate delay targets between control ticks along the engine's
+        per-pair delay rate, so a moving source's delays ramp instead of
+        stepping at the control rate. Machine-local and read once at
+        startup, like controlRateHz; off reproduces the stepped targets. */
+    static bool getDelayExtrapolation()
+    {
+        juce::PropertiesFile props (getOptions());
+        return props.getBoolValue ("delayExtrapolation", true);
+    }
+
+    static void setDelayExtrapolation (bool enabled)
+    {
+        juce::PropertiesFile props (getOptions());
+        props.setValue ("delayExtrapolation", enabled);
+        props.saveIfNeeded();
+    }
+
+    /** Offer Master plugins on this computer a shared-memory ring instead of
+        UDP for their automation (advertised in OSCQuery HOST_INFO; plugins
+        that do not find it keep sending UDP). Machine-local and read once at
+        startup; takes effect the next time the OSC Query server starts. */
+    static bool getLocalControlRing()
+    {
+        juce::PropertiesFile props (getOptions());
+        return props.getBoolValue ("localControlRing", false);
+    }
+
+    static void setLocalControlRing (bool enabled)
+    {
+        juce::PropertiesFile props (getOptions());
+        props.setValue ("localControlRing", enabled);
+        props.saveIfNeeded();
+    }
+
+    /** Playout delay (ms) for timetagged OSC bundles: the Track plugins'
+        sampled DAW automation is applied at its timetag plus this delay,
+        which absorbs network and flush jitter. -1 applies timetagged
+        messages on arrival. Machine-local and read once at startup. */
+    static int getOscTimetagPlayoutMs()
+    {
+        juce::PropertiesFile props (getOptions());
+        return props.getIntValue ("oscTimetagPlayoutMs", 30);
+    }
+
+    static void setOscTimetagPlayoutMs (int ms)
+    {
+        juce::PropertiesFile props (getOptions());
+        props.setValue ("oscTimetagPlayoutMs", ms);
+        props.saveIfNeeded();
+    }
+
+    /** Head of every Sampler cell kept in RAM, in ms; the rest is read from
+        the memory-mapped sample cache. 0 reads everything from the mapping.
+        Machine-local. */
+    static int getSamplerPinnedHeadMs()
+    {
+        juce::PropertiesFile props (getOptions());
+        return props.getIntValue ("samplerPinnedHeadMs", 100);
+    }
+
+    static void setSamplerPinnedHeadMs (int ms)
+    {
+        juce::PropertiesFile props (getOptions());
+        props.setValue ("samplerPinnedHeadMs", ms);
+        props.saveIfNeeded();
+    }
+
+    /** Sampler cells longer than this are streamed from disk by a read-ahead
+        thread instead of being read from the sample cache mapping on the
+        audio thread. 0 disables streaming. Machine-local. */
+    static double getSamplerStreamThresholdSeconds()
+    {
+        juce::PropertiesFile props (getOptions());
+        return props.getDoubleValue ("samplerStreamThresholdSeconds", 20.0);
+    }
+
+    static void setSamplerStreamThresholdSeconds (double seconds)
+    {
+        juce::PropertiesFile props (getOptions());
+        props.setValue ("samplerStreamThresholdSeconds", seconds);
+        props.saveIfNeeded();
+    }
+
+    /** Extra threads the matrix recalculation spreads its input rows over
+        (0 = the control-rate worker alone, -1 = auto from the core count).
+        Machine-local and read once at startup, like controlRateHz. The
+        matrices are identical for any value. */
+    static int getMatrixRecalcWorkers()
+    {
+        juce::PropertiesFile props (getOptions());
+        return props.getIntValue ("matrixRecalcWorkers", -1);
+    }
+
+    static void setMatrixRecalcWorkers (int numWorkers)
+    {
+        juce::PropertiesFile props (getOptions());
+        props.setValue ("matrixRecalcWorkers", numWorkers);
+        props.saveIfNeeded();
+    }
+
 private:
     static juce::PropertiesFile::Options getOptions()
     {
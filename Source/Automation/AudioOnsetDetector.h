@@ -0,0 +1,157 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+/**
+ * Audio-thread onset detector for AutomOtion audio triggers.
+ *
+ * Scans each input's block for the first sample above its trigger threshold
+ * and posts an Onset (input, absolute sample position) to a lock-free FIFO.
+ * AutomOtionProcessor drains the FIFO on its next 50 Hz tick and backdates
+ * the movement by the onset's age, so a transient between ticks is neither
+ * missed nor late by the meter ballistics.
+ *
+ * Per input, a detector fires once, then holds for holdMs and re-arms when a
+ * whole block stays below the threshold minus rearmHysteresisDb. That only
+ * keeps a sustained signal from flooding the FIFO; the musical re-arm (RMS
+ * below the reset level) is still AutomOtion's.
+ *
+ * Threads: process() on the audio thread; setTrigger()/popOnset()/
+ * getSamplePosition() on the message thread; prepare() while audio is
+ * stopped or from prepareToPlay().
+ */
+class AudioOnsetDetector
+{
+public:
+    static constexpr float holdMs = 50.0f;
+    static constexpr float rearmHysteresisDb = 6.0f;
+    static constexpr int fifoSize = 1024;
+
+    struct Onset
+    {
+        int input = 0;
+        juce::int64 samplePosition = 0;   // Absolute, on getSamplePosition()'s clock
+    };
+
+    explicit AudioOnsetDetector (int numInputs)
+        : inputs (static_cast<size_t> (numInputs)), fifo (fifoSize), onsets (static_cast<size_t> (fifoSize))
+    {
+    }
+
+    void prepare (double newSampleRate)
+    {
+        sampleRate.store (newSampleRate > 0.0 ? newSampleRate : 48000.0, std::memory_order_relaxed);
+    }
+
+    double getSampleRate() const noexcept { return sampleRate.load (std::memory_order_relaxed); }
+
+    /** Enable or disable an input's detector and set its threshold (message thread). */
+    void setTrigger (int input, bool enabled, float thresholdDb) noexcept
+    {
+        if (input < 0 || input >= static_cast<int> (inputs.size()))
+            return;
+
+        auto& in = inputs[static_cast<size_t> (input)];
+        in.thresholdGain.store (enabled ? juce::Decibels::decibelsToGain (thresholdDb, -200.0f) : 0.0f,
+                                std::memory_order_relaxed);
+    }
+
+    //==========================================================================
+    // Audio thread
+
+    /** Scan one block. Channel i of buffer is input i. */
+    void process (const juce::AudioBuffer<float>& buffer, int startSample, int numSamples) noexcept
+    {
+        const auto blockStart = samplePosition.load (std::memory_order_relaxed);
+        const int holdSamples = static_cast<int> (getSampleRate() * holdMs * 0.001);
+        const float rearmScale = juce::Decibels::decibelsToGain (-rearmHysteresisDb);
+        const int numChannels = juce::jmin (buffer.getNumChannels(), static_cast<int> (inputs.size()));
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            auto& in = inputs[static_cast<size_t> (ch)];
+            const float threshold = in.thresholdGain.load (std::memory_order_relaxed);
+            if (threshold <= 0.0f)
+            {
+                in.armed = true;
+                in.holdRemaining = 0;
+                continue;
+            }
+
+            // Vectorised block peak first: the common case is a quiet block
+            const float peak = buffer.getMagnitude (ch, startSample, numSamples);
+
+            if (! in.armed)
+            {
+                in.holdRemaining -= numSamples;
+                if (in.holdRemaining <= 0 && peak < threshold * rearmScale)
+                    in.armed = true;
+                continue;
+            }
+
+            if (peak <= threshold)
+                continue;
+
+            const float* data = buffer.getReadPointer (ch, startSample);
+            int offset = 0;
+            while (offset < numSamples && std::abs (data[offset]) <= threshold)
+                ++offset;
+
+            post ({ ch, blockStart + offset });
+            in.armed = false;
+            in.holdRemaining = holdSamples - (numSamples - offset);
+        }
+
+        samplePosition.store (blockStart + numSamples, std::memory_order_release);
+    }
+
+    //==========================================================================
+    // Message thread
+
+    /** Samples processed so far; the clock Onset::samplePosition is on. */
+    juce::int64 getSamplePosition() const noexcept
+    {
+        return samplePosition.load (std::memory_order_acquire);
+    }
+
+    bool popOnset (Onset& onset) noexcept
+    {
+        const auto scope = fifo.read (1);
+        if (scope.blockSize1 < 1)
+            return false;
+        onset = onsets[static_cast<size_t> (scope.startIndex1)];
+        return true;
+    }
+
+private:
+    struct InputState
+    {
+        std::atomic<float> thresholdGain { 0.0f };   // 0 = disabled
+
+        // Audio thread only
+        bool armed = true;
+        int holdRemaining = 0;
+    };
+
+    void post (const Onset& onset) noexcept
+    {
+        // With the hold, 64 inputs post well under fifoSize per tick; a full
+        // FIFO means nothing is draining it, so the onset is stale anyway
+        const auto scope = fifo.write (1);
+        if (scope.blockSize1 < 1)
+            return;
+        onsets[static_cast<size_t> (scope.startIndex1)] = onset;
+    }
+
+    std::vector<InputState> inputs;
+    juce::AbstractFifo fifo;
+    std::vector<Onset> onsets;
+    std::atomic<juce::int64> samplePosition { 0 };
+    std::atomic<double> sampleRate { 48000.0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AudioOnsetDetector)
+};
@@ -7,6 +7,7 @@
 #include "../Parameters/ParameterDirtyTracker.h"
 #include "../Helpers/CoordinateConverter.h"
 #include "../Network/OSCProtocolTypes.h"
+#include "AudioOnsetDetector.h"
 
 /**
  * AutomOtion Processor for WFS Input Position Animation
@@ -22,6 +23,8 @@
  * - Stay at destination or return to origin
  * - Global stop/pause controls
  * - Only active when tracking is disabled for the input
+ * - Audio trigger from an onset detector run in the audio callback; the
+ *   movement is backdated to the onset's sample position
  */
 class AutomOtionProcessor
 {
@@ -91,6 +94,7 @@ public:
         float currentRmsDb = -200.0f;        // Latest RMS level from audio
         bool triggerArmed = true;            // Ready to trigger on audio peak
         bool waitingForRearm = false;        // Movement complete, waiting for RMS to drop
+        float pendingOnsetAge = -1.0f;       // Seconds since the oldest onset this tick (-1 = none)
 
         // Coordinate mode for this movement (captured at start)
         int coordinateMode = 0;  // 0=Cartesian, 1=Cylindrical, 2=Spherical
@@ -112,7 +116,7 @@ public:
     // Construction
     //==========================================================================
     explicit AutomOtionProcessor (WFSValueTreeState& state, int numInputs = 64)
-        : valueTreeState (state), numInputChannels (numInputs)
+        : valueTreeState (state), numInputChannels (numInputs), onsetDetector (numInputs)
     {
         states.resize (static_cast<size_t> (numInputs));
     }
@@ -125,6 +129,8 @@ public:
     //==========================================================================
     void process (float deltaTimeSeconds)
     {
+        collectOnsets();
+
         for (int i = 0; i < numInputChannels; ++i)
         {
             processInput (i, deltaTimeSeconds);
@@ -593,7 +599,11 @@ public:
     // Audio Level Input (for audio triggering)
     //==========================================================================
 
-    /** Set current audio levels for an input (called from timer thread at 50Hz) */
+    /** Onset detector fed from the audio callback (see AudioOnsetDetector) */
+    AudioOnsetDetector& getOnsetDetector() noexcept { return onsetDetector; }
+
+    /** Set current audio levels for an input (called from timer thread at 50Hz).
+        The levels drive the rearm and the UI; triggering uses the onset detector. */
     void setInputLevels (int inputIndex, float shortPeakDb, float rmsDb)
     {
         if (inputIndex < 0 || inputIndex >= numInputChannels)
@@ -715,6 +725,32 @@ public:
     }
 
 private:
+    /** Longest backdate applied to an audio-triggered start (a stalled tick
+        shouldn't make a movement jump) */
+    static constexpr float maxOnsetBackdateSeconds = 0.1f;
+
+    //==========================================================================
+    // Audio Trigger Onsets
+    //==========================================================================
+
+    /** Drain the detector's onsets into each input's pendingOnsetAge */
+    void collectOnsets()
+    {
+        const auto now = onsetDetector.getSamplePosition();
+        const auto sampleRate = onsetDetector.getSampleRate();
+
+        AudioOnsetDetector::Onset onset;
+        while (onsetDetector.popOnset (onset))
+        {
+            if (onset.input < 0 || onset.input >= numInputChannels)
+                continue;
+
+            auto& state = states[static_cast<size_t> (onset.input)];
+            const auto age = static_cast<float> (static_cast<double> (now - onset.samplePosition) / sampleRate);
+            state.pendingOnsetAge = juce::jmax (state.pendingOnsetAge, age);   // Oldest wins
+        }
+    }
+
     //==========================================================================
     // Per-Input Processing
     //==========================================================================
@@ -732,6 +768,7 @@ private:
         {
             float triggerThresholdDb = static_cast<float> (otomoSection.getProperty (WFSParameterIDs::inputOtomoThreshold, -20.0f));
             float resetThresholdDb = static_cast<float> (otomoSection.getProperty (WFSParameterIDs::inputOtomoReset, -60.0f));
+            onsetDetector.setTrigger (inputIndex, true, triggerThresholdDb);
 
             // Check rearm condition: RMS dropped below reset threshold
             if (state.waitingForRearm)
@@ -743,13 +780,20 @@ private:
                 }
             }
 
-            // Check trigger condition: armed + short peak above threshold
-            if (state.triggerArmed && state.currentShortPeakDb > triggerThresholdDb)
+            // Check trigger condition: armed + an onset above threshold since last tick
+            if (state.triggerArmed && state.pendingOnsetAge >= 0.0f)
             {
                 // Trigger the motion! (suppress blocked feedback — a no-op trigger is
                 // expected when the source already sits on the destination)
                 const bool started = startMotion (inputIndex, -1, /*suppressBlockedFeedback*/ true);
-                if (! started)
+                if (started)
+                {
+                    // Backdate to the onset: the update below adds this tick's
+                    // deltaTime, so the move ends up pendingOnsetAge along
+                    state.elapsedTime = juce::jmax (0.0f, juce::jmin (state.pendingOnsetAge, maxOnsetBackdateSeconds)
+                                                          - deltaTime);
+                }
+                else
                 {
                     // No-op trigger (e.g. Absolute + Stay input already at its
                     // destination). Consume it and rearm once the level drops again,
@@ -761,6 +805,13 @@ private:
                 // On a successful start, startMotion already cleared both flags.
             }
         }
+        else
+        {
+            onsetDetector.setTrigger (inputIndex, false, 0.0f);
+        }
+
+        // Onsets only count on the tick they arrive (none while moving or disarmed)
+        state.pendingOnsetAge = -1.0f;
 
         // Process return fade sequence (fade out → snap → fade in)
         if (state.state == State::Returning && state.returnPhase != AutomOtionState::ReturnPhase::None)
@@ -1039,5 +1090,6 @@ private:
     WFSValueTreeState& valueTreeState;
     int numInputChannels;
     std::vector<AutomOtionState> states;
+    AudioOnsetDetector onsetDetector;
     ParameterDirtyTracker* dirtyTracker = nullptr;
 };
@@ -0,0 +1,355 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "../../spatcore/dsp/WFSHighShelfFilter.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/**
+ * BinauralLegacyRenderer
+ *
+ * The legacy (renderMode 0) virtual-speaker-pair kernel of BinauralProcessor:
+ * per input and ear, a fractional delay tap, an HF shelf and a level ramp,
+ * summed into the left/right outputs.
+ *
+ * Layout:
+ * - One delay line per input in a single contiguous arena. Both ears used to
+ *   write the same samples into two separate lines; they now read two taps
+ *   off one line, which halves the delay memory the worker walks.
+ * - Each ear is rendered in three passes over the block: tap positions and
+ *   interpolation, the shelf recurrence, then the level ramp and sum. The
+ *   first and last passes are independent per sample and run as plain loops
+ *   over contiguous scratch that the compiler vectorises; only the shelf
+ *   recurrence stays serial.
+ *
+ * Output is bit-identical to the original per-sample loop
+ * (renderInputReference, which is also the fallback whenever a tap could
+ * reach samples the block itself writes: delays under one sample or within
+ * one block of the line length). Inputs are summed in index order, so the
+ * float summation order is unchanged.
+ *
+ * One documented tolerance: an input that has been digitally silent for two
+ * delay-line lengths (2 s) is skipped until it carries signal again, and its
+ * shelves are reset. The skipped contribution is the shelves' decay tail
+ * after at least one second of zero input, far below -300 dBFS.
+ *
+ * Worker thread only; prepare()/release() while the worker is stopped.
+ */
+class BinauralLegacyRenderer
+{
+public:
+    struct EarParams
+    {
+        float delayMs = 0.0f;
+        float level = 0.0f;           // linear 0-1
+        float hfAttenuationDb = 0.0f;
+    };
+
+    void prepare (double newSampleRate, int maxBlockSize, int numInputs)
+    {
+        sampleRate = newSampleRate;
+
+        // Maximum delay = 1 second
+        delayLineLength = (int) (sampleRate * 1.0);
+
+        const auto n = (size_t) juce::jmax (0, numInputs);
+        delayArena.assign (n * (size_t) delayLineLength, 0.0f);
+        writePositions.assign (n, 0);
+        silentSamples.assign (n, 0);
+
+        WFSHighShelfFilter filter;
+        filter.prepare (sampleRate);
+        hfFiltersL.assign (n, filter);
+        hfFiltersR.assign (n, filter);
+
+        // Smoothed parameter state (snap on first block)
+        prevParamsL.assign (n, SmoothedParams());
+        prevParamsR.assign (n, SmoothedParams());
+
+        tapScratch.assign ((size_t) juce::jmax (1, maxBlockSize), 0.0f);
+    }
+
+    void release()
+    {
+        delayArena.clear();
+        delayArena.shrink_to_fit();
+        hfFiltersL.clear();
+        hfFiltersR.clear();
+    }
+
+    void reset()
+    {
+        std::fill (delayArena.begin(), delayArena.end(), 0.0f);
+        std::fill (writePositions.begin(), writePositions.end(), 0);
+        std::fill (silentSamples.begin(), silentSamples.end(), 0);
+        for (auto& filter : hfFiltersL)
+            filter.reset();
+        for (auto& filter : hfFiltersR)
+            filter.reset();
+        for (auto& p : prevParamsL)
+            p.initialized = false;
+        for (auto& p : prevParamsR)
+            p.initialized = false;
+    }
+
+    /** Forces the per-sample reference loop for every input (offline-render
+        binaural-legacy-scalar path); the app never sets it. */
+    void setUseReferenceKernel (bool shouldUse) noexcept { useReferenceKernel = shouldUse; }
+
+    /**
+     * Render one input into both ears and sum into outL/outR.
+     * Uses fractional delay with linear interpolation and per-sample
+     * parameter interpolation to avoid graininess on fast position changes.
+     */
+    void processInput (int inputIdx,
+                       const float* inputData,
+                       int numSamples,
+                       const EarParams& left,
+                       const EarParams& right,
+                       float* outL,
+                       float* outR)
+    {
+        if (numSamples <= 0 || numSamples > (int) tapScratch.size())
+            return;
+
+        const auto idx = (size_t) inputIdx;
+        const Ramp rampL = advanceParams (prevParamsL[idx], left);
+        const Ramp rampR = advanceParams (prevParamsR[idx], right);
+
+        // Set HF filter gain (filter state provides inherent smoothing)
+        hfFiltersL[idx].setGainDb (left.hfAttenuationDb);
+        hfFiltersR[idx].setGainDb (right.hfAttenuationDb);
+
+        int& writePos = writePositions[idx];
+        float* line = delayArena.data() + idx * (size_t) delayLineLength;
+
+        if (! useReferenceKernel && skipSilentInput (idx, inputData, numSamples))
+        {
+            writePos = (writePos + numSamples) % delayLineLength;
+            return;
+        }
+
+        if (useReferenceKernel || ! canRenderBlockwise (rampL, numSamples)
+                               || ! canRenderBlockwise (rampR, numSamples))
+        {
+            renderInputReference (line, writePos, inputData, numSamples, rampL, rampR,
+                                  hfFiltersL[idx], hfFiltersR[idx], outL, outR);
+            return;
+        }
+
+        // Write the whole block first: the delay bounds checked above keep
+        // every tap on samples written before its own.
+        const int firstPart = juce::jmin (numSamples, delayLineLength - writePos);
+        std::copy (inputData, inputData + firstPart, line + writePos);
+        std::copy (inputData + firstPart, inputData + numSamples, line);
+
+        renderEar (line, writePos, numSamples, rampL, hfFiltersL[idx], outL);
+        renderEar (line, writePos, numSamples, rampR, hfFiltersR[idx], outR);
+
+        writePos = (writePos + numSamples) % delayLineLength;
+    }
+
+private:
+    // Per-input smoothed parameter state for interpolation between blocks
+    struct SmoothedParams
+    {
+        float delayMs = 0.0f;
+        float level = 0.0f;
+        float hfDb = 0.0f;
+        bool initialized = false;
+    };
+
+    // Per-sample interpolation endpoints for one ear and block
+    struct Ramp
+    {
+        float startDelayMs, endDelayMs;
+        float startLevel, endLevel;
+    };
+
+    static Ramp advanceParams (SmoothedParams& prevParams, const EarParams& params)
+    {
+        // First block after init: snap to current values (no interpolation from zero)
+        if (! prevParams.initialized)
+        {
+            prevParams.delayMs = params.delayMs;
+            prevParams.level = params.level;
+            prevParams.hfDb = params.hfAttenuationDb;
+            prevParams.initialized = true;
+        }
+
+        const Ramp ramp { prevParams.delayMs, params.delayMs, prevParams.level, params.level };
+
+        // Update prev for next block
+        prevParams.delayMs = params.delayMs;
+        prevParams.level = params.level;
+        prevParams.hfDb = params.hfAttenuationDb;
+        return ramp;
+    }
+
+    float clampedDelaySamples (float delayMs) const noexcept
+    {
+        float delaySamples = delayMs * (float) (sampleRate / 1000.0);
+        if (delaySamples < 0.0f) delaySamples = 0.0f;
+        if (delaySamples > (float) (delayLineLength - 2)) delaySamples = (float) (delayLineLength - 2);
+        return delaySamples;
+    }
+
+    /** True when no tap in the block can land on a sample this block writes
+        after the tap's own sample: at least one sample of delay (the upper
+        interpolation point is then already written) and at most the line
+        length minus the block (the lower one is not yet overwritten). The
+        delay ramp is monotonic, so its endpoints bound it. */
+    bool canRenderBlockwise (const Ramp& ramp, int numSamples) const noexcept
+    {
+        const float a = clampedDelaySamples (ramp.startDelayMs);
+        const float b = clampedDelaySamples (ramp.endDelayMs);
+        return juce::jmin (a, b) >= 1.0f
+            && juce::jmax (a, b) <= (float) (delayLineLength - numSamples - 1);
+    }
+
+    /** Counts consecutive silent samples; true while the input may be
+        skipped (see the class comment for the tolerance). */
+    bool skipSilentInput (size_t idx, const float* inputData, int numSamples)
+    {
+        bool silent = true;
+        for (int i = 0; i < numSamples && silent; ++i)
+            silent = inputData[i] == 0.0f;
+
+        auto& run = silentSamples[idx];
+        if (! silent)
+        {
+            run = 0;
+            return false;
+        }
+
+        const int threshold = 2 * delayLineLength;
+        if (run >= threshold)
+            return true;
+
+        run = juce::jmin (threshold, run + numSamples);
+        if (run < threshold)
+            return false;
+
+        // Entering the skip: the line holds only zeros and the shelves have
+        // been fed zeros for at least one second.
+        hfFiltersL[idx].reset();
+        hfFiltersR[idx].reset();
+        return true;
+    }
+
+    void renderEar (const float* line, int writeStart, int numSamples, const Ramp& ramp,
+                    WFSHighShelfFilter& hfFilter, float* output)
+    {
+        float* tap = tapScratch.data();
+        const float invNumSamples = 1.0f / (float) numSamples;
+        const float msToSamples = (float) (sampleRate / 1000.0);
+        const float maxDelay = (float) (delayLineLength - 2);
+
+        // Pass 1: interpolated delay taps (same arithmetic as the reference)
+        for (int i = 0; i < numSamples; ++i)
+        {
+            int writePos = writeStart + i;
+            if (writePos >= delayLineLength) writePos -= delayLineLength;
+
+            const float t = (float) i * invNumSamples;
+            const float currentDelayMs = ramp.startDelayMs + (ramp.endDelayMs - ramp.startDelayMs) * t;
+
+            float delaySamples = currentDelayMs * msToSamples;
+            if (delaySamples < 0.0f) delaySamples = 0.0f;
+            if (delaySamples > maxDelay) delaySamples = maxDelay;
+
+            float exactReadPos = (float) writePos - delaySamples;
+            if (exactReadPos < 0.0f)
+                exactReadPos += (float) delayLineLength;
+
+            int readPos1 = (int) exactReadPos;
+            if (readPos1 >= delayLineLength) readPos1 -= delayLineLength;
+            int readPos2 = readPos1 + 1;
+            if (readPos2 >= delayLineLength) readPos2 -= delayLineLength;
+            const float fraction = exactReadPos - std::floor (exactReadPos);
+
+            tap[i] = line[readPos1] + fraction * (line[readPos2] - line[readPos1]);
+        }
+
+        // Pass 2: HF shelf (serial recurrence)
+        for (int i = 0; i < numSamples; ++i)
+            tap[i] = hfFilter.processSample (tap[i]);
+
+        // Pass 3: interpolated level, summed into the output
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float t = (float) i * invNumSamples;
+            const float currentLevel = ramp.startLevel + (ramp.endLevel - ramp.startLevel) * t;
+            output[i] += tap[i] * currentLevel;
+        }
+    }
+
+    /** The original per-sample loop, both ears in one pass over the shared
+        line (each ear read its own identical copy of it before). */
+    void renderInputReference (float* line, int& writePos, const float* inputData, int numSamples,
+                               const Ramp& rampL, const Ramp& rampR,
+                               WFSHighShelfFilter& hfFilterL, WFSHighShelfFilter& hfFilterR,
+                               float* outL, float* outR) const
+    {
+        const float invNumSamples = 1.0f / (float) numSamples;
+        const float msToSamples = (float) (sampleRate / 1000.0);
+        const float maxDelay = (float) (delayLineLength - 2);
+
+        auto tapAt = [&] (const Ramp& ramp, float t)
+        {
+            // Interpolate delay across the block
+            const float currentDelayMs = ramp.startDelayMs + (ramp.endDelayMs - ramp.startDelayMs) * t;
+
+            // Fractional delay in samples
+            float delaySamples = currentDelayMs * msToSamples;
+            if (delaySamples < 0.0f) delaySamples = 0.0f;
+            if (delaySamples > maxDelay) delaySamples = maxDelay;
+
+            // Fractional read position with linear interpolation
+            float exactReadPos = (float) writePos - delaySamples;
+            if (exactReadPos < 0.0f)
+                exactReadPos += (float) delayLineLength;
+
+            int readPos1 = (int) exactReadPos;
+            if (readPos1 >= delayLineLength) readPos1 -= delayLineLength;
+            const int readPos2 = (readPos1 + 1) % delayLineLength;
+            const float fraction = exactReadPos - std::floor (exactReadPos);
+
+            return line[readPos1] + fraction * (line[readPos2] - line[readPos1]);
+        };
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            // Write input to delay line
+            line[writePos] = inputData[i];
+
+            const float t = (float) i * invNumSamples;
+            const float levelL = rampL.startLevel + (rampL.endLevel - rampL.startLevel) * t;
+            const float levelR = rampR.startLevel + (rampR.endLevel - rampR.startLevel) * t;
+
+            // Apply HF filter, then interpolated level, and sum to output
+            outL[i] += hfFilterL.processSample (tapAt (rampL, t)) * levelL;
+            outR[i] += hfFilterR.processSample (tapAt (rampR, t)) * levelR;
+
+            // Advance write position
+            writePos = (writePos + 1) % delayLineLength;
+        }
+    }
+
+    double sampleRate = 48000.0;
+    int delayLineLength = 0;
+    bool useReferenceKernel = false;
+
+    std::vector<float> delayArena;       // [input][delayLineLength]
+    std::vector<int> writePositions;
+    std::vector<int> silentSamples;      // Consecutive zero input samples, capped
+
+    std::vector<WFSHighShelfFilter> hfFiltersL;
+    std::vector<WFSHighShelfFilter> hfFiltersR;
+
+    std::vector<SmoothedParams> prevParamsL;
+    std::vector<SmoothedParams> prevParamsR;
+
+    std::vector<float> tapScratch;
+};
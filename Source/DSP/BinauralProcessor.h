@@ -2,8 +2,8 @@
 
 #include <JuceHeader.h>
 #include "BinauralCalculationEngine.h"
+#include "BinauralLegacyRenderer.h"
 #include "../../spatcore/rt/SharedInputRingBuffer.h"
-#include "../../spatcore/dsp/WFSHighShelfFilter.h"
 #include "../../spatcore/rt/LockFreeRingBuffer.h"
 #include "../../spatcore/rt/AudioWorkgroupCoordinator.h"
 #include "../../spatcore/binaural/BinauralEngine.h"
@@ -22,8 +22,8 @@
  * - When no inputs are soloed: ALL inputs are processed
  * - When any input is soloed: only soloed inputs are processed
  *
- * For each processed input:
- * - Applies per-input delay using circular buffer (separate L/R)
+ * For each processed input (legacy mode, see BinauralLegacyRenderer):
+ * - Applies per-ear delay taps off one circular buffer per input
  * - Applies HF shelf filter for air absorption (separate L/R)
  * - Applies level attenuation
  * - Sums to left/right outputs
@@ -61,41 +61,12 @@ public:
         numInputChannels = numInputs;
         currentBlockSize = maxBlockSize;
 
-        // Maximum delay = 1 second
-        delayBufferLength = (int) (sampleRate * 1.0);
-
-        // Create per-input delay buffers for left and right
-        delayBuffersL.clear();
-        delayBuffersR.clear();
-        writePositionsL.clear();
-        writePositionsR.clear();
-        hfFiltersL.clear();
-        hfFiltersR.clear();
-        prevParamsL.clear();
-        prevParamsR.clear();
-        inputBuffers.clear();
+        // Delay lines, HF filters and smoothed parameters of the legacy path
+        legacyRenderer.prepare (sampleRate, maxBlockSize, numInputs);
 
+        inputBuffers.clear();
         for (int i = 0; i < numInputs; ++i)
         {
-            // Delay buffers
-            delayBuffersL.push_back (juce::AudioBuffer<float> (1, delayBufferLength));
-            delayBuffersL.back().clear();
-            delayBuffersR.push_back (juce::AudioBuffer<float> (1, delayBufferLength));
-            delayBuffersR.back().clear();
-            writePositionsL.push_back (0);
-            writePositionsR.push_back (0);
-
-            // HF filters
-            WFSHighShelfFilter filterL, filterR;
-            filterL.prepare (sampleRate);
-            filterR.prepare (sampleRate);
-            hfFiltersL.push_back (filterL);
-            hfFiltersR.push_back (filterR);
-
-            // Smoothed parameter state (snap on first block)
-            prevParamsL.push_back (SmoothedParams());
-            prevParamsR.push_back (SmoothedParams());
-
             // Input ring buffers (4x block size for safety margin)
             inputBuffers.push_back (std::make_unique<LockFreeRingBuffer>());
             inputBuffers.back()->setSize (maxBlockSize * 4);
@@ -133,10 +104,7 @@ public:
     {
         prepared.store (false, std::memory_order_release);
         stopThread (1000);
-        delayBuffersL.clear();
-        delayBuffersR.clear();
-        hfFiltersL.clear();
-        hfFiltersR.clear();
+        legacyRenderer.release();
         inputBuffers.clear();
         outputBufferL.reset();
         outputBufferR.reset();
@@ -263,22 +231,7 @@ public:
      */
     void reset()
     {
-        for (auto& buf : delayBuffersL)
-            buf.clear();
-        for (auto& buf : delayBuffersR)
-            buf.clear();
-        for (auto& pos : writePositionsL)
-            pos = 0;
-        for (auto& pos : writePositionsR)
-            pos = 0;
-        for (auto& filter : hfFiltersL)
-            filter.reset();
-        for (auto& filter : hfFiltersR)
-            filter.reset();
-        for (auto& p : prevParamsL)
-            p.initialized = false;
-        for (auto& p : prevParamsR)
-            p.initialized = false;
+        legacyRenderer.reset();
         for (auto& buf : inputBuffers)
             buf->reset();
         if (outputBufferL) outputBufferL->reset();
@@ -302,15 +255,6 @@ public:
     }
 
 private:
-    // Per-input smoothed parameter state for interpolation between blocks
-    struct SmoothedParams
-    {
-        float delayMs = 0.0f;
-        float level = 0.0f;
-        float hfDb = 0.0f;
-        bool initialized = false;
-    };
-
     /**
      * Worker thread main loop.
      */
@@ -424,8 +368,9 @@ private:
         // Never read the ValueTree from here (RT-safety: no locks on the tree, no allocation).
         const auto rt = binauralCalc.getRtParams();
 
-        // HRTF render modes take their own path; the legacy ORTF code below
-        // stays byte-for-byte so mode 0 nulls against pre-HRTF builds.
+        // HRTF render modes take their own path; the legacy ORTF path below
+        // (BinauralLegacyRenderer) stays bit-identical so mode 0 nulls
+        // against pre-HRTF builds.
         // (The legacy path never consumes the reverb taps; the HRTF path
         // resyncs their cursors when it takes over.)
         if (rt.renderMode != 0)
@@ -469,27 +414,15 @@ private:
                 continue;
 
             // Get binaural parameters for this input (tree-free, snapshot-driven)
-            auto binauralPair = binauralCalc.calculate (inputIdx, rt);
-
-            const float* inputData = inputBlock.getReadPointer (0);
-
-            // Process left channel
-            processInputToChannel (inputIdx, inputData, samplesRead,
-                                   binauralPair.left,
-                                   delayBuffersL[inputIdx],
-                                   writePositionsL[inputIdx],
-                                   hfFiltersL[inputIdx],
-                                   outL,
-                                   prevParamsL[inputIdx]);
-
-            // Process right channel
-            processInputToChannel (inputIdx, inputData, samplesRead,
-                                   binauralPair.right,
-                                   delayBuffersR[inputIdx],
-                                   writePositionsR[inputIdx],
-                                   hfFiltersR[inputIdx],
-                                   outR,
-                                   prevParamsR[inputIdx]);
+            const auto binauralPair = binauralCalc.calculate (inputIdx, rt);
+            const auto toEar = [] (const BinauralCalculationEngine::BinauralOutput& o)
+            {
+                return BinauralLegacyRenderer::EarParams { o.delayMs, o.level, o.hfAttenuationDb };
+            };
+
+            legacyRenderer.processInput (inputIdx, inputBlock.getReadPointer (0), samplesRead,
+                                         toEar (binauralPair.left), toEar (binauralPair.right),
+                                         outL, outR);
         }
 
         // Write to output ring buffers
@@ -654,90 +587,6 @@ private:
         outputBufferR->write (outR, numSamples);
     }
 
-    /**
-     * Process one input to one output channel (left or right).
-     * Uses fractional delay with linear interpolation and per-sample
-     * parameter interpolation to avoid graininess on fast position changes.
-     */
-    void processInputToChannel (int inputIdx,
-                                const float* inputData,
-                                int numSamples,
-                                const BinauralCalculationEngine::BinauralOutput& params,
-                                juce::AudioBuffer<float>& delayBuffer,
-                                int& writePos,
-                                WFSHighShelfFilter& hfFilter,
-                                float* output,
-                                SmoothedParams& prevParams)
-    {
-        juce::ignoreUnused (inputIdx);
-        float* delayData = delayBuffer.getWritePointer (0);
-
-        // First block after init: snap to current values (no interpolation from zero)
-        if (!prevParams.initialized)
-        {
-            prevParams.delayMs = params.delayMs;
-            prevParams.level = params.level;
-            prevParams.hfDb = params.hfAttenuationDb;
-            prevParams.initialized = true;
-        }
-
-        // Per-sample interpolation endpoints
-        float startDelayMs = prevParams.delayMs;
-        float startLevel = prevParams.level;
-        float endDelayMs = params.delayMs;
-        float endLevel = params.level;
-        float invNumSamples = 1.0f / (float) numSamples;
-
-        // Update prev for next block
-        prevParams.delayMs = params.delayMs;
-        prevParams.level = params.level;
-        prevParams.hfDb = params.hfAttenuationDb;
-
-        // Set HF filter gain (filter state provides inherent smoothing)
-        hfFilter.setGainDb (params.hfAttenuationDb);
-
-        float msToSamples = (float) (sampleRate / 1000.0);
-        float maxDelay = (float) (delayBufferLength - 2);
-
-        // Process each sample with interpolated parameters
-        for (int i = 0; i < numSamples; ++i)
-        {
-            // Write input to delay buffer
-            delayData[writePos] = inputData[i];
-
-            // Interpolate delay and level across the block
-            float t = (float) i * invNumSamples;
-            float currentDelayMs = startDelayMs + (endDelayMs - startDelayMs) * t;
-            float currentLevel = startLevel + (endLevel - startLevel) * t;
-
-            // Fractional delay in samples
-            float delaySamples = currentDelayMs * msToSamples;
-            if (delaySamples < 0.0f) delaySamples = 0.0f;
-            if (delaySamples > maxDelay) delaySamples = maxDelay;
-
-            // Fractional read position with linear interpolation
-            float exactReadPos = (float) writePos - delaySamples;
-            if (exactReadPos < 0.0f)
-                exactReadPos += (float) delayBufferLength;
-
-            int readPos1 = (int) exactReadPos;
-            if (readPos1 >= delayBufferLength) readPos1 -= delayBufferLength;
-            int readPos2 = (readPos1 + 1) % delayBufferLength;
-            float fraction = exactReadPos - std::floor (exactReadPos);
-
-            float delayedSample = delayData[readPos1] + fraction * (delayData[readPos2] - delayData[readPos1]);
-
-            // Apply HF filter
-            float filteredSample = hfFilter.processSample (delayedSample);
-
-            // Apply interpolated level and sum to output
-            output[i] += filteredSample * currentLevel;
-
-            // Advance write position
-            writePos = (writePos + 1) % delayBufferLength;
-        }
-    }
-
     BinauralCalculationEngine& binauralCalc;
 
     // Deliberately non-atomic: written only in prepareToPlay(), which asserts the
@@ -745,7 +594,6 @@ private:
     double sampleRate = 48000.0;
     int numInputChannels = 0;
     int currentBlockSize = 512;
-    int delayBufferLength = 0;
 
     std::atomic<bool> processingEnabled {false};
     std::atomic<bool> prepared {false};   // set by prepareToPlay, cleared by releaseResources
@@ -772,18 +620,9 @@ private:
     std::unique_ptr<LockFreeRingBuffer> outputBufferL;
     std::unique_ptr<LockFreeRingBuffer> outputBufferR;
 
-    // Per-input delay buffers (separate for left and right)
-    std::vector<juce::AudioBuffer<float>> delayBuffersL;
-    std::vector<juce::AudioBuffer<float>> delayBuffersR;
-    std::vector<int> writePositionsL;
-    std::vector<int> writePositionsR;
-
-    // Per-input HF shelf filters
-    std::vector<WFSHighShelfFilter> hfFiltersL;
-    std::vector<WFSHighShelfFilter> hfFiltersR;
-
-    std::vector<SmoothedParams> prevParamsL;
-    std::vector<SmoothedParams> prevParamsR;
+    // Legacy virtual-speaker path (renderMode 0): delay arena, HF shelves
+    // and smoothed per-ear parameters
+    BinauralLegacyRenderer legacyRenderer;
 
     // Working buffers
     juce::AudioBuffer<float> inputBlock;
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/**
+ * ControlRateParallelFor
+ *
+ * Fork-join pool for the control-rate matrix recalculation: the control-rate
+ * sibling of spatcore's AudioParallelFor. Same shape (persistent workers, the
+ * calling thread participates, indices handed out with an atomic fetch_add so
+ * fast threads steal the remaining work, fully serial with 0 workers), but the
+ * workers are ordinary high-priority juce::Threads rather than time-constraint
+ * audio threads: they run once per control tick next to the audio callback,
+ * not inside its deadline.
+ *
+ * run() executes body (index, slot) exactly once for every index in
+ * [0, count). slot identifies the thread (0 = caller, 1..numWorkers = pool
+ * threads) so callers can keep per-slot scratch. For results that do not
+ * depend on the worker count, body must write only state owned by its index.
+ *
+ * prepare() and run() are called from one thread at a time (the engine holds
+ * its recalcLock around both).
+ */
+class ControlRateParallelFor
+{
+public:
+    using Body = std::function<void (int index, int slot)>;
+
+    ControlRateParallelFor() = default;
+
+    ~ControlRateParallelFor()
+    {
+        prepare (0);
+    }
+
+    /** Start (or stop) pool threads. 0 runs everything on the caller. */
+    void prepare (int numWorkers)
+    {
+        numWorkers = juce::jmax (0, numWorkers);
+        if (numWorkers == static_cast<int> (workers.size()))
+            return;
+
+        for (auto& w : workers)
+            w->signalThreadShouldExit();
+        for (auto& w : workers)
+            w->go.signal();
+        for (auto& w : workers)
+            w->stopThread (1000);
+        workers.clear();
+
+        for (int i = 0; i < numWorkers; ++i)
+        {
+            workers.push_back (std::make_unique<Worker> (*this, i + 1));
+            workers.back()->startThread (juce::Thread::Priority::high);
+        }
+    }
+
+    int getNumWorkers() const { return static_cast<int> (workers.size()); }
+
+    /** Caller plus pool threads: the number of distinct slot values. */
+    int getNumSlots() const { return 1 + getNumWorkers(); }
+
+    void run (int count, const Body& body)
+    {
+        if (count <= 0)
+            return;
+
+        // Waking the pool costs more than one index of work
+        if (workers.empty() || count == 1)
+        {
+            for (int i = 0; i < count; ++i)
+                body (i, 0);
+            return;
+        }
+
+        taskBody = &body;
+        taskCount = count;
+        nextIndex.store (0);
+        activeWorkers.store (static_cast<int> (workers.size()));
+
+        for (auto& w : workers)
+            w->go.signal();
+
+        drain (0);
+        done.wait (-1);
+
+        taskBody = nullptr;
+    }
+
+private:
+    class Worker : public juce::Thread
+    {
+    public:
+        Worker (ControlRateParallelFor& o, int s)
+            : juce::Thread ("WFS Matrix Worker " + juce::String (s)), owner (o), slot (s) {}
+
+        void run() override
+        {
+            for (;;)
+            {
+                go.wait (-1);
+                if (threadShouldExit())
+                    break;
+
+                owner.drain (slot);
+
+                if (owner.activeWorkers.fetch_sub (1) == 1)
+                    owner.done.signal();
+            }
+        }
+
+        juce::WaitableEvent go;
+
+    private:
+        ControlRateParallelFor& owner;
+        const int slot;
+    };
+
+    void drain (int slot)
+    {
+        for (int i = nextIndex.fetch_add (1); i < taskCount; i = nextIndex.fetch_add (1))
+            (*taskBody) (i, slot);
+    }
+
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    // Task state: written before the workers' go.signal(), read back after
+    // done.wait(); the events order the accesses
+    const Body* taskBody = nullptr;
+    int taskCount = 0;
+    std::atomic<int> nextIndex { 0 };
+    std::atomic<int> activeWorkers { 0 };
+    juce::WaitableEvent done;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ControlRateParallelFor)
+};
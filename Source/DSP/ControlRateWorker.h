@@ -0,0 +1,128 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "ControlTickStats.h"
+#include <functional>
+#include <vector>
+
+/**
+ * ControlRateWorker
+ *
+ * Dedicated thread that runs the control-rate stages (delay-mode ramps, matrix
+ * recalculation, publication of the matrix targets) on its own clock instead of
+ * piggy-backing on the message-thread timer, so a busy GUI (repaints, file
+ * dialogs, window drags) no longer stretches the time between matrix updates.
+ *
+ * Stages are registered before start() and run in registration order once per
+ * tick; each receives the nominal tick length in seconds. The clock is
+ * deadline-based: sleep until shortly before the deadline, then yield until it
+ * passes. A tick that finishes after the next deadline counts as an overrun and
+ * the clock resyncs from "now" rather than firing a burst of catch-up ticks.
+ *
+ * Stats (tick jitter, per-stage cost, overruns) are kept in a ControlTickStats
+ * and can be read from any thread with getStats().
+ */
+class ControlRateWorker : private juce::Thread
+{
+public:
+    using StageFunction = std::function<void (float deltaTimeSeconds)>;
+
+    using Stats = ControlTickStats::Stats;
+
+    /** Supported clock rates. Anything else is snapped to the nearest. */
+    static int snapRate (int hz)
+    {
+        if (hz >= 150) return 200;
+        if (hz >= 75)  return 100;
+        return 50;
+    }
+
+    ControlRateWorker() : juce::Thread ("WFS Control Rate") {}
+
+    ~ControlRateWorker() override
+    {
+        stop();
+    }
+
+    /** Register a stage. Only valid while the worker is stopped. */
+    void addStage (const juce::String& name, StageFunction fn)
+    {
+        jassert (! isThreadRunning());
+        stages.push_back (std::move (fn));
+        stats.addStage (name);
+    }
+
+    void start (int rateHz)
+    {
+        if (isThreadRunning())
+            return;
+
+        tickRateHz = snapRate (rateHz);
+        stats.setRateHz (tickRateHz);
+        stats.reset();
+
+        if (! startRealtimeThread (juce::Thread::RealtimeOptions{}.withPeriodHz (tickRateHz)))
+            startThread (juce::Thread::Priority::highest);
+    }
+
+    void stop()
+    {
+        stopThread (1000);
+    }
+
+    bool isRunning() const { return isThreadRunning(); }
+    int getRateHz() const { return tickRateHz; }
+
+    Stats getStats() const { return stats.getStats(); }
+
+    /** Clear peak values (e.g. after they have been logged). */
+    void resetPeaks() { stats.resetPeaks(); }
+
+private:
+    void run() override
+    {
+        const double periodMs = 1000.0 / tickRateHz;
+        const float dt = 1.0f / static_cast<float> (tickRateHz);
+        double deadline = juce::Time::getMillisecondCounterHiRes() + periodMs;
+
+        while (! threadShouldExit())
+        {
+            // Coarse sleep to ~1 ms before the deadline, then yield the rest:
+            // wait() alone is only millisecond-accurate on most schedulers
+            const double remaining = deadline - juce::Time::getMillisecondCounterHiRes();
+            if (remaining > 1.5)
+                wait (static_cast<int> (remaining - 1.0));
+
+            while (! threadShouldExit() && juce::Time::getMillisecondCounterHiRes() < deadline)
+                juce::Thread::yield();
+
+            if (threadShouldExit())
+                break;
+
+            double t0 = juce::Time::getMillisecondCounterHiRes();
+            stats.recordTickStart (static_cast<float> ((t0 - deadline) * 1000.0));
+
+            for (size_t i = 0; i < stages.size(); ++i)
+            {
+                stages[i] (dt);
+
+                const double t1 = juce::Time::getMillisecondCounterHiRes();
+                stats.recordStage (static_cast<int> (i), static_cast<float> ((t1 - t0) * 1000.0));
+                t0 = t1;
+            }
+
+            deadline += periodMs;
+            const double now = juce::Time::getMillisecondCounterHiRes();
+            const bool overran = now > deadline;
+            if (overran)
+                deadline = now + periodMs;
+            stats.recordTickEnd (overran);
+        }
+    }
+
+    std::vector<StageFunction> stages;
+    ControlTickStats stats;
+    int tickRateHz = 50;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ControlRateWorker)
+};
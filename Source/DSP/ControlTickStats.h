@@ -0,0 +1,184 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/**
+ * ControlTickStats
+ *
+ * Timing of a control-rate clock: how late each tick started, how long each of
+ * its stages took, and how many ticks overran. One writer (the thread that runs
+ * the tick), any number of readers: everything is kept in relaxed atomics and
+ * read as a Stats copy with getStats().
+ *
+ * Used by ControlRateWorker for its own thread, and by MainComponent for the
+ * stages that still run on the message-thread timer, so both clocks report the
+ * same figures (diagnostics_get_control_rate, the once-per-second health log).
+ */
+class ControlTickStats
+{
+public:
+    struct StageStats
+    {
+        juce::String name;
+        float lastUs = 0.0f;
+        float peakUs = 0.0f;
+        float meanUs = 0.0f;
+    };
+
+    struct Stats
+    {
+        int rateHz = 0;
+        juce::uint64 ticks = 0;
+        juce::uint64 overruns = 0;
+        float lastJitterUs = 0.0f;     // Lateness of the most recent tick vs its deadline
+        float peakJitterUs = 0.0f;
+        float meanJitterUs = 0.0f;
+        std::vector<StageStats> stages;
+    };
+
+    /** Register a stage; returns its index for recordStage(). Before the first tick only. */
+    int addStage (const juce::String& name)
+    {
+        auto s = std::make_unique<Stage>();
+        s->name = name;
+        stages.push_back (std::move (s));
+        return static_cast<int> (stages.size()) - 1;
+    }
+
+    void setRateHz (int hz) { rateHz.store (hz, std::memory_order_relaxed); }
+
+    //==========================================================================
+    // Writer side (the ticking thread only)
+    //==========================================================================
+
+    /** A tick started jitterUs after its deadline. */
+    void recordTickStart (float jitterUs)
+    {
+        lastJitterUs.store (jitterUs, std::memory_order_relaxed);
+        storePeak (peakJitterUs, jitterUs);
+        jitterSumUs.store (jitterSumUs.load (std::memory_order_relaxed) + jitterUs, std::memory_order_relaxed);
+    }
+
+    void recordStage (int index, float us)
+    {
+        auto& st = *stages[static_cast<size_t> (index)];
+        st.lastUs.store (us, std::memory_order_relaxed);
+        storePeak (st.peakUs, us);
+        st.sumUs.store (st.sumUs.load (std::memory_order_relaxed) + us, std::memory_order_relaxed);
+    }
+
+    void recordTickEnd (bool overran)
+    {
+        tickCount.fetch_add (1, std::memory_order_relaxed);
+        if (overran)
+            overrunCount.fetch_add (1, std::memory_order_relaxed);
+    }
+
+    //==========================================================================
+    // Reader side (any thread)
+    //==========================================================================
+
+    Stats getStats() const
+    {
+        Stats s;
+        s.rateHz = rateHz.load (std::memory_order_relaxed);
+        s.ticks = tickCount.load (std::memory_order_relaxed);
+        s.overruns = overrunCount.load (std::memory_order_relaxed);
+        s.lastJitterUs = lastJitterUs.load (std::memory_order_relaxed);
+        s.peakJitterUs = peakJitterUs.load (std::memory_order_relaxed);
+        s.meanJitterUs = s.ticks > 0 ? static_cast<float> (jitterSumUs.load (std::memory_order_relaxed) / static_cast<double> (s.ticks))
+                                     : 0.0f;
+
+        for (const auto& st : stages)
+        {
+            StageStats ss;
+            ss.name = st->name;
+            ss.lastUs = st->lastUs.load (std::memory_order_relaxed);
+            ss.peakUs = st->peakUs.load (std::memory_order_relaxed);
+            ss.meanUs = s.ticks > 0 ? static_cast<float> (st->sumUs.load (std::memory_order_relaxed) / static_cast<double> (s.ticks))
+                                    : 0.0f;
+            s.stages.push_back (ss);
+        }
+        return s;
+    }
+
+    /** Clear peak values (e.g. after they have been logged or read). */
+    void resetPeaks()
+    {
+        peakJitterUs.store (0.0f, std::memory_order_relaxed);
+        for (auto& st : stages)
+            st->peakUs.store (0.0f, std::memory_order_relaxed);
+    }
+
+    /** Clear everything. Only while nothing is ticking. */
+    void reset()
+    {
+        tickCount.store (0);
+        overrunCount.store (0);
+        lastJitterUs.store (0.0f);
+        peakJitterUs.store (0.0f);
+        jitterSumUs.store (0.0);
+        for (auto& st : stages)
+        {
+            st->lastUs.store (0.0f);
+            st->peakUs.store (0.0f);
+            st->sumUs.store (0.0);
+        }
+    }
+
+    static juce::var toVar (const Stats& s)
+    {
+        auto obj = std::make_unique<juce::DynamicObject>();
+        obj->setProperty ("rateHz", s.rateHz);
+        obj->setProperty ("ticks", static_cast<juce::int64> (s.ticks));
+        obj->setProperty ("overruns", static_cast<juce::int64> (s.overruns));
+
+        auto jitter = std::make_unique<juce::DynamicObject>();
+        jitter->setProperty ("lastUs", s.lastJitterUs);
+        jitter->setProperty ("peakUs", s.peakJitterUs);
+        jitter->setProperty ("meanUs", s.meanJitterUs);
+        obj->setProperty ("jitter", juce::var (jitter.release()));
+
+        juce::Array<juce::var> stageList;
+        for (const auto& st : s.stages)
+        {
+            auto so = std::make_unique<juce::DynamicObject>();
+            so->setProperty ("name", st.name);
+            so->setProperty ("lastUs", st.lastUs);
+            so->setProperty ("peakUs", st.peakUs);
+            so->setProperty ("meanUs", st.meanUs);
+            stageList.add (juce::var (so.release()));
+        }
+        obj->setProperty ("stages", stageList);
+        return juce::var (obj.release());
+    }
+
+private:
+    struct Stage
+    {
+        juce::String name;
+        std::atomic<float> lastUs { 0.0f };
+        std::atomic<float> peakUs { 0.0f };
+        std::atomic<double> sumUs { 0.0 };
+    };
+
+    static void storePeak (std::atomic<float>& peak, float v)
+    {
+        if (v > peak.load (std::memory_order_relaxed))
+            peak.store (v, std::memory_order_relaxed);   // Single writer: no CAS needed
+    }
+
+    std::vector<std::unique_ptr<Stage>> stages;
+    std::atomic<int> rateHz { 0 };
+
+    std::atomic<juce::uint64> tickCount { 0 };
+    std::atomic<juce::uint64> overrunCount { 0 };
+    std::atomic<float> lastJitterUs { 0.0f };
+    std::atomic<float> peakJitterUs { 0.0f };
+    std::atomic<double> jitterSumUs { 0.0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ControlTickStats)
+};
@@ -0,0 +1,305 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "../../spatcore/dsp/LFOWaveforms.h"
+
+#include <array>
+#include <cmath>
+#include <initializer_list>
+#include <vector>
+
+/**
+ * Control-rate LFO engine shared by LFOProcessor (inputs) and
+ * ClusterLFOProcessor (clusters).
+ *
+ * State is structure-of-arrays: one contiguous row per quantity and per axis,
+ * indexed by voice, so each tick runs the fades, ramps and offset scaling for
+ * every voice of an axis as one vectorised pass. Only the waveform lookup
+ * (LFOWaveforms::applyWaveform) and random target draws stay per voice.
+ *
+ * Parameters are pushed in with setVoiceParams() when they change; process()
+ * never touches the value tree.
+ *
+ * Per voice:
+ * - Main ramp (0→1) that cycles at the period rate, reset on activation
+ * - 500ms global fade in/out when activating/deactivating
+ * - Per axis: independent ramp at its rate multiplier, phase offset,
+ *   1-second fade when the shape changes from OFF (and, if enabled, when it
+ *   changes between two non-OFF shapes), random target redrawn on wrap
+ *
+ * Message thread only.
+ */
+class LFOEngine
+{
+public:
+    static constexpr int maxAxes = 5;
+    static constexpr float fadeTimeSeconds = 0.5f;
+    static constexpr float axisFadeTimeSeconds = 1.0f;
+
+    /** How an axis's waveform (-1..+1) becomes its offset */
+    enum class AxisMapping
+    {
+        Bipolar,        // waveform * amplitude * fades
+        Unipolar,       // (waveform + 1) / 2 * amplitude * fades
+        Exponential     // amplitude ^ ((waveform + 1) / 2 * fades), 1 at rest
+    };
+
+    struct VoiceParams
+    {
+        bool active = false;
+        float period = 5.0f;
+        int globalPhase = 0;
+        std::array<int, maxAxes> shape {};
+        std::array<float, maxAxes> rate { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+        std::array<float, maxAxes> amplitude { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+        std::array<int, maxAxes> phase {};
+    };
+
+    LFOEngine (int numVoicesToUse, std::initializer_list<AxisMapping> axisMappings, bool crossfadeShapeChanges)
+        : numVoices (numVoicesToUse),
+          numAxes (juce::jmin (maxAxes, static_cast<int> (axisMappings.size()))),
+          crossfadeShapes (crossfadeShapeChanges)
+    {
+        std::copy_n (axisMappings.begin(), numAxes, mappings.begin());
+
+        const auto nv = static_cast<size_t> (numVoices);
+        const auto na = static_cast<size_t> (numAxes) * nv;
+
+        active.assign (nv, 0);
+        wasActive.assign (nv, 0);
+        justActivated.assign (nv, 0);
+        running.assign (nv, 0);
+        invPeriod.assign (nv, 1.0f / 5.0f);
+        ramp.assign (nv, 0.0f);
+        rampIncrement.assign (nv, 0.0f);
+        fadeLevel.assign (nv, 0.0f);
+
+        shape.assign (na, LFOWaveforms::Off);
+        prevShape.assign (na, LFOWaveforms::Off);
+        rate.assign (na, 1.0f);
+        amplitude.assign (na, 1.0f);
+        phaseOffset.assign (na, 10.0f);
+        axisRamp.assign (na, 0.0f);
+        adjustedRamp.assign (na, 0.0f);
+        prevAdjustedRamp.assign (na, 0.0f);
+        axisFade.assign (na, 0.0f);
+        lastRandom.assign (na, 0.0f);
+        randomTarget.assign (na, 0.0f);
+        normalized.assign (na, 0.0f);
+        offset.assign (na, 0.0f);
+    }
+
+    int getNumVoices() const noexcept { return numVoices; }
+    int getNumAxes() const noexcept   { return numAxes; }
+
+    /** Cache one voice's parameters (call when they change, not per tick) */
+    void setVoiceParams (int voice, const VoiceParams& p)
+    {
+        if (voice < 0 || voice >= numVoices)
+            return;
+
+        const auto v = static_cast<size_t> (voice);
+        active[v] = p.active ? 1 : 0;
+        invPeriod[v] = 1.0f / juce::jmax (0.01f, p.period);
+
+        for (int a = 0; a < numAxes; ++a)
+        {
+            const auto i = index (a, voice);
+            shape[i] = p.shape[static_cast<size_t> (a)];
+            rate[i] = p.rate[static_cast<size_t> (a)];
+            amplitude[i] = p.amplitude[static_cast<size_t> (a)];
+            // +10 keeps negative phases positive for the wrap in process()
+            phaseOffset[i] = static_cast<float> (p.globalPhase + p.phase[static_cast<size_t> (a)]) / 360.0f + 10.0f;
+        }
+    }
+
+    /** Advance every voice by one control tick */
+    void process (float deltaTimeSeconds)
+    {
+        const float fadeIncrement = deltaTimeSeconds / fadeTimeSeconds;
+        const float axisFadeIncrement = deltaTimeSeconds / axisFadeTimeSeconds;
+
+        // Global fade, activation and main ramp
+        for (int v = 0; v < numVoices; ++v)
+        {
+            const auto i = static_cast<size_t> (v);
+            const bool on = active[i] != 0;
+
+            fadeLevel[i] = juce::jlimit (0.0f, 1.0f, fadeLevel[i] + (on ? fadeIncrement : -fadeIncrement));
+            justActivated[i] = (on && wasActive[i] == 0) ? 1 : 0;
+            wasActive[i] = active[i];
+
+            // Ramps keep running through the fade out
+            running[i] = (on || fadeLevel[i] > 0.0f) ? 1 : 0;
+            rampIncrement[i] = running[i] != 0 ? deltaTimeSeconds * invPeriod[i] : 0.0f;
+
+            // Reset to phase 0 on enable so all clocks start synchronized
+            float r = justActivated[i] != 0 ? 0.0f : ramp[i];
+            r += rampIncrement[i];
+            ramp[i] = r >= 1.0f ? r - std::floor (r) : r;
+        }
+
+        for (int a = 0; a < numAxes; ++a)
+        {
+            processAxisRampsAndFades (a, axisFadeIncrement);
+            processAxisWaveforms (a);
+            processAxisOffsets (a);
+        }
+    }
+
+    //==========================================================================
+    // Outputs (0-based voice)
+    //==========================================================================
+
+    float getRamp (int voice) const noexcept       { return isVoice (voice) ? ramp[static_cast<size_t> (voice)] : 0.0f; }
+    float getFadeLevel (int voice) const noexcept  { return isVoice (voice) ? fadeLevel[static_cast<size_t> (voice)] : 0.0f; }
+    bool isActive (int voice) const noexcept       { return isVoice (voice) && active[static_cast<size_t> (voice)] != 0; }
+    bool wasActiveLastTick (int voice) const noexcept { return isVoice (voice) && wasActive[static_cast<size_t> (voice)] != 0; }
+
+    float getNormalized (int axis, int voice) const noexcept
+    {
+        return isAxisVoice (axis, voice) ? normalized[index (axis, voice)] : 0.0f;
+    }
+
+    float getOffset (int axis, int voice) const noexcept
+    {
+        if (! isAxisVoice (axis, voice))
+            return mappings[static_cast<size_t> (juce::jlimit (0, maxAxes - 1, axis))] == AxisMapping::Exponential ? 1.0f : 0.0f;
+        return offset[index (axis, voice)];
+    }
+
+    /** One axis's offsets for all voices, contiguous */
+    const float* getOffsets (int axis) const noexcept     { return offset.data() + index (axis, 0); }
+    const float* getRamps() const noexcept                { return ramp.data(); }
+    const float* getFadeLevels() const noexcept           { return fadeLevel.data(); }
+
+private:
+    size_t index (int axis, int voice) const noexcept
+    {
+        return static_cast<size_t> (axis) * static_cast<size_t> (numVoices) + static_cast<size_t> (voice);
+    }
+
+    bool isVoice (int voice) const noexcept { return voice >= 0 && voice < numVoices; }
+    bool isAxisVoice (int axis, int voice) const noexcept { return axis >= 0 && axis < numAxes && isVoice (voice); }
+
+    void processAxisRampsAndFades (int axis, float axisFadeIncrement)
+    {
+        constexpr int off = LFOWaveforms::Off;
+        const auto base = index (axis, 0);
+        const int* cur = shape.data() + base;
+        int* prev = prevShape.data() + base;
+        float* fade = axisFade.data() + base;
+        float* r = axisRamp.data() + base;
+        float* adj = adjustedRamp.data() + base;
+        const float* axisRate = rate.data() + base;
+        const float* phase = phaseOffset.data() + base;
+
+        for (int v = 0; v < numVoices; ++v)
+        {
+            const auto i = static_cast<size_t> (v);
+            const bool justAct = justActivated[i] != 0;
+
+            // Axis fade restarts on OFF→ON, on activation, and (clusters) on a
+            // change between two non-OFF shapes
+            const bool restart = (prev[v] == off && cur[v] != off)
+                              || (justAct && cur[v] != off && fade[v] >= 1.0f)
+                              || (crossfadeShapes && prev[v] != off && cur[v] != off && prev[v] != cur[v]);
+            const float f = restart ? 0.0f : fade[v];
+            fade[v] = cur[v] != off ? juce::jmin (1.0f, f + axisFadeIncrement)
+                                    : juce::jmax (0.0f, f - axisFadeIncrement);
+            prev[v] = cur[v];
+
+            float x = justAct ? 0.0f : r[v];
+            x += rampIncrement[i] * axisRate[v];
+            x = x >= 1.0f ? x - std::floor (x) : x;
+            r[v] = x;
+
+            const float p = x + phase[v];
+            adj[v] = p - std::floor (p);
+        }
+    }
+
+    void processAxisWaveforms (int axis)
+    {
+        const auto base = index (axis, 0);
+
+        for (int v = 0; v < numVoices; ++v)
+        {
+            const auto i = base + static_cast<size_t> (v);
+
+            if (running[static_cast<size_t> (v)] == 0)
+            {
+                normalized[i] = 0.0f;
+                continue;
+            }
+
+            // New random target each time this axis's phased ramp wraps
+            if (shape[i] == LFOWaveforms::Random && adjustedRamp[i] < prevAdjustedRamp[i])
+            {
+                lastRandom[i] = randomTarget[i];
+                randomTarget[i] = random.nextFloat() * 2.0f - 1.0f;
+            }
+            prevAdjustedRamp[i] = adjustedRamp[i];
+
+            normalized[i] = LFOWaveforms::applyWaveform (shape[i], adjustedRamp[i], lastRandom[i], randomTarget[i]);
+        }
+    }
+
+    // Stopped voices have normalized == 0 and fadeLevel == 0, so every
+    // mapping lands on its rest value without a branch.
+    void processAxisOffsets (int axis)
+    {
+        const auto base = index (axis, 0);
+        float* out = offset.data() + base;
+        const float* n = normalized.data() + base;
+
+        switch (mappings[static_cast<size_t> (axis)])
+        {
+            case AxisMapping::Bipolar:
+                juce::FloatVectorOperations::multiply (out, n, amplitude.data() + base, numVoices);
+                juce::FloatVectorOperations::multiply (out, fadeLevel.data(), numVoices);
+                juce::FloatVectorOperations::multiply (out, axisFade.data() + base, numVoices);
+                break;
+
+            case AxisMapping::Unipolar:
+                juce::FloatVectorOperations::add (out, n, 1.0f, numVoices);
+                juce::FloatVectorOperations::multiply (out, 0.5f, numVoices);
+                juce::FloatVectorOperations::multiply (out, amplitude.data() + base, numVoices);
+                juce::FloatVectorOperations::multiply (out, fadeLevel.data(), numVoices);
+                juce::FloatVectorOperations::multiply (out, axisFade.data() + base, numVoices);
+                break;
+
+            case AxisMapping::Exponential:
+                juce::FloatVectorOperations::add (out, n, 1.0f, numVoices);
+                juce::FloatVectorOperations::multiply (out, 0.5f, numVoices);
+                juce::FloatVectorOperations::multiply (out, fadeLevel.data(), numVoices);
+                juce::FloatVectorOperations::multiply (out, axisFade.data() + base, numVoices);
+                for (int v = 0; v < numVoices; ++v)
+                    out[v] = std::pow (amplitude[base + static_cast<size_t> (v)], out[v]);
+                break;
+        }
+    }
+
+    //==========================================================================
+    // Member Variables
+    //==========================================================================
+    const int numVoices;
+    const int numAxes;
+    const bool crossfadeShapes;
+    std::array<AxisMapping, maxAxes> mappings {};
+
+    // Per voice
+    std::vector<uint8_t> active, wasActive, justActivated, running;
+    std::vector<float> invPeriod, ramp, rampIncrement, fadeLevel;
+
+    // Per axis, then per voice (row = axis)
+    std::vector<int> shape, prevShape;
+    std::vector<float> rate, amplitude, phaseOffset;
+    std::vector<float> axisRamp, adjustedRamp, prevAdjustedRamp, axisFade;
+    std::vector<float> lastRandom, randomTarget;
+    std::vector<float> normalized, offset;
+
+    juce::Random random;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LFOEngine)
+};
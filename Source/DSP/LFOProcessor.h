@@ -3,84 +3,58 @@
 #include <JuceHeader.h>
 #include "../Parameters/WFSValueTreeState.h"
 #include "../Parameters/WFSParameterIDs.h"
-#include "../../spatcore/dsp/LFOWaveforms.h"
+#include "LFOEngine.h"
+
+#include <atomic>
+#include <memory>
 
 /**
  * LFO Processor for WFS Input Position Modulation
  *
  * Generates periodic position offsets for each input channel based on LFO parameters.
- * Called at 50Hz from the MainComponent timer callback.
+ * Called at 50Hz from the MainComponent timer callback (message thread), with
+ * the measured time since the previous tick.
  *
- * Each input has independent LFO state with:
+ * Each input is one voice of an LFOEngine with X/Y/Z axes:
  * - Main ramp (0→1) that cycles at the period rate
  * - Per-axis waveform shape, rate multiplier, amplitude, and phase
  * - 500ms global fade in/out when activating/deactivating LFO
  * - 1-second per-axis fade when shape changes from OFF to any other (prevents brisk changes)
  * - Random shape picks new target at period boundary
+ * - Gyrophone rotation offset from the main ramp
+ *
+ * Parameters are cached: the LFO sections are re-read only for inputs whose
+ * properties changed since the last tick (or all of them after a reload).
  */
-class LFOProcessor
+class LFOProcessor : private juce::ValueTree::Listener
 {
 public:
     // Waveform shapes — delegated to LFOWaveforms shared utility
     static constexpr int Off      = LFOWaveforms::Off;
     static constexpr int Random   = LFOWaveforms::Random;
 
-    //==========================================================================
-    // Per-Input LFO State
-    //==========================================================================
-    struct LFOState
-    {
-        float ramp = 0.0f;              // Main ramp 0→1 (kept for gyrophone + progress UI)
-        float rampX = 0.0f;             // Independent X-axis ramp 0→1
-        float rampY = 0.0f;             // Independent Y-axis ramp 0→1
-        float rampZ = 0.0f;             // Independent Z-axis ramp 0→1
-        float fadeLevel = 0.0f;         // 0→1 for 500ms fade in/out
-        bool wasActive = false;         // Previous active state for fade detection
-
-        // Per-axis amplitude fade (0→1, 1-second ramp when shape changes from OFF)
-        float fadeX = 0.0f;
-        float fadeY = 0.0f;
-        float fadeZ = 0.0f;
-
-        // Previous shape values for detecting OFF→ON transitions
-        int prevShapeX = 0;
-        int prevShapeY = 0;
-        int prevShapeZ = 0;
-
-        // Random shape state - per axis
-        float randomTargetX = 0.0f;
-        float randomTargetY = 0.0f;
-        float randomTargetZ = 0.0f;
-        float lastRandomX = 0.0f;
-        float lastRandomY = 0.0f;
-        float lastRandomZ = 0.0f;
-
-        // Per-axis ramp tracking for independent random generation
-        float prevRampX = 0.0f;
-        float prevRampY = 0.0f;
-        float prevRampZ = 0.0f;
-
-        // Cached output values for UI display
-        float normalizedX = 0.0f;       // -1 to +1 for UI slider
-        float normalizedY = 0.0f;
-        float normalizedZ = 0.0f;
-
-        // Final offset values in meters
-        float offsetX = 0.0f;
-        float offsetY = 0.0f;
-        float offsetZ = 0.0f;
-
-        // Gyrophone rotation offset in radians (added to input rotation for HF directivity)
-        float gyrophoneOffsetRad = 0.0f;
-    };
+    enum Axis { AxisX = 0, AxisY, AxisZ, numAxes };
 
     //==========================================================================
     // Construction
     //==========================================================================
     explicit LFOProcessor (WFSValueTreeState& state, int numInputs = 64)
-        : valueTreeState (state), numInputChannels (numInputs)
+        : valueTreeState (state),
+          numInputChannels (numInputs),
+          engine (numInputs, { LFOEngine::AxisMapping::Bipolar,
+                               LFOEngine::AxisMapping::Bipolar,
+                               LFOEngine::AxisMapping::Bipolar }, false),
+          inputDirty (new std::atomic<bool>[static_cast<size_t> (numInputs)])
     {
-        states.resize (static_cast<size_t> (numInputs));
+        gyrophoneScale.assign (static_cast<size_t> (numInputs), 0.0f);
+        gyrophoneOffsetRad.assign (static_cast<size_t> (numInputs), 0.0f);
+        markAllDirty();
+        valueTreeState.addListener (this);
+    }
+
+    ~LFOProcessor() override
+    {
+        valueTreeState.removeListener (this);
     }
 
     //==========================================================================
@@ -93,15 +67,15 @@ public:
      */
     void process (float deltaTimeSeconds)
     {
-        constexpr float fadeTimeSeconds = 0.5f;      // 500ms global fade
-        constexpr float axisFadeTimeSeconds = 1.0f;  // 1-second per-axis fade
-        const float fadeIncrement = deltaTimeSeconds / fadeTimeSeconds;
-        const float axisFadeIncrement = deltaTimeSeconds / axisFadeTimeSeconds;
-
-        for (int i = 0; i < numInputChannels; ++i)
-        {
-            processInput (i, deltaTimeSeconds, fadeIncrement, axisFadeIncrement);
-        }
+        refreshDirtyParams();
+        engine.process (deltaTimeSeconds);
+
+        // Gyrophone: rotate brightness cone based on main ramp, one full turn
+        // per period, faded with the LFO
+        juce::FloatVectorOperations::multiply (gyrophoneOffsetRad.data(), engine.getRamps(),
+                                               gyrophoneScale.data(), numInputChannels);
+        juce::FloatVectorOperations::multiply (gyrophoneOffsetRad.data(), engine.getFadeLevels(),
+                                               numInputChannels);
     }
 
     //==========================================================================
@@ -109,263 +83,122 @@ public:
     //==========================================================================
 
     /** Get current LFO offset in meters for an input */
-    float getOffsetX (int inputIndex) const
-    {
-        if (inputIndex < 0 || inputIndex >= numInputChannels)
-            return 0.0f;
-        return states[static_cast<size_t> (inputIndex)].offsetX;
-    }
-
-    float getOffsetY (int inputIndex) const
-    {
-        if (inputIndex < 0 || inputIndex >= numInputChannels)
-            return 0.0f;
-        return states[static_cast<size_t> (inputIndex)].offsetY;
-    }
-
-    float getOffsetZ (int inputIndex) const
-    {
-        if (inputIndex < 0 || inputIndex >= numInputChannels)
-            return 0.0f;
-        return states[static_cast<size_t> (inputIndex)].offsetZ;
-    }
+    float getOffsetX (int inputIndex) const { return engine.getOffset (AxisX, inputIndex); }
+    float getOffsetY (int inputIndex) const { return engine.getOffset (AxisY, inputIndex); }
+    float getOffsetZ (int inputIndex) const { return engine.getOffset (AxisZ, inputIndex); }
 
     /** Get normalized output (-1 to +1) for UI display */
-    float getNormalizedX (int inputIndex) const
-    {
-        if (inputIndex < 0 || inputIndex >= numInputChannels)
-            return 0.0f;
-        return states[static_cast<size_t> (inputIndex)].normalizedX;
-    }
-
-    float getNormalizedY (int inputIndex) const
-    {
-        if (inputIndex < 0 || inputIndex >= numInputChannels)
-            return 0.0f;
-        return states[static_cast<size_t> (inputIndex)].normalizedY;
-    }
-
-    float getNormalizedZ (int inputIndex) const
-    {
-        if (inputIndex < 0 || inputIndex >= numInputChannels)
-            return 0.0f;
-        return states[static_cast<size_t> (inputIndex)].normalizedZ;
-    }
+    float getNormalizedX (int inputIndex) const { return engine.getNormalized (AxisX, inputIndex); }
+    float getNormalizedY (int inputIndex) const { return engine.getNormalized (AxisY, inputIndex); }
+    float getNormalizedZ (int inputIndex) const { return engine.getNormalized (AxisZ, inputIndex); }
 
     /** Get gyrophone rotation offset in radians (for HF directivity modulation) */
     float getGyrophoneOffsetRad (int inputIndex) const
     {
         if (inputIndex < 0 || inputIndex >= numInputChannels)
             return 0.0f;
-        return states[static_cast<size_t> (inputIndex)].gyrophoneOffsetRad;
+        return gyrophoneOffsetRad[static_cast<size_t> (inputIndex)];
     }
 
     /** Get ramp progress (0→1) for progress indicator */
-    float getRampProgress (int inputIndex) const
-    {
-        if (inputIndex < 0 || inputIndex >= numInputChannels)
-            return 0.0f;
-        return states[static_cast<size_t> (inputIndex)].ramp;
-    }
+    float getRampProgress (int inputIndex) const { return engine.getRamp (inputIndex); }
 
     /** Check if LFO is active for an input */
-    bool isActive (int inputIndex) const
-    {
-        if (inputIndex < 0 || inputIndex >= numInputChannels)
-            return false;
-        auto lfoSection = valueTreeState.getInputLFOSection (inputIndex);
-        return static_cast<int> (lfoSection.getProperty (WFSParameterIDs::inputLFOactive, 0)) != 0;
-    }
+    bool isActive (int inputIndex) const { return engine.isActive (inputIndex); }
 
 private:
     //==========================================================================
-    // Per-Input Processing
+    // Parameter Cache
     //==========================================================================
-    void processInput (int inputIndex, float deltaTime, float fadeIncrement, float axisFadeIncrement)
+    void markAllDirty()
     {
-        auto& state = states[static_cast<size_t> (inputIndex)];
+        for (int i = 0; i < numInputChannels; ++i)
+            inputDirty[static_cast<size_t> (i)].store (true, std::memory_order_relaxed);
+        anyDirty.store (true, std::memory_order_release);
+    }
+
+    void refreshDirtyParams()
+    {
+        if (! anyDirty.exchange (false, std::memory_order_acquire))
+            return;
+
+        for (int i = 0; i < numInputChannels; ++i)
+            if (inputDirty[static_cast<size_t> (i)].exchange (false, std::memory_order_relaxed))
+                refreshInputParams (i);
+    }
+
+    void refreshInputParams (int inputIndex)
+    {
+        using namespace WFSParameterIDs;
+
         auto lfoSection = valueTreeState.getInputLFOSection (inputIndex);
 
-        // Read parameters
-        bool isActive = static_cast<int> (lfoSection.getProperty (WFSParameterIDs::inputLFOactive, 0)) != 0;
-        float period = static_cast<float> (lfoSection.getProperty (WFSParameterIDs::inputLFOperiod, 5.0f));
-        int globalPhase = static_cast<int> (lfoSection.getProperty (WFSParameterIDs::inputLFOphase, 0));
-
-        int shapeX = static_cast<int> (lfoSection.getProperty (WFSParameterIDs::inputLFOshapeX, 0));
-        int shapeY = static_cast<int> (lfoSection.getProperty (WFSParameterIDs::inputLFOshapeY, 0));
-        int shapeZ = static_cast<int> (lfoSection.getProperty (WFSParameterIDs::inputLFOshapeZ, 0));
-
-        float rateX = static_cast<float> (lfoSection.getProperty (WFSParameterIDs::inputLFOrateX, 1.0f));
-        float rateY = static_cast<float> (lfoSection.getProperty (WFSParameterIDs::inputLFOrateY, 1.0f));
-        float rateZ = static_cast<float> (lfoSection.getProperty (WFSParameterIDs::inputLFOrateZ, 1.0f));
-
-        float amplitudeX = static_cast<float> (lfoSection.getProperty (WFSParameterIDs::inputLFOamplitudeX, 1.0f));
-        float amplitudeY = static_cast<float> (lfoSection.getProperty (WFSParameterIDs::inputLFOamplitudeY, 1.0f));
-        float amplitudeZ = static_cast<float> (lfoSection.getProperty (WFSParameterIDs::inputLFOamplitudeZ, 1.0f));
-
-        int phaseX = static_cast<int> (lfoSection.getProperty (WFSParameterIDs::inputLFOphaseX, 0));
-        int phaseY = static_cast<int> (lfoSection.getProperty (WFSParameterIDs::inputLFOphaseY, 0));
-        int phaseZ = static_cast<int> (lfoSection.getProperty (WFSParameterIDs::inputLFOphaseZ, 0));
-
-        // Gyrophone: -1 = Anti-Clockwise, 0 = OFF, 1 = Clockwise
-        int gyrophone = static_cast<int> (lfoSection.getProperty (WFSParameterIDs::inputLFOgyrophone, 0));
-
-        // Update fade level (500ms fade in/out)
-        if (isActive && state.fadeLevel < 1.0f)
-        {
-            state.fadeLevel = juce::jmin (1.0f, state.fadeLevel + fadeIncrement);
-        }
-        else if (!isActive && state.fadeLevel > 0.0f)
-        {
-            state.fadeLevel = juce::jmax (0.0f, state.fadeLevel - fadeIncrement);
-        }
-
-        // Per-axis amplitude fade (1-second ramp when shape changes from OFF to any other)
-        // Reset fade when shape transitions from OFF (0) to non-OFF, or when LFO just became active
-        bool justActivated = isActive && !state.wasActive;
-
-        // Reset all ramps to phase 0 on enable so clocks start synchronized
-        if (justActivated)
-        {
-            state.ramp  = 0.0f;
-            state.rampX = 0.0f;
-            state.rampY = 0.0f;
-            state.rampZ = 0.0f;
-        }
-
-        if ((state.prevShapeX == Off && shapeX != Off) || (justActivated && shapeX != Off && state.fadeX >= 1.0f))
-            state.fadeX = 0.0f;
-        if ((state.prevShapeY == Off && shapeY != Off) || (justActivated && shapeY != Off && state.fadeY >= 1.0f))
-            state.fadeY = 0.0f;
-        if ((state.prevShapeZ == Off && shapeZ != Off) || (justActivated && shapeZ != Off && state.fadeZ >= 1.0f))
-            state.fadeZ = 0.0f;
-
-        // Ramp up per-axis fade when shape is active, ramp down when OFF
-        if (shapeX != Off && state.fadeX < 1.0f)
-            state.fadeX = juce::jmin (1.0f, state.fadeX + axisFadeIncrement);
-        else if (shapeX == Off && state.fadeX > 0.0f)
-            state.fadeX = juce::jmax (0.0f, state.fadeX - axisFadeIncrement);
-
-        if (shapeY != Off && state.fadeY < 1.0f)
-            state.fadeY = juce::jmin (1.0f, state.fadeY + axisFadeIncrement);
-        else if (shapeY == Off && state.fadeY > 0.0f)
-            state.fadeY = juce::jmax (0.0f, state.fadeY - axisFadeIncrement);
-
-        if (shapeZ != Off && state.fadeZ < 1.0f)
-            state.fadeZ = juce::jmin (1.0f, state.fadeZ + axisFadeIncrement);
-        else if (shapeZ == Off && state.fadeZ > 0.0f)
-            state.fadeZ = juce::jmax (0.0f, state.fadeZ - axisFadeIncrement);
-
-        // Store current shapes for next frame's transition detection
-        state.prevShapeX = shapeX;
-        state.prevShapeY = shapeY;
-        state.prevShapeZ = shapeZ;
-
-        // Update ramp (continues even during fade out for smooth transition)
-        if (state.fadeLevel > 0.0f || isActive)
-        {
-            float rampIncrement = deltaTime / juce::jmax (0.01f, period);
-
-            // Main ramp kept for gyrophone + progress UI
-            state.ramp += rampIncrement;
-            if (state.ramp >= 1.0f)
-                state.ramp = std::fmod (state.ramp, 1.0f);
-
-            // Independent per-axis ramps — each advances at its own rate
-            state.rampX += rampIncrement * rateX;
-            if (state.rampX >= 1.0f) state.rampX = std::fmod (state.rampX, 1.0f);
-
-            state.rampY += rampIncrement * rateY;
-            if (state.rampY >= 1.0f) state.rampY = std::fmod (state.rampY, 1.0f);
-
-            state.rampZ += rampIncrement * rateZ;
-            if (state.rampZ >= 1.0f) state.rampZ = std::fmod (state.rampZ, 1.0f);
-
-            // Phase-adjusted ramps for waveform generation
-            float totalPhaseX = (globalPhase + phaseX) / 360.0f;
-            float totalPhaseY = (globalPhase + phaseY) / 360.0f;
-            float totalPhaseZ = (globalPhase + phaseZ) / 360.0f;
-
-            float rampX = std::fmod (state.rampX + totalPhaseX + 10.0f, 1.0f);
-            float rampY = std::fmod (state.rampY + totalPhaseY + 10.0f, 1.0f);
-            float rampZ = std::fmod (state.rampZ + totalPhaseZ + 10.0f, 1.0f);
-
-            // Generate new random targets when each axis's ramp wraps independently
-            // Wrap detected when current ramp < previous ramp (went from ~1.0 back to ~0.0)
-            if (shapeX == Random && rampX < state.prevRampX)
-            {
-                state.lastRandomX = state.randomTargetX;
-                state.randomTargetX = random.nextFloat() * 2.0f - 1.0f;
-            }
-            if (shapeY == Random && rampY < state.prevRampY)
-            {
-                state.lastRandomY = state.randomTargetY;
-                state.randomTargetY = random.nextFloat() * 2.0f - 1.0f;
-            }
-            if (shapeZ == Random && rampZ < state.prevRampZ)
-            {
-                state.lastRandomZ = state.randomTargetZ;
-                state.randomTargetZ = random.nextFloat() * 2.0f - 1.0f;
-            }
-
-            // Store current ramps for next frame's wrap detection
-            state.prevRampX = rampX;
-            state.prevRampY = rampY;
-            state.prevRampZ = rampZ;
-
-            // Calculate waveform outputs (-1 to +1)
-            state.normalizedX = applyWaveform (shapeX, rampX, state.lastRandomX, state.randomTargetX);
-            state.normalizedY = applyWaveform (shapeY, rampY, state.lastRandomY, state.randomTargetY);
-            state.normalizedZ = applyWaveform (shapeZ, rampZ, state.lastRandomZ, state.randomTargetZ);
-
-            // Apply amplitude, global fade, and per-axis fade to get final offsets
-            state.offsetX = state.normalizedX * amplitudeX * state.fadeLevel * state.fadeX;
-            state.offsetY = state.normalizedY * amplitudeY * state.fadeLevel * state.fadeY;
-            state.offsetZ = state.normalizedZ * amplitudeZ * state.fadeLevel * state.fadeZ;
-
-            // Gyrophone: rotate brightness cone based on main ramp
-            // Uses main ramp (not per-axis) so rotation completes one full cycle per period
-            // gyrophone: -1 = anti-clockwise, 0 = off, 1 = clockwise
-            if (gyrophone != 0)
-            {
-                // Full rotation (2π) over one period, direction based on gyrophone sign
-                // Negated so positive (clockwise) rotates in positive angular direction
-                state.gyrophoneOffsetRad = static_cast<float> (-gyrophone) * state.ramp
-                                           * juce::MathConstants<float>::twoPi * state.fadeLevel;
-            }
-            else
-            {
-                state.gyrophoneOffsetRad = 0.0f;
-            }
-        }
-        else
-        {
-            // Fully faded out - reset offsets
-            state.offsetX = 0.0f;
-            state.offsetY = 0.0f;
-            state.offsetZ = 0.0f;
-            state.gyrophoneOffsetRad = 0.0f;
-            state.normalizedX = 0.0f;
-            state.normalizedY = 0.0f;
-            state.normalizedZ = 0.0f;
-        }
-
-        state.wasActive = isActive;
+        LFOEngine::VoiceParams p;
+        p.active = static_cast<int> (lfoSection.getProperty (inputLFOactive, 0)) != 0;
+        p.period = static_cast<float> (lfoSection.getProperty (inputLFOperiod, 5.0f));
+        p.globalPhase = static_cast<int> (lfoSection.getProperty (inputLFOphase, 0));
+
+        p.shape[AxisX] = static_cast<int> (lfoSection.getProperty (inputLFOshapeX, 0));
+        p.shape[AxisY] = static_cast<int> (lfoSection.getProperty (inputLFOshapeY, 0));
+        p.shape[AxisZ] = static_cast<int> (lfoSection.getProperty (inputLFOshapeZ, 0));
+
+        p.rate[AxisX] = static_cast<float> (lfoSection.getProperty (inputLFOrateX, 1.0f));
+        p.rate[AxisY] = static_cast<float> (lfoSection.getProperty (inputLFOrateY, 1.0f));
+        p.rate[AxisZ] = static_cast<float> (lfoSection.getProperty (inputLFOrateZ, 1.0f));
+
+        p.amplitude[AxisX] = static_cast<float> (lfoSection.getProperty (inputLFOamplitudeX, 1.0f));
+        p.amplitude[AxisY] = static_cast<float> (lfoSection.getProperty (inputLFOamplitudeY, 1.0f));
+        p.amplitude[AxisZ] = static_cast<float> (lfoSection.getProperty (inputLFOamplitudeZ, 1.0f));
+
+        p.phase[AxisX] = static_cast<int> (lfoSection.getProperty (inputLFOphaseX, 0));
+        p.phase[AxisY] = static_cast<int> (lfoSection.getProperty (inputLFOphaseY, 0));
+        p.phase[AxisZ] = static_cast<int> (lfoSection.getProperty (inputLFOphaseZ, 0));
+
+        engine.setVoiceParams (inputIndex, p);
+
+        // Gyrophone: -1 = Anti-Clockwise, 0 = OFF, 1 = Clockwise.
+        // Negated so positive (clockwise) rotates in positive angular direction
+        const int gyrophone = static_cast<int> (lfoSection.getProperty (inputLFOgyrophone, 0));
+        gyrophoneScale[static_cast<size_t> (inputIndex)] = static_cast<float> (-gyrophone)
+                                                          * juce::MathConstants<float>::twoPi;
     }
 
     //==========================================================================
-    // Waveform Generation (delegated to shared LFOWaveforms utility)
+    // ValueTree::Listener
     //==========================================================================
-    float applyWaveform (int shape, float ramp, float lastRandom, float targetRandom) const
+    void valueTreePropertyChanged (juce::ValueTree& tree, const juce::Identifier&) override
     {
-        return LFOWaveforms::applyWaveform (shape, ramp, lastRandom, targetRandom);
+        if (tree.getType() != WFSParameterIDs::LFO)
+            return;
+
+        auto input = tree.getParent();
+        if (input.getType() != WFSParameterIDs::Input)
+            return;
+
+        const int inputIndex = input.getParent().indexOf (input);
+        if (inputIndex < 0 || inputIndex >= numInputChannels)
+            return;
+
+        inputDirty[static_cast<size_t> (inputIndex)].store (true, std::memory_order_relaxed);
+        anyDirty.store (true, std::memory_order_release);
     }
 
+    // Channel count change or config reload
+    void valueTreeChildAdded (juce::ValueTree&, juce::ValueTree&) override        { markAllDirty(); }
+    void valueTreeChildRemoved (juce::ValueTree&, juce::ValueTree&, int) override { markAllDirty(); }
+
     //==========================================================================
     // Member Variables
     //==========================================================================
     WFSValueTreeState& valueTreeState;
     int numInputChannels;
-    std::vector<LFOState> states;
-    juce::Random random;
+    LFOEngine engine;
+
+    std::vector<float> gyrophoneScale;      // -direction * 2π per input
+    std::vector<float> gyrophoneOffsetRad;
+
+    std::unique_ptr<std::atomic<bool>[]> inputDirty;
+    std::atomic<bool> anyDirty { true };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LFOProcessor)
 };
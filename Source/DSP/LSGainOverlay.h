@@ -0,0 +1,58 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <algorithm>
+#include <vector>
+
+/**
+ * Sparse Live Source Tamer gains.
+ *
+ * Per input, only the outputs whose gain is not unity (the speakers inside
+ * that input's LS radius), as compressed rows: row i holds entries
+ * [rowStart[i], rowStart[i + 1]), sorted by output. Any pair not listed is 1.0.
+ *
+ * Built by LiveSourceTamerEngine one row per input (add() then endRow()),
+ * and read by WFSCalculationEngine::recalculateMatrix().
+ */
+struct LSGainOverlay
+{
+    std::vector<int> rowStart { 0 };    // numRows + 1 offsets into outputs/gains
+    std::vector<int> outputs;
+    std::vector<float> gains;
+
+    void clear()
+    {
+        rowStart.assign (1, 0);
+        outputs.clear();
+        gains.clear();
+    }
+
+    int getNumRows() const noexcept     { return static_cast<int> (rowStart.size()) - 1; }
+    int getNumEntries() const noexcept  { return static_cast<int> (outputs.size()); }
+
+    /** Append an entry to the current row (outputs in ascending order) */
+    void add (int output, float gain)
+    {
+        outputs.push_back (output);
+        gains.push_back (gain);
+    }
+
+    /** Close the current row; the next add() starts the next input */
+    void endRow()
+    {
+        rowStart.push_back (static_cast<int> (outputs.size()));
+    }
+
+    float getGain (int input, int output) const noexcept
+    {
+        if (input < 0 || input >= getNumRows())
+            return 1.0f;
+
+        const auto first = outputs.begin() + rowStart[static_cast<size_t> (input)];
+        const auto last = outputs.begin() + rowStart[static_cast<size_t> (input) + 1];
+        const auto it = std::lower_bound (first, last, output);
+        if (it == last || *it != output)
+            return 1.0f;
+        return gains[static_cast<size_t> (it - outputs.begin())];
+    }
+};
@@ -4,6 +4,10 @@
 #include "../Parameters/WFSValueTreeState.h"
 #include "../Parameters/WFSParameterIDs.h"
 #include "WFSCalculationEngine.h"
+#include "LSGainOverlay.h"
+#include <algorithm>
+#include <atomic>
+#include <utility>
 #include <vector>
 #include <cmath>
 
@@ -20,12 +24,17 @@
  * Call process() at 50Hz (every 4 timer ticks) to update LS gains.
  * The gains are then applied in WFSCalculationEngine during level calculation.
  *
+ * Speakers are indexed in a uniform XY grid, rebuilt only when an output moves
+ * or its LS enable changes, so each active input only visits the cells its
+ * radius overlaps. Gains are kept sparse (LSGainOverlay): one entry per speaker
+ * inside an input's radius, everything else unity.
+ *
  * Activation conditions:
  * - inputLSactive must be true (master enable per input)
  * - Output must be within inputLSradius of input
  * - outputLSattenEnable must be non-zero (per-output bypass)
  */
-class LiveSourceTamerEngine
+class LiveSourceTamerEngine : private juce::ValueTree::Listener
 {
 public:
     LiveSourceTamerEngine(WFSValueTreeState& state,
@@ -37,14 +46,18 @@ public:
           numInputs(numInputChannels),
           numOutputs(numOutputChannels)
     {
-        // Allocate LS gains array (one per input-output routing)
-        lsGains.resize(static_cast<size_t>(numInputs * numOutputs), 1.0f);
-
         // Initialize ramp state per input (start at 0 = inactive)
         rampProgress.resize(static_cast<size_t>(numInputs), 0.0f);
 
         // Initialize per-input tracking for dirty flag optimization
         wasActiveBeforeProcess.resize(static_cast<size_t>(numInputs), false);
+
+        valueTreeState.addListener(this);
+    }
+
+    ~LiveSourceTamerEngine() override
+    {
+        valueTreeState.removeListener(this);
     }
 
     /**
@@ -67,6 +80,11 @@ public:
         // Ramp increment per process() call: 500ms at 50Hz = 25 ticks
         constexpr float rampIncrement = 1.0f / 25.0f;  // 0.04 per tick
 
+        if (speakersDirty.exchange(false))
+            rebuildSpeakerGrid();
+
+        lsGains.clear();
+
         for (int inIdx = 0; inIdx < numInputs; ++inIdx)
         {
             // Get LS section for this input
@@ -99,14 +117,10 @@ public:
                 }
             }
 
-            // If ramp is 0, no LS effect at all - skip calculations
+            // If ramp is 0, no LS effect at all - empty row
             if (ramp <= 0.0f)
             {
-                for (int outIdx = 0; outIdx < numOutputs; ++outIdx)
-                {
-                    size_t matrixIdx = static_cast<size_t>(inIdx * numOutputs + outIdx);
-                    lsGains[matrixIdx] = 1.0f;
-                }
+                lsGains.endRow();
                 continue;
             }
 
@@ -125,29 +139,18 @@ public:
             float peakGR = (inIdx < static_cast<int>(peakGRs.size())) ? peakGRs[inIdx] : 1.0f;
             float slowGR = (inIdx < static_cast<int>(slowGRs.size())) ? slowGRs[inIdx] : 1.0f;
 
-            // Process each output
-            for (int outIdx = 0; outIdx < numOutputs; ++outIdx)
-            {
-                size_t matrixIdx = static_cast<size_t>(inIdx * numOutputs + outIdx);
-
-                // Check per-output LS enable
-                auto outputOptions = valueTreeState.getOutputOptionsSection(outIdx);
-                int outputLSEnable = outputOptions.getProperty(outputLSattenEnable, 1);
+            float combinedAtten = fixedAttenLinear * peakGR * slowGR;
 
-                if (outputLSEnable == 0)
-                {
-                    // LS bypassed for this output
-                    lsGains[matrixIdx] = 1.0f;
-                    continue;
-                }
-
-                // Get speaker position
-                auto speakerPos = calculationEngine.getSpeakerPosition(outIdx);
+            // Only the LS-enabled speakers in the cells the radius overlaps
+            rowScratch.clear();
+            forEachSpeakerNear(inputPos.x, inputPos.y, radius, [&](int outIdx)
+            {
+                const auto o = static_cast<size_t>(outIdx);
 
                 // Calculate distance from input to speaker
-                float dx = speakerPos.x - inputPos.x;
-                float dy = speakerPos.y - inputPos.y;
-                float dz = speakerPos.z - inputPos.z;
+                float dx = speakerX[o] - inputPos.x;
+                float dy = speakerY[o] - inputPos.y;
+                float dz = speakerZ[o] - inputPos.z;
                 float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
 
                 // Normalize distance by radius
@@ -155,10 +158,7 @@ public:
 
                 // Check if outside radius - no LS effect
                 if (normalizedDist >= 1.0f)
-                {
-                    lsGains[matrixIdx] = 1.0f;
-                    continue;
-                }
+                    return;
 
                 // Calculate shape factor (attenuation amount at this distance)
                 // shapeFactor = 1.0 at center, 0.0 at edge
@@ -170,26 +170,30 @@ public:
                 // Formula: gain = 1.0 - shapeFactor * (1.0 - combinedAtten)
                 //        = shapeFactor * combinedAtten + (1.0 - shapeFactor) * 1.0
                 //        = lerp(1.0, combinedAtten, shapeFactor)
-
-                float combinedAtten = fixedAttenLinear * peakGR * slowGR;
                 float targetGain = 1.0f - shapeFactor * (1.0f - combinedAtten);
 
                 // Apply enable ramp: lerp from 1.0 to targetGain over 500ms
                 float lsGain = 1.0f + ramp * (targetGain - 1.0f);
 
-                lsGains[matrixIdx] = lsGain;
-            }
+                if (lsGain != 1.0f)
+                    rowScratch.emplace_back(outIdx, lsGain);
+            });
+
+            std::sort(rowScratch.begin(), rowScratch.end());
+            for (const auto& entry : rowScratch)
+                lsGains.add(entry.first, entry.second);
+            lsGains.endRow();
         }
     }
 
     /**
-     * Get pointer to LS gains array.
-     * Index: [inputIndex * numOutputs + outputIndex]
+     * Get the sparse LS gains from the last process() call.
+     * One row per input; outputs not listed are unity.
      * Values are linear multipliers (0-1).
      */
-    const float* getLSGains() const
+    const LSGainOverlay& getLSGainOverlay() const
     {
-        return lsGains.data();
+        return lsGains;
     }
 
     /**
@@ -200,7 +204,7 @@ public:
         if (inputIndex >= 0 && inputIndex < numInputs &&
             outputIndex >= 0 && outputIndex < numOutputs)
         {
-            return lsGains[static_cast<size_t>(inputIndex * numOutputs + outputIndex)];
+            return lsGains.getGain(inputIndex, outputIndex);
         }
         return 1.0f;
     }
@@ -248,16 +252,145 @@ public:
     }
 
     /**
-     * Mark positions as dirty (call when input/output positions change).
-     * This doesn't affect LS gains directly since we recalculate every frame,
-     * but can be used to trigger immediate recalculation if needed.
+     * Mark speaker positions as dirty so the grid is rebuilt on the next
+     * process(). Output moves and LS enable changes made through the value
+     * tree are picked up by the listener; input positions are read every
+     * frame and need no call.
      */
     void markPositionsDirty()
     {
-        // Currently we recalculate every process() call, so no caching needed
+        speakersDirty.store(true);
     }
 
 private:
+    //==========================================================================
+    // Speaker grid
+    //==========================================================================
+
+    static constexpr float minCellSize = 0.25f;   // meters
+    static constexpr int maxCellsPerSide = 64;
+
+    /**
+     * Rebuild the grid over the LS-enabled speakers (message thread).
+     * Cell size aims at about one speaker per cell across the rig's larger
+     * extent; Z is left to the exact distance test.
+     */
+    void rebuildSpeakerGrid()
+    {
+        using namespace WFSParameterIDs;
+
+        const auto nOut = static_cast<size_t>(numOutputs);
+        speakerX.assign(nOut, 0.0f);
+        speakerY.assign(nOut, 0.0f);
+        speakerZ.assign(nOut, 0.0f);
+
+        std::vector<int> enabled;
+        enabled.reserve(nOut);
+
+        float minX = 0.0f, maxX = 0.0f, minY = 0.0f, maxY = 0.0f;
+        for (int outIdx = 0; outIdx < numOutputs; ++outIdx)
+        {
+            // Per-output LS enable (0 = LS bypassed for this output)
+            auto outputOptions = valueTreeState.getOutputOptionsSection(outIdx);
+            if (static_cast<int>(outputOptions.getProperty(outputLSattenEnable, 1)) == 0)
+                continue;
+
+            auto pos = calculationEngine.getSpeakerPosition(outIdx);
+            const auto o = static_cast<size_t>(outIdx);
+            speakerX[o] = pos.x;
+            speakerY[o] = pos.y;
+            speakerZ[o] = pos.z;
+
+            if (enabled.empty())
+            {
+                minX = maxX = pos.x;
+                minY = maxY = pos.y;
+            }
+            else
+            {
+                minX = juce::jmin(minX, pos.x);
+                maxX = juce::jmax(maxX, pos.x);
+                minY = juce::jmin(minY, pos.y);
+                maxY = juce::jmax(maxY, pos.y);
+            }
+            enabled.push_back(outIdx);
+        }
+
+        const float extent = juce::jmax(maxX - minX, maxY - minY);
+        const int perSide = juce::jlimit(1, maxCellsPerSide,
+            static_cast<int>(std::ceil(std::sqrt(static_cast<float>(enabled.size())))));
+        gridCellSize = juce::jmax(minCellSize, extent / static_cast<float>(perSide));
+        gridOriginX = minX;
+        gridOriginY = minY;
+        gridCellsX = juce::jlimit(1, maxCellsPerSide, static_cast<int>((maxX - minX) / gridCellSize) + 1);
+        gridCellsY = juce::jlimit(1, maxCellsPerSide, static_cast<int>((maxY - minY) / gridCellSize) + 1);
+
+        // Counting sort of the speakers into cells (cell = y * cellsX + x)
+        std::vector<int> cellOf(enabled.size());
+        gridCellStart.assign(static_cast<size_t>(gridCellsX * gridCellsY + 1), 0);
+        for (size_t k = 0; k < enabled.size(); ++k)
+        {
+            const auto o = static_cast<size_t>(enabled[k]);
+            cellOf[k] = cellIndex(cellCoord(speakerX[o], gridOriginX, gridCellsX),
+                                  cellCoord(speakerY[o], gridOriginY, gridCellsY));
+            ++gridCellStart[static_cast<size_t>(cellOf[k]) + 1];
+        }
+        for (size_t c = 1; c < gridCellStart.size(); ++c)
+            gridCellStart[c] += gridCellStart[c - 1];
+
+        gridSpeakers.assign(enabled.size(), 0);
+        std::vector<int> fill(gridCellStart.begin(), gridCellStart.end() - 1);
+        for (size_t k = 0; k < enabled.size(); ++k)
+            gridSpeakers[static_cast<size_t>(fill[static_cast<size_t>(cellOf[k])]++)] = enabled[k];
+    }
+
+    int cellCoord(float v, float origin, int cells) const
+    {
+        return juce::jlimit(0, cells - 1, static_cast<int>(std::floor((v - origin) / gridCellSize)));
+    }
+
+    int cellIndex(int cx, int cy) const { return cy * gridCellsX + cx; }
+
+    /** Call fn(outputIndex) for every LS-enabled speaker in the cells that the
+        square [x - radius, x + radius] x [y - radius, y + radius] overlaps.
+        Edge cells hold everything beyond the grid, so clamping is exact. */
+    template <typename Fn>
+    void forEachSpeakerNear(float x, float y, float radius, Fn&& fn) const
+    {
+        if (gridSpeakers.empty() || radius <= 0.0f)
+            return;
+
+        const int x0 = cellCoord(x - radius, gridOriginX, gridCellsX);
+        const int x1 = cellCoord(x + radius, gridOriginX, gridCellsX);
+        const int y0 = cellCoord(y - radius, gridOriginY, gridCellsY);
+        const int y1 = cellCoord(y + radius, gridOriginY, gridCellsY);
+
+        for (int cy = y0; cy <= y1; ++cy)
+        {
+            // Cells of one grid row are contiguous in gridSpeakers
+            const int first = gridCellStart[static_cast<size_t>(cellIndex(x0, cy))];
+            const int last = gridCellStart[static_cast<size_t>(cellIndex(x1, cy) + 1)];
+            for (int k = first; k < last; ++k)
+                fn(gridSpeakers[static_cast<size_t>(k)]);
+        }
+    }
+
+    //==========================================================================
+    // ValueTree::Listener
+    //==========================================================================
+    void valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier& property) override
+    {
+        using namespace WFSParameterIDs;
+
+        if (property == outputPositionX || property == outputPositionY ||
+            property == outputPositionZ || property == outputLSattenEnable)
+            speakersDirty.store(true);
+    }
+
+    // Channel count change or config reload
+    void valueTreeChildAdded(juce::ValueTree&, juce::ValueTree&) override        { speakersDirty.store(true); }
+    void valueTreeChildRemoved(juce::ValueTree&, juce::ValueTree&, int) override { speakersDirty.store(true); }
+
     /**
      * Calculate shape factor based on normalized distance and shape type.
      *
@@ -292,8 +425,17 @@ private:
     int numInputs;
     int numOutputs;
 
-    // LS gains per routing [inputIndex * numOutputs + outputIndex]
-    std::vector<float> lsGains;
+    // Sparse LS gains: per input, the speakers inside its radius
+    LSGainOverlay lsGains;
+    std::vector<std::pair<int, float>> rowScratch;
+
+    // Speaker grid over LS-enabled outputs (rebuilt when speakersDirty)
+    std::atomic<bool> speakersDirty { true };
+    std::vector<float> speakerX, speakerY, speakerZ;    // [outputIndex]
+    std::vector<int> gridCellStart;                     // cellsX * cellsY + 1 offsets into gridSpeakers
+    std::vector<int> gridSpeakers;                      // Output indices, by cell
+    float gridOriginX = 0.0f, gridOriginY = 0.0f, gridCellSize = 1.0f;
+    int gridCellsX = 1, gridCellsY = 1;
 
     // Ramp state for smooth enable/disable transition (500ms)
     // 0.0 = fully inactive, 1.0 = fully active
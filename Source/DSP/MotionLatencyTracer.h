@@ -0,0 +1,304 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <vector>
+
+/**
+ * MotionLatencyTracer
+ *
+ * Motion-to-sound latency of position input (tracking receivers and OSC /
+ * Remote position writes), traced per frame through four timestamps:
+ *
+ *   receipt    network thread, when the datagram arrived
+ *   routed     message thread, when the ingest drain applied it
+ *   published  control-rate worker, when a matrix generation consumed it
+ *   applied    audio thread, first block that read that generation's targets
+ *
+ * Receipt is per drained batch rather than per packet (the ingest queues are
+ * spatcore types with no room for a stamp): ReceiptStamp keeps the arrival
+ * time of the oldest packet not yet drained, so the queue stage is measured
+ * pessimistically. The renderer's one-pole smoothing toward the new targets
+ * comes on top of "applied" and is not traced.
+ *
+ * Producers never block or allocate: WFSCalculationEngine pushes consumed
+ * frames (under its recalcLock, so one producer at a time) and the audio
+ * callback pushes applied generations, each into its own SPSC ring. collect()
+ * on the message thread pairs them and feeds per-stage sample windows;
+ * getSnapshot() reports percentiles over the last windowSize samples.
+ */
+class MotionLatencyTracer
+{
+public:
+    /** Arrival stamp for one receiver: markArrival() on the network thread for
+        each packet, takeForDrain() on the message thread for each drained update. */
+    class ReceiptStamp
+    {
+    public:
+        void markArrival() noexcept
+        {
+            juce::int64 expected = 0;
+            pending.compare_exchange_strong (expected, juce::Time::getHighResolutionTicks(),
+                                             std::memory_order_release, std::memory_order_relaxed);
+        }
+
+        juce::int64 takeForDrain() noexcept
+        {
+            if (const auto oldest = pending.exchange (0, std::memory_order_acquire); oldest != 0)
+                current = oldest;
+            return current;
+        }
+
+        /** The stamp takeForDrain() last returned. Message thread. */
+        juce::int64 getDrainTicks() const noexcept { return current; }
+
+    private:
+        std::atomic<juce::int64> pending { 0 };
+        juce::int64 current = 0;    // Message thread: stamp of the batch being drained
+    };
+
+    enum Stage { Queue, Engine, Render, Total, NumStages };
+
+    static constexpr int windowSize = 2048;
+
+    struct StageSummary
+    {
+        int samples = 0;            // In the current window
+        juce::uint64 total = 0;     // Since the last reset
+        double p50Ms = 0.0, p95Ms = 0.0, p99Ms = 0.0, maxMs = 0.0;
+    };
+
+    struct Snapshot
+    {
+        std::array<StageSummary, NumStages> stages;
+        juce::uint64 framesDropped = 0;    // Rings full, applied block lost, or never applied (audio stopped)
+        juce::uint64 appliedDropped = 0;   // Applied generations the audio thread's ring could not take
+    };
+
+    static const char* getStageName (int stage)
+    {
+        static const char* names[] = { "queue", "engine", "render", "total" };
+        return names[juce::jlimit (0, NumStages - 1, stage)];
+    }
+
+    //==========================================================================
+    // Producers
+    //==========================================================================
+
+    /** Engine: a frame consumed by the matrix generation it just published. */
+    void pushFrame (int inputIndex, juce::int64 receiptTicks, juce::int64 routedTicks,
+                    juce::int64 publishedTicks, juce::uint64 generation) noexcept
+    {
+        if (! frames.push ({ inputIndex, receiptTicks, routedTicks, publishedTicks, generation }))
+            dropped.fetch_add (1, std::memory_order_relaxed);
+    }
+
+    /** Audio thread: first block rendered with the targets of this generation. */
+    void pushApplied (juce::uint64 generation, juce::int64 appliedTicks) noexcept
+    {
+        // A generation the full ring could not take goes in later as a loss
+        // marker (ticks 0), ahead of anything newer. Without it its frames
+        // would match the next applied block and inflate render/total.
+        if (lostAppliedGeneration != 0 && applied.push ({ lostAppliedGeneration, 0 }))
+            lostAppliedGeneration = 0;
+
+        if (lostAppliedGeneration != 0 || ! applied.push ({ generation, appliedTicks }))
+        {
+            lostAppliedGeneration = generation;   // Covers every older loss too
+            appliedDropped.fetch_add (1, std::memory_order_relaxed);
+        }
+    }
+
+    //==========================================================================
+    // Consumer
+    //==========================================================================
+
+    /** Pair frames with applied generations and fold them into the windows. Message thread. */
+    void collect()
+    {
+        const juce::ScopedLock sl (consumerLock);
+        collectLocked();
+    }
+
+    Snapshot getSnapshot()
+    {
+        const juce::ScopedLock sl (consumerLock);
+        collectLocked();
+
+        Snapshot snap;
+        snap.framesDropped = dropped.load (std::memory_order_relaxed);
+        snap.appliedDropped = appliedDropped.load (std::memory_order_relaxed);
+        std::vector<float> sorted;
+        for (int s = 0; s < NumStages; ++s)
+        {
+            const auto& w = windows[static_cast<size_t> (s)];
+            auto& out = snap.stages[static_cast<size_t> (s)];
+            out.total = w.total;
+            out.samples = static_cast<int> (juce::jmin<juce::uint64> (w.total, windowSize));
+            if (out.samples == 0)
+                continue;
+
+            sorted.assign (w.samplesMs.begin(), w.samplesMs.begin() + out.samples);
+            std::sort (sorted.begin(), sorted.end());
+            auto pct = [&sorted] (double p)
+            {
+                return static_cast<double> (sorted[static_cast<size_t> (p * static_cast<double> (sorted.size() - 1) + 0.5)]);
+            };
+            out.p50Ms = pct (0.50);
+            out.p95Ms = pct (0.95);
+            out.p99Ms = pct (0.99);
+            out.maxMs = static_cast<double> (sorted.back());
+        }
+        return snap;
+    }
+
+    void reset()
+    {
+        const juce::ScopedLock sl (consumerLock);
+        collectLocked();
+        for (auto& w : windows)
+            w = {};
+        pending.clear();
+        dropped.store (0, std::memory_order_relaxed);
+        appliedDropped.store (0, std::memory_order_relaxed);
+    }
+
+    /** Snapshot as a JSON-ready var: { stages: { queue: {...}, ... }, frames_dropped, applied_dropped }. */
+    juce::var toVar()
+    {
+        const auto snap = getSnapshot();
+        auto stagesObj = std::make_unique<juce::DynamicObject>();
+        for (int s = 0; s < NumStages; ++s)
+        {
+            const auto& st = snap.stages[static_cast<size_t> (s)];
+            auto obj = std::make_unique<juce::DynamicObject>();
+            obj->setProperty ("samples", st.samples);
+            obj->setProperty ("total", static_cast<juce::int64> (st.total));
+            obj->setProperty ("p50_ms", st.p50Ms);
+            obj->setProperty ("p95_ms", st.p95Ms);
+            obj->setProperty ("p99_ms", st.p99Ms);
+            obj->setProperty ("max_ms", st.maxMs);
+            stagesObj->setProperty (getStageName (s), juce::var (obj.release()));
+        }
+
+        auto root = std::make_unique<juce::DynamicObject>();
+        root->setProperty ("window", windowSize);
+        root->setProperty ("stages", juce::var (stagesObj.release()));
+        root->setProperty ("frames_dropped", static_cast<juce::int64> (snap.framesDropped));
+        root->setProperty ("applied_dropped", static_cast<juce::int64> (snap.appliedDropped));
+        return juce::var (root.release());
+    }
+
+    juce::String toJSON() { return juce::JSON::toString (toVar()); }
+
+private:
+    struct Frame
+    {
+        int inputIndex = -1;
+        juce::int64 receiptTicks = 0, routedTicks = 0, publishedTicks = 0;
+        juce::uint64 generation = 0;
+    };
+
+    struct Applied
+    {
+        juce::uint64 generation = 0;
+        juce::int64 ticks = 0;
+    };
+
+    template <typename T, int Capacity>
+    class SpscRing
+    {
+    public:
+        bool push (const T& item) noexcept
+        {
+            const auto w = writePos.load (std::memory_order_relaxed);
+            if (w - readPos.load (std::memory_order_acquire) >= static_cast<size_t> (Capacity))
+                return false;
+            items[w % Capacity] = item;
+            writePos.store (w + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool pop (T& out) noexcept
+        {
+            const auto r = readPos.load (std::memory_order_relaxed);
+            if (r == writePos.load (std::memory_order_acquire))
+                return false;
+            out = items[r % Capacity];
+            readPos.store (r + 1, std::memory_order_release);
+            return true;
+        }
+
+    private:
+        std::array<T, Capacity> items {};
+        alignas (64) std::atomic<size_t> writePos { 0 };
+        alignas (64) std::atomic<size_t> readPos { 0 };
+    };
+
+    struct Window
+    {
+        std::array<float, windowSize> samplesMs {};
+        juce::uint64 total = 0;
+
+        void add (juce::int64 fromTicks, juce::int64 toTicks)
+        {
+            if (fromTicks == 0 || toTicks < fromTicks)
+                return;
+            samplesMs[static_cast<size_t> (total % windowSize)]
+                = static_cast<float> (juce::Time::highResolutionTicksToSeconds (toTicks - fromTicks) * 1000.0);
+            ++total;
+        }
+    };
+
+    static constexpr size_t maxPending = 4096;
+
+    void collectLocked()
+    {
+        Frame f;
+        while (frames.pop (f))
+        {
+            windows[Queue].add (f.receiptTicks, f.routedTicks);
+            windows[Engine].add (f.routedTicks, f.publishedTicks);
+            if (pending.size() >= maxPending)
+            {
+                pending.erase (pending.begin());
+                dropped.fetch_add (1, std::memory_order_relaxed);
+            }
+            pending.push_back (f);
+        }
+
+        // Generations are applied in order, so the first applied generation at
+        // or after a frame's own is the block that made it audible. A loss
+        // marker (ticks 0) means that block is unknown: its frames are
+        // counted as dropped, not matched to a later block.
+        Applied a;
+        while (applied.pop (a))
+        {
+            size_t done = 0;
+            while (done < pending.size() && pending[done].generation <= a.generation)
+            {
+                const auto& p = pending[done++];
+                if (a.ticks == 0)
+                {
+                    dropped.fetch_add (1, std::memory_order_relaxed);
+                    continue;
+                }
+                windows[Render].add (p.publishedTicks, a.ticks);
+                windows[Total].add (p.receiptTicks != 0 ? p.receiptTicks : p.routedTicks, a.ticks);
+            }
+            pending.erase (pending.begin(), pending.begin() + static_cast<std::ptrdiff_t> (done));
+        }
+    }
+
+    SpscRing<Frame, 1024> frames;
+    SpscRing<Applied, 256> applied;
+    std::atomic<juce::uint64> dropped { 0 };
+    std::atomic<juce::uint64> appliedDropped { 0 };
+    juce::uint64 lostAppliedGeneration = 0;    // Audio thread only: loss marker not yet in the ring
+
+    juce::CriticalSection consumerLock;
+    std::vector<Frame> pending;
+    std::array<Window, NumStages> windows;
+};
@@ -1,6 +1,5 @@
 #include "WFSCalculationEngine.h"
 #include "../../spatcore/dsp/NumericGuards.h"
-#include <array>
 #include <limits>
 
 using namespace WFSParameterIDs;
@@ -8,11 +7,17 @@ using namespace WFSParameterDefaults;
 
 //==============================================================================
 WFSCalculationEngine::WFSCalculationEngine (WFSValueTreeState& state)
+    : WFSCalculationEngine (state, maxInputChannels, maxOutputChannels, maxReverbChannels)
+{
+}
+
+WFSCalculationEngine::WFSCalculationEngine (WFSValueTreeState& state,
+                                            int numInputChannels, int numOutputChannels, int numReverbChannels)
     : valueTreeState (state)
 {
-    numInputs = maxInputChannels;
-    numOutputs = maxOutputChannels;
-    numReverbs = maxReverbChannels;
+    numInputs = juce::jmax (1, numInputChannels);
+    numOutputs = juce::jmax (1, numOutputChannels);
+    numReverbs = juce::jmax (1, numReverbChannels);
 
     // Reserve space for positions
     listenerPositions.resize (static_cast<size_t> (numOutputs));
@@ -32,33 +37,78 @@ WFSCalculationEngine::WFSCalculationEngine (WFSValueTreeState& state)
     commonAttenRampOffsetDb.resize (static_cast<size_t> (numInputs), 0.0f);  // Start at 0
     commonAttenRampTimeRemaining.resize (static_cast<size_t> (numInputs), 0.0f);  // No active ramps
 
-    // Reserve space for Input → Output matrix results
+    // Size every published slot, so the first pass seeds from a valid (zero) set
     const size_t matrixSize = static_cast<size_t> (numInputs * numOutputs);
-    delayTimesMs.resize (matrixSize, 0.0f);
-    levels.resize (matrixSize, 0.0f);
-    hfAttenuationDb.resize (matrixSize, 0.0f);
-
-    // Reserve space for Floor Reflection matrix results
-    frDelayTimesMs.resize (matrixSize, 0.0f);
-    frLevels.resize (matrixSize, 0.0f);
-    frHFAttenuationDb.resize (matrixSize, 0.0f);
-
-    // Reserve space for Input → Reverb Feed matrix results
     const size_t inputReverbSize = static_cast<size_t> (numInputs * numReverbs);
-    inputReverbDelayTimesMs.resize (inputReverbSize, 0.0f);
-    inputReverbLevels.resize (inputReverbSize, 0.0f);
-    inputReverbHFAttenuationDb.resize (inputReverbSize, 0.0f);
-
-    // Reserve space for Reverb Return → Output matrix results
     const size_t reverbOutputSize = static_cast<size_t> (numReverbs * numOutputs);
-    reverbOutputDelayTimesMs.resize (reverbOutputSize, 0.0f);
-    reverbOutputLevels.resize (reverbOutputSize, 0.0f);
-    reverbOutputHFAttenuationDb.resize (reverbOutputSize, 0.0f);
+    for (auto& set : matrixSlots)
+    {
+        for (auto* v : { &set.delayTimesMs, &set.delayRatesMsPerS, &set.levels, &set.hfAttenuationDb,
+                         &set.frDelayTimesMs, &set.frLevels, &set.frHFAttenuationDb })
+            v->resize (matrixSize, 0.0f);
+        for (auto* v : { &set.inputReverbDelayTimesMs, &set.inputReverbLevels, &set.inputReverbHFAttenuationDb })
+            v->resize (inputReverbSize, 0.0f);
+        for (auto* v : { &set.reverbOutputDelayTimesMs, &set.reverbOutputLevels, &set.reverbOutputHFAttenuationDb })
+            v->resize (reverbOutputSize, 0.0f);
+    }
 
     // Initialize per-input dirty flags (all dirty initially)
     inputDirtyFlags.resize (static_cast<size_t> (numInputs), true);
+    outputDirtyFlags.resize (static_cast<size_t> (numOutputs), 1);
+
+    // Incremental recompute caches (first pass is full: outputsDirty starts true)
+    for (auto* v : { &rawDelayMs, &rawLevel, &rawAttenuationDb, &rawDistanceAttenDb, &rawAngularAtten })
+        v->resize (matrixSize, 0.0f);
+    rawValidForMinLatency.resize (matrixSize, 0);
+    rawValidForCommonAtten.resize (matrixSize, 0);
+    rawRoutingMuted.resize (matrixSize, 0);
+    rawRowTerms.resize (static_cast<size_t> (numInputs));
+    rawRowValid.resize (static_cast<size_t> (numInputs), 0);
+    rowMinDelay.resize (static_cast<size_t> (numInputs), 0.0f);
+    rowFoundValidOutput.resize (static_cast<size_t> (numInputs), 0);
+    inputCommonAttenAdjustments.resize (static_cast<size_t> (numInputs), 0.0f);
+    appliedLSGains.resize (matrixSize, 1.0f);
+    targetLSGains.resize (matrixSize, 1.0f);
+    lsPairChanged.resize (matrixSize, 0);
+    lsRowChanged.resize (static_cast<size_t> (numInputs), 0);
+
+    // Size the flat parameter mirror (filled by the recalculateAll*Positions() calls below)
+    {
+        const auto nIn = static_cast<size_t> (numInputs);
+        const auto nOut = static_cast<size_t> (numOutputs);
+        const auto nRev = static_cast<size_t> (numReverbs);
+        auto& ip = liveParams.inputs;
+        auto& op = liveParams.outputs;
+        auto& rp = liveParams.reverbs;
+
+        for (auto* v : { &ip.attenuationDb, &ip.delayLatencyMs, &ip.distanceAttenuation, &ip.distanceRatio,
+                         &ip.offsetX, &ip.offsetY, &ip.offsetZ, &ip.hfShelfDb, &ip.sidelinesFringe,
+                         &ip.frAttenuationDb })
+            v->resize (nIn, 0.0f);
+        for (auto* v : { &ip.minimalLatency, &ip.attenuationLaw, &ip.commonAttenPercent, &ip.heightFactorPercent,
+                         &ip.directivityDeg, &ip.rotationDeg, &ip.tiltDeg })
+            v->resize (nIn, 0);
+        for (auto* v : { &ip.flipX, &ip.flipY, &ip.flipZ, &ip.constraintX, &ip.constraintY, &ip.constraintZ,
+                         &ip.muteReverbSends, &ip.sidelinesActive, &ip.frActive })
+            v->resize (nIn, 0);
+        ip.arrayAttenDb.resize (nIn * static_cast<size_t> (numArrayGroups), 0.0f);
+        ip.routingMuted.resize (nIn * nOut, 0);
+
+        for (auto* v : { &op.distanceAttenPercent, &op.hfDamping, &op.delayLatencyMs })
+            v->resize (nOut, 0.0f);
+        for (auto* v : { &op.miniLatencyEnable, &op.frEnable, &op.arrayAssignment })
+            v->resize (nOut, 0);
+        op.angular.resize (nOut);
+
+        for (auto* v : { &rp.hfDamping, &rp.delayLatencyMs, &rp.returnDistanceAttenuation })
+            v->resize (nRev, 0.0f);
+        for (auto* v : { &rp.miniLatencyEnable, &rp.distanceAttenPercent, &rp.returnCommonAttenPercent })
+            v->resize (nRev, 0);
+        rp.feedAngular.resize (nRev);
+        rp.outputMuted.resize (nRev * nOut, 0);
+    }
 
-    // Calculate initial positions
+    // Calculate initial positions (also fills the parameter mirror)
     recalculateAllListenerPositions();
     recalculateAllInputPositions();
     recalculateAllReverbPositions();
@@ -72,6 +122,7 @@ WFSCalculationEngine::WFSCalculationEngine (WFSValueTreeState& state)
 
 WFSCalculationEngine::~WFSCalculationEngine()
 {
+    cancelPendingUpdate();
     valueTreeState.removeListener (this);
 }
 
@@ -121,6 +172,9 @@ WFSCalculationEngine::Position WFSCalculationEngine::getCompositeInputPosition (
 
 void WFSCalculationEngine::recalculateAllListenerPositions()
 {
+    for (int i = 0; i < numOutputs; ++i)
+        refreshOutputParams (i);
+
     const juce::ScopedLock sl (positionLock);
 
     for (int i = 0; i < numOutputs; ++i)
@@ -136,6 +190,10 @@ void WFSCalculationEngine::recalculateAllListenerPositions()
 
 void WFSCalculationEngine::recalculateAllInputPositions()
 {
+    refreshGlobalParams();
+    for (int i = 0; i < numInputs; ++i)
+        refreshInputParams (i);
+
     const juce::ScopedLock sl (positionLock);
 
     for (int i = 0; i < numInputs; ++i)
@@ -167,6 +225,31 @@ void WFSCalculationEngine::markInputDirty(int inputIndex)
     matrixDirty.store(true);
 }
 
+void WFSCalculationEngine::markOutputDirty (int outputIndex)
+{
+    // Only this output's column (and the reverb->output matrix) is recomputed
+    if (outputIndex >= 0 && outputIndex < numOutputs)
+        outputDirtyFlags[static_cast<size_t> (outputIndex)] = 1;
+    matrixDirty.store (true);
+}
+
+WFSCalculationEngine::RecalcStats WFSCalculationEngine::getLastRecalcStats() const
+{
+    const juce::SpinLock::ScopedLockType sl (recalcStatsLock);
+    return lastRecalcStats;
+}
+
+void WFSCalculationEngine::setRecalcWorkers (int numWorkers)
+{
+    const juce::ScopedLock sl (recalcLock);
+    recalcPool.prepare (numWorkers);
+}
+
+int WFSCalculationEngine::getRecalcWorkers() const
+{
+    return recalcPool.getNumWorkers();
+}
+
 //==============================================================================
 // LFO Offset Support
 //==============================================================================
@@ -285,6 +368,94 @@ WFSCalculationEngine::GradientMapOffsets WFSCalculationEngine::getGradientMapOff
     return gradientMapOffsets[static_cast<size_t> (inputIndex)];
 }
 
+//==============================================================================
+// Tracked Offset Fast Path
+//==============================================================================
+
+void WFSCalculationEngine::setTrackedOffset (int inputIndex, float x, float y, float z,
+                                             juce::int64 receiptTicks, juce::int64 routedTicks)
+{
+    if (inputIndex < 0 || inputIndex >= static_cast<int> (trackedOffsets.size()))
+        return;
+
+    auto& slot = trackedOffsets[static_cast<size_t> (inputIndex)];
+    const auto seq = slot.sequence.load (std::memory_order_relaxed);
+    slot.sequence.store (seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence (std::memory_order_release);
+    slot.x.store (x, std::memory_order_relaxed);
+    slot.y.store (y, std::memory_order_relaxed);
+    slot.z.store (z, std::memory_order_relaxed);
+    slot.receiptTicks.store (receiptTicks, std::memory_order_relaxed);
+    slot.routedTicks.store (routedTicks, std::memory_order_relaxed);
+    slot.active.store (true, std::memory_order_relaxed);
+    slot.sequence.store (seq + 2, std::memory_order_release);
+
+    slot.fresh.store (true, std::memory_order_release);
+    matrixDirty.store (true);
+}
+
+void WFSCalculationEngine::releaseTrackedOffset (int inputIndex)
+{
+    if (inputIndex < 0 || inputIndex >= static_cast<int> (trackedOffsets.size()))
+        return;
+
+    auto& slot = trackedOffsets[static_cast<size_t> (inputIndex)];
+    const auto seq = slot.sequence.load (std::memory_order_relaxed);
+    slot.sequence.store (seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence (std::memory_order_release);
+    slot.active.store (false, std::memory_order_relaxed);
+    slot.receiptTicks.store (0, std::memory_order_relaxed);
+    slot.routedTicks.store (0, std::memory_order_relaxed);
+    slot.sequence.store (seq + 2, std::memory_order_release);
+
+    // Recompute once against the ValueTree offset the fast path committed
+    slot.fresh.store (true, std::memory_order_release);
+    matrixDirty.store (true);
+}
+
+void WFSCalculationEngine::notePositionFrame (int inputIndex, juce::int64 receiptTicks, juce::int64 routedTicks)
+{
+    if (inputIndex < 0 || inputIndex >= static_cast<int> (trackedOffsets.size()))
+        return;
+
+    auto& slot = trackedOffsets[static_cast<size_t> (inputIndex)];
+    const auto seq = slot.sequence.load (std::memory_order_relaxed);
+    slot.sequence.store (seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence (std::memory_order_release);
+    slot.receiptTicks.store (receiptTicks, std::memory_order_relaxed);
+    slot.routedTicks.store (routedTicks, std::memory_order_relaxed);
+    slot.sequence.store (seq + 2, std::memory_order_release);
+    slot.fresh.store (true, std::memory_order_release);
+}
+
+WFSCalculationEngine::TrackedOffsetRead WFSCalculationEngine::readTrackedOffset (int inputIndex)
+{
+    TrackedOffsetRead read;
+    if (inputIndex < 0 || inputIndex >= static_cast<int> (trackedOffsets.size()))
+        return read;
+
+    auto& slot = trackedOffsets[static_cast<size_t> (inputIndex)];
+    read.fresh = slot.fresh.exchange (false, std::memory_order_acq_rel);
+
+    for (;;)
+    {
+        const auto before = slot.sequence.load (std::memory_order_acquire);
+        if ((before & 1u) != 0)
+            continue;   // Writer mid-update (a handful of stores)
+
+        read.active = slot.active.load (std::memory_order_relaxed);
+        read.x = slot.x.load (std::memory_order_relaxed);
+        read.y = slot.y.load (std::memory_order_relaxed);
+        read.z = slot.z.load (std::memory_order_relaxed);
+        read.receiptTicks = slot.receiptTicks.load (std::memory_order_relaxed);
+        read.routedTicks = slot.routedTicks.load (std::memory_order_relaxed);
+
+        std::atomic_thread_fence (std::memory_order_acquire);
+        if (slot.sequence.load (std::memory_order_relaxed) == before)
+            return read;
+    }
+}
+
 //==============================================================================
 // Speed-Limited Position Support
 //==============================================================================
@@ -435,13 +606,13 @@ void WFSCalculationEngine::updateInputPosition (int inputIndex)
     input.z = positionSection.getProperty (inputPositionZ, 0.0f);
 }
 
-void WFSCalculationEngine::applyCompositeConstraints (Position& pos, const juce::ValueTree& posSection) const
+void WFSCalculationEngine::applyCompositeConstraints (Position& pos, int inputIndex) const
 {
     constexpr float absoluteLimit = 50.0f;  // Maximum ±50m for any axis
 
-    // Get stage bounds from stage state
-    auto stageState = valueTreeState.getStageState();
-    if (! stageState.isValid())
+    // Stage bounds come from the parameter mirror (see refreshGlobalParams())
+    const auto& g = calcParams.global;
+    if (! g.stageValid)
     {
         // Fallback: just apply absolute limits
         pos.x = juce::jlimit (-absoluteLimit, absoluteLimit, pos.x);
@@ -450,47 +621,28 @@ void WFSCalculationEngine::applyCompositeConstraints (Position& pos, const juce:
         return;
     }
 
-    int currentStageShape = stageState.getProperty (WFSParameterIDs::stageShape, 0);
-    float halfWidth = (currentStageShape == 0)
-        ? static_cast<float> (stageState.getProperty (WFSParameterIDs::stageWidth, 20.0f)) / 2.0f
-        : static_cast<float> (stageState.getProperty (WFSParameterIDs::stageDiameter, 20.0f)) / 2.0f;
-    float halfDepth = (currentStageShape == 0)
-        ? static_cast<float> (stageState.getProperty (WFSParameterIDs::stageDepth, 20.0f)) / 2.0f
-        : static_cast<float> (stageState.getProperty (WFSParameterIDs::stageDiameter, 20.0f)) / 2.0f;
-    float stageHeightVal = static_cast<float> (stageState.getProperty (WFSParameterIDs::stageHeight, 10.0f));
-    float originW = static_cast<float> (stageState.getProperty (WFSParameterIDs::originWidth, 0.0f));
-    float originD = static_cast<float> (stageState.getProperty (WFSParameterIDs::originDepth, 0.0f));
-    float originH = static_cast<float> (stageState.getProperty (WFSParameterIDs::originHeight, 0.0f));
-
-    // Calculate stage bounds
-    float minX = -halfWidth - originW;
-    float maxX = halfWidth - originW;
-    float minY = -halfDepth - originD;
-    float maxY = halfDepth - originD;
-    float minZ = -originH;
-    float maxZ = stageHeightVal - originH;
-
     // Check constraint toggles from input's position section
-    bool constraintX = static_cast<int> (posSection.getProperty (inputConstraintX, 1)) != 0;
-    bool constraintY = static_cast<int> (posSection.getProperty (inputConstraintY, 1)) != 0;
-    bool constraintZ = static_cast<int> (posSection.getProperty (inputConstraintZ, 1)) != 0;
+    const auto i = static_cast<size_t> (inputIndex);
+    bool constraintX = calcParams.inputs.constraintX[i] != 0;
+    bool constraintY = calcParams.inputs.constraintY[i] != 0;
+    bool constraintZ = calcParams.inputs.constraintZ[i] != 0;
 
     // Apply X constraint (stage bounds if enabled, always absolute limit).
     // safeClamp tolerates non-finite stage geometry (e.g. NaN stageWidth
     // loaded from a corrupted config file) — passes value through rather
     // than tripping jlimit's bounds assert.
     if (constraintX)
-        pos.x = WFSHelpers::safeClamp (minX, maxX, pos.x);
+        pos.x = WFSHelpers::safeClamp (g.minX, g.maxX, pos.x);
     pos.x = juce::jlimit (-absoluteLimit, absoluteLimit, pos.x);
 
     // Apply Y constraint (stage bounds if enabled, always absolute limit)
     if (constraintY)
-        pos.y = WFSHelpers::safeClamp (minY, maxY, pos.y);
+        pos.y = WFSHelpers::safeClamp (g.minY, g.maxY, pos.y);
     pos.y = juce::jlimit (-absoluteLimit, absoluteLimit, pos.y);
 
     // Apply Z constraint (stage bounds if enabled, always absolute limit)
     if (constraintZ)
-        pos.z = WFSHelpers::safeClamp (minZ, maxZ, pos.z);
+        pos.z = WFSHelpers::safeClamp (g.minZ, g.maxZ, pos.z);
     pos.z = juce::jlimit (-absoluteLimit, absoluteLimit, pos.z);
 
     // Apply radius constraint (always enforce 50m max)
@@ -528,6 +680,9 @@ WFSCalculationEngine::Position WFSCalculationEngine::getReverbReturnPosition (in
 
 void WFSCalculationEngine::recalculateAllReverbPositions()
 {
+    for (int i = 0; i < numReverbs; ++i)
+        refreshReverbParams (i);
+
     const juce::ScopedLock sl (positionLock);
 
     for (int i = 0; i < numReverbs; ++i)
@@ -590,76 +745,46 @@ float WFSCalculationEngine::distance3D (const Position& a, const Position& b)
 
 bool WFSCalculationEngine::isRoutingMuted (int inputIndex, int outputIndex) const
 {
-    auto mutesSection = valueTreeState.getInputMutesSection (inputIndex);
-    if (! mutesSection.isValid())
+    if (outputIndex < 0 || outputIndex >= numOutputs)
         return false;
 
-    juce::String mutesStr = mutesSection.getProperty (inputMutes).toString();
-    juce::StringArray mutesArray;
-    mutesArray.addTokens (mutesStr, ",", "");
-
-    if (outputIndex >= 0 && outputIndex < mutesArray.size())
-    {
-        return mutesArray[outputIndex].getIntValue() != 0;
-    }
-
-    return false;
+    return calcParams.inputs.routingMuted[static_cast<size_t> (inputIndex * numOutputs + outputIndex)] != 0;
 }
 
 float WFSCalculationEngine::calculateSidelineAttenuation (int inputIndex, const Position& inputPos) const
 {
-    // Get sidelines parameters from Mutes section
-    auto mutesSection = valueTreeState.getInputMutesSection (inputIndex);
-    if (! mutesSection.isValid())
-        return 1.0f;
-
-    int sidelinesActive = mutesSection.getProperty (inputSidelinesActive, 0);
-    if (sidelinesActive == 0)
+    const auto i = static_cast<size_t> (inputIndex);
+    if (calcParams.inputs.sidelinesActive[i] == 0)
         return 1.0f;  // Sidelines disabled - no attenuation
 
-    float fringeSize = static_cast<float> (mutesSection.getProperty (inputSidelinesFringe, 1.0f));
+    float fringeSize = calcParams.inputs.sidelinesFringe[i];
 
-    // Get stage parameters
-    auto stageState = valueTreeState.getStageState();
-    if (! stageState.isValid())
+    // Stage edges come from the parameter mirror (see refreshGlobalParams())
+    const auto& g = calcParams.global;
+    if (! g.stageValid)
         return 1.0f;
 
-    int currentStageShape = stageState.getProperty (WFSParameterIDs::stageShape, 0);
-    float originW = static_cast<float> (stageState.getProperty (originWidth, 0.0f));
-    float originD = static_cast<float> (stageState.getProperty (originDepth, -5.0f));
-
     float distanceFromEdge = 0.0f;
 
-    if (currentStageShape == 0)  // Box stage
+    if (g.stageShape == 0)  // Box stage
     {
-        float stageW = static_cast<float> (stageState.getProperty (WFSParameterIDs::stageWidth, 20.0f));
-        float stageD = static_cast<float> (stageState.getProperty (WFSParameterIDs::stageDepth, 10.0f));
-
-        // Calculate stage bounds in origin-relative coordinates
-        float leftEdge = -stageW / 2.0f - originW;
-        float rightEdge = stageW / 2.0f - originW;
-        float upstageEdge = stageD / 2.0f - originD;  // Back (positive Y)
-        // Downstage edge is NOT included (front toward audience)
-
         // Calculate minimum distance to any relevant edge (left, right, upstage)
-        float distToLeft = inputPos.x - leftEdge;
-        float distToRight = rightEdge - inputPos.x;
-        float distToUpstage = upstageEdge - inputPos.y;
+        // Downstage edge is NOT included (front toward audience)
+        float distToLeft = inputPos.x - g.leftEdge;
+        float distToRight = g.rightEdge - inputPos.x;
+        float distToUpstage = g.upstageEdge - inputPos.y;
 
         distanceFromEdge = juce::jmin (distToLeft, distToRight, distToUpstage);
     }
     else  // Cylinder (1) or Dome (2) - radial distance
     {
-        float stageDiam = static_cast<float> (stageState.getProperty (WFSParameterIDs::stageDiameter, 20.0f));
-        float stageRadius = stageDiam / 2.0f;
-
         // Calculate radial distance from stage center
-        float dx = inputPos.x + originW;  // Offset to center
-        float dy = inputPos.y + originD;
+        float dx = inputPos.x + g.originWidth;  // Offset to center
+        float dy = inputPos.y + g.originDepth;
         float radialDistance = std::sqrt (dx * dx + dy * dy);
 
         // Distance from circular edge
-        distanceFromEdge = stageRadius - radialDistance;
+        distanceFromEdge = g.radius - radialDistance;
     }
 
     // Apply fringe zone logic
@@ -693,60 +818,44 @@ float WFSCalculationEngine::calculateSidelineAttenuation (int inputIndex, const
 
 bool WFSCalculationEngine::isInputReverbMuted (int inputIndex) const
 {
-    // Check if inputMuteReverbSends is enabled for this input
-    auto mutesSection = valueTreeState.getInputMutesSection (inputIndex);
-    if (! mutesSection.isValid())
-        return false;
-
-    int muteReverbSends = mutesSection.getProperty (inputMuteReverbSends, 0);
-    return muteReverbSends != 0;
+    // inputMuteReverbSends for this input
+    return calcParams.inputs.muteReverbSends[static_cast<size_t> (inputIndex)] != 0;
 }
 
 bool WFSCalculationEngine::isReverbOutputMuted (int reverbIndex, int outputIndex) const
 {
-    // Check reverbMutes array for this reverb->output pair
-    auto returnSection = valueTreeState.getReverbReturnSection (reverbIndex);
-    if (! returnSection.isValid())
+    // reverbMutes entry for this reverb->output pair
+    if (outputIndex < 0 || outputIndex >= numOutputs)
         return false;
 
-    juce::String mutesStr = returnSection.getProperty (reverbMutes).toString();
-    juce::StringArray mutesArray;
-    mutesArray.addTokens (mutesStr, ",", "");
-
-    if (outputIndex >= 0 && outputIndex < mutesArray.size())
-    {
-        return mutesArray[outputIndex].getIntValue() != 0;
-    }
-
-    return false;
+    return calcParams.reverbs.outputMuted[static_cast<size_t> (reverbIndex * numOutputs + outputIndex)] != 0;
 }
 
 //==============================================================================
 // Angular Attenuation
 //==============================================================================
 
-float WFSCalculationEngine::calculateAngularAttenuation (int /*inputIndex*/, int outputIndex,
-                                                          const Position& inputPos,
-                                                          const Position& speakerPos) const
+void WFSCalculationEngine::AngularZones::resize (size_t n)
 {
-    // Get output parameters
-    auto positionSection = valueTreeState.getOutputPositionSection (outputIndex);
-
-    int orientationDeg = positionSection.getProperty (outputOrientation, 0);
-    int pitchDeg = positionSection.getProperty (outputPitch, outputPitchDefault);
-    int angleOnDeg = positionSection.getProperty (outputAngleOn, outputAngleOnDefault);
-    int angleOffDeg = positionSection.getProperty (outputAngleOff, outputAngleOffDefault);
+    alwaysOn.resize (n, 1);
+    rearX.resize (n, 0.0f);
+    rearY.resize (n, 0.0f);
+    rearZ.resize (n, 0.0f);
+    angleOnRad.resize (n, 0.0f);
+    muteAngleRad.resize (n, 0.0f);
+}
 
+void WFSCalculationEngine::AngularZones::set (size_t idx, int orientationDeg, int pitchDeg,
+                                              int angleOnDeg, int angleOffDeg)
+{
     // Optimization: if angleOn >= 90°, all inputs are in the "on" zone
     // (hemisphere behind speaker) - skip angular calculation
-    if (angleOnDeg >= 90)
-        return 1.0f;
+    alwaysOn[idx] = angleOnDeg >= 90 ? 1 : 0;
 
     // Convert to radians
     constexpr float degToRad = juce::MathConstants<float>::pi / 180.0f;
     float orientationRad = static_cast<float> (orientationDeg) * degToRad;
     float pitchRad = static_cast<float> (pitchDeg) * degToRad;
-    float angleOnRad = static_cast<float> (angleOnDeg) * degToRad;
     float angleOffRad = static_cast<float> (angleOffDeg) * degToRad;
 
     // Calculate speaker's rear axis direction vector
@@ -762,14 +871,19 @@ float WFSCalculationEngine::calculateAngularAttenuation (int /*inputIndex*/, int
     // With orientation rotation: positive angles point right (clockwise from above)
     // rear = (-sin(orientation), cos(orientation), 0) for pitch=0
     // With pitch: z component from pitch, xy components scaled by cos(pitch)
-    float rearDirX = -cosPitch * std::sin (orientationRad);
-    float rearDirY = cosPitch * std::cos (orientationRad);
-    float rearDirZ = sinPitch;
+    rearX[idx] = -cosPitch * std::sin (orientationRad);
+    rearY[idx] = cosPitch * std::cos (orientationRad);
+    rearZ[idx] = sinPitch;
+
+    angleOnRad[idx] = static_cast<float> (angleOnDeg) * degToRad;
+    muteAngleRad[idx] = juce::MathConstants<float>::pi - angleOffRad;
+}
+
+float WFSCalculationEngine::AngularZones::attenuation (size_t idx, float dx, float dy, float dz) const
+{
+    if (alwaysOn[idx] != 0)
+        return 1.0f;
 
-    // Vector from speaker to input
-    float dx = inputPos.x - speakerPos.x;
-    float dy = inputPos.y - speakerPos.y;
-    float dz = inputPos.z - speakerPos.z;
     float distance = std::sqrt (dx * dx + dy * dy + dz * dz);
 
     // Avoid division by zero
@@ -777,7 +891,7 @@ float WFSCalculationEngine::calculateAngularAttenuation (int /*inputIndex*/, int
         return 1.0f;  // Input at speaker position - full contribution
 
     // Dot product between rear axis and input direction (normalized)
-    float dotProduct = (dx * rearDirX + dy * rearDirY + dz * rearDirZ) / distance;
+    float dotProduct = (dx * rearX[idx] + dy * rearY[idx] + dz * rearZ[idx]) / distance;
 
     // Clamp to valid range for acos
     dotProduct = juce::jlimit (-1.0f, 1.0f, dotProduct);
@@ -790,100 +904,122 @@ float WFSCalculationEngine::calculateAngularAttenuation (int /*inputIndex*/, int
     // angle >= (π - angleOff): muted (0.0)
     // In between: linear interpolation
 
-    if (angle <= angleOnRad)
+    const float onAngle = angleOnRad[idx];
+    if (angle <= onAngle)
         return 1.0f;
 
-    float muteAngle = juce::MathConstants<float>::pi - angleOffRad;
-
+    const float muteAngle = muteAngleRad[idx];
     if (angle >= muteAngle)
         return 0.0f;
 
     // Linear interpolation in transition zone
-    float transitionWidth = muteAngle - angleOnRad;
+    float transitionWidth = muteAngle - onAngle;
     if (transitionWidth <= 0.0f)
         return 1.0f;  // No transition zone
 
-    float progress = (angle - angleOnRad) / transitionWidth;
+    float progress = (angle - onAngle) / transitionWidth;
     return 1.0f - progress;
 }
 
+float WFSCalculationEngine::calculateAngularAttenuation (int /*inputIndex*/, int outputIndex,
+                                                          const Position& inputPos,
+                                                          const Position& speakerPos) const
+{
+    // Vector from speaker to input
+    return calcParams.outputs.angular.attenuation (static_cast<size_t> (outputIndex),
+                                             inputPos.x - speakerPos.x,
+                                             inputPos.y - speakerPos.y,
+                                             inputPos.z - speakerPos.z);
+}
+
 float WFSCalculationEngine::calculateReverbFeedAngularAttenuation (int /*inputIndex*/, int reverbIndex,
                                                                     const Position& inputPos,
                                                                     const Position& reverbFeedPos) const
 {
-    // Get reverb feed parameters (similar to output but from reverb feed section)
-    auto feedSection = valueTreeState.getReverbFeedSection (reverbIndex);
-
-    int orientationDeg = feedSection.getProperty (reverbOrientation, reverbOrientationDefault);
-    int pitchDeg = feedSection.getProperty (reverbPitch, reverbPitchDefault);
-    int angleOnDeg = feedSection.getProperty (reverbAngleOn, reverbAngleOnDefault);
-    int angleOffDeg = feedSection.getProperty (reverbAngleOff, reverbAngleOffDefault);
-
-    // Optimization: if angleOn >= 90°, all inputs are in the "on" zone
-    if (angleOnDeg >= 90)
-        return 1.0f;
-
-    // Convert to radians
-    constexpr float degToRad = juce::MathConstants<float>::pi / 180.0f;
-    float orientationRad = static_cast<float> (orientationDeg) * degToRad;
-    float pitchRad = static_cast<float> (pitchDeg) * degToRad;
-    float angleOnRad = static_cast<float> (angleOnDeg) * degToRad;
-    float angleOffRad = static_cast<float> (angleOffDeg) * degToRad;
-
-    // Calculate rear axis direction vector (same logic as output angular attenuation)
-    // Positive orientation angles point right (clockwise from above)
-    float cosPitch = std::cos (pitchRad);
-    float sinPitch = std::sin (pitchRad);
-
-    float rearDirX = -cosPitch * std::sin (orientationRad);
-    float rearDirY = cosPitch * std::cos (orientationRad);
-    float rearDirZ = sinPitch;
-
-    // Vector from reverb feed to input
-    float dx = inputPos.x - reverbFeedPos.x;
-    float dy = inputPos.y - reverbFeedPos.y;
-    float dz = inputPos.z - reverbFeedPos.z;
-    float distance = std::sqrt (dx * dx + dy * dy + dz * dz);
+    // Same zones as output angular attenuation, from the reverb feed parameters
+    return calcParams.reverbs.feedAngular.attenuation (static_cast<size_t> (reverbIndex),
+                                                 inputPos.x - reverbFeedPos.x,
+                                                 inputPos.y - reverbFeedPos.y,
+                                                 inputPos.z - reverbFeedPos.z);
+}
 
-    if (distance < 0.001f)
-        return 1.0f;
+bool WFSCalculationEngine::recalculateMatrixIfDirty (const LSGainOverlay* lsGains)
+{
+    if (!matrixDirty.load())
+        return false;
 
-    // Dot product between rear axis and input direction
-    float dotProduct = (dx * rearDirX + dy * rearDirY + dz * rearDirZ) / distance;
-    dotProduct = juce::jlimit (-1.0f, 1.0f, dotProduct);
+    recalculateMatrix (lsGains);
+    return true;
+}
 
-    float angle = std::acos (dotProduct);
+void WFSCalculationEngine::applyLSGainOverlay (const LSGainOverlay* overlay)
+{
+    const auto nOut = static_cast<size_t> (numOutputs);
 
-    if (angle <= angleOnRad)
-        return 1.0f;
+    auto forEachEntry = [this, nOut] (const LSGainOverlay& o, auto&& fn)
+    {
+        const int rows = juce::jmin (o.getNumRows(), numInputs);
+        for (int in = 0; in < rows; ++in)
+        {
+            for (int k = o.rowStart[static_cast<size_t> (in)]; k < o.rowStart[static_cast<size_t> (in) + 1]; ++k)
+            {
+                const int out = o.outputs[static_cast<size_t> (k)];
+                if (out >= 0 && out < numOutputs)
+                    fn (in, static_cast<size_t> (in) * nOut + static_cast<size_t> (out), o.gains[static_cast<size_t> (k)]);
+            }
+        }
+    };
 
-    float muteAngle = juce::MathConstants<float>::pi - angleOffRad;
+    auto flagIfMoved = [this] (int in, size_t idx, float)
+    {
+        if (lsPairChanged[idx] == 0 && targetLSGains[idx] != appliedLSGains[idx])
+        {
+            lsPairChanged[idx] = 1;
+            lsRowChanged[static_cast<size_t> (in)] = 1;
+            lsChangedPairs.push_back (idx);
+        }
+    };
 
-    if (angle >= muteAngle)
-        return 0.0f;
+    // Pairs that left an input's radius go back to unity
+    forEachEntry (targetLSOverlay, [this] (int, size_t idx, float) { targetLSGains[idx] = 1.0f; });
 
-    float transitionWidth = muteAngle - angleOnRad;
-    if (transitionWidth <= 0.0f)
-        return 1.0f;
+    if (overlay != nullptr)
+        forEachEntry (*overlay, [this] (int, size_t idx, float gain) { targetLSGains[idx] = gain; });
 
-    float progress = (angle - angleOnRad) / transitionWidth;
-    return 1.0f - progress;
+    forEachEntry (targetLSOverlay, flagIfMoved);
+    if (overlay != nullptr)
+    {
+        forEachEntry (*overlay, flagIfMoved);
+        targetLSOverlay = *overlay;
+    }
+    else
+    {
+        targetLSOverlay.clear();
+    }
 }
 
-bool WFSCalculationEngine::recalculateMatrixIfDirty (const float* lsGains)
+void WFSCalculationEngine::recalculateMatrix (const LSGainOverlay* lsGains)
 {
-    if (!matrixDirty.load())
-        return false;
+    // The control-rate worker and message-thread callers (config reload,
+    // channel count change) may both get here
+    const juce::ScopedLock recalcSl (recalcLock);
 
-    recalculateMatrix (lsGains);
-    return true;
-}
+    // A channel add/remove is waiting for its coalesced mirror refresh: when we
+    // are on the message thread, run it now rather than recalculating stale
+    if (isUpdatePending() && juce::MessageManager::existsAndIsCurrentThread())
+        handleUpdateNowIfNeeded();
 
-void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
-{
     // Clear dirty flag at start (any new changes during calc will set it again)
     matrixDirty.store(false);
 
+    // Take a private copy of the parameter mirror if it changed since last pass
+    syncCalcParams();
+
+    // All per-channel parameters below come from the calculation's copy
+    const auto& ip = calcParams.inputs;
+    const auto& op = calcParams.outputs;
+    const auto& rp = calcParams.reverbs;
+
     // Copy positions under lock and determine which inputs need recalculation
     std::vector<Position> localInputPositions;
     std::vector<Position> localSpeakerPositions;
@@ -893,6 +1029,7 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
     std::vector<float> localGyrophoneOffsets;  // Gyrophone rotation offsets per input
     std::vector<GradientMapOffsets> localGradientMapOffsets;  // Gradient map parameter offsets per input
     std::vector<bool> inputsToRecalc;
+    std::vector<uint8_t> columnsToRecalc;
 
     // Delay mode ramp state (for smooth transitions when toggling inputMinimalLatency)
     std::vector<int> localPreviousMode;
@@ -903,8 +1040,13 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
     std::vector<float> localCommonAttenRampOffsetDb;
     std::vector<float> localCommonAttenRampTimeRemaining;
 
+    // Tracked offsets from the tracking fast path (lock-free, outside positionLock)
+    std::vector<TrackedOffsetRead> localTracked (static_cast<size_t> (numInputs));
+    for (int i = 0; i < numInputs; ++i)
+        localTracked[static_cast<size_t> (i)] = readTrackedOffset (i);
+
     // Capture dirty state and clear flags
-    bool needOutputRecalc = outputsDirty.exchange(false);
+    const bool allColumnsDirty = outputsDirty.exchange(false);
     bool needReverbRecalc = reverbsDirty.exchange(false);
 
     {
@@ -918,20 +1060,20 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
         // Apply flip transformation and regular offset (before LFO)
         for (size_t i = 0; i < localInputPositions.size(); ++i)
         {
-            auto posSection = valueTreeState.getInputPositionSection (static_cast<int> (i));
-
             // Apply flip (mirror around origin)
-            if (static_cast<int> (posSection.getProperty (inputFlipX, 0)) != 0)
+            if (ip.flipX[i] != 0)
                 localInputPositions[i].x = -localInputPositions[i].x;
-            if (static_cast<int> (posSection.getProperty (inputFlipY, 0)) != 0)
+            if (ip.flipY[i] != 0)
                 localInputPositions[i].y = -localInputPositions[i].y;
-            if (static_cast<int> (posSection.getProperty (inputFlipZ, 0)) != 0)
+            if (ip.flipZ[i] != 0)
                 localInputPositions[i].z = -localInputPositions[i].z;
 
-            // Apply regular offset (inputOffsetX/Y/Z)
-            localInputPositions[i].x += static_cast<float> (posSection.getProperty (inputOffsetX, 0.0f));
-            localInputPositions[i].y += static_cast<float> (posSection.getProperty (inputOffsetY, 0.0f));
-            localInputPositions[i].z += static_cast<float> (posSection.getProperty (inputOffsetZ, 0.0f));
+            // Apply regular offset (inputOffsetX/Y/Z), or the tracked one
+            // while the fast path owns it
+            const auto tracked = i < localTracked.size() ? localTracked[i] : TrackedOffsetRead {};
+            localInputPositions[i].x += tracked.active ? tracked.x : ip.offsetX[i];
+            localInputPositions[i].y += tracked.active ? tracked.y : ip.offsetY[i];
+            localInputPositions[i].z += tracked.active ? tracked.z : ip.offsetZ[i];
         }
 
         // Apply LFO offsets to input positions
@@ -957,10 +1099,7 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
         // Apply composite position constraints (safety layer)
         // This clamps the final position without affecting raw position or LFO amplitude
         for (size_t i = 0; i < localInputPositions.size(); ++i)
-        {
-            auto posSection = valueTreeState.getInputPositionSection (static_cast<int> (i));
-            applyCompositeConstraints (localInputPositions[i], posSection);
-        }
+            applyCompositeConstraints (localInputPositions[i], static_cast<int> (i));
 
         // Store composite positions for external access (used by LiveSourceTamerEngine)
         compositeInputPositions = localInputPositions;
@@ -980,385 +1119,265 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
         localCommonAttenRampOffsetDb = commonAttenRampOffsetDb;
         localCommonAttenRampTimeRemaining = commonAttenRampTimeRemaining;
 
-        // Capture and clear per-input dirty flags
-        // If outputs or reverbs changed, ALL inputs need recalculation
+        // Capture and clear per-input and per-output dirty flags. A dirty
+        // output only costs its column; a reverb change only the reverb matrices.
         inputsToRecalc.resize(static_cast<size_t>(numInputs));
         for (int i = 0; i < numInputs; ++i)
         {
-            inputsToRecalc[static_cast<size_t>(i)] = needOutputRecalc || needReverbRecalc || inputDirtyFlags[static_cast<size_t>(i)];
+            inputsToRecalc[static_cast<size_t>(i)] = inputDirtyFlags[static_cast<size_t>(i)]
+                                                   || localTracked[static_cast<size_t>(i)].fresh;
             inputDirtyFlags[static_cast<size_t>(i)] = false;
         }
-    }
-
-    // Get global config parameters
-    auto masterState = valueTreeState.getMasterState();
-    float globalHaasEffect = masterState.getProperty (haasEffect, haasEffectDefault);
-    float globalSystemLatency = masterState.getProperty (systemLatency, systemLatencyDefault);
-
-    // Temporary arrays for Input → Output calculations
-    // Initialize with copies of existing arrays (non-dirty inputs keep their values)
-    std::vector<float> newDelays;
-    std::vector<float> newLevels;
-    std::vector<float> newHF;
-    {
-        const juce::ScopedLock sl (matrixLock);
-        newDelays = delayTimesMs;
-        newLevels = levels;
-        newHF = hfAttenuationDb;
-    }
 
-    // Temporary arrays for Floor Reflection calculations
-    std::vector<float> newFRDelays;
-    std::vector<float> newFRLevels;
-    std::vector<float> newFRHF;
-    {
-        const juce::ScopedLock sl (matrixLock);
-        newFRDelays = frDelayTimesMs;
-        newFRLevels = frLevels;
-        newFRHF = frHFAttenuationDb;
+        columnsToRecalc = outputDirtyFlags;
+        if (allColumnsDirty)
+            std::fill (columnsToRecalc.begin(), columnsToRecalc.end(), uint8_t (1));
+        std::fill (outputDirtyFlags.begin(), outputDirtyFlags.end(), uint8_t (0));
     }
 
-    // Temporary arrays for Input → Reverb Feed calculations
-    std::vector<float> newInputReverbDelays;
-    std::vector<float> newInputReverbLevels;
-    std::vector<float> newInputReverbHF;
+    // Get global config parameters
+    float globalHaasEffect = calcParams.global.haasEffect;
+    float globalSystemLatency = calcParams.global.systemLatency;
+
+    // Temporary arrays, seeded from the current generation (non-dirty pairs
+    // keep their values). Only this function publishes and recalcLock is
+    // held, so the pinned set stays current for the whole pass.
+    const auto previous = readMatrices();
+
+    // Input → Output
+    std::vector<float> newDelays = previous->delayTimesMs;
+    std::vector<float> newLevels = previous->levels;
+    std::vector<float> newHF = previous->hfAttenuationDb;
+
+    // Floor Reflection
+    std::vector<float> newFRDelays = previous->frDelayTimesMs;
+    std::vector<float> newFRLevels = previous->frLevels;
+    std::vector<float> newFRHF = previous->frHFAttenuationDb;
+
+    // Input → Reverb Feed
+    std::vector<float> newInputReverbDelays = previous->inputReverbDelayTimesMs;
+    std::vector<float> newInputReverbLevels = previous->inputReverbLevels;
+    std::vector<float> newInputReverbHF = previous->inputReverbHFAttenuationDb;
+
+    // Reverb Return → Output (only recalculated if outputs or reverbs changed)
+    std::vector<float> newReverbOutputDelays = previous->reverbOutputDelayTimesMs;
+    std::vector<float> newReverbOutputLevels = previous->reverbOutputLevels;
+    std::vector<float> newReverbOutputHF = previous->reverbOutputHFAttenuationDb;
+
+    // Pairs whose delay/level/FR are rewritten this pass, and rows with any
+    std::vector<uint8_t> pairsToFinalise (static_cast<size_t> (numInputs * numOutputs), 0);
+    std::vector<uint8_t> rowsTouched (static_cast<size_t> (numInputs), 0);
+
+    // Rows whose common attenuation lift moved (their reverb feeds follow it)
+    std::vector<uint8_t> commonAttenChanged (static_cast<size_t> (numInputs), 0);
+
+    // Output geometry in SoA form for the row kernel (constant across inputs)
+    std::vector<float> outputGeometry (static_cast<size_t> (numOutputs) * 7);
+    WFSMatrixKernel::OutputTerms outputTerms;
     {
-        const juce::ScopedLock sl (matrixLock);
-        newInputReverbDelays = inputReverbDelayTimesMs;
-        newInputReverbLevels = inputReverbLevels;
-        newInputReverbHF = inputReverbHFAttenuationDb;
-    }
+        const auto nOut = static_cast<size_t> (numOutputs);
+        float* speakerX = outputGeometry.data();
+        float* speakerY = speakerX + nOut;
+        float* speakerZ = speakerY + nOut;
+        float* listenerX = speakerZ + nOut;
+        float* listenerY = listenerX + nOut;
+        float* listenerZ = listenerY + nOut;
+        float* speakerToListener = listenerZ + nOut;
+
+        for (size_t out = 0; out < nOut; ++out)
+        {
+            const Position& speakerPos = localSpeakerPositions[out];
+            const Position& listenerPos = localListenerPositions[out];
+            speakerX[out] = speakerPos.x;
+            speakerY[out] = speakerPos.y;
+            speakerZ[out] = speakerPos.z;
+            listenerX[out] = listenerPos.x;
+            listenerY[out] = listenerPos.y;
+            listenerZ[out] = listenerPos.z;
+            speakerToListener[out] = distance3D (speakerPos, listenerPos);  // No height factor for speaker->listener
+        }
 
-    // Temporary arrays for Reverb Return → Output calculations
-    // (only recalculated if outputs or reverbs changed)
-    std::vector<float> newReverbOutputDelays;
-    std::vector<float> newReverbOutputLevels;
-    std::vector<float> newReverbOutputHF;
-    {
-        const juce::ScopedLock sl (matrixLock);
-        newReverbOutputDelays = reverbOutputDelayTimesMs;
-        newReverbOutputLevels = reverbOutputLevels;
-        newReverbOutputHF = reverbOutputHFAttenuationDb;
+        outputTerms.speakerX = speakerX;
+        outputTerms.speakerY = speakerY;
+        outputTerms.speakerZ = speakerZ;
+        outputTerms.listenerX = listenerX;
+        outputTerms.listenerY = listenerY;
+        outputTerms.listenerZ = listenerZ;
+        outputTerms.speakerToListener = speakerToListener;
+        outputTerms.distanceAttenPercent = op.distanceAttenPercent.data();
+        outputTerms.hfDamping = op.hfDamping.data();
+        outputTerms.miniLatencyEnable = op.miniLatencyEnable.data();
+        outputTerms.angularAlwaysOn = op.angular.alwaysOn.data();
+        outputTerms.angularRearX = op.angular.rearX.data();
+        outputTerms.angularRearY = op.angular.rearY.data();
+        outputTerms.angularRearZ = op.angular.rearZ.data();
+        outputTerms.angularOnRad = op.angular.angleOnRad.data();
+        outputTerms.angularMuteRad = op.angular.muteAngleRad.data();
     }
 
-    // Store common attenuation adjustment per input (for reverb feed calculations)
-    std::vector<float> inputCommonAttenAdjustments (static_cast<size_t> (numInputs), 0.0f);
+    // AVX2 / NEON when available and enabled, scalar reference otherwise
+    const auto processRow = WFSMatrixKernel::selectRowFunction (vectorKernelEnabled.load());
 
-    // Temporary arrays for level post-processing (per output, reset per input)
-    std::vector<float> tempAttenuationDb (static_cast<size_t> (numOutputs));
-    // Distance/ratio attenuation component only (excludes inputAttenuation and the
-    // gradient-map offset). The common-attenuation lift is derived from THIS, so the
-    // user's deliberate input-attenuation trim is never lifted back toward 0 dB.
-    std::vector<float> tempDistanceAttenDb (static_cast<size_t> (numOutputs));
-    std::vector<float> tempAngularAtten (static_cast<size_t> (numOutputs));
-
-    // Track which outputs are valid for minimal latency calculation (per input)
-    // An output is valid if: NOT muted, NOT angleOff'd (level > 0), AND outputMiniLatencyEnable = 1
-    std::vector<bool> validForMinLatency (static_cast<size_t> (numOutputs), false);
-
-    // Track which outputs are valid for common attenuation calculation (per input)
-    // An output is valid if: NOT muted, NOT angleOff'd
-    std::vector<bool> validForCommonAtten (static_cast<size_t> (numOutputs), false);
-
-    // Cache output array assignments (0 = Single, 1-10 = Array 1-10)
-    std::vector<int> outputArrayAssignments (static_cast<size_t> (numOutputs), 0);
+    // Contiguous runs of dirty columns: a row whose own terms did not change
+    // only sends these through the kernel
+    std::vector<std::pair<int, int>> dirtyColumnRuns;
+    int numDirtyColumns = 0;
     for (int outIdx = 0; outIdx < numOutputs; ++outIdx)
     {
-        auto outputChannelSection = valueTreeState.getOutputChannelSection (outIdx);
-        outputArrayAssignments[static_cast<size_t> (outIdx)] =
-            outputChannelSection.getProperty (outputArray, outputArrayDefault);
-    }
-
-    // Calculate for each input->output pair
-    for (int inIdx = 0; inIdx < numInputs; ++inIdx)
-    {
-        // Skip inputs that don't need recalculation (existing values preserved from copy)
-        if (!inputsToRecalc[static_cast<size_t>(inIdx)])
+        if (columnsToRecalc[static_cast<size_t> (outIdx)] == 0)
             continue;
 
-        const Position& inputPos = localInputPositions[static_cast<size_t> (inIdx)];
-
-        // Get input attenuation parameters. inputAttenuation lives in the Channel
-        // section - that is where the GUI, OSC and snapshot system all read/write it -
-        // while the Attenuation section holds the distance law, ratio and common-atten.
-        auto inputChannelSection = valueTreeState.getInputChannelSection (inIdx);
-        auto inputAttenSection = valueTreeState.getInputAttenuationSection (inIdx);
-        float inputAtten = inputChannelSection.getProperty (inputAttenuation, inputAttenuationDefault);
-
-        // Apply gradient map attenuation offset (additive in dB)
-        if (static_cast<size_t> (inIdx) < localGradientMapOffsets.size())
-            inputAtten += localGradientMapOffsets[static_cast<size_t> (inIdx)].attenuationDb;
-
-        float inputDistAtten = inputAttenSection.getProperty (inputDistanceAttenuation, inputDistanceAttenuationDefault);
-        int attenLaw = inputAttenSection.getProperty (inputAttenuationLaw, inputAttenuationLawDefault);
-        float distRatio = inputAttenSection.getProperty (inputDistanceRatio, inputDistanceRatioDefault);
-        int commonAttenPercent = inputAttenSection.getProperty (inputCommonAtten, inputCommonAttenDefault);
-        float commonAttenFactor = static_cast<float> (commonAttenPercent) / 100.0f;
-
-        // Get per-array attenuation values from the Mutes section (dB, 0 = no attenuation)
-        auto inputMutesSection = valueTreeState.getInputMutesSection (inIdx);
-
-        // Parse the per-output routing-mute bitmask once per input (was tokenised
-        // per inIdx × outIdx call in isRoutingMuted() — O(N×M) → O(N)).
-        juce::StringArray inputMutesPerOutput;
-        if (inputMutesSection.isValid())
-            inputMutesPerOutput.addTokens (inputMutesSection.getProperty (inputMutes).toString(), ",", "");
-
-        std::array<float, 10> arrayAttenDb = {0.0f};
-        arrayAttenDb[0] = inputMutesSection.getProperty (inputArrayAtten1, inputArrayAttenDefault);
-        arrayAttenDb[1] = inputMutesSection.getProperty (inputArrayAtten2, inputArrayAttenDefault);
-        arrayAttenDb[2] = inputMutesSection.getProperty (inputArrayAtten3, inputArrayAttenDefault);
-        arrayAttenDb[3] = inputMutesSection.getProperty (inputArrayAtten4, inputArrayAttenDefault);
-        arrayAttenDb[4] = inputMutesSection.getProperty (inputArrayAtten5, inputArrayAttenDefault);
-        arrayAttenDb[5] = inputMutesSection.getProperty (inputArrayAtten6, inputArrayAttenDefault);
-        arrayAttenDb[6] = inputMutesSection.getProperty (inputArrayAtten7, inputArrayAttenDefault);
-        arrayAttenDb[7] = inputMutesSection.getProperty (inputArrayAtten8, inputArrayAttenDefault);
-        arrayAttenDb[8] = inputMutesSection.getProperty (inputArrayAtten9, inputArrayAttenDefault);
-        arrayAttenDb[9] = inputMutesSection.getProperty (inputArrayAtten10, inputArrayAttenDefault);
-
-        // Get input channel parameters (inputChannelSection fetched above)
-        int minimalLatencyMode = inputChannelSection.getProperty (inputMinimalLatency, 0);
-        float inputDelayLat = inputChannelSection.getProperty (inputDelayLatency, 0.0f);
-
-        // Get input height factor (0-100%) for distance calculations
-        auto inputPosSection = valueTreeState.getInputPositionSection (inIdx);
-        int heightFactorPercent = inputPosSection.getProperty (inputHeightFactor, inputHeightFactorDefault);
-        float heightFactor = static_cast<float> (heightFactorPercent) / 100.0f;
+        ++numDirtyColumns;
+        if (! dirtyColumnRuns.empty() && dirtyColumnRuns.back().second == outIdx)
+            dirtyColumnRuns.back().second = outIdx + 1;
+        else
+            dirtyColumnRuns.emplace_back (outIdx, outIdx + 1);
+    }
+    const bool anyDirtyColumn = numDirtyColumns > 0;
 
-        // Get input directivity parameters
-        auto inputDirectivitySection = valueTreeState.getInputDirectivitySection (inIdx);
-        int directivityDeg = inputDirectivitySection.getProperty (inputDirectivity, inputDirectivityDefault);
-        int rotationDeg = inputDirectivitySection.getProperty (inputRotation, inputRotationDefault);
-        int tiltDeg = inputDirectivitySection.getProperty (inputTilt, inputTiltDefault);
-        float hfShelfDb = inputDirectivitySection.getProperty (inputHFshelf, inputHFshelfDefault);
+    // Z only reaches the kernel through the height factor, the directivity cone
+    // and the angular zones, so without those a Z-only move leaves the raw terms
+    bool anyAngularZone = false;
+    for (int outIdx = 0; outIdx < numOutputs; ++outIdx)
+        anyAngularZone = anyAngularZone || op.angular.alwaysOn[static_cast<size_t> (outIdx)] == 0;
 
-        // Convert directivity parameters to radians
-        float directivityRad = static_cast<float> (directivityDeg) * (juce::MathConstants<float>::pi / 180.0f);
-        float rotationRad = static_cast<float> (rotationDeg) * (juce::MathConstants<float>::pi / 180.0f);
-        float tiltRad = static_cast<float> (tiltDeg) * (juce::MathConstants<float>::pi / 180.0f);
+    // Pairs whose Live Source Tamer gain moved since it was last baked in
+    applyLSGainOverlay (lsGains);
 
-        // Add gyrophone rotation offset (Leslie speaker effect for HF directivity)
-        if (static_cast<size_t>(inIdx) < localGyrophoneOffsets.size())
-            rotationRad += localGyrophoneOffsets[static_cast<size_t>(inIdx)];
+    RecalcStats stats;
+    stats.dirtyOutputs = numDirtyColumns;
 
-        // Precompute facing direction for this input
-        // rotation=0 faces toward -Y (audience), tilt=0 is horizontal
-        float facingX = std::sin (rotationRad) * std::cos (tiltRad);
-        float facingY = -std::cos (rotationRad) * std::cos (tiltRad);
-        float facingZ = std::sin (tiltRad);
+    // Calculate one input's row of input->output pairs
+    auto directRow = [&] (int inIdx, RecalcStats& rowStats)
+    {
+        const auto in = static_cast<size_t> (inIdx);
+        const size_t rowBase = in * static_cast<size_t> (numOutputs);
+        uint8_t* finaliseRow = pairsToFinalise.data() + rowBase;
+        const uint8_t* routingRow = ip.routingMuted.data() + rowBase;
 
-        // Reset tracking arrays for this input
-        std::fill (validForMinLatency.begin(), validForMinLatency.end(), false);
-        std::fill (validForCommonAtten.begin(), validForCommonAtten.end(), false);
-        std::fill (tempAttenuationDb.begin(), tempAttenuationDb.end(), -92.0f);
-        std::fill (tempDistanceAttenDb.begin(), tempDistanceAttenDb.end(), 0.0f);
-        std::fill (tempAngularAtten.begin(), tempAngularAtten.end(), 0.0f);
+        // A clean input only revisits the dirty columns and the pairs whose LS
+        // gain moved; with neither, its row is kept from the previous pass
+        const bool rowFull = inputsToRecalc[in] || allColumnsDirty;
+        bool anyPair = rowFull;
 
-        for (int outIdx = 0; outIdx < numOutputs; ++outIdx)
+        if (! rowFull)
         {
-            const size_t matrixIdx = static_cast<size_t> (inIdx * numOutputs + outIdx);
-
-            // Get output parameters early (needed for outputMiniLatencyEnable check)
-            auto outputOptionsSection = valueTreeState.getOutputOptionsSection (outIdx);
-            auto outputPositionSection = valueTreeState.getOutputPositionSection (outIdx);
-
-            int outputMiniLatEnable = outputOptionsSection.getProperty (outputMiniLatencyEnable, 1);
-
-            // ==========================================
-            // MUTING CHECK
-            // ==========================================
-            // Skip calculations if this input→output routing is muted
-            const bool routingMuted = outIdx >= 0
-                                   && outIdx < inputMutesPerOutput.size()
-                                   && inputMutesPerOutput[outIdx].getIntValue() != 0;
-            if (routingMuted)
-            {
-                newDelays[matrixIdx] = 0.0f;
-                newLevels[matrixIdx] = 0.0f;
-                newHF[matrixIdx] = 0.0f;
-                continue;
-            }
-
-            const Position& speakerPos = localSpeakerPositions[static_cast<size_t> (outIdx)];
-            const Position& listenerPos = localListenerPositions[static_cast<size_t> (outIdx)];
-
-            // ==========================================
-            // ANGULAR ATTENUATION
-            // ==========================================
-            // Check if input is in the "off" zone in front of speaker
-            // Note: Uses original inputPos (no height factor applied)
-            float angularAtten = calculateAngularAttenuation (inIdx, outIdx, inputPos, speakerPos);
+            if (! anyDirtyColumn && lsRowChanged[in] == 0)
+                return;
 
-            // If angular attenuation is 0, input is in mute zone - skip further calculations
-            if (angularAtten <= 0.0f)
-            {
-                newDelays[matrixIdx] = 0.0f;
-                newLevels[matrixIdx] = 0.0f;
-                newHF[matrixIdx] = 0.0f;
-                continue;
-            }
-
-            // This output is valid for minimal latency search if outputMiniLatencyEnable = 1
-            // (and we've passed mute and angleOff checks)
-            if (outputMiniLatEnable == 1)
-                validForMinLatency[static_cast<size_t> (outIdx)] = true;
-
-            // This output is valid for common attenuation search
-            // (we've passed mute and angleOff checks)
-            validForCommonAtten[static_cast<size_t> (outIdx)] = true;
-
-            float outputDistAttenPercent = outputOptionsSection.getProperty (outputDistanceAttenPercent, 100.0f);
-            float outputHFdamp = outputPositionSection.getProperty (outputHFdamping, outputHFdampingDefault);
-
-            // ==========================================
-            // DISTANCE CALCULATIONS (with height factor)
-            // ==========================================
-            // Apply height factor to Z component for distance calculations only
-            // This scales how much the height difference contributes to distance
-            auto distanceWithHeightFactor = [heightFactor] (const Position& a, const Position& b) -> float
-            {
-                float dx = b.x - a.x;
-                float dy = b.y - a.y;
-                float dz = (b.z - a.z) * heightFactor;  // Scale Z difference
-                return std::sqrt (dx * dx + dy * dy + dz * dz);
-            };
-
-            float inputToListener = distanceWithHeightFactor (inputPos, listenerPos);
-            float inputToSpeaker = distanceWithHeightFactor (inputPos, speakerPos);
-            float speakerToListener = distance3D (speakerPos, listenerPos);  // No height factor for speaker→listener
-
-            // ==========================================
-            // DELAY CALCULATION (raw distance-based delay)
-            // ==========================================
-            // Delay = (distance input->listener - distance speaker->listener) / speed of sound
-            float delayMeters = inputToListener - speakerToListener;
-            float delayMs = (delayMeters / speedOfSound) * 1000.0f;
-            delayMs = juce::jmax (0.0f, delayMs);  // Clamp to minimum 0
-
-            // Store raw delay (will be post-processed after inner loop)
-            newDelays[matrixIdx] = delayMs;
-
-            // ==========================================
-            // LEVEL CALCULATION (store dB for post-processing)
-            // ==========================================
-            float distanceAttenDb = 0.0f;
-
-            if (attenLaw == 0)
-            {
-                // Law 0: Linear (dB/m)
-                // distanceAttenDb = inputDistanceAttenuation * distance
-                distanceAttenDb = inputDistAtten * inputToSpeaker;
-            }
-            else
+            const uint8_t* lsChangedRow = lsPairChanged.data() + rowBase;
+            for (int outIdx = 0; outIdx < numOutputs; ++outIdx)
             {
-                // Law 1: Inverse square (1/d)
-                // -6dB per doubling of distance, 0dB at reference distance (distRatio)
-                // distanceAttenDb = -20 * log10(distance / distRatio)
-                // Clamp inside reference sphere to 0dB (no amplification)
-                float effectiveDistance = inputToSpeaker / juce::jmax (0.001f, distRatio);
-                if (effectiveDistance < 1.0f)
-                    distanceAttenDb = 0.0f;  // Inside reference sphere - no attenuation
-                else
-                    distanceAttenDb = -20.0f * std::log10 (effectiveDistance);
+                const auto o = static_cast<size_t> (outIdx);
+                finaliseRow[o] = (columnsToRecalc[o] != 0 || lsChangedRow[o] != 0) ? 1 : 0;
+                anyPair = anyPair || finaliseRow[o] != 0;
             }
+        }
 
-            // Apply outputDistAttenPercent scaling to the distance-dependent part
-            float scaledDistanceAttenDb = distanceAttenDb * (outputDistAttenPercent / 100.0f);
-            float attenuationDb = inputAtten + scaledDistanceAttenDb;
-
-            // Clamp to reasonable range (-92dB to 0dB)
-            attenuationDb = juce::jlimit (-92.0f, 0.0f, attenuationDb);
-
-            // Store dB and angular values for post-processing
-            // (linear conversion and angular multiplication will be done after common attenuation)
-            tempAttenuationDb[static_cast<size_t> (outIdx)] = attenuationDb;
-            // Store the distance-only component separately so the common-attenuation lift
-            // operates on it alone (input attenuation + gradient-map offset are preserved).
-            tempDistanceAttenDb[static_cast<size_t> (outIdx)] = juce::jlimit (-92.0f, 0.0f, scaledDistanceAttenDb);
-            tempAngularAtten[static_cast<size_t> (outIdx)] = angularAtten;
-
-            // Temporarily mark as active (will be replaced in post-processing)
-            newLevels[matrixIdx] = 1.0f;
-
-            // ==========================================
-            // HF ATTENUATION CALCULATION
-            // ==========================================
-            // Two cumulative HF attenuations:
-            // 1. Output-based: outputHFdamping (dB/m) * distance
-            // 2. Input directivity-based: smooth falloff from inputHFshelf
-
-            // 1. Output-based HF damping
-            float hfAttenOutput = outputHFdamp * inputToSpeaker;
-
-            // 2. Input directivity HF attenuation
-            float hfAttenDirectivity = 0.0f;
+        if (! anyPair)
+            return;
 
-            // Only calculate if directivity < 360° and inputHFshelf < 0dB
-            if (directivityDeg < 360 && hfShelfDb < 0.0f)
-            {
-                // Calculate raw distance (without height factor) for directivity
-                float dx = speakerPos.x - inputPos.x;
-                float dy = speakerPos.y - inputPos.y;
-                float dz = speakerPos.z - inputPos.z;
-                float rawDistance = std::sqrt (dx * dx + dy * dy + dz * dz);
+        rowsTouched[in] = 1;
 
-                if (rawDistance > 0.001f)
-                {
-                    // Normalize direction to speaker
-                    float invDist = 1.0f / rawDistance;
-                    float toSpeakerX = dx * invDist;
-                    float toSpeakerY = dy * invDist;
-                    float toSpeakerZ = dz * invDist;
+        const Position& inputPos = localInputPositions[in];
 
-                    // Dot product: facing · toSpeaker
-                    float dotProduct = facingX * toSpeakerX + facingY * toSpeakerY + facingZ * toSpeakerZ;
+        // Get input attenuation parameters
+        float inputAtten = ip.attenuationDb[in];
 
-                    // Clamp for acos
-                    dotProduct = juce::jlimit (-1.0f, 1.0f, dotProduct);
+        // Apply gradient map attenuation offset (additive in dB)
+        if (in < localGradientMapOffsets.size())
+            inputAtten += localGradientMapOffsets[in].attenuationDb;
 
-                    // Angle between facing direction and direction to speaker
-                    float angleToSpeaker = std::acos (dotProduct);
+        int commonAttenPercent = ip.commonAttenPercent[in];
+        float commonAttenFactor = static_cast<float> (commonAttenPercent) / 100.0f;
 
-                    // Half of the brightness cone (directivity defines full cone)
-                    float halfDirectivity = directivityRad * 0.5f;
+        // Per-array attenuation values (dB, 0 = no attenuation)
+        const float* arrayAttenDb = ip.arrayAttenDb.data() + in * static_cast<size_t> (numArrayGroups);
 
-                    // If outside the brightness cone, apply smooth falloff
-                    if (angleToSpeaker > halfDirectivity)
-                    {
-                        // Transition from edge of cone to rear (π)
-                        float transitionRange = juce::MathConstants<float>::pi - halfDirectivity;
+        // Get input channel parameters
+        int minimalLatencyMode = ip.minimalLatency[in];
+        float inputDelayLat = ip.delayLatencyMs[in];
 
-                        if (transitionRange > 0.001f)
-                        {
-                            // Progress from 0 (at cone edge) to 1 (at rear)
-                            float progress = (angleToSpeaker - halfDirectivity) / transitionRange;
-                            progress = juce::jmin (1.0f, progress);
+        // Get input directivity parameters
+        int directivityDeg = ip.directivityDeg[in];
+        float hfShelfDb = ip.hfShelfDb[in];
 
-                            // Smooth falloff using sqrt(sin) as in Max patch
-                            // At progress=0: sin(0)=0, sqrt=0, attenuation=0
-                            // At progress=1: sin(π/2)=1, sqrt=1, attenuation=hfShelfDb
-                            float sinArg = progress * juce::MathConstants<float>::halfPi;
-                            hfAttenDirectivity = hfShelfDb * std::sqrt (std::sin (sinArg));
-                        }
-                    }
-                    // Inside brightness cone: hfAttenDirectivity stays 0
-                }
-                // If distance is 0, angle is undefined - no directivity attenuation
-            }
+        // Sideline attenuation depends on the input only
+        const float sidelineAtten = calculateSidelineAttenuation (inIdx, inputPos);
 
-            // Combine both HF attenuations (additive in dB)
-            // Gradient map HF shelf offset applied uniformly to ALL speakers
-            float gmHfOffset = (static_cast<size_t> (inIdx) < localGradientMapOffsets.size())
-                                   ? localGradientMapOffsets[static_cast<size_t> (inIdx)].hfShelfDb
-                                   : 0.0f;
-            float hfAtten = hfAttenOutput + hfAttenDirectivity + gmHfOffset;
+        // Convert directivity parameters to radians
+        float directivityRad = static_cast<float> (directivityDeg) * (juce::MathConstants<float>::pi / 180.0f);
+        float rotationRad = static_cast<float> (ip.rotationDeg[in]) * (juce::MathConstants<float>::pi / 180.0f);
+        float tiltRad = static_cast<float> (ip.tiltDeg[in]) * (juce::MathConstants<float>::pi / 180.0f);
 
-            // Clamp to reasonable range
-            hfAtten = juce::jlimit (-60.0f, 0.0f, hfAtten);
+        // Add gyrophone rotation offset (Leslie speaker effect for HF directivity)
+        if (in < localGyrophoneOffsets.size())
+            rotationRad += localGyrophoneOffsets[in];
+
+        WFSMatrixKernel::InputTerms inputTerms;
+        inputTerms.x = inputPos.x;
+        inputTerms.y = inputPos.y;
+        inputTerms.z = inputPos.z;
+        inputTerms.heightFactor = static_cast<float> (ip.heightFactorPercent[in]) / 100.0f;
+        inputTerms.attenuationDb = inputAtten;
+        inputTerms.attenuationLaw = ip.attenuationLaw[in];
+        inputTerms.distanceAttenuation = ip.distanceAttenuation[in];
+        inputTerms.distanceRatio = juce::jmax (0.001f, ip.distanceRatio[in]);
+
+        // Directivity HF falloff only when directivity < 360° and inputHFshelf < 0dB.
+        // Facing direction: rotation=0 faces toward -Y (audience), tilt=0 is horizontal
+        inputTerms.directivityActive = directivityDeg < 360 && hfShelfDb < 0.0f;
+        inputTerms.facingX = std::sin (rotationRad) * std::cos (tiltRad);
+        inputTerms.facingY = -std::cos (rotationRad) * std::cos (tiltRad);
+        inputTerms.facingZ = std::sin (tiltRad);
+        inputTerms.halfDirectivity = directivityRad * 0.5f;
+        inputTerms.transitionRange = juce::MathConstants<float>::pi - inputTerms.halfDirectivity;
+        inputTerms.hfShelfDb = hfShelfDb;
+
+        // Gradient map HF shelf offset applied uniformly to ALL speakers
+        inputTerms.hfOffsetDb = (in < localGradientMapOffsets.size())
+                                    ? localGradientMapOffsets[in].hfShelfDb
+                                    : 0.0f;
+        inputTerms.routingMuted = routingRow;
+
+        // Raw terms of this row are still valid if nothing the kernel reads from
+        // the input side changed; then only dirty columns need the kernel
+        const bool zMatters = inputTerms.heightFactor != 0.0f || inputTerms.directivityActive || anyAngularZone;
+        const bool rawReusable = rawRowValid[in] != 0 && ! allColumnsDirty
+                                 && WFSMatrixKernel::sameInputTerms (inputTerms, rawRowTerms[in], zMatters)
+                                 && std::equal (routingRow, routingRow + numOutputs, rawRoutingMuted.data() + rowBase);
+
+        WFSMatrixKernel::RowResults row;
+        row.delayMs = rawDelayMs.data() + rowBase;
+        row.level = rawLevel.data() + rowBase;
+        row.hfDb = newHF.data() + rowBase;
+        row.attenuationDb = rawAttenuationDb.data() + rowBase;
+        row.distanceAttenDb = rawDistanceAttenDb.data() + rowBase;
+        row.angularAtten = rawAngularAtten.data() + rowBase;
+        row.validForMinLatency = rawValidForMinLatency.data() + rowBase;
+        row.validForCommonAtten = rawValidForCommonAtten.data() + rowBase;
+
+        // Raw delays, level markers (1 = active), HF and the dB/angular terms below
+        if (rawReusable)
+        {
+            for (const auto& run : dirtyColumnRuns)
+                WFSMatrixKernel::processColumns (processRow, inputTerms, outputTerms, row, run.first, run.second);
 
-            newHF[matrixIdx] = hfAtten;
+            rowStats.pairsKernel += numDirtyColumns;
+            if (rowFull)
+                ++rowStats.rowsKernelSkipped;
+        }
+        else
+        {
+            processRow (inputTerms, outputTerms, row, numOutputs);
+            std::copy (routingRow, routingRow + numOutputs, rawRoutingMuted.begin() + static_cast<std::ptrdiff_t> (rowBase));
+            rowStats.pairsKernel += numOutputs;
         }
 
+        rawRowTerms[in] = inputTerms;
+        rawRowTerms[in].routingMuted = nullptr;
+        rawRowValid[in] = 1;
+
         // ==========================================
         // DELAY POST-PROCESSING (per input)
         // ==========================================
@@ -1369,14 +1388,11 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
 
         for (int outIdx = 0; outIdx < numOutputs; ++outIdx)
         {
-            if (validForMinLatency[static_cast<size_t> (outIdx)])
+            const size_t matrixIdx = rowBase + static_cast<size_t> (outIdx);
+            if (rawValidForMinLatency[matrixIdx] && rawDelayMs[matrixIdx] < minDelay)
             {
-                const size_t matrixIdx = static_cast<size_t> (inIdx * numOutputs + outIdx);
-                if (newDelays[matrixIdx] < minDelay)
-                {
-                    minDelay = newDelays[matrixIdx];
-                    foundValidOutput = true;
-                }
+                minDelay = rawDelayMs[matrixIdx];
+                foundValidOutput = true;
             }
         }
 
@@ -1410,64 +1426,6 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
         // Update previous mode
         localPreviousMode[static_cast<size_t> (inIdx)] = minimalLatencyMode;
 
-        // Apply mode-specific delay processing
-        if (minimalLatencyMode == 0)
-        {
-            // Mode 0: Acoustic Precedence
-            // finalDelay = calculatedDelay + haasEffect - systemLatency + inputDelayLatency + outputDelayLatency
-            for (int outIdx = 0; outIdx < numOutputs; ++outIdx)
-            {
-                const size_t matrixIdx = static_cast<size_t> (inIdx * numOutputs + outIdx);
-
-                // Skip if muted (level = 0)
-                if (newLevels[matrixIdx] <= 0.0f)
-                    continue;
-
-                // Get output delay latency
-                auto outputChannelSection = valueTreeState.getOutputChannelSection (outIdx);
-                float outputDelayLat = outputChannelSection.getProperty (outputDelayLatency, 0.0f);
-
-                float finalDelay = newDelays[matrixIdx] + globalHaasEffect - globalSystemLatency
-                                   + inputDelayLat + outputDelayLat;
-
-                newDelays[matrixIdx] = juce::jmax (0.0f, finalDelay);
-            }
-        }
-        else
-        {
-            // Mode 1: Minimal Latency
-            // Subtract minimum from all delays (if we found valid outputs)
-            if (foundValidOutput)
-            {
-                for (int outIdx = 0; outIdx < numOutputs; ++outIdx)
-                {
-                    const size_t matrixIdx = static_cast<size_t> (inIdx * numOutputs + outIdx);
-
-                    // Skip if muted (level = 0)
-                    if (newLevels[matrixIdx] <= 0.0f)
-                        continue;
-
-                    float finalDelay = newDelays[matrixIdx] - minDelay;
-                    newDelays[matrixIdx] = juce::jmax (0.0f, finalDelay);
-                }
-            }
-            // If no valid outputs found, leave delays as calculated (no subtraction)
-        }
-
-        // Apply ramp offset for smooth mode transitions
-        float rampOffset = localRampOffset[static_cast<size_t> (inIdx)];
-        if (std::abs (rampOffset) > 0.001f)
-        {
-            for (int outIdx = 0; outIdx < numOutputs; ++outIdx)
-            {
-                const size_t matrixIdx = static_cast<size_t> (inIdx * numOutputs + outIdx);
-                if (newLevels[matrixIdx] > 0.0f)
-                {
-                    newDelays[matrixIdx] = juce::jmax (0.0f, newDelays[matrixIdx] + rampOffset);
-                }
-            }
-        }
-
         // ==========================================
         // LEVEL POST-PROCESSING - Common Attenuation (per input)
         // ==========================================
@@ -1487,9 +1445,9 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
         // input-attenuation trim - it only removes the common distance floor.
         for (int outIdx = 0; outIdx < numOutputs; ++outIdx)
         {
-            if (validForCommonAtten[static_cast<size_t> (outIdx)])
+            if (rawValidForCommonAtten[rowBase + static_cast<size_t> (outIdx)])
             {
-                float atten = tempDistanceAttenDb[static_cast<size_t> (outIdx)];
+                float atten = rawDistanceAttenDb[rowBase + static_cast<size_t> (outIdx)];
                 if (atten > minAttenuation)
                 {
                     minAttenuation = atten;
@@ -1537,32 +1495,91 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
         // Update previous percentage for next calculation
         localPrevCommonAttenPercent[static_cast<size_t> (inIdx)] = currentPercent;
 
+        // A partial row is only correct while the row-wide terms it was built
+        // on still hold: moving the nearest speaker shifts every delay of a
+        // minimal-latency input, a new loudest pair shifts the common lift
+        const bool minDelayChanged = minimalLatencyMode != 0
+                                     && (rowMinDelay[in] != minDelay || (rowFoundValidOutput[in] != 0) != foundValidOutput);
+        const bool commonAttenMoved = inputCommonAttenAdjustments[in] != commonAttenAdjustment;
+        const bool finaliseAll = rowFull || ! rawReusable || minDelayChanged || commonAttenMoved;
+
+        rowMinDelay[in] = minDelay;
+        rowFoundValidOutput[in] = foundValidOutput ? 1 : 0;
+        commonAttenChanged[in] = commonAttenMoved ? 1 : 0;
+
         // Store the common attenuation adjustment for later use in reverb feed calculations
-        inputCommonAttenAdjustments[static_cast<size_t> (inIdx)] = commonAttenAdjustment;
+        inputCommonAttenAdjustments[in] = commonAttenAdjustment;
+
+        if (finaliseAll)
+        {
+            std::fill (finaliseRow, finaliseRow + numOutputs, uint8_t (1));
+            ++rowStats.rowsFull;
+        }
+        else
+        {
+            ++rowStats.rowsPartial;
+        }
 
-        // Get current ramp offset for this input
-        float commonAttenRampOffset = localCommonAttenRampOffsetDb[static_cast<size_t> (inIdx)];
+        // Get current ramp offsets for this input
+        const float rampOffset = localRampOffset[in];
+        const float commonAttenRampOffset = localCommonAttenRampOffsetDb[in];
+
+        // ==========================================
+        // FINAL DELAY AND LEVEL (per pair)
+        // ==========================================
 
-        // Apply common attenuation adjustment and convert to linear levels
         for (int outIdx = 0; outIdx < numOutputs; ++outIdx)
         {
-            const size_t matrixIdx = static_cast<size_t> (inIdx * numOutputs + outIdx);
+            const size_t matrixIdx = rowBase + static_cast<size_t> (outIdx);
 
-            // Skip if muted (newLevels is already 0)
-            if (newLevels[matrixIdx] <= 0.0f)
+            if (finaliseRow[outIdx] == 0)
                 continue;
 
+            ++rowStats.pairsFinalised;
+            appliedLSGains[matrixIdx] = targetLSGains[matrixIdx];
+
+            // Muted (routing or angular mute zone): the raw zero delay stands
+            if (rawLevel[matrixIdx] <= 0.0f)
+            {
+                newDelays[matrixIdx] = rawDelayMs[matrixIdx];
+                newLevels[matrixIdx] = 0.0f;
+                continue;
+            }
+
+            float finalDelay = rawDelayMs[matrixIdx];
+
+            if (minimalLatencyMode == 0)
+            {
+                // Mode 0: Acoustic Precedence
+                // finalDelay = calculatedDelay + haasEffect - systemLatency + inputDelayLatency + outputDelayLatency
+                float outputDelayLat = op.delayLatencyMs[static_cast<size_t> (outIdx)];
+                finalDelay = juce::jmax (0.0f, finalDelay + globalHaasEffect - globalSystemLatency
+                                               + inputDelayLat + outputDelayLat);
+            }
+            else if (foundValidOutput)
+            {
+                // Mode 1: Minimal Latency - subtract the row minimum
+                // (if no valid outputs were found, the delay stays as calculated)
+                finalDelay = juce::jmax (0.0f, finalDelay - minDelay);
+            }
+
+            // Apply ramp offset for smooth mode transitions
+            if (std::abs (rampOffset) > 0.001f)
+                finalDelay = juce::jmax (0.0f, finalDelay + rampOffset);
+
+            newDelays[matrixIdx] = finalDelay;
+
             // Get stored values
-            float attenuationDb = tempAttenuationDb[static_cast<size_t> (outIdx)];
-            float angularAtten = tempAngularAtten[static_cast<size_t> (outIdx)];
+            float attenuationDb = rawAttenuationDb[matrixIdx];
+            float angularAtten = rawAngularAtten[matrixIdx];
 
             // Apply common attenuation adjustment + ramp offset
             attenuationDb += commonAttenAdjustment + commonAttenRampOffset;
 
             // Apply per-array attenuation (if output is assigned to an array 1-10)
-            int outputArrayNum = outputArrayAssignments[static_cast<size_t> (outIdx)];
-            if (outputArrayNum >= 1 && outputArrayNum <= 10)
-                attenuationDb += arrayAttenDb[static_cast<size_t> (outputArrayNum - 1)];
+            int outputArrayNum = op.arrayAssignment[static_cast<size_t> (outIdx)];
+            if (outputArrayNum >= 1 && outputArrayNum <= numArrayGroups)
+                attenuationDb += arrayAttenDb[outputArrayNum - 1];
 
             // Clamp to 0dB max (don't amplify) and -92dB min
             attenuationDb = juce::jlimit (-92.0f, 0.0f, attenuationDb);
@@ -1574,47 +1591,44 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
             linearLevel *= angularAtten;
 
             // Apply Live Source Tamer gain (linear multiplier 0.0-1.0)
-            if (lsGains != nullptr)
-                linearLevel *= lsGains[matrixIdx];
+            linearLevel *= appliedLSGains[matrixIdx];
 
             // Apply Sideline attenuation (linear multiplier 0.0-1.0)
-            float sidelineAtten = calculateSidelineAttenuation (inIdx, inputPos);
             linearLevel *= sidelineAtten;
 
             newLevels[matrixIdx] = linearLevel;
         }
-    }
+    };
 
     // ==========================================================================
     // FLOOR REFLECTION CALCULATIONS
     // ==========================================================================
     // Floor reflections simulate sound bouncing off the floor (z=0 plane).
     // For each input/output pair, calculate extra delay and attenuation for
-    // the reflected path through position (x, y, -z).
+    // the reflected path through position (x, y, -z). Follows the direct
+    // pairs rewritten above.
 
-    for (int inIdx = 0; inIdx < numInputs; ++inIdx)
+    auto floorReflectionRow = [&] (int inIdx)
     {
-        // Skip inputs that don't need recalculation
-        if (!inputsToRecalc[static_cast<size_t>(inIdx)])
-            continue;
+        // Skip rows the direct pass left alone
+        if (rowsTouched[static_cast<size_t>(inIdx)] == 0)
+            return;
 
         const Position& inputPos = localInputPositions[static_cast<size_t>(inIdx)];
 
-        // Get FR parameters from Hackoustics section
-        auto hackousticsSection = valueTreeState.getInputHackousticsSection(inIdx);
-        int frActive = hackousticsSection.getProperty(inputFRactive, 0);
-
         // If FR not active for this input, zero all FR entries
-        if (frActive == 0)
+        if (ip.frActive[static_cast<size_t>(inIdx)] == 0)
         {
             for (int outIdx = 0; outIdx < numOutputs; ++outIdx)
             {
                 const size_t matrixIdx = static_cast<size_t>(inIdx * numOutputs + outIdx);
+                if (pairsToFinalise[matrixIdx] == 0)
+                    continue;
                 newFRDelays[matrixIdx] = 0.0f;
                 newFRLevels[matrixIdx] = 0.0f;
                 newFRHF[matrixIdx] = 0.0f;
             }
-            continue;
+            return;
         }
 
         // Skip if source is at or below floor (z <= 0) - no reflection possible
@@ -1623,26 +1637,30 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
             for (int outIdx = 0; outIdx < numOutputs; ++outIdx)
             {
                 const size_t matrixIdx = static_cast<size_t>(inIdx * numOutputs + outIdx);
+                if (pairsToFinalise[matrixIdx] == 0)
+                    continue;
                 newFRDelays[matrixIdx] = 0.0f;
                 newFRLevels[matrixIdx] = 0.0f;
                 newFRHF[matrixIdx] = 0.0f;
             }
-            continue;
+            return;
         }
 
         // Calculate reflected position (mirror across z=0 plane)
         Position reflectedPos = { inputPos.x, inputPos.y, -inputPos.z };
 
         // Get FR parameters
-        float frAttenDb = hackousticsSection.getProperty(inputFRattenuation, -3.0f);
+        float frAttenDb = ip.frAttenuationDb[static_cast<size_t>(inIdx)];
 
         for (int outIdx = 0; outIdx < numOutputs; ++outIdx)
         {
             const size_t matrixIdx = static_cast<size_t>(inIdx * numOutputs + outIdx);
 
+            if (pairsToFinalise[matrixIdx] == 0)
+                continue;
+
             // Get output FR enable parameter
-            auto outputOptionsSection = valueTreeState.getOutputOptionsSection(outIdx);
-            int outputFRen = outputOptionsSection.getProperty(outputFRenable, 1);
+            int outputFRen = op.frEnable[static_cast<size_t>(outIdx)];
 
             // Skip if output FR disabled OR direct signal is muted (level = 0)
             if (outputFRen == 0 || newLevels[matrixIdx] <= 0.0f)
@@ -1698,8 +1716,7 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
             newFRLevels[matrixIdx] = frLevelLinear;
 
             // FR HF attenuation: start with direct signal HF, add extra for longer path
-            auto outputPositionSection = valueTreeState.getOutputPositionSection(outIdx);
-            float outputHFdamp = outputPositionSection.getProperty(outputHFdamping, outputHFdampingDefault);
+            float outputHFdamp = op.hfDamping[static_cast<size_t>(outIdx)];
 
             // Extra path length for reflected signal
             float extraPathMeters = reflectedToSpeaker - directDistance;
@@ -1710,7 +1727,7 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
 
             newFRHF[matrixIdx] = frHF;
         }
-    }
+    };
 
     // ==========================================================================
     // INPUT → REVERB FEED CALCULATIONS
@@ -1719,16 +1736,35 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
     // They receive the common attenuation adjustment from outputs but are not
     // included in the minimum search
 
-    // Temporary arrays for reverb feed level post-processing (per reverb, reset per input)
-    std::vector<float> tempReverbAttenuationDb (static_cast<size_t> (numReverbs));
-    std::vector<float> tempReverbAngularAtten (static_cast<size_t> (numReverbs));
-    std::vector<bool> validReverbForMinLatency (static_cast<size_t> (numReverbs), false);
+    // Temporary arrays for reverb feed level post-processing (per reverb, reset
+    // per input), one set per pool slot
+    struct ReverbFeedScratch
+    {
+        std::vector<float> attenuationDb, angularAtten;
+        std::vector<bool> validForMinLatency;
+    };
+    std::vector<ReverbFeedScratch> reverbFeedScratch (static_cast<size_t> (recalcPool.getNumSlots()));
+    for (auto& scratch : reverbFeedScratch)
+    {
+        scratch.attenuationDb.resize (static_cast<size_t> (numReverbs));
+        scratch.angularAtten.resize (static_cast<size_t> (numReverbs));
+        scratch.validForMinLatency.resize (static_cast<size_t> (numReverbs), false);
+    }
 
-    for (int inIdx = 0; inIdx < numInputs; ++inIdx)
+    auto reverbFeedRow = [&] (int inIdx, int slot, RecalcStats& rowStats)
     {
-        // Skip inputs that don't need recalculation (existing values preserved from copy)
-        if (!inputsToRecalc[static_cast<size_t>(inIdx)])
-            continue;
+        // Only inputs that changed, or whose common attenuation lift moved
+        // (existing values preserved from copy). Global and reverb changes
+        // redo every row.
+        if (! inputsToRecalc[static_cast<size_t>(inIdx)] && ! allColumnsDirty && ! needReverbRecalc
+            && commonAttenChanged[static_cast<size_t>(inIdx)] == 0)
+            return;
+
+        ++rowStats.reverbFeedRows;
+
+        auto& tempReverbAttenuationDb = reverbFeedScratch[static_cast<size_t> (slot)].attenuationDb;
+        auto& tempReverbAngularAtten = reverbFeedScratch[static_cast<size_t> (slot)].angularAtten;
+        auto& validReverbForMinLatency = reverbFeedScratch[static_cast<size_t> (slot)].validForMinLatency;
 
         const Position& inputPos = localInputPositions[static_cast<size_t> (inIdx)];
 
@@ -1743,36 +1779,36 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
                 newInputReverbLevels[matrixIdx] = 0.0f;
                 newInputReverbHF[matrixIdx] = 0.0f;
             }
-            continue;
+            return;
         }
 
-        // Get input parameters (same as for outputs). inputAttenuation comes from the
-        // Channel section; distance law/ratio from the Attenuation section.
-        auto inputChannelSection = valueTreeState.getInputChannelSection (inIdx);
-        auto inputAttenSection = valueTreeState.getInputAttenuationSection (inIdx);
-        float inputAtten = inputChannelSection.getProperty (inputAttenuation, inputAttenuationDefault);
+        // Get input parameters (same as for outputs)
+        const auto in = static_cast<size_t> (inIdx);
+        float inputAtten = ip.attenuationDb[in];
 
         // Apply gradient map attenuation offset for reverb feeds too
-        if (static_cast<size_t> (inIdx) < localGradientMapOffsets.size())
-            inputAtten += localGradientMapOffsets[static_cast<size_t> (inIdx)].attenuationDb;
+        if (in < localGradientMapOffsets.size())
+            inputAtten += localGradientMapOffsets[in].attenuationDb;
 
-        float inputDistAtten = inputAttenSection.getProperty (inputDistanceAttenuation, inputDistanceAttenuationDefault);
-        int attenLaw = inputAttenSection.getProperty (inputAttenuationLaw, inputAttenuationLawDefault);
-        float distRatio = inputAttenSection.getProperty (inputDistanceRatio, inputDistanceRatioDefault);
+        float inputDistAtten = ip.distanceAttenuation[in];
+        int attenLaw = ip.attenuationLaw[in];
+        float distRatio = ip.distanceRatio[in];
 
-        int minimalLatencyMode = inputChannelSection.getProperty (inputMinimalLatency, 0);
-        float inputDelayLat = inputChannelSection.getProperty (inputDelayLatency, 0.0f);
+        int minimalLatencyMode = ip.minimalLatency[in];
+        float inputDelayLat = ip.delayLatencyMs[in];
 
-        auto inputPosSection = valueTreeState.getInputPositionSection (inIdx);
-        int heightFactorPercent = inputPosSection.getProperty (inputHeightFactor, inputHeightFactorDefault);
-        float heightFactor = static_cast<float> (heightFactorPercent) / 100.0f;
+        float heightFactor = static_cast<float> (ip.heightFactorPercent[in]) / 100.0f;
 
         // Get input directivity parameters
-        auto inputDirectivitySection = valueTreeState.getInputDirectivitySection (inIdx);
-        int directivityDeg = inputDirectivitySection.getProperty (inputDirectivity, inputDirectivityDefault);
-        int rotationDeg = inputDirectivitySection.getProperty (inputRotation, inputRotationDefault);
-        int tiltDeg = inputDirectivitySection.getProperty (inputTilt, inputTiltDefault);
-        float hfShelfDb = inputDirectivitySection.getProperty (inputHFshelf, inputHFshelfDefault);
+        int directivityDeg = ip.directivityDeg[in];
+        int rotationDeg = ip.rotationDeg[in];
+        int tiltDeg = ip.tiltDeg[in];
+        float hfShelfDb = ip.hfShelfDb[in];
+
+        // Gradient map HF shelf offset applied uniformly to reverb feeds too
+        const float gmHfOffset = (in < localGradientMapOffsets.size())
+                                     ? localGradientMapOffsets[in].hfShelfDb
+                                     : 0.0f;
 
         float directivityRad = static_cast<float> (directivityDeg) * (juce::MathConstants<float>::pi / 180.0f);
         float rotationRad = static_cast<float> (rotationDeg) * (juce::MathConstants<float>::pi / 180.0f);
@@ -1800,11 +1836,10 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
             const Position& reverbFeedPos = localReverbFeedPositions[static_cast<size_t> (revIdx)];
 
             // Get reverb feed parameters
-            auto feedSection = valueTreeState.getReverbFeedSection (revIdx);
-            int reverbMiniLatEnable = feedSection.getProperty (reverbMiniLatencyEnable, reverbMiniLatencyEnableDefault);
             // Note: reverbLSenable (Live Source attenuation enable) reserved for future use
-            int reverbDistAttenPercent = feedSection.getProperty (reverbDistanceAttenEnable, reverbDistanceAttenEnableDefault);
-            float reverbHFdamp = feedSection.getProperty (reverbHFdamping, reverbHFdampingDefault);
+            int reverbMiniLatEnable = rp.miniLatencyEnable[static_cast<size_t> (revIdx)];
+            int reverbDistAttenPercent = rp.distanceAttenPercent[static_cast<size_t> (revIdx)];
+            float reverbHFdamp = rp.hfDamping[static_cast<size_t> (revIdx)];
 
             // Angular attenuation check
             float angularAtten = calculateReverbFeedAngularAttenuation (inIdx, revIdx, inputPos, reverbFeedPos);
@@ -1904,10 +1939,6 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
                 }
             }
 
-            // Gradient map HF shelf offset applied uniformly to reverb feeds too
-            float gmHfOffset = (static_cast<size_t> (inIdx) < localGradientMapOffsets.size())
-                                   ? localGradientMapOffsets[static_cast<size_t> (inIdx)].hfShelfDb
-                                   : 0.0f;
             float hfAtten = hfAttenReverb + hfAttenDirectivity + gmHfOffset;
             newInputReverbHF[matrixIdx] = juce::jlimit (-60.0f, 0.0f, hfAtten);
         }
@@ -1953,8 +1984,7 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
                 const size_t matrixIdx = static_cast<size_t> (inIdx * numReverbs + revIdx);
                 if (newInputReverbLevels[matrixIdx] > 0.0f)
                 {
-                    auto channelSection = valueTreeState.getReverbChannelSection (revIdx);
-                    float reverbDelayLat = channelSection.getProperty (reverbDelayLatency, reverbDelayLatencyDefault);
+                    float reverbDelayLat = rp.delayLatencyMs[static_cast<size_t> (revIdx)];
 
                     float finalDelay = newInputReverbDelays[matrixIdx] + globalHaasEffect - globalSystemLatency
                                        + inputDelayLat + reverbDelayLat;
@@ -1983,6 +2013,40 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
 
             newInputReverbLevels[matrixIdx] = linearLevel;
         }
+    };
+
+    // ==========================================================================
+    // ROW DISPATCH
+    // ==========================================================================
+    // Each input row writes only its own slice of every matrix and its own
+    // ramp/aggregate entries, so rows run on the pool in any order and the
+    // result is identical to a serial pass. Counters are kept per slot and
+    // summed afterwards.
+
+    std::vector<RecalcStats> slotStats (static_cast<size_t> (recalcPool.getNumSlots()));
+
+    recalcPool.run (numInputs, [&] (int inIdx, int slot)
+    {
+        auto& rowStats = slotStats[static_cast<size_t> (slot)];
+        directRow (inIdx, rowStats);
+        floorReflectionRow (inIdx);
+        reverbFeedRow (inIdx, slot, rowStats);
+    });
+
+    // Every flagged pair was finalised above, so its gain is now applied
+    for (const auto idx : lsChangedPairs)
+        lsPairChanged[idx] = 0;
+    lsChangedPairs.clear();
+    std::fill (lsRowChanged.begin(), lsRowChanged.end(), uint8_t (0));
+
+    for (const auto& slotStat : slotStats)
+    {
+        stats.rowsFull += slotStat.rowsFull;
+        stats.rowsPartial += slotStat.rowsPartial;
+        stats.rowsKernelSkipped += slotStat.rowsKernelSkipped;
+        stats.pairsKernel += slotStat.pairsKernel;
+        stats.pairsFinalised += slotStat.pairsFinalised;
+        stats.reverbFeedRows += slotStat.reverbFeedRows;
     }
 
     // ==========================================================================
@@ -1991,26 +2055,41 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
     // Reverb returns act like simplified inputs (ambient sources)
     // Only recalculate if outputs or reverbs have changed (existing values preserved from copy)
 
-    if (needOutputRecalc || needReverbRecalc)
+    stats.reverbReturnsRecomputed = anyDirtyColumn || needReverbRecalc;
+
+    if (stats.reverbReturnsRecomputed)
     {
-    // Temporary arrays for reverb return level post-processing
-    std::vector<float> tempReverbReturnAttenDb (static_cast<size_t> (numOutputs));
-    std::vector<float> tempReverbReturnAngularAtten (static_cast<size_t> (numOutputs));
-    std::vector<bool> validOutputForReverbMinLatency (static_cast<size_t> (numOutputs), false);
-    std::vector<bool> validOutputForReverbCommonAtten (static_cast<size_t> (numOutputs), false);
+    // Temporary arrays for reverb return level post-processing, one set per pool slot
+    struct ReverbReturnScratch
+    {
+        std::vector<float> attenDb, angularAtten;
+        std::vector<bool> validForMinLatency, validForCommonAtten;
+    };
+    std::vector<ReverbReturnScratch> reverbReturnScratch (static_cast<size_t> (recalcPool.getNumSlots()));
+    for (auto& scratch : reverbReturnScratch)
+    {
+        scratch.attenDb.resize (static_cast<size_t> (numOutputs));
+        scratch.angularAtten.resize (static_cast<size_t> (numOutputs));
+        scratch.validForMinLatency.resize (static_cast<size_t> (numOutputs), false);
+        scratch.validForCommonAtten.resize (static_cast<size_t> (numOutputs), false);
+    }
 
-    for (int revIdx = 0; revIdx < numReverbs; ++revIdx)
+    // One reverb's row per task (same independence as the input rows)
+    recalcPool.run (numReverbs, [&] (int revIdx, int slot)
     {
+        auto& tempReverbReturnAttenDb = reverbReturnScratch[static_cast<size_t> (slot)].attenDb;
+        auto& tempReverbReturnAngularAtten = reverbReturnScratch[static_cast<size_t> (slot)].angularAtten;
+        auto& validOutputForReverbMinLatency = reverbReturnScratch[static_cast<size_t> (slot)].validForMinLatency;
+        auto& validOutputForReverbCommonAtten = reverbReturnScratch[static_cast<size_t> (slot)].validForCommonAtten;
+
         const Position& returnPos = localReverbReturnPositions[static_cast<size_t> (revIdx)];
 
         // Get reverb return parameters
-        auto returnSection = valueTreeState.getReverbReturnSection (revIdx);
-        float reverbDistAtten = returnSection.getProperty (reverbDistanceAttenuation, reverbDistanceAttenuationDefault);
-        int reverbCommonAttenPct = returnSection.getProperty (reverbCommonAtten, reverbCommonAttenDefault);
+        float reverbDistAtten = rp.returnDistanceAttenuation[static_cast<size_t> (revIdx)];
+        int reverbCommonAttenPct = rp.returnCommonAttenPercent[static_cast<size_t> (revIdx)];
         float reverbCommonAttenFactor = static_cast<float> (reverbCommonAttenPct) / 100.0f;
 
-        auto feedSection = valueTreeState.getReverbFeedSection (revIdx);
-        int reverbMiniLatEnable = feedSection.getProperty (reverbMiniLatencyEnable, reverbMiniLatencyEnableDefault);
+        int reverbMiniLatEnable = rp.miniLatencyEnable[static_cast<size_t> (revIdx)];
 
         // Reset tracking arrays
         std::fill (validOutputForReverbMinLatency.begin(), validOutputForReverbMinLatency.end(), false);
@@ -2035,12 +2114,9 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
             const Position& listenerPos = localListenerPositions[static_cast<size_t> (outIdx)];
 
             // Get output parameters
-            auto outputOptionsSection = valueTreeState.getOutputOptionsSection (outIdx);
-            auto outputPositionSection = valueTreeState.getOutputPositionSection (outIdx);
-
-            int outputMiniLatEnable = outputOptionsSection.getProperty (outputMiniLatencyEnable, 1);
-            float outputDistAttenPercent = outputOptionsSection.getProperty (outputDistanceAttenPercent, 100.0f);
-            float outputHFdamp = outputPositionSection.getProperty (outputHFdamping, outputHFdampingDefault);
+            int outputMiniLatEnable = op.miniLatencyEnable[static_cast<size_t> (outIdx)];
+            float outputDistAttenPercent = op.distanceAttenPercent[static_cast<size_t> (outIdx)];
+            float outputHFdamp = op.hfDamping[static_cast<size_t> (outIdx)];
 
             // Angular attenuation: use output's angular parameters on reverb return position
             // (reverb returns are treated like inputs - can be screened by speaker facing)
@@ -2162,36 +2238,72 @@ void WFSCalculationEngine::recalculateMatrix (const float* lsGains)
 
             newReverbOutputLevels[matrixIdx] = linearLevel;
         }
+    });
+    } // End of if (stats.reverbReturnsRecomputed)
+
+    {
+        const juce::SpinLock::ScopedLockType sl (recalcStatsLock);
+        lastRecalcStats = stats;
+    }
+
+    // Delay derivative against the previous generation
+    std::vector<float> newDelayRates (newDelays.size(), 0.0f);
+    {
+        const auto now = juce::Time::getHighResolutionTicks();
+        const double dt = lastDelayPublishTicks != 0
+                              ? juce::Time::highResolutionTicksToSeconds (now - lastDelayPublishTicks) : 0.0;
+        lastDelayPublishTicks = now;
+
+        const auto& previousDelays = previous->delayTimesMs;
+        if (dt > 0.0 && dt <= maxDelayRateGapSeconds && previousDelays.size() == newDelays.size())
+        {
+            const auto invDt = static_cast<float> (1.0 / dt);
+            for (size_t i = 0; i < newDelays.size(); ++i)
+            {
+                const float rate = (newDelays[i] - previousDelays[i]) * invDt;
+                newDelayRates[i] = std::abs (rate) <= maxDelayRateMsPerS ? rate : 0.0f;
+            }
+        }
     }
-    } // End of if (needOutputRecalc || needReverbRecalc)
 
-    // Update all matrices under lock
+    // Publish the results as one generation for readMatrices(). The
+    // temporaries are swapped in (no copy); the slot's old buffers die with them.
     {
-        const juce::ScopedLock sl (matrixLock);
-
-        // Copy into existing vectors rather than std::move — keeps internal
-        // data pointers stable so the audio thread (which holds raw .data()
-        // pointers between lock acquisitions) never sees a dangling pointer.
-
-        // Input → Output
-        std::copy (newDelays.begin(), newDelays.end(), delayTimesMs.begin());
-        std::copy (newLevels.begin(), newLevels.end(), levels.begin());
-        std::copy (newHF.begin(), newHF.end(), hfAttenuationDb.begin());
-
-        // Floor Reflections
-        std::copy (newFRDelays.begin(), newFRDelays.end(), frDelayTimesMs.begin());
-        std::copy (newFRLevels.begin(), newFRLevels.end(), frLevels.begin());
-        std::copy (newFRHF.begin(), newFRHF.end(), frHFAttenuationDb.begin());
-
-        // Input → Reverb Feed
-        std::copy (newInputReverbDelays.begin(), newInputReverbDelays.end(), inputReverbDelayTimesMs.begin());
-        std::copy (newInputReverbLevels.begin(), newInputReverbLevels.end(), inputReverbLevels.begin());
-        std::copy (newInputReverbHF.begin(), newInputReverbHF.end(), inputReverbHFAttenuationDb.begin());
-
-        // Reverb Return → Output
-        std::copy (newReverbOutputDelays.begin(), newReverbOutputDelays.end(), reverbOutputDelayTimesMs.begin());
-        std::copy (newReverbOutputLevels.begin(), newReverbOutputLevels.end(), reverbOutputLevels.begin());
-        std::copy (newReverbOutputHF.begin(), newReverbOutputHF.end(), reverbOutputHFAttenuationDb.begin());
+        const int slot = acquireFreeMatrixSlot();
+        auto& set = matrixSlots[static_cast<size_t> (slot)];
+
+        set.delayTimesMs.swap (newDelays);
+        set.delayRatesMsPerS.swap (newDelayRates);
+        set.levels.swap (newLevels);
+        set.hfAttenuationDb.swap (newHF);
+        set.frDelayTimesMs.swap (newFRDelays);
+        set.frLevels.swap (newFRLevels);
+        set.frHFAttenuationDb.swap (newFRHF);
+        set.inputReverbDelayTimesMs.swap (newInputReverbDelays);
+        set.inputReverbLevels.swap (newInputReverbLevels);
+        set.inputReverbHFAttenuationDb.swap (newInputReverbHF);
+        set.reverbOutputDelayTimesMs.swap (newReverbOutputDelays);
+        set.reverbOutputLevels.swap (newReverbOutputLevels);
+        set.reverbOutputHFAttenuationDb.swap (newReverbOutputHF);
+
+        set.generation = matrixGeneration.load (std::memory_order_relaxed) + 1;
+        currentMatrixSlot.store (slot);
+        matrixGeneration.store (set.generation, std::memory_order_release);
+    }
+
+    // Every position frame this pass consumed, stamped with the generation it
+    // is published in; the renderer side is stamped by the audio callback
+    if (latencyTracer != nullptr)
+    {
+        const auto now = juce::Time::getHighResolutionTicks();
+        const auto generation = matrixGeneration.load (std::memory_order_relaxed);
+        for (size_t i = 0; i < localTracked.size(); ++i)
+        {
+            const auto& tracked = localTracked[i];
+            if (tracked.fresh && tracked.routedTicks != 0)
+                latencyTracer->pushFrame (static_cast<int> (i), tracked.receiptTicks,
+                                          tracked.routedTicks, now, generation);
+        }
     }
 
     // Update ramp states under position lock
@@ -2217,8 +2329,7 @@ float WFSCalculationEngine::getDelayMs (int inputIndex, int outputIndex) const
         outputIndex < 0 || outputIndex >= numOutputs)
         return 0.0f;
 
-    const juce::ScopedLock sl (matrixLock);
-    return delayTimesMs[static_cast<size_t> (inputIndex * numOutputs + outputIndex)];
+    return readMatrices()->delayTimesMs[static_cast<size_t> (inputIndex * numOutputs + outputIndex)];
 }
 
 float WFSCalculationEngine::getLevel (int inputIndex, int outputIndex) const
@@ -2227,8 +2338,7 @@ float WFSCalculationEngine::getLevel (int inputIndex, int outputIndex) const
         outputIndex < 0 || outputIndex >= numOutputs)
         return 0.0f;
 
-    const juce::ScopedLock sl (matrixLock);
-    return levels[static_cast<size_t> (inputIndex * numOutputs + outputIndex)];
+    return readMatrices()->levels[static_cast<size_t> (inputIndex * numOutputs + outputIndex)];
 }
 
 float WFSCalculationEngine::getHFAttenuation (int inputIndex, int outputIndex) const
@@ -2237,8 +2347,40 @@ float WFSCalculationEngine::getHFAttenuation (int inputIndex, int outputIndex) c
         outputIndex < 0 || outputIndex >= numOutputs)
         return 0.0f;
 
-    const juce::ScopedLock sl (matrixLock);
-    return hfAttenuationDb[static_cast<size_t> (inputIndex * numOutputs + outputIndex)];
+    return readMatrices()->hfAttenuationDb[static_cast<size_t> (inputIndex * numOutputs + outputIndex)];
+}
+
+WFSCalculationEngine::MatrixReadHandle WFSCalculationEngine::readMatrices() const
+{
+    // Pin the current slot, then confirm it is still current: if a publish
+    // slipped in between, the writer may already be refilling the slot we saw.
+    // The writer never touches the current slot, so a confirmed pin is stable.
+    for (;;)
+    {
+        const int slot = currentMatrixSlot.load();
+        matrixSlotReaders[static_cast<size_t> (slot)].fetch_add (1);
+
+        if (currentMatrixSlot.load() == slot)
+            return MatrixReadHandle (*this, slot);
+
+        matrixSlotReaders[static_cast<size_t> (slot)].fetch_sub (1);
+    }
+}
+
+int WFSCalculationEngine::acquireFreeMatrixSlot() const
+{
+    // Only recalculateMatrix() writes (serialised by recalcLock). Readers pin
+    // briefly, so with four slots a free one is virtually always available.
+    const int current = currentMatrixSlot.load();
+
+    for (;;)
+    {
+        for (int i = 0; i < numMatrixSlots; ++i)
+            if (i != current && matrixSlotReaders[static_cast<size_t> (i)].load() == 0)
+                return i;
+
+        juce::Thread::yield();
+    }
 }
 
 //==============================================================================
@@ -2315,10 +2457,232 @@ int WFSCalculationEngine::findReverbIndexFromTree (const juce::ValueTree& tree)
     return -1;
 }
 
+//==============================================================================
+// Parameter Mirror
+//==============================================================================
+
+void WFSCalculationEngine::refreshInputParams (int inputIndex)
+{
+    if (inputIndex < 0 || inputIndex >= numInputs)
+        return;
+
+    const auto i = static_cast<size_t> (inputIndex);
+    const juce::ScopedLock sl (paramLock);
+    paramsVersion.fetch_add (1, std::memory_order_release);   // readers block on paramLock until we are done
+    auto& p = liveParams.inputs;
+
+    // inputAttenuation lives in the Channel section - that is where the GUI, OSC
+    // and snapshot system all read/write it - while the Attenuation section holds
+    // the distance law, ratio and common-atten.
+    auto channelSection = valueTreeState.getInputChannelSection (inputIndex);
+    p.attenuationDb[i]  = static_cast<float> (channelSection.getProperty (inputAttenuation, inputAttenuationDefault));
+    p.minimalLatency[i] = static_cast<int> (channelSection.getProperty (inputMinimalLatency, 0));
+    p.delayLatencyMs[i] = static_cast<float> (channelSection.getProperty (inputDelayLatency, 0.0f));
+
+    auto attenSection = valueTreeState.getInputAttenuationSection (inputIndex);
+    p.distanceAttenuation[i] = static_cast<float> (attenSection.getProperty (inputDistanceAttenuation, inputDistanceAttenuationDefault));
+    p.attenuationLaw[i]      = static_cast<int> (attenSection.getProperty (inputAttenuationLaw, inputAttenuationLawDefault));
+    p.distanceRatio[i]       = static_cast<float> (attenSection.getProperty (inputDistanceRatio, inputDistanceRatioDefault));
+    p.commonAttenPercent[i]  = static_cast<int> (attenSection.getProperty (inputCommonAtten, inputCommonAttenDefault));
+
+    auto posSection = valueTreeState.getInputPositionSection (inputIndex);
+    p.heightFactorPercent[i] = static_cast<int> (posSection.getProperty (inputHeightFactor, inputHeightFactorDefault));
+    p.flipX[i] = static_cast<int> (posSection.getProperty (inputFlipX, 0)) != 0 ? 1 : 0;
+    p.flipY[i] = static_cast<int> (posSection.getProperty (inputFlipY, 0)) != 0 ? 1 : 0;
+    p.flipZ[i] = static_cast<int> (posSection.getProperty (inputFlipZ, 0)) != 0 ? 1 : 0;
+    p.offsetX[i] = static_cast<float> (posSection.getProperty (inputOffsetX, 0.0f));
+    p.offsetY[i] = static_cast<float> (posSection.getProperty (inputOffsetY, 0.0f));
+    p.offsetZ[i] = static_cast<float> (posSection.getProperty (inputOffsetZ, 0.0f));
+    p.constraintX[i] = static_cast<int> (posSection.getProperty (inputConstraintX, 1)) != 0 ? 1 : 0;
+    p.constraintY[i] = static_cast<int> (posSection.getProperty (inputConstraintY, 1)) != 0 ? 1 : 0;
+    p.constraintZ[i] = static_cast<int> (posSection.getProperty (inputConstraintZ, 1)) != 0 ? 1 : 0;
+
+    auto directivitySection = valueTreeState.getInputDirectivitySection (inputIndex);
+    p.directivityDeg[i] = static_cast<int> (directivitySection.getProperty (inputDirectivity, inputDirectivityDefault));
+    p.rotationDeg[i]    = static_cast<int> (directivitySection.getProperty (inputRotation, inputRotationDefault));
+    p.tiltDeg[i]        = static_cast<int> (directivitySection.getProperty (inputTilt, inputTiltDefault));
+    p.hfShelfDb[i]      = static_cast<float> (directivitySection.getProperty (inputHFshelf, inputHFshelfDefault));
+
+    auto mutesSection = valueTreeState.getInputMutesSection (inputIndex);
+    p.muteReverbSends[i] = static_cast<int> (mutesSection.getProperty (inputMuteReverbSends, 0)) != 0 ? 1 : 0;
+    p.sidelinesActive[i] = static_cast<int> (mutesSection.getProperty (inputSidelinesActive, 0)) != 0 ? 1 : 0;
+    p.sidelinesFringe[i] = static_cast<float> (mutesSection.getProperty (inputSidelinesFringe, 1.0f));
+
+    const juce::Identifier* arrayAttenIds[numArrayGroups] = {
+        &inputArrayAtten1, &inputArrayAtten2, &inputArrayAtten3, &inputArrayAtten4, &inputArrayAtten5,
+        &inputArrayAtten6, &inputArrayAtten7, &inputArrayAtten8, &inputArrayAtten9, &inputArrayAtten10 };
+    float* arrayAtten = p.arrayAttenDb.data() + i * static_cast<size_t> (numArrayGroups);
+    for (int a = 0; a < numArrayGroups; ++a)
+        arrayAtten[a] = static_cast<float> (mutesSection.getProperty (*arrayAttenIds[a], inputArrayAttenDefault));
+
+    // Per-output routing mutes: comma-separated 0/1 list, missing entries = unmuted
+    juce::StringArray mutesPerOutput;
+    mutesPerOutput.addTokens (mutesSection.getProperty (inputMutes).toString(), ",", "");
+    uint8_t* muted = p.routingMuted.data() + i * static_cast<size_t> (numOutputs);
+    for (int out = 0; out < numOutputs; ++out)
+        muted[out] = (out < mutesPerOutput.size() && mutesPerOutput[out].getIntValue() != 0) ? 1 : 0;
+
+    auto hackousticsSection = valueTreeState.getInputHackousticsSection (inputIndex);
+    p.frActive[i] = static_cast<int> (hackousticsSection.getProperty (inputFRactive, 0)) != 0 ? 1 : 0;
+    p.frAttenuationDb[i] = static_cast<float> (hackousticsSection.getProperty (inputFRattenuation, -3.0f));
+}
+
+void WFSCalculationEngine::refreshOutputParams (int outputIndex)
+{
+    if (outputIndex < 0 || outputIndex >= numOutputs)
+        return;
+
+    const auto o = static_cast<size_t> (outputIndex);
+    const juce::ScopedLock sl (paramLock);
+    paramsVersion.fetch_add (1, std::memory_order_release);
+    auto& p = liveParams.outputs;
+
+    auto optionsSection = valueTreeState.getOutputOptionsSection (outputIndex);
+    p.miniLatencyEnable[o]    = static_cast<int> (optionsSection.getProperty (outputMiniLatencyEnable, 1));
+    p.distanceAttenPercent[o] = static_cast<float> (optionsSection.getProperty (outputDistanceAttenPercent, 100.0f));
+    p.frEnable[o]             = static_cast<int> (optionsSection.getProperty (outputFRenable, 1));
+
+    auto channelSection = valueTreeState.getOutputChannelSection (outputIndex);
+    p.arrayAssignment[o] = static_cast<int> (channelSection.getProperty (outputArray, outputArrayDefault));
+    p.delayLatencyMs[o]  = static_cast<float> (channelSection.getProperty (outputDelayLatency, 0.0f));
+
+    auto positionSection = valueTreeState.getOutputPositionSection (outputIndex);
+    p.hfDamping[o] = static_cast<float> (positionSection.getProperty (outputHFdamping, outputHFdampingDefault));
+    p.angular.set (o,
+                   static_cast<int> (positionSection.getProperty (outputOrientation, 0)),
+                   static_cast<int> (positionSection.getProperty (outputPitch, outputPitchDefault)),
+                   static_cast<int> (positionSection.getProperty (outputAngleOn, outputAngleOnDefault)),
+                   static_cast<int> (positionSection.getProperty (outputAngleOff, outputAngleOffDefault)));
+}
+
+void WFSCalculationEngine::refreshReverbParams (int reverbIndex)
+{
+    if (reverbIndex < 0 || reverbIndex >= numReverbs)
+        return;
+
+    const auto r = static_cast<size_t> (reverbIndex);
+    const juce::ScopedLock sl (paramLock);
+    paramsVersion.fetch_add (1, std::memory_order_release);
+    auto& p = liveParams.reverbs;
+
+    auto feedSection = valueTreeState.getReverbFeedSection (reverbIndex);
+    p.miniLatencyEnable[r]    = static_cast<int> (feedSection.getProperty (reverbMiniLatencyEnable, reverbMiniLatencyEnableDefault));
+    p.distanceAttenPercent[r] = static_cast<int> (feedSection.getProperty (reverbDistanceAttenEnable, reverbDistanceAttenEnableDefault));
+    p.hfDamping[r]            = static_cast<float> (feedSection.getProperty (reverbHFdamping, reverbHFdampingDefault));
+    p.feedAngular.set (r,
+                       static_cast<int> (feedSection.getProperty (reverbOrientation, reverbOrientationDefault)),
+                       static_cast<int> (feedSection.getProperty (reverbPitch, reverbPitchDefault)),
+                       static_cast<int> (feedSection.getProperty (reverbAngleOn, reverbAngleOnDefault)),
+                       static_cast<int> (feedSection.getProperty (reverbAngleOff, reverbAngleOffDefault)));
+
+    auto channelSection = valueTreeState.getReverbChannelSection (reverbIndex);
+    p.delayLatencyMs[r] = static_cast<float> (channelSection.getProperty (reverbDelayLatency, reverbDelayLatencyDefault));
+
+    auto returnSection = valueTreeState.getReverbReturnSection (reverbIndex);
+    p.returnDistanceAttenuation[r] = static_cast<float> (returnSection.getProperty (reverbDistanceAttenuation, reverbDistanceAttenuationDefault));
+    p.returnCommonAttenPercent[r]  = static_cast<int> (returnSection.getProperty (reverbCommonAtten, reverbCommonAttenDefault));
+
+    juce::StringArray mutesPerOutput;
+    mutesPerOutput.addTokens (returnSection.getProperty (reverbMutes).toString(), ",", "");
+    uint8_t* muted = p.outputMuted.data() + r * static_cast<size_t> (numOutputs);
+    for (int out = 0; out < numOutputs; ++out)
+        muted[out] = (out < mutesPerOutput.size() && mutesPerOutput[out].getIntValue() != 0) ? 1 : 0;
+}
+
+void WFSCalculationEngine::refreshGlobalParams()
+{
+    const juce::ScopedLock sl (paramLock);
+    paramsVersion.fetch_add (1, std::memory_order_release);
+    auto& g = liveParams.global;
+
+    auto masterState = valueTreeState.getMasterState();
+    g.haasEffect = static_cast<float> (masterState.getProperty (haasEffect, haasEffectDefault));
+    g.systemLatency = static_cast<float> (masterState.getProperty (systemLatency, systemLatencyDefault));
+
+    auto stageState = valueTreeState.getStageState();
+    g.stageValid = stageState.isValid();
+    if (! g.stageValid)
+        return;
+
+    g.stageShape = static_cast<int> (stageState.getProperty (WFSParameterIDs::stageShape, 0));
+    const float stageW = static_cast<float> (stageState.getProperty (WFSParameterIDs::stageWidth, 20.0f));
+    const float stageD = static_cast<float> (stageState.getProperty (WFSParameterIDs::stageDepth, 20.0f));
+    const float stageH = static_cast<float> (stageState.getProperty (WFSParameterIDs::stageHeight, 10.0f));
+    const float stageDiam = static_cast<float> (stageState.getProperty (WFSParameterIDs::stageDiameter, 20.0f));
+    const float originH = static_cast<float> (stageState.getProperty (WFSParameterIDs::originHeight, 0.0f));
+    g.originWidth = static_cast<float> (stageState.getProperty (WFSParameterIDs::originWidth, 0.0f));
+    g.originDepth = static_cast<float> (stageState.getProperty (WFSParameterIDs::originDepth, 0.0f));
+
+    // Composite constraint bounds (cylinder/dome use the diameter on both axes)
+    const float halfWidth = (g.stageShape == 0) ? stageW / 2.0f : stageDiam / 2.0f;
+    const float halfDepth = (g.stageShape == 0) ? stageD / 2.0f : stageDiam / 2.0f;
+    g.minX = -halfWidth - g.originWidth;
+    g.maxX = halfWidth - g.originWidth;
+    g.minY = -halfDepth - g.originDepth;
+    g.maxY = halfDepth - g.originDepth;
+    g.minZ = -originH;
+    g.maxZ = stageH - originH;
+
+    // Sideline edges in origin-relative coordinates (box: left, right, upstage)
+    g.leftEdge = -stageW / 2.0f - g.originWidth;
+    g.rightEdge = stageW / 2.0f - g.originWidth;
+    g.upstageEdge = stageD / 2.0f - g.originDepth;
+    g.radius = stageDiam / 2.0f;
+}
+
+void WFSCalculationEngine::syncCalcParams()
+{
+    const auto version = paramsVersion.load (std::memory_order_acquire);
+    if (version == calcParamsVersion)
+        return;
+
+    // Vector assignment reuses calcParams' capacity, so after the first pass
+    // this only copies
+    const juce::ScopedLock sl (paramLock);
+    calcParams = liveParams;
+    calcParamsVersion = paramsVersion.load (std::memory_order_relaxed);
+}
+
+void WFSCalculationEngine::refreshAllParams()
+{
+    refreshGlobalParams();
+
+    for (int i = 0; i < numInputs; ++i)
+        refreshInputParams (i);
+
+    for (int i = 0; i < numOutputs; ++i)
+        refreshOutputParams (i);
+
+    for (int i = 0; i < numReverbs; ++i)
+        refreshReverbParams (i);
+}
+
 //==============================================================================
 // ValueTree::Listener
 //==============================================================================
 
+void WFSCalculationEngine::valueTreeChildAdded (juce::ValueTree&, juce::ValueTree&)
+{
+    // Channel count change or section rebuild (config reload): refresh the whole
+    // parameter mirror once, after the burst of child events settles
+    triggerAsyncUpdate();
+}
+
+void WFSCalculationEngine::valueTreeChildRemoved (juce::ValueTree&, juce::ValueTree&, int)
+{
+    triggerAsyncUpdate();
+}
+
+void WFSCalculationEngine::handleAsyncUpdate()
+{
+    refreshAllParams();
+
+    // Every pair must be recomputed against the rebuilt mirror
+    outputsDirty.store (true);
+    reverbsDirty.store (true);
+    matrixDirty.store (true);
+}
+
 void WFSCalculationEngine::valueTreePropertyChanged (juce::ValueTree& tree,
                                                       const juce::Identifier& property)
 {
@@ -2337,15 +2701,18 @@ void WFSCalculationEngine::valueTreePropertyChanged (juce::ValueTree& tree,
 
         if (outputIndex >= 0 && outputIndex < numOutputs)
         {
+            // Orientation also drives the angular zones in the parameter mirror
+            if (property == outputOrientation)
+                refreshOutputParams (outputIndex);
+
             const juce::ScopedLock sl (positionLock);
 
             if (isOutputPositionProperty)
                 updateSpeakerPosition (outputIndex);
 
             recalculateListenerPosition (outputIndex);
-            // Output changed - affects ALL inputs, need full recalc
-            outputsDirty.store(true);
-            matrixDirty.store(true);
+            // Output changed - recompute its column for every input
+            markOutputDirty (outputIndex);
         }
         return;
     }
@@ -2443,8 +2810,8 @@ void WFSCalculationEngine::valueTreePropertyChanged (juce::ValueTree& tree,
                                 property == inputArrayAtten9 ||
                                 property == inputArrayAtten10);
 
-    // Live Source Tamer parameters (affect level calculations via the lsGains
-    // array passed into recalculateMatrix())
+    // Live Source Tamer parameters (affect level calculations via the LS gain
+    // overlay passed into recalculateMatrix())
     bool isInputLSProperty = (property == inputLSactive ||
                               property == inputLSradius ||
                               property == inputLSshape ||
@@ -2476,14 +2843,22 @@ void WFSCalculationEngine::valueTreePropertyChanged (juce::ValueTree& tree,
                               property == inputFRhighShelfSlope ||
                               property == inputFRdiffusion);
 
+    // Composite position constraint toggles (clamp to stage bounds per axis)
+    bool isInputConstraintProperty = (property == inputConstraintX ||
+                                      property == inputConstraintY ||
+                                      property == inputConstraintZ);
+
     if (isInputAttenProperty || isInputChannelProperty || isInputHeightProperty ||
         isInputDirectivityProperty || isInputMuteProperty || isInputLSProperty ||
-        isInputFlipProperty || isInputOffsetProperty || isInputFRProperty)
+        isInputFlipProperty || isInputOffsetProperty || isInputFRProperty ||
+        isInputConstraintProperty)
     {
         int inputIndex = findInputIndexFromTree (tree);
 
         if (inputIndex >= 0 && inputIndex < numInputs)
         {
+            refreshInputParams (inputIndex);
+
             const juce::ScopedLock sl (positionLock);
             inputDirtyFlags[static_cast<size_t> (inputIndex)] = true;
             matrixDirty.store(true);
@@ -2511,9 +2886,15 @@ void WFSCalculationEngine::valueTreePropertyChanged (juce::ValueTree& tree,
 
     if (isOutputOptionProperty || isOutputAngularProperty)
     {
-        // Output parameter changed - affects ALL inputs
-        outputsDirty.store(true);
-        matrixDirty.store(true);
+        int outputIndex = findOutputIndexFromTree (tree);
+        if (outputIndex >= 0 && outputIndex < numOutputs)
+        {
+            refreshOutputParams (outputIndex);
+
+            // Output parameter changed - recompute its column for every input
+            const juce::ScopedLock sl (positionLock);
+            markOutputDirty (outputIndex);
+        }
         return;
     }
 
@@ -2538,6 +2919,10 @@ void WFSCalculationEngine::valueTreePropertyChanged (juce::ValueTree& tree,
 
     if (isReverbFeedProperty || isReverbReturnProperty)
     {
+        int reverbIndex = findReverbIndexFromTree (tree);
+        if (reverbIndex >= 0 && reverbIndex < numReverbs)
+            refreshReverbParams (reverbIndex);
+
         // Reverb parameter changed - affects ALL inputs for reverb matrices
         reverbsDirty.store(true);
         matrixDirty.store(true);
@@ -2553,10 +2938,22 @@ void WFSCalculationEngine::valueTreePropertyChanged (juce::ValueTree& tree,
 
     if (isMasterProperty)
     {
+        refreshGlobalParams();
+
         // Global parameter changed - affects everything
         outputsDirty.store(true);
         reverbsDirty.store(true);
         matrixDirty.store(true);
         return;
     }
+
+    // ==========================================================================
+    // STAGE GEOMETRY (composite constraints + sidelines)
+    // ==========================================================================
+
+    if (tree.hasType (Stage))
+    {
+        refreshGlobalParams();
+        markAllInputsDirty();
+    }
 }
@@ -1,9 +1,14 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include <array>
 #include "../Parameters/WFSValueTreeState.h"
 #include "../Parameters/WFSParameterIDs.h"
 #include "../Parameters/WFSParameterDefaults.h"
+#include "WFSMatrixKernel.h"
+#include "ControlRateParallelFor.h"
+#include "MotionLatencyTracer.h"
+#include "LSGainOverlay.h"
 
 //==============================================================================
 /**
@@ -24,9 +29,29 @@
     Update Strategy:
     - Listener/speaker positions: Cached, update on output param change
     - Input positions: Cached, update on input param change
-    - Matrix (delays/levels/HF): Recalculated on demand via recalculateMatrix()
+    - Matrix parameters: Mirrored into flat per-channel arrays, refreshed per
+      channel on param change (the matrix loops never touch the ValueTree)
+    - Matrix (delays/levels/HF): Recalculated on demand via recalculateMatrix(),
+      incrementally: a dirty input redoes its row, a dirty output its column,
+      changed LS gains only their pairs. Raw geometry terms are cached per pair
+      so an input whose kernel terms did not change (e.g. a Z-only move at
+      height factor 0) skips the kernel. See getLastRecalcStats()
+
+    Threading:
+    - ValueTree listeners and position updates run on the message thread
+    - recalculateMatrix() may run on a control-rate worker (ControlRateWorker).
+      It reads a private copy of the parameter mirror, taken under paramLock
+      only when a refresh bumped paramsVersion, and is serialised by recalcLock
+      so message-thread callers (config reload) can still force a recalc.
+      Its input and reverb rows can be spread over a ControlRateParallelFor
+      pool (setRecalcWorkers()); rows are independent, so the result is the
+      same for any worker count
+    - Each pass publishes all matrices as one generation (readMatrices()),
+      read without locks. Consumers that need stable pointers across passes
+      copy from a pinned generation into their own arrays
 */
-class WFSCalculationEngine : private juce::ValueTree::Listener
+class WFSCalculationEngine : private juce::ValueTree::Listener,
+                             private juce::AsyncUpdater
 {
 public:
     //==========================================================================
@@ -39,6 +64,13 @@ public:
 
     //==========================================================================
     explicit WFSCalculationEngine (WFSValueTreeState& state);
+
+    /** Sizes the matrices to explicit channel counts instead of the
+        WFSParameterDefaults maxima. Used by headless harnesses
+        (tools/validation/matrix-bench) to exercise larger systems. */
+    WFSCalculationEngine (WFSValueTreeState& state,
+                          int numInputChannels, int numOutputChannels, int numReverbChannels);
+
     ~WFSCalculationEngine() override;
 
     //==========================================================================
@@ -101,6 +133,32 @@ public:
     /** Get gradient map offsets for an input */
     GradientMapOffsets getGradientMapOffsets (int inputIndex) const;
 
+    //==========================================================================
+    // Tracked Offset Fast Path
+    //==========================================================================
+
+    /** Latest filtered tracking offset for an input, bypassing the ValueTree
+        (see WFSNetwork::TrackingFastPath). While a slot is active it replaces
+        inputOffsetX/Y/Z in the composite position; the ValueTree copy is
+        committed at a decimated rate for UI and feedback. Lock-free (one
+        seqlock per input), single writer: the tracking drain on the message
+        thread. receiptTicks / routedTicks are the high-resolution ticks the
+        frame arrived and was routed at (0 = unknown), for MotionLatencyTracer. */
+    void setTrackedOffset (int inputIndex, float x, float y, float z,
+                           juce::int64 receiptTicks, juce::int64 routedTicks);
+
+    /** Hand the input back to its ValueTree offset (tracking went idle). */
+    void releaseTrackedOffset (int inputIndex);
+
+    /** Stamp a position frame that went through the ValueTree instead
+        (tracking with the fast path off, OSC / Remote position writes), so
+        the latency tracer sees every route the same way. */
+    void notePositionFrame (int inputIndex, juce::int64 receiptTicks, juce::int64 routedTicks);
+
+    /** Frames consumed by recalculateMatrix() are reported here (nullptr = off).
+        Set before the control-rate worker starts. */
+    void setLatencyTracer (MotionLatencyTracer* tracer) { latencyTracer = tracer; }
+
     //==========================================================================
     // Speed-Limited Position Support
     //==========================================================================
@@ -124,15 +182,34 @@ public:
     //==========================================================================
 
     /** Recalculate entire delay/level/HF matrix if dirty. Call this at control rate (~50Hz)
-        lsGains: Live Source Tamer gains applied during level calculation, or nullptr for
-        unity. Index: [inputIndex * numOutputs + outputIndex]. Supplied fresh on every call
-        (never cached) so the engine holds no pointer into LiveSourceTamerEngine.
+        lsGains: Live Source Tamer gains applied during level calculation, as a sparse
+        overlay (pairs not listed are unity), or nullptr for all unity. Supplied fresh on
+        every call (never cached) so the engine holds no pointer into LiveSourceTamerEngine.
         Returns true if recalculation was performed, false if skipped (not dirty) */
-    bool recalculateMatrixIfDirty (const float* lsGains);
+    bool recalculateMatrixIfDirty (const LSGainOverlay* lsGains);
 
     /** Force recalculation regardless of dirty state.
         See recalculateMatrixIfDirty() for the lsGains contract. */
-    void recalculateMatrix (const float* lsGains);
+    void recalculateMatrix (const LSGainOverlay* lsGains);
+
+    /** Use the AVX2/NEON row kernel when the CPU supports it (default), or force
+        the scalar reference path. See WFSMatrixKernel.h for the accuracy contract.
+        Switching redoes every pair, so no cached raw term mixes both kernels. */
+    void setVectorKernelEnabled (bool shouldBeEnabled)
+    {
+        if (vectorKernelEnabled.exchange (shouldBeEnabled) != shouldBeEnabled)
+        {
+            outputsDirty.store (true);
+            matrixDirty.store (true);
+        }
+    }
+    bool isVectorKernelEnabled() const { return vectorKernelEnabled.load(); }
+
+    /** Spread recalculateMatrix() rows over this many extra threads (0 = all
+        on the calling thread, the default). Results are identical for any
+        count. Blocks until a running pass finishes. */
+    void setRecalcWorkers (int numWorkers);
+    int getRecalcWorkers() const;
 
     /** Check if matrix needs recalculation */
     bool isMatrixDirty() const { return matrixDirty.load(); }
@@ -140,56 +217,128 @@ public:
     /** Mark matrix as needing recalculation */
     void markMatrixDirty() { matrixDirty.store(true); }
 
-    /** Mark all inputs as needing recalculation (e.g., when LS gains change) */
+    /** Mark all inputs as needing recalculation */
     void markAllInputsDirty();
 
     /** Mark a single input as needing recalculation */
     void markInputDirty(int inputIndex);
 
+    /** LS Tamer gains changed. Only requests a pass: recalculateMatrix() compares
+        the overlay it is given with the one it last applied, entry by entry, and
+        rewrites just the pairs that moved (outputs inside an input's LS radius,
+        now or on the previous pass), instead of whole input rows. */
+    void markLSGainsDirty() { matrixDirty.store (true); }
+
+    /** What the last recalculateMatrix() pass actually recomputed. A row is one
+        input across all outputs; a pair is one input/output entry. */
+    struct RecalcStats
+    {
+        int rowsFull = 0;                // Rows rewritten across every output
+        int rowsPartial = 0;             // Rows where only dirty/LS-changed outputs were rewritten
+        int rowsKernelSkipped = 0;       // Dirty rows whose geometry was unchanged (raw terms reused)
+        int dirtyOutputs = 0;            // Outputs whose parameters/position changed
+        int pairsKernel = 0;             // Pairs through the geometry kernel
+        int pairsFinalised = 0;          // Pairs whose delay/level/FR were rewritten
+        int reverbFeedRows = 0;          // Input rows of the input->reverb matrix
+        bool reverbReturnsRecomputed = false;
+    };
+
+    RecalcStats getLastRecalcStats() const;
+
     /** Get matrix dimensions */
     int getNumInputs() const { return numInputs; }
     int getNumOutputs() const { return numOutputs; }
     int getNumReverbs() const { return numReverbs; }
 
     //==========================================================================
-    // Matrix Results (thread-safe read)
-    // Index: [inputIndex * numOutputs + outputIndex]
+    // Matrix Generations (lock-free, consistent read)
     //==========================================================================
 
-    /** Get pointer to delay times array (ms). Size = numInputs * numOutputs */
-    const float* getDelayTimesMs() const { return delayTimesMs.data(); }
+    /** All matrices produced by one recalculateMatrix() pass. */
+    struct MatrixSet
+    {
+        juce::uint64 generation = 0;
 
-    /** Get pointer to levels array (linear 0-1). Size = numInputs * numOutputs */
-    const float* getLevels() const { return levels.data(); }
+        // [inputIndex * numOutputs + outputIndex]: delay (ms), level (linear
+        // 0-1), HF attenuation (dB, negative)
+        std::vector<float> delayTimesMs, levels, hfAttenuationDb;
 
-    /** Get pointer to HF attenuation array (dB, negative). Size = numInputs * numOutputs */
-    const float* getHFAttenuationDb() const { return hfAttenuationDb.data(); }
+        // How fast each pair's delay moved between the last two generations
+        // (ms per second). Zero for a pair that was still, after a pause longer
+        // than maxDelayRateGapSeconds, or when the step was too steep to be
+        // motion (a jump). The audio callback uses it to extrapolate delays
+        // between control ticks.
+        std::vector<float> delayRatesMsPerS;
 
-    /** Get delay for specific routing */
-    float getDelayMs (int inputIndex, int outputIndex) const;
+        // Floor reflection, same layout: extra delay of the reflected path (ms),
+        // level and HF attenuation of the reflected signal
+        std::vector<float> frDelayTimesMs, frLevels, frHFAttenuationDb;
 
-    /** Get level for specific routing */
-    float getLevel (int inputIndex, int outputIndex) const;
+        // [inputIndex * numReverbs + reverbIndex]
+        std::vector<float> inputReverbDelayTimesMs, inputReverbLevels, inputReverbHFAttenuationDb;
 
-    /** Get HF attenuation for specific routing */
-    float getHFAttenuation (int inputIndex, int outputIndex) const;
+        // [reverbIndex * numOutputs + outputIndex]
+        std::vector<float> reverbOutputDelayTimesMs, reverbOutputLevels, reverbOutputHFAttenuationDb;
+    };
+
+    /** Pins the latest published MatrixSet while it is alive; the writer never
+        reuses a pinned slot. Acquire and release are a couple of atomic ops
+        (no locks, no allocation), so this is usable from the audio thread.
+        Keep it short-lived: a handle held across many recalculations makes the
+        writer wait for a free slot. */
+    class MatrixReadHandle
+    {
+    public:
+        /** Pins nothing (for callers that may have no engine) */
+        MatrixReadHandle() noexcept = default;
+
+        MatrixReadHandle (MatrixReadHandle&& other) noexcept
+            : engine (other.engine), slot (other.slot), set (other.set)
+        {
+            other.engine = nullptr;
+        }
+
+        ~MatrixReadHandle()
+        {
+            if (engine != nullptr)
+                engine->matrixSlotReaders[static_cast<size_t> (slot)].fetch_sub (1);
+        }
+
+        const MatrixSet* operator->() const noexcept { return set; }
+        const MatrixSet& operator*() const noexcept  { return *set; }
+        explicit operator bool() const noexcept      { return set != nullptr; }
+
+    private:
+        friend class WFSCalculationEngine;
+        MatrixReadHandle (const WFSCalculationEngine& e, int s) noexcept
+            : engine (&e), slot (s), set (&e.matrixSlots[static_cast<size_t> (s)]) {}
+
+        const WFSCalculationEngine* engine = nullptr;
+        int slot = 0;
+        const MatrixSet* set = nullptr;
+
+        JUCE_DECLARE_NON_COPYABLE (MatrixReadHandle)
+    };
+
+    /** Latest consistent set of matrices. */
+    MatrixReadHandle readMatrices() const;
+
+    /** Generation of the latest published set (0 = none yet). Compare against
+        a remembered value to skip work when nothing was recalculated. */
+    juce::uint64 getMatrixGeneration() const noexcept { return matrixGeneration.load (std::memory_order_acquire); }
 
     //==========================================================================
-    // Floor Reflection Matrix Results (thread-safe read)
-    // Index: [inputIndex * numOutputs + outputIndex]
+    // Single-pair reads from the latest generation (pins it per call)
     //==========================================================================
 
-    /** Get pointer to FR delay times array (ms, extra delay for reflected path).
-        Size = numInputs * numOutputs */
-    const float* getFRDelayTimesMs() const { return frDelayTimesMs.data(); }
+    /** Get delay for specific routing */
+    float getDelayMs (int inputIndex, int outputIndex) const;
 
-    /** Get pointer to FR levels array (linear 0-1).
-        Size = numInputs * numOutputs */
-    const float* getFRLevels() const { return frLevels.data(); }
+    /** Get level for specific routing */
+    float getLevel (int inputIndex, int outputIndex) const;
 
-    /** Get pointer to FR HF attenuation array (dB, negative).
-        Size = numInputs * numOutputs */
-    const float* getFRHFAttenuationDb() const { return frHFAttenuationDb.data(); }
+    /** Get HF attenuation for specific routing */
+    float getHFAttenuation (int inputIndex, int outputIndex) const;
 
     //==========================================================================
     // Reverb Position Access (thread-safe)
@@ -204,42 +353,14 @@ public:
     /** Force recalculation of all reverb positions */
     void recalculateAllReverbPositions();
 
-    //==========================================================================
-    // Input → Reverb Feed Matrix Results (thread-safe read)
-    // Index: [inputIndex * numReverbs + reverbIndex]
-    //==========================================================================
-
-    /** Get pointer to input→reverb delay times array (ms). Size = numInputs * numReverbs */
-    const float* getInputReverbDelayTimesMs() const { return inputReverbDelayTimesMs.data(); }
-
-    /** Get pointer to input→reverb levels array (linear 0-1). Size = numInputs * numReverbs */
-    const float* getInputReverbLevels() const { return inputReverbLevels.data(); }
-
-    /** Get pointer to input→reverb HF attenuation array (dB). Size = numInputs * numReverbs */
-    const float* getInputReverbHFAttenuationDb() const { return inputReverbHFAttenuationDb.data(); }
-
-    //==========================================================================
-    // Reverb Return → Output Matrix Results (thread-safe read)
-    // Index: [reverbIndex * numOutputs + outputIndex]
-    //==========================================================================
-
-    /** Get pointer to reverb→output delay times array (ms). Size = numReverbs * numOutputs */
-    const float* getReverbOutputDelayTimesMs() const { return reverbOutputDelayTimesMs.data(); }
-
-    /** Get pointer to reverb→output levels array (linear 0-1). Size = numReverbs * numOutputs */
-    const float* getReverbOutputLevels() const { return reverbOutputLevels.data(); }
-
-    /** Get pointer to reverb→output HF attenuation array (dB). Size = numReverbs * numOutputs */
-    const float* getReverbOutputHFAttenuationDb() const { return reverbOutputHFAttenuationDb.data(); }
-
 private:
     //==========================================================================
     // ValueTree::Listener overrides
     //==========================================================================
     void valueTreePropertyChanged (juce::ValueTree& tree,
                                    const juce::Identifier& property) override;
-    void valueTreeChildAdded (juce::ValueTree&, juce::ValueTree&) override {}
-    void valueTreeChildRemoved (juce::ValueTree&, juce::ValueTree&, int) override {}
+    void valueTreeChildAdded (juce::ValueTree&, juce::ValueTree&) override;
+    void valueTreeChildRemoved (juce::ValueTree&, juce::ValueTree&, int) override;
     void valueTreeChildOrderChanged (juce::ValueTree&, int, int) override {}
     void valueTreeParentChanged (juce::ValueTree&) override {}
 
@@ -254,7 +375,12 @@ private:
 
     /** Apply safety constraints to composite position (after flip + offset + LFO).
         Clamps to stage bounds if constraint enabled, and always enforces ±50m absolute limit. */
-    void applyCompositeConstraints (Position& pos, const juce::ValueTree& posSection) const;
+    void applyCompositeConstraints (Position& pos, int inputIndex) const;
+
+    /** Write an LS overlay into targetLSGains (resetting the previous overlay's
+        pairs) and flag the pairs whose gain differs from the applied one.
+        Costs the overlay entries, not inputs x outputs. recalcLock held. */
+    void applyLSGainOverlay (const LSGainOverlay* overlay);
 
     static float distance3D (const Position& a, const Position& b);
 
@@ -295,6 +421,123 @@ private:
     /** Check if reverb→output routing is muted (reverbMutes array) */
     bool isReverbOutputMuted (int reverbIndex, int outputIndex) const;
 
+    //==========================================================================
+    // Parameter mirror
+    //==========================================================================
+    // Structure-of-arrays copy of every ValueTree property the matrix loops
+    // read. Refreshed one channel at a time from valueTreePropertyChanged(),
+    // wholesale from the recalculateAll*Positions() calls, and lazily after a
+    // channel is added/removed.
+    //
+    // Writer: the message thread, in the refresh*() functions, into liveParams
+    // under paramLock; each refresh bumps paramsVersion.
+    // Reader: recalculateMatrix(), on the control-rate worker (or a message-
+    // thread caller forcing a recalc). It never reads liveParams: under
+    // recalcLock, syncCalcParams() copies liveParams into calcParams under
+    // paramLock whenever paramsVersion has moved, and the matrix loops (and
+    // their ControlRateParallelFor rows) read only calcParams.
+
+    static constexpr int numArrayGroups = 10;   // inputArrayAtten1..10
+
+    /** Angular screening zone for speakers and reverb feeds. The rear axis and
+        zone angles are derived once per parameter change, so the per-pair
+        test is one dot product and one acos. */
+    struct AngularZones
+    {
+        std::vector<uint8_t> alwaysOn;        // angleOn >= 90°: whole hemisphere is "on"
+        std::vector<float> rearX, rearY, rearZ;
+        std::vector<float> angleOnRad;
+        std::vector<float> muteAngleRad;      // π - angleOff
+
+        void resize (size_t n);
+        void set (size_t idx, int orientationDeg, int pitchDeg, int angleOnDeg, int angleOffDeg);
+
+        /** 0.0 (muted) to 1.0 (full) for a source at (dx, dy, dz) from the zone apex */
+        float attenuation (size_t idx, float dx, float dy, float dz) const;
+    };
+
+    struct InputParams                          // [inputIndex] unless noted
+    {
+        std::vector<float> attenuationDb;       // Channel: inputAttenuation
+        std::vector<int> minimalLatency;
+        std::vector<float> delayLatencyMs;
+        std::vector<float> distanceAttenuation; // Attenuation section
+        std::vector<int> attenuationLaw;
+        std::vector<float> distanceRatio;
+        std::vector<int> commonAttenPercent;
+        std::vector<int> heightFactorPercent;   // Position section
+        std::vector<uint8_t> flipX, flipY, flipZ;
+        std::vector<float> offsetX, offsetY, offsetZ;
+        std::vector<uint8_t> constraintX, constraintY, constraintZ;
+        std::vector<int> directivityDeg;        // Directivity section
+        std::vector<int> rotationDeg;
+        std::vector<int> tiltDeg;
+        std::vector<float> hfShelfDb;
+        std::vector<uint8_t> muteReverbSends;   // Mutes section
+        std::vector<uint8_t> sidelinesActive;
+        std::vector<float> sidelinesFringe;
+        std::vector<float> arrayAttenDb;        // [inputIndex * numArrayGroups + arrayIndex]
+        std::vector<uint8_t> routingMuted;      // [inputIndex * numOutputs + outputIndex]
+        std::vector<uint8_t> frActive;          // Hackoustics section
+        std::vector<float> frAttenuationDb;
+    };
+
+    struct OutputParams                         // [outputIndex]
+    {
+        std::vector<int> miniLatencyEnable;     // Options section
+        std::vector<float> distanceAttenPercent;
+        std::vector<int> frEnable;
+        std::vector<float> hfDamping;           // Position section
+        std::vector<int> arrayAssignment;       // Channel section: 0 = single, 1-10 = array
+        std::vector<float> delayLatencyMs;
+        AngularZones angular;
+    };
+
+    struct ReverbParams                         // [reverbIndex] unless noted
+    {
+        std::vector<int> miniLatencyEnable;     // Feed section
+        std::vector<int> distanceAttenPercent;
+        std::vector<float> hfDamping;
+        AngularZones feedAngular;
+        std::vector<float> delayLatencyMs;      // Channel section
+        std::vector<float> returnDistanceAttenuation;   // Return section
+        std::vector<int> returnCommonAttenPercent;
+        std::vector<uint8_t> outputMuted;       // [reverbIndex * numOutputs + outputIndex]
+    };
+
+    struct GlobalParams
+    {
+        float haasEffect = 0.0f;
+        float systemLatency = 0.0f;
+
+        bool stageValid = false;
+        int stageShape = 0;                     // 0 = box, 1 = cylinder, 2 = dome
+        float originWidth = 0.0f, originDepth = 0.0f;
+        float minX = 0.0f, maxX = 0.0f;         // Composite constraint bounds
+        float minY = 0.0f, maxY = 0.0f;
+        float minZ = 0.0f, maxZ = 0.0f;
+        float leftEdge = 0.0f, rightEdge = 0.0f, upstageEdge = 0.0f;   // Box sidelines
+        float radius = 0.0f;                                            // Cylinder/dome sidelines
+    };
+
+    struct ParamSnapshot
+    {
+        InputParams inputs;
+        OutputParams outputs;
+        ReverbParams reverbs;
+        GlobalParams global;
+    };
+
+    void refreshInputParams (int inputIndex);
+    void refreshOutputParams (int outputIndex);
+    void refreshReverbParams (int reverbIndex);
+    void refreshGlobalParams();
+    void refreshAllParams();
+    void syncCalcParams();
+
+    // AsyncUpdater: coalesced full mirror refresh after channel add/remove
+    void handleAsyncUpdate() override;
+
     //==========================================================================
     // State
     //==========================================================================
@@ -316,6 +559,17 @@ private:
     std::vector<float> gyrophoneOffsets;           // [inputIndex] - Gyrophone rotation offsets (radians)
     std::vector<GradientMapOffsets> gradientMapOffsets;  // [inputIndex] - Gradient map parameter offsets
 
+    // Flat parameter mirror: liveParams is written by the refresh*() functions on
+    // the message thread under paramLock; calcParams is the recalculation's own
+    // copy, re-taken only when paramsVersion moved (see syncCalcParams())
+    ParamSnapshot liveParams;
+    ParamSnapshot calcParams;
+    juce::CriticalSection paramLock;
+    std::atomic<uint32_t> paramsVersion { 1 };
+    uint32_t calcParamsVersion = 0;
+    juce::CriticalSection recalcLock;             // Serialises recalculateMatrix() callers
+    std::atomic<bool> vectorKernelEnabled { true };  // Row kernel selection (see WFSMatrixKernel.h)
+
     // Delay mode ramp state for smooth transitions when toggling inputMinimalLatency
     std::vector<int> previousMinimalLatencyMode;  // [inputIndex] - Previous mode (0 or 1), -1 = uninitialized
     std::vector<float> delayModeRampOffset;       // [inputIndex] - Current ramp offset in ms (decays to 0 over 1s)
@@ -325,36 +579,80 @@ private:
     std::vector<float> commonAttenRampOffsetDb;     // [inputIndex] - Current ramp offset in dB (decays to 0)
     std::vector<float> commonAttenRampTimeRemaining; // [inputIndex] - Remaining ramp time in seconds
 
-    // Input → Output matrix results [inputIndex * numOutputs + outputIndex]
-    std::vector<float> delayTimesMs;
-    std::vector<float> levels;
-    std::vector<float> hfAttenuationDb;
-
-    // Floor Reflection matrix results [inputIndex * numOutputs + outputIndex]
-    // Extra delay, level, and HF for reflected signal through floor (z=0 plane)
-    std::vector<float> frDelayTimesMs;      // Extra delay in ms for reflected path
-    std::vector<float> frLevels;            // Linear gain (0-1) for reflected signal
-    std::vector<float> frHFAttenuationDb;   // HF attenuation in dB for reflected path
-
-    // Input → Reverb Feed matrix results [inputIndex * numReverbs + reverbIndex]
-    std::vector<float> inputReverbDelayTimesMs;
-    std::vector<float> inputReverbLevels;
-    std::vector<float> inputReverbHFAttenuationDb;
-
-    // Reverb Return → Output matrix results [reverbIndex * numOutputs + outputIndex]
-    std::vector<float> reverbOutputDelayTimesMs;
-    std::vector<float> reverbOutputLevels;
-    std::vector<float> reverbOutputHFAttenuationDb;
-
     // Thread safety
     mutable juce::CriticalSection positionLock;
-    mutable juce::CriticalSection matrixLock;
+
+    // Published generations (see readMatrices()). Four slots: the current one,
+    // the one being written, and room for readers still pinning older ones.
+    static constexpr int numMatrixSlots = 4;
+    std::array<MatrixSet, numMatrixSlots> matrixSlots;
+    mutable std::array<std::atomic<int>, numMatrixSlots> matrixSlotReaders {};
+    std::atomic<int> currentMatrixSlot { 0 };
+    std::atomic<juce::uint64> matrixGeneration { 0 };
+    int acquireFreeMatrixSlot() const;
 
     // Dirty flags for lazy recalculation
     std::atomic<bool> matrixDirty { true };           // Any change requiring full recalc
-    std::atomic<bool> outputsDirty { true };          // Output positions changed (affects all inputs)
+    std::atomic<bool> outputsDirty { true };          // Every output column dirty (global/stage-wide changes)
     std::atomic<bool> reverbsDirty { true };          // Reverb positions changed
     std::vector<bool> inputDirtyFlags;                // Per-input dirty flags (protected by positionLock)
+    std::vector<uint8_t> outputDirtyFlags;            // Per-output column flags (protected by positionLock)
+
+    void markOutputDirty (int outputIndex);           // Caller holds positionLock
+
+    // Incremental recompute state, owned by recalculateMatrix() (recalcLock).
+    // Raw kernel terms per pair [inputIndex * numOutputs + outputIndex], so a
+    // clean column or an unchanged row never goes through the kernel again.
+    std::vector<float> rawDelayMs, rawLevel, rawAttenuationDb, rawDistanceAttenDb, rawAngularAtten;
+    std::vector<uint8_t> rawValidForMinLatency, rawValidForCommonAtten;
+    std::vector<uint8_t> rawRoutingMuted;             // Routing mutes the raw terms were computed with
+    std::vector<WFSMatrixKernel::InputTerms> rawRowTerms;  // [inputIndex] terms of the last kernel pass
+    std::vector<uint8_t> rawRowValid;                 // [inputIndex] rawRowTerms usable
+    std::vector<float> rowMinDelay;                   // [inputIndex] row aggregates of the last pass:
+    std::vector<uint8_t> rowFoundValidOutput;         //   a partial row is only valid while these hold
+    std::vector<float> inputCommonAttenAdjustments;   //   (also feeds the input->reverb rows)
+    std::vector<float> appliedLSGains;                // LS gains baked into levels
+    std::vector<float> targetLSGains;                 // LS gains of the current overlay (dense, 1 = none)
+    LSGainOverlay targetLSOverlay;                    // Overlay written into targetLSGains
+    std::vector<uint8_t> lsPairChanged;               // Pair's target differs from its applied gain
+    std::vector<uint8_t> lsRowChanged;                // [inputIndex] any lsPairChanged in the row
+    std::vector<size_t> lsChangedPairs;               // Indices set in lsPairChanged, for clearing
+    RecalcStats lastRecalcStats;
+
+    // Delay derivative bookkeeping (recalcLock). A pair moving faster than
+    // maxDelayRateMsPerS (~20 m/s) is a jump, not motion, and gets no rate.
+    static constexpr double maxDelayRateGapSeconds = 0.1;
+    static constexpr float maxDelayRateMsPerS = 60.0f;
+    juce::int64 lastDelayPublishTicks = 0;
+    mutable juce::SpinLock recalcStatsLock;
+
+    // Tracked offset slots, fixed-size so the writer never races a resize.
+    // sequence is odd while a write is in progress.
+    struct TrackedOffsetSlot
+    {
+        std::atomic<juce::uint32> sequence { 0 };
+        std::atomic<float> x { 0.0f }, y { 0.0f }, z { 0.0f };
+        std::atomic<juce::int64> receiptTicks { 0 };
+        std::atomic<juce::int64> routedTicks { 0 };
+        std::atomic<bool> active { false };
+        std::atomic<bool> fresh { false };     // Not yet consumed by a recalculation
+    };
+
+    struct TrackedOffsetRead
+    {
+        bool active = false;
+        bool fresh = false;
+        float x = 0.0f, y = 0.0f, z = 0.0f;
+        juce::int64 receiptTicks = 0;
+        juce::int64 routedTicks = 0;
+    };
+
+    std::array<TrackedOffsetSlot, WFSParameterDefaults::maxInputChannels> trackedOffsets;
+    TrackedOffsetRead readTrackedOffset (int inputIndex);   // Consumes the fresh flag
+    MotionLatencyTracer* latencyTracer = nullptr;
+
+    // Fork-join pool for the row loops of recalculateMatrix() (under recalcLock)
+    ControlRateParallelFor recalcPool;
 
     // Speed of sound (m/s)
     static constexpr float speedOfSound = 343.0f;
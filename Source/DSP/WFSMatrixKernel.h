@@ -0,0 +1,827 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <cmath>
+#include <cstdint>
+
+#if JUCE_INTEL
+ #include <immintrin.h>
+ #define WFS_MATRIX_KERNEL_AVX2 1
+ #if defined (_MSC_VER) && ! defined (__clang__)
+  #define WFS_MATRIX_KERNEL_AVX2_TARGET
+ #else
+  #define WFS_MATRIX_KERNEL_AVX2_TARGET __attribute__ ((target ("avx2")))
+ #endif
+#elif JUCE_ARM && (defined (__aarch64__) || defined (_M_ARM64))
+ #include <arm_neon.h>
+ #define WFS_MATRIX_KERNEL_NEON 1
+#endif
+
+#ifndef WFS_MATRIX_KERNEL_AVX2
+ #define WFS_MATRIX_KERNEL_AVX2 0
+#endif
+#ifndef WFS_MATRIX_KERNEL_NEON
+ #define WFS_MATRIX_KERNEL_NEON 0
+#endif
+
+//==============================================================================
+/**
+    Row kernel for the WFS input -> output matrix.
+
+    Computes, for one input against every output, the raw delay, level marker,
+    HF attenuation and the per-output terms the engine's per-input
+    post-processing needs (attenuation dB, distance-only dB, angular factor,
+    min-latency / common-atten eligibility). This is the per-pair body that
+    used to live inline in WFSCalculationEngine::recalculateMatrix().
+
+    Three implementations share one contract:
+    - Scalar: the reference path, uses std:: transcendentals
+    - AVX2:   8 outputs per iteration, selected at runtime when the CPU has AVX2
+    - NEON:   4 outputs per iteration on AArch64 (NEON is baseline there)
+
+    The vector paths do the geometry with plain IEEE mul/add/div/sqrt (no FMA),
+    so distances, delays and dot products match the scalar path bit for bit.
+    Only log10, acos and sin are approximated:
+    - log10 (x >= 1):   atanh series on the mantissa, |error| <= 3e-7 (x <= 1e6)
+    - acos  [-1, 1]:    A&S 4.4.46 polynomial, |error| <= 5e-7 rad
+    - sin   [0, pi/2]:  Taylor to x^11, |error| <= 2e-7
+
+    In matrix terms (checked by matrix-bench --check) this bounds the vector
+    vs scalar difference at 1e-4 on linear levels and 1e-3 ms on delays.
+    HF attenuation is held to 0.05 dB: the sqrt(sin) directivity falloff has
+    an infinite slope at the cone edge, so a 1e-7 rad difference in angle
+    shows up as up to ~0.02 dB right there. Pairs sitting exactly on an
+    angular mute boundary may be muted by one path and not the other; their
+    levels still agree to the level tolerance.
+*/
+namespace WFSMatrixKernel
+{
+    //==========================================================================
+    /** Everything the row needs from one input (constant across outputs). */
+    struct InputTerms
+    {
+        float x = 0.0f, y = 0.0f, z = 0.0f;     // composite input position
+        float heightFactor = 1.0f;              // Z scale for distance (0-1)
+        float attenuationDb = 0.0f;             // input attenuation + gradient-map offset
+        int attenuationLaw = 0;                 // 0 = linear dB/m, 1 = inverse distance
+        float distanceAttenuation = 0.0f;       // dB/m (law 0)
+        float distanceRatio = 1.0f;             // reference distance (law 1), >= 0.001
+        bool directivityActive = false;         // directivity < 360° and HF shelf < 0 dB
+        float facingX = 0.0f, facingY = -1.0f, facingZ = 0.0f;
+        float halfDirectivity = 0.0f;           // radians
+        float transitionRange = 0.0f;           // pi - halfDirectivity
+        float hfShelfDb = 0.0f;
+        float hfOffsetDb = 0.0f;                // gradient-map HF shelf offset
+        const uint8_t* routingMuted = nullptr;  // [outputIndex]
+    };
+
+    /** Per-output arrays (SoA, constant across inputs). */
+    struct OutputTerms
+    {
+        const float* speakerX = nullptr;
+        const float* speakerY = nullptr;
+        const float* speakerZ = nullptr;
+        const float* listenerX = nullptr;
+        const float* listenerY = nullptr;
+        const float* listenerZ = nullptr;
+        const float* speakerToListener = nullptr;     // distance, no height factor
+        const float* distanceAttenPercent = nullptr;  // outputDistanceAttenPercent
+        const float* hfDamping = nullptr;             // dB/m
+        const int* miniLatencyEnable = nullptr;
+        const uint8_t* angularAlwaysOn = nullptr;     // angleOn >= 90°
+        const float* angularRearX = nullptr;
+        const float* angularRearY = nullptr;
+        const float* angularRearZ = nullptr;
+        const float* angularOnRad = nullptr;
+        const float* angularMuteRad = nullptr;        // pi - angleOff
+    };
+
+    /** Where one input's row is written, all indexed by output. */
+    struct RowResults
+    {
+        float* delayMs = nullptr;            // raw path-difference delay, 0 when muted
+        float* level = nullptr;              // 1 = active, 0 = muted (linear level set later)
+        float* hfDb = nullptr;
+        float* attenuationDb = nullptr;      // -92 when muted
+        float* distanceAttenDb = nullptr;    // 0 when muted
+        float* angularAtten = nullptr;       // 0 when muted
+        uint8_t* validForMinLatency = nullptr;
+        uint8_t* validForCommonAtten = nullptr;
+    };
+
+    static constexpr float speedOfSound = 343.0f;
+
+    //==========================================================================
+    // Scalar reference
+    //==========================================================================
+
+    inline void processRangeScalar (const InputTerms& in, const OutputTerms& out,
+                                    const RowResults& r, int begin, int end)
+    {
+        constexpr float pi = juce::MathConstants<float>::pi;
+
+        for (int o = begin; o < end; ++o)
+        {
+            const auto i = static_cast<size_t> (o);
+
+            r.attenuationDb[i] = -92.0f;
+            r.distanceAttenDb[i] = 0.0f;
+            r.angularAtten[i] = 0.0f;
+            r.validForMinLatency[i] = 0;
+            r.validForCommonAtten[i] = 0;
+
+            // Routing mute
+            if (in.routingMuted[i] != 0)
+            {
+                r.delayMs[i] = 0.0f;
+                r.level[i] = 0.0f;
+                r.hfDb[i] = 0.0f;
+                continue;
+            }
+
+            const float speakerX = out.speakerX[i];
+            const float speakerY = out.speakerY[i];
+            const float speakerZ = out.speakerZ[i];
+
+            // Angular attenuation: input in the "off" zone in front of the speaker
+            // (uses the raw input position, no height factor)
+            float angularAtten = 1.0f;
+            if (out.angularAlwaysOn[i] == 0)
+            {
+                float dx = in.x - speakerX;
+                float dy = in.y - speakerY;
+                float dz = in.z - speakerZ;
+                float distance = std::sqrt (dx * dx + dy * dy + dz * dz);
+
+                if (distance >= 0.001f)
+                {
+                    float dotProduct = (dx * out.angularRearX[i] + dy * out.angularRearY[i]
+                                        + dz * out.angularRearZ[i]) / distance;
+                    dotProduct = juce::jlimit (-1.0f, 1.0f, dotProduct);
+                    float angle = std::acos (dotProduct);
+
+                    const float onAngle = out.angularOnRad[i];
+                    const float muteAngle = out.angularMuteRad[i];
+                    const float transitionWidth = muteAngle - onAngle;
+
+                    if (angle <= onAngle)
+                        angularAtten = 1.0f;
+                    else if (angle >= muteAngle)
+                        angularAtten = 0.0f;
+                    else if (transitionWidth <= 0.0f)
+                        angularAtten = 1.0f;
+                    else
+                        angularAtten = 1.0f - (angle - onAngle) / transitionWidth;
+                }
+            }
+
+            // In the mute zone - skip further calculations
+            if (angularAtten <= 0.0f)
+            {
+                r.delayMs[i] = 0.0f;
+                r.level[i] = 0.0f;
+                r.hfDb[i] = 0.0f;
+                continue;
+            }
+
+            if (out.miniLatencyEnable[i] == 1)
+                r.validForMinLatency[i] = 1;
+            r.validForCommonAtten[i] = 1;
+
+            // Distances (height factor scales the Z difference, not speaker->listener)
+            float ldx = out.listenerX[i] - in.x;
+            float ldy = out.listenerY[i] - in.y;
+            float ldz = (out.listenerZ[i] - in.z) * in.heightFactor;
+            float inputToListener = std::sqrt (ldx * ldx + ldy * ldy + ldz * ldz);
+
+            float sdx = speakerX - in.x;
+            float sdy = speakerY - in.y;
+            float sdz = (speakerZ - in.z) * in.heightFactor;
+            float inputToSpeaker = std::sqrt (sdx * sdx + sdy * sdy + sdz * sdz);
+
+            // Delay: path difference input->listener vs speaker->listener
+            float delayMeters = inputToListener - out.speakerToListener[i];
+            float delayMs = (delayMeters / speedOfSound) * 1000.0f;
+            r.delayMs[i] = juce::jmax (0.0f, delayMs);
+
+            // Level (dB, converted to linear after common attenuation)
+            float distanceAttenDb = 0.0f;
+            if (in.attenuationLaw == 0)
+            {
+                distanceAttenDb = in.distanceAttenuation * inputToSpeaker;
+            }
+            else
+            {
+                // -6 dB per doubling, 0 dB inside the reference sphere
+                float effectiveDistance = inputToSpeaker / in.distanceRatio;
+                if (effectiveDistance >= 1.0f)
+                    distanceAttenDb = -20.0f * std::log10 (effectiveDistance);
+            }
+
+            float scaledDistanceAttenDb = distanceAttenDb * (out.distanceAttenPercent[i] / 100.0f);
+            r.attenuationDb[i] = juce::jlimit (-92.0f, 0.0f, in.attenuationDb + scaledDistanceAttenDb);
+            r.distanceAttenDb[i] = juce::jlimit (-92.0f, 0.0f, scaledDistanceAttenDb);
+            r.angularAtten[i] = angularAtten;
+            r.level[i] = 1.0f;
+
+            // HF: output damping (dB/m) + input directivity falloff + gradient-map offset
+            float hfAttenOutput = out.hfDamping[i] * inputToSpeaker;
+            float hfAttenDirectivity = 0.0f;
+
+            if (in.directivityActive)
+            {
+                float dx = speakerX - in.x;
+                float dy = speakerY - in.y;
+                float dz = speakerZ - in.z;
+                float rawDistance = std::sqrt (dx * dx + dy * dy + dz * dz);
+
+                if (rawDistance > 0.001f)
+                {
+                    float invDist = 1.0f / rawDistance;
+                    float dotProduct = in.facingX * (dx * invDist) + in.facingY * (dy * invDist)
+                                       + in.facingZ * (dz * invDist);
+                    dotProduct = juce::jlimit (-1.0f, 1.0f, dotProduct);
+                    float angleToSpeaker = std::acos (dotProduct);
+
+                    // Outside the brightness cone: sqrt(sin) falloff towards the rear
+                    if (angleToSpeaker > in.halfDirectivity && in.transitionRange > 0.001f)
+                    {
+                        float progress = (angleToSpeaker - in.halfDirectivity) / in.transitionRange;
+                        progress = juce::jmin (1.0f, progress);
+                        hfAttenDirectivity = in.hfShelfDb * std::sqrt (std::sin (progress * (pi * 0.5f)));
+                    }
+                }
+            }
+
+            float hfAtten = hfAttenOutput + hfAttenDirectivity + in.hfOffsetDb;
+            r.hfDb[i] = juce::jlimit (-60.0f, 0.0f, hfAtten);
+        }
+    }
+
+    inline void processRowScalar (const InputTerms& in, const OutputTerms& out,
+                                  const RowResults& r, int numOutputs)
+    {
+        processRangeScalar (in, out, r, 0, numOutputs);
+    }
+
+    //==========================================================================
+    // Polynomial coefficients shared by the vector paths
+    //==========================================================================
+
+    namespace Approx
+    {
+        // acos(x) ~ sqrt(1 - x) * P(x) on [0, 1] (Abramowitz & Stegun 4.4.46)
+        static constexpr float acos0 = 1.5707963050f;
+        static constexpr float acos1 = -0.2145988016f;
+        static constexpr float acos2 = 0.0889789874f;
+        static constexpr float acos3 = -0.0501743046f;
+        static constexpr float acos4 = 0.0308918810f;
+        static constexpr float acos5 = -0.0170881256f;
+        static constexpr float acos6 = 0.0066700901f;
+        static constexpr float acos7 = -0.0012624911f;
+
+        static constexpr float ln2 = 0.693147180559945f;
+        static constexpr float log10e = 0.434294481903252f;
+        static constexpr float sqrt2 = 1.414213562373095f;
+    }
+
+   #if WFS_MATRIX_KERNEL_AVX2
+    //==========================================================================
+    // AVX2 (8 outputs per iteration)
+    //==========================================================================
+
+    namespace Avx2
+    {
+        WFS_MATRIX_KERNEL_AVX2_TARGET inline __m256 select (__m256 mask, __m256 a, __m256 b)
+        {
+            return _mm256_blendv_ps (b, a, mask);
+        }
+
+        WFS_MATRIX_KERNEL_AVX2_TARGET inline __m256 clamp (__m256 v, float lo, float hi)
+        {
+            return _mm256_min_ps (_mm256_max_ps (v, _mm256_set1_ps (lo)), _mm256_set1_ps (hi));
+        }
+
+        /** log10 for x >= 1 (other lanes return garbage; callers mask them). */
+        WFS_MATRIX_KERNEL_AVX2_TARGET inline __m256 log10 (__m256 x)
+        {
+            const __m256i bits = _mm256_castps_si256 (x);
+            __m256i exponent = _mm256_sub_epi32 (_mm256_srli_epi32 (bits, 23), _mm256_set1_epi32 (127));
+            __m256 m = _mm256_castsi256_ps (_mm256_or_si256 (_mm256_and_si256 (bits, _mm256_set1_epi32 (0x007fffff)),
+                                                             _mm256_set1_epi32 (0x3f800000)));
+
+            // Fold the mantissa into [sqrt(0.5), sqrt(2)] so |s| <= 0.172
+            const __m256 big = _mm256_cmp_ps (m, _mm256_set1_ps (Approx::sqrt2), _CMP_GT_OQ);
+            m = select (big, _mm256_mul_ps (m, _mm256_set1_ps (0.5f)), m);
+            exponent = _mm256_sub_epi32 (exponent, _mm256_castps_si256 (big));
+
+            const __m256 one = _mm256_set1_ps (1.0f);
+            const __m256 s = _mm256_div_ps (_mm256_sub_ps (m, one), _mm256_add_ps (m, one));
+            const __m256 s2 = _mm256_mul_ps (s, s);
+
+            // ln(m) = 2 atanh(s) = 2s (1 + s^2/3 + s^4/5 + s^6/7 + s^8/9)
+            __m256 p = _mm256_set1_ps (1.0f / 9.0f);
+            p = _mm256_add_ps (_mm256_mul_ps (p, s2), _mm256_set1_ps (1.0f / 7.0f));
+            p = _mm256_add_ps (_mm256_mul_ps (p, s2), _mm256_set1_ps (1.0f / 5.0f));
+            p = _mm256_add_ps (_mm256_mul_ps (p, s2), _mm256_set1_ps (1.0f / 3.0f));
+            p = _mm256_add_ps (_mm256_mul_ps (p, s2), one);
+            const __m256 lnM = _mm256_mul_ps (_mm256_mul_ps (_mm256_set1_ps (2.0f), s), p);
+
+            const __m256 ln = _mm256_add_ps (_mm256_mul_ps (_mm256_cvtepi32_ps (exponent), _mm256_set1_ps (Approx::ln2)), lnM);
+            return _mm256_mul_ps (ln, _mm256_set1_ps (Approx::log10e));
+        }
+
+        /** acos for x in [-1, 1]. */
+        WFS_MATRIX_KERNEL_AVX2_TARGET inline __m256 acos (__m256 x)
+        {
+            const __m256 ax = _mm256_andnot_ps (_mm256_set1_ps (-0.0f), x);
+
+            __m256 p = _mm256_set1_ps (Approx::acos7);
+            p = _mm256_add_ps (_mm256_mul_ps (p, ax), _mm256_set1_ps (Approx::acos6));
+            p = _mm256_add_ps (_mm256_mul_ps (p, ax), _mm256_set1_ps (Approx::acos5));
+            p = _mm256_add_ps (_mm256_mul_ps (p, ax), _mm256_set1_ps (Approx::acos4));
+            p = _mm256_add_ps (_mm256_mul_ps (p, ax), _mm256_set1_ps (Approx::acos3));
+            p = _mm256_add_ps (_mm256_mul_ps (p, ax), _mm256_set1_ps (Approx::acos2));
+            p = _mm256_add_ps (_mm256_mul_ps (p, ax), _mm256_set1_ps (Approx::acos1));
+            p = _mm256_add_ps (_mm256_mul_ps (p, ax), _mm256_set1_ps (Approx::acos0));
+
+            const __m256 r = _mm256_mul_ps (_mm256_sqrt_ps (_mm256_sub_ps (_mm256_set1_ps (1.0f), ax)), p);
+            const __m256 negative = _mm256_cmp_ps (x, _mm256_setzero_ps(), _CMP_LT_OQ);
+            return select (negative, _mm256_sub_ps (_mm256_set1_ps (juce::MathConstants<float>::pi), r), r);
+        }
+
+        /** sin for x in [0, pi/2]. */
+        WFS_MATRIX_KERNEL_AVX2_TARGET inline __m256 sin (__m256 x)
+        {
+            const __m256 x2 = _mm256_mul_ps (x, x);
+            __m256 p = _mm256_set1_ps (-1.0f / 39916800.0f);
+            p = _mm256_add_ps (_mm256_mul_ps (p, x2), _mm256_set1_ps (1.0f / 362880.0f));
+            p = _mm256_add_ps (_mm256_mul_ps (p, x2), _mm256_set1_ps (-1.0f / 5040.0f));
+            p = _mm256_add_ps (_mm256_mul_ps (p, x2), _mm256_set1_ps (1.0f / 120.0f));
+            p = _mm256_add_ps (_mm256_mul_ps (p, x2), _mm256_set1_ps (-1.0f / 6.0f));
+            p = _mm256_add_ps (_mm256_mul_ps (p, x2), _mm256_set1_ps (1.0f));
+            return _mm256_mul_ps (x, p);
+        }
+
+        /** Loads 8 bytes and returns an all-ones lane mask where they are non-zero. */
+        WFS_MATRIX_KERNEL_AVX2_TARGET inline __m256 nonZeroMask (const uint8_t* p)
+        {
+            const __m256i v = _mm256_cvtepu8_epi32 (_mm_loadl_epi64 (reinterpret_cast<const __m128i*> (p)));
+            const __m256i zero = _mm256_cmpeq_epi32 (v, _mm256_setzero_si256());
+            return _mm256_castsi256_ps (_mm256_xor_si256 (zero, _mm256_set1_epi32 (-1)));
+        }
+
+        WFS_MATRIX_KERNEL_AVX2_TARGET inline void storeMask (uint8_t* dest, __m256 mask)
+        {
+            const int bits = _mm256_movemask_ps (mask);
+            for (int k = 0; k < 8; ++k)
+                dest[k] = static_cast<uint8_t> ((bits >> k) & 1);
+        }
+    }
+
+    WFS_MATRIX_KERNEL_AVX2_TARGET inline void processRowAVX2 (const InputTerms& in, const OutputTerms& out,
+                                                              const RowResults& r, int numOutputs)
+    {
+        using namespace Avx2;
+
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 one = _mm256_set1_ps (1.0f);
+        const __m256 inX = _mm256_set1_ps (in.x);
+        const __m256 inY = _mm256_set1_ps (in.y);
+        const __m256 inZ = _mm256_set1_ps (in.z);
+        const __m256 heightFactor = _mm256_set1_ps (in.heightFactor);
+        const __m256 inputAtten = _mm256_set1_ps (in.attenuationDb);
+        const __m256 minDistance = _mm256_set1_ps (0.001f);
+        const __m256 onePercent = _mm256_set1_ps (100.0f);
+        const bool directivity = in.directivityActive && in.transitionRange > 0.001f;
+
+        int o = 0;
+        for (; o + 8 <= numOutputs; o += 8)
+        {
+            const __m256 routed = _mm256_xor_ps (nonZeroMask (in.routingMuted + o), _mm256_castsi256_ps (_mm256_set1_epi32 (-1)));
+
+            const __m256 speakerX = _mm256_loadu_ps (out.speakerX + o);
+            const __m256 speakerY = _mm256_loadu_ps (out.speakerY + o);
+            const __m256 speakerZ = _mm256_loadu_ps (out.speakerZ + o);
+
+            // Raw speaker->input geometry (shared by angular and directivity)
+            const __m256 dx = _mm256_sub_ps (inX, speakerX);
+            const __m256 dy = _mm256_sub_ps (inY, speakerY);
+            const __m256 dz = _mm256_sub_ps (inZ, speakerZ);
+            const __m256 rawDistance = _mm256_sqrt_ps (_mm256_add_ps (_mm256_add_ps (_mm256_mul_ps (dx, dx),
+                                                                                      _mm256_mul_ps (dy, dy)),
+                                                                        _mm256_mul_ps (dz, dz)));
+
+            // Angular attenuation
+            __m256 dot = _mm256_add_ps (_mm256_add_ps (_mm256_mul_ps (dx, _mm256_loadu_ps (out.angularRearX + o)),
+                                                       _mm256_mul_ps (dy, _mm256_loadu_ps (out.angularRearY + o))),
+                                        _mm256_mul_ps (dz, _mm256_loadu_ps (out.angularRearZ + o)));
+            dot = clamp (_mm256_div_ps (dot, rawDistance), -1.0f, 1.0f);
+            const __m256 angle = Avx2::acos (dot);
+            const __m256 onAngle = _mm256_loadu_ps (out.angularOnRad + o);
+            const __m256 muteAngle = _mm256_loadu_ps (out.angularMuteRad + o);
+            const __m256 transitionWidth = _mm256_sub_ps (muteAngle, onAngle);
+
+            __m256 angular = _mm256_sub_ps (one, _mm256_div_ps (_mm256_sub_ps (angle, onAngle), transitionWidth));
+            angular = select (_mm256_cmp_ps (transitionWidth, zero, _CMP_LE_OQ), one, angular);
+            angular = select (_mm256_cmp_ps (angle, muteAngle, _CMP_GE_OQ), zero, angular);
+            angular = select (_mm256_cmp_ps (angle, onAngle, _CMP_LE_OQ), one, angular);
+            angular = select (_mm256_or_ps (nonZeroMask (out.angularAlwaysOn + o),
+                                            _mm256_cmp_ps (rawDistance, minDistance, _CMP_LT_OQ)),
+                              one, angular);
+
+            const __m256 active = _mm256_and_ps (routed, _mm256_cmp_ps (angular, zero, _CMP_GT_OQ));
+            const __m256 miniLatency = _mm256_castsi256_ps (_mm256_cmpeq_epi32 (
+                _mm256_loadu_si256 (reinterpret_cast<const __m256i*> (out.miniLatencyEnable + o)),
+                _mm256_set1_epi32 (1)));
+
+            // Distances with height factor
+            const __m256 ldx = _mm256_sub_ps (_mm256_loadu_ps (out.listenerX + o), inX);
+            const __m256 ldy = _mm256_sub_ps (_mm256_loadu_ps (out.listenerY + o), inY);
+            const __m256 ldz = _mm256_mul_ps (_mm256_sub_ps (_mm256_loadu_ps (out.listenerZ + o), inZ), heightFactor);
+            const __m256 inputToListener = _mm256_sqrt_ps (_mm256_add_ps (_mm256_add_ps (_mm256_mul_ps (ldx, ldx),
+                                                                                          _mm256_mul_ps (ldy, ldy)),
+                                                                            _mm256_mul_ps (ldz, ldz)));
+
+            const __m256 sdx = _mm256_sub_ps (speakerX, inX);
+            const __m256 sdy = _mm256_sub_ps (speakerY, inY);
+            const __m256 sdz = _mm256_sub_ps (speakerZ, inZ);
+            const __m256 sdzScaled = _mm256_mul_ps (sdz, heightFactor);
+            const __m256 inputToSpeaker = _mm256_sqrt_ps (_mm256_add_ps (_mm256_add_ps (_mm256_mul_ps (sdx, sdx),
+                                                                                         _mm256_mul_ps (sdy, sdy)),
+                                                                           _mm256_mul_ps (sdzScaled, sdzScaled)));
+
+            // Delay
+            const __m256 delayMeters = _mm256_sub_ps (inputToListener, _mm256_loadu_ps (out.speakerToListener + o));
+            const __m256 delayMs = _mm256_max_ps (zero, _mm256_mul_ps (_mm256_div_ps (delayMeters, _mm256_set1_ps (speedOfSound)),
+                                                                       _mm256_set1_ps (1000.0f)));
+
+            // Level
+            __m256 distanceAttenDb;
+            if (in.attenuationLaw == 0)
+            {
+                distanceAttenDb = _mm256_mul_ps (_mm256_set1_ps (in.distanceAttenuation), inputToSpeaker);
+            }
+            else
+            {
+                const __m256 effective = _mm256_div_ps (inputToSpeaker, _mm256_set1_ps (in.distanceRatio));
+                const __m256 outside = _mm256_cmp_ps (effective, one, _CMP_GE_OQ);
+                distanceAttenDb = _mm256_and_ps (outside, _mm256_mul_ps (_mm256_set1_ps (-20.0f), Avx2::log10 (effective)));
+            }
+
+            const __m256 scaled = _mm256_mul_ps (distanceAttenDb,
+                                                 _mm256_div_ps (_mm256_loadu_ps (out.distanceAttenPercent + o), onePercent));
+            const __m256 attenuationDb = clamp (_mm256_add_ps (inputAtten, scaled), -92.0f, 0.0f);
+            const __m256 distanceOnlyDb = clamp (scaled, -92.0f, 0.0f);
+
+            // HF
+            const __m256 hfOutput = _mm256_mul_ps (_mm256_loadu_ps (out.hfDamping + o), inputToSpeaker);
+            __m256 hfDirectivity = zero;
+
+            if (directivity)
+            {
+                const __m256 invDist = _mm256_div_ps (one, rawDistance);
+                __m256 facingDot = _mm256_add_ps (_mm256_add_ps (_mm256_mul_ps (_mm256_set1_ps (in.facingX), _mm256_mul_ps (sdx, invDist)),
+                                                                 _mm256_mul_ps (_mm256_set1_ps (in.facingY), _mm256_mul_ps (sdy, invDist))),
+                                                  _mm256_mul_ps (_mm256_set1_ps (in.facingZ), _mm256_mul_ps (sdz, invDist)));
+                facingDot = clamp (facingDot, -1.0f, 1.0f);
+                const __m256 angleToSpeaker = Avx2::acos (facingDot);
+                const __m256 halfDirectivity = _mm256_set1_ps (in.halfDirectivity);
+
+                __m256 progress = _mm256_div_ps (_mm256_sub_ps (angleToSpeaker, halfDirectivity),
+                                                 _mm256_set1_ps (in.transitionRange));
+                progress = _mm256_min_ps (one, progress);
+                const __m256 falloff = _mm256_sqrt_ps (_mm256_max_ps (zero, Avx2::sin (_mm256_mul_ps (progress,
+                                                                                                      _mm256_set1_ps (juce::MathConstants<float>::pi * 0.5f)))));
+                const __m256 outsideCone = _mm256_and_ps (_mm256_cmp_ps (rawDistance, minDistance, _CMP_GT_OQ),
+                                                          _mm256_cmp_ps (angleToSpeaker, halfDirectivity, _CMP_GT_OQ));
+                hfDirectivity = _mm256_and_ps (outsideCone, _mm256_mul_ps (_mm256_set1_ps (in.hfShelfDb), falloff));
+            }
+
+            const __m256 hf = clamp (_mm256_add_ps (_mm256_add_ps (hfOutput, hfDirectivity), _mm256_set1_ps (in.hfOffsetDb)),
+                                     -60.0f, 0.0f);
+
+            _mm256_storeu_ps (r.delayMs + o, _mm256_and_ps (active, delayMs));
+            _mm256_storeu_ps (r.level + o, _mm256_and_ps (active, one));
+            _mm256_storeu_ps (r.hfDb + o, _mm256_and_ps (active, hf));
+            _mm256_storeu_ps (r.attenuationDb + o, select (active, attenuationDb, _mm256_set1_ps (-92.0f)));
+            _mm256_storeu_ps (r.distanceAttenDb + o, _mm256_and_ps (active, distanceOnlyDb));
+            _mm256_storeu_ps (r.angularAtten + o, _mm256_and_ps (active, angular));
+            storeMask (r.validForMinLatency + o, _mm256_and_ps (active, miniLatency));
+            storeMask (r.validForCommonAtten + o, active);
+        }
+
+        processRangeScalar (in, out, r, o, numOutputs);
+    }
+   #endif
+
+   #if WFS_MATRIX_KERNEL_NEON
+    //==========================================================================
+    // NEON (4 outputs per iteration, AArch64)
+    //==========================================================================
+
+    namespace Neon
+    {
+        inline float32x4_t clamp (float32x4_t v, float lo, float hi)
+        {
+            return vminq_f32 (vmaxq_f32 (v, vdupq_n_f32 (lo)), vdupq_n_f32 (hi));
+        }
+
+        inline float32x4_t andMask (uint32x4_t mask, float32x4_t v)
+        {
+            return vreinterpretq_f32_u32 (vandq_u32 (mask, vreinterpretq_u32_f32 (v)));
+        }
+
+        /** log10 for x >= 1 (other lanes return garbage; callers mask them). */
+        inline float32x4_t log10 (float32x4_t x)
+        {
+            const uint32x4_t bits = vreinterpretq_u32_f32 (x);
+            int32x4_t exponent = vsubq_s32 (vreinterpretq_s32_u32 (vshrq_n_u32 (bits, 23)), vdupq_n_s32 (127));
+            float32x4_t m = vreinterpretq_f32_u32 (vorrq_u32 (vandq_u32 (bits, vdupq_n_u32 (0x007fffff)),
+                                                              vdupq_n_u32 (0x3f800000)));
+
+            // Fold the mantissa into [sqrt(0.5), sqrt(2)] so |s| <= 0.172
+            const uint32x4_t big = vcgtq_f32 (m, vdupq_n_f32 (Approx::sqrt2));
+            m = vbslq_f32 (big, vmulq_f32 (m, vdupq_n_f32 (0.5f)), m);
+            exponent = vsubq_s32 (exponent, vreinterpretq_s32_u32 (big));
+
+            const float32x4_t one = vdupq_n_f32 (1.0f);
+            const float32x4_t s = vdivq_f32 (vsubq_f32 (m, one), vaddq_f32 (m, one));
+            const float32x4_t s2 = vmulq_f32 (s, s);
+
+            float32x4_t p = vdupq_n_f32 (1.0f / 9.0f);
+            p = vaddq_f32 (vmulq_f32 (p, s2), vdupq_n_f32 (1.0f / 7.0f));
+            p = vaddq_f32 (vmulq_f32 (p, s2), vdupq_n_f32 (1.0f / 5.0f));
+            p = vaddq_f32 (vmulq_f32 (p, s2), vdupq_n_f32 (1.0f / 3.0f));
+            p = vaddq_f32 (vmulq_f32 (p, s2), one);
+            const float32x4_t lnM = vmulq_f32 (vmulq_f32 (vdupq_n_f32 (2.0f), s), p);
+
+            const float32x4_t ln = vaddq_f32 (vmulq_f32 (vcvtq_f32_s32 (exponent), vdupq_n_f32 (Approx::ln2)), lnM);
+            return vmulq_f32 (ln, vdupq_n_f32 (Approx::log10e));
+        }
+
+        /** acos for x in [-1, 1]. */
+        inline float32x4_t acos (float32x4_t x)
+        {
+            const float32x4_t ax = vabsq_f32 (x);
+
+            float32x4_t p = vdupq_n_f32 (Approx::acos7);
+            p = vaddq_f32 (vmulq_f32 (p, ax), vdupq_n_f32 (Approx::acos6));
+            p = vaddq_f32 (vmulq_f32 (p, ax), vdupq_n_f32 (Approx::acos5));
+            p = vaddq_f32 (vmulq_f32 (p, ax), vdupq_n_f32 (Approx::acos4));
+            p = vaddq_f32 (vmulq_f32 (p, ax), vdupq_n_f32 (Approx::acos3));
+            p = vaddq_f32 (vmulq_f32 (p, ax), vdupq_n_f32 (Approx::acos2));
+            p = vaddq_f32 (vmulq_f32 (p, ax), vdupq_n_f32 (Approx::acos1));
+            p = vaddq_f32 (vmulq_f32 (p, ax), vdupq_n_f32 (Approx::acos0));
+
+            const float32x4_t r = vmulq_f32 (vsqrtq_f32 (vsubq_f32 (vdupq_n_f32 (1.0f), ax)), p);
+            const uint32x4_t negative = vcltq_f32 (x, vdupq_n_f32 (0.0f));
+            return vbslq_f32 (negative, vsubq_f32 (vdupq_n_f32 (juce::MathConstants<float>::pi), r), r);
+        }
+
+        /** sin for x in [0, pi/2]. */
+        inline float32x4_t sin (float32x4_t x)
+        {
+            const float32x4_t x2 = vmulq_f32 (x, x);
+            float32x4_t p = vdupq_n_f32 (-1.0f / 39916800.0f);
+            p = vaddq_f32 (vmulq_f32 (p, x2), vdupq_n_f32 (1.0f / 362880.0f));
+            p = vaddq_f32 (vmulq_f32 (p, x2), vdupq_n_f32 (-1.0f / 5040.0f));
+            p = vaddq_f32 (vmulq_f32 (p, x2), vdupq_n_f32 (1.0f / 120.0f));
+            p = vaddq_f32 (vmulq_f32 (p, x2), vdupq_n_f32 (-1.0f / 6.0f));
+            p = vaddq_f32 (vmulq_f32 (p, x2), vdupq_n_f32 (1.0f));
+            return vmulq_f32 (x, p);
+        }
+
+        /** Loads 4 bytes and returns an all-ones lane mask where they are non-zero. */
+        inline uint32x4_t nonZeroMask (const uint8_t* p)
+        {
+            const uint32_t lanes[4] = { p[0], p[1], p[2], p[3] };
+            return vmvnq_u32 (vceqq_u32 (vld1q_u32 (lanes), vdupq_n_u32 (0)));
+        }
+
+        inline void storeMask (uint8_t* dest, uint32x4_t mask)
+        {
+            dest[0] = static_cast<uint8_t> (vgetq_lane_u32 (mask, 0) & 1);
+            dest[1] = static_cast<uint8_t> (vgetq_lane_u32 (mask, 1) & 1);
+            dest[2] = static_cast<uint8_t> (vgetq_lane_u32 (mask, 2) & 1);
+            dest[3] = static_cast<uint8_t> (vgetq_lane_u32 (mask, 3) & 1);
+        }
+    }
+
+    inline void processRowNEON (const InputTerms& in, const OutputTerms& out,
+                                const RowResults& r, int numOutputs)
+    {
+        using namespace Neon;
+
+        const float32x4_t zero = vdupq_n_f32 (0.0f);
+        const float32x4_t one = vdupq_n_f32 (1.0f);
+        const float32x4_t inX = vdupq_n_f32 (in.x);
+        const float32x4_t inY = vdupq_n_f32 (in.y);
+        const float32x4_t inZ = vdupq_n_f32 (in.z);
+        const float32x4_t heightFactor = vdupq_n_f32 (in.heightFactor);
+        const float32x4_t inputAtten = vdupq_n_f32 (in.attenuationDb);
+        const float32x4_t minDistance = vdupq_n_f32 (0.001f);
+        const float32x4_t onePercent = vdupq_n_f32 (100.0f);
+        const bool directivity = in.directivityActive && in.transitionRange > 0.001f;
+
+        int o = 0;
+        for (; o + 4 <= numOutputs; o += 4)
+        {
+            const uint32x4_t routed = vmvnq_u32 (nonZeroMask (in.routingMuted + o));
+
+            const float32x4_t speakerX = vld1q_f32 (out.speakerX + o);
+            const float32x4_t speakerY = vld1q_f32 (out.speakerY + o);
+            const float32x4_t speakerZ = vld1q_f32 (out.speakerZ + o);
+
+            // Raw speaker->input geometry (shared by angular and directivity)
+            const float32x4_t dx = vsubq_f32 (inX, speakerX);
+            const float32x4_t dy = vsubq_f32 (inY, speakerY);
+            const float32x4_t dz = vsubq_f32 (inZ, speakerZ);
+            const float32x4_t rawDistance = vsqrtq_f32 (vaddq_f32 (vaddq_f32 (vmulq_f32 (dx, dx), vmulq_f32 (dy, dy)),
+                                                                   vmulq_f32 (dz, dz)));
+
+            // Angular attenuation
+            float32x4_t dot = vaddq_f32 (vaddq_f32 (vmulq_f32 (dx, vld1q_f32 (out.angularRearX + o)),
+                                                    vmulq_f32 (dy, vld1q_f32 (out.angularRearY + o))),
+                                         vmulq_f32 (dz, vld1q_f32 (out.angularRearZ + o)));
+            dot = clamp (vdivq_f32 (dot, rawDistance), -1.0f, 1.0f);
+            const float32x4_t angle = Neon::acos (dot);
+            const float32x4_t onAngle = vld1q_f32 (out.angularOnRad + o);
+            const float32x4_t muteAngle = vld1q_f32 (out.angularMuteRad + o);
+            const float32x4_t transitionWidth = vsubq_f32 (muteAngle, onAngle);
+
+            float32x4_t angular = vsubq_f32 (one, vdivq_f32 (vsubq_f32 (angle, onAngle), transitionWidth));
+            angular = vbslq_f32 (vcleq_f32 (transitionWidth, zero), one, angular);
+            angular = vbslq_f32 (vcgeq_f32 (angle, muteAngle), zero, angular);
+            angular = vbslq_f32 (vcleq_f32 (angle, onAngle), one, angular);
+            angular = vbslq_f32 (vorrq_u32 (nonZeroMask (out.angularAlwaysOn + o), vcltq_f32 (rawDistance, minDistance)),
+                                 one, angular);
+
+            const uint32x4_t active = vandq_u32 (routed, vcgtq_f32 (angular, zero));
+            const uint32x4_t miniLatency = vceqq_s32 (vld1q_s32 (out.miniLatencyEnable + o), vdupq_n_s32 (1));
+
+            // Distances with height factor
+            const float32x4_t ldx = vsubq_f32 (vld1q_f32 (out.listenerX + o), inX);
+            const float32x4_t ldy = vsubq_f32 (vld1q_f32 (out.listenerY + o), inY);
+            const float32x4_t ldz = vmulq_f32 (vsubq_f32 (vld1q_f32 (out.listenerZ + o), inZ), heightFactor);
+            const float32x4_t inputToListener = vsqrtq_f32 (vaddq_f32 (vaddq_f32 (vmulq_f32 (ldx, ldx), vmulq_f32 (ldy, ldy)),
+                                                                       vmulq_f32 (ldz, ldz)));
+
+            const float32x4_t sdx = vsubq_f32 (speakerX, inX);
+            const float32x4_t sdy = vsubq_f32 (speakerY, inY);
+            const float32x4_t sdz = vsubq_f32 (speakerZ, inZ);
+            const float32x4_t sdzScaled = vmulq_f32 (sdz, heightFactor);
+            const float32x4_t inputToSpeaker = vsqrtq_f32 (vaddq_f32 (vaddq_f32 (vmulq_f32 (sdx, sdx), vmulq_f32 (sdy, sdy)),
+                                                                      vmulq_f32 (sdzScaled, sdzScaled)));
+
+            // Delay
+            const float32x4_t delayMeters = vsubq_f32 (inputToListener, vld1q_f32 (out.speakerToListener + o));
+            const float32x4_t delayMs = vmaxq_f32 (zero, vmulq_f32 (vdivq_f32 (delayMeters, vdupq_n_f32 (speedOfSound)),
+                                                                    vdupq_n_f32 (1000.0f)));
+
+            // Level
+            float32x4_t distanceAttenDb;
+            if (in.attenuationLaw == 0)
+            {
+                distanceAttenDb = vmulq_f32 (vdupq_n_f32 (in.distanceAttenuation), inputToSpeaker);
+            }
+            else
+            {
+                const float32x4_t effective = vdivq_f32 (inputToSpeaker, vdupq_n_f32 (in.distanceRatio));
+                distanceAttenDb = andMask (vcgeq_f32 (effective, one),
+                                           vmulq_f32 (vdupq_n_f32 (-20.0f), Neon::log10 (effective)));
+            }
+
+            const float32x4_t scaled = vmulq_f32 (distanceAttenDb, vdivq_f32 (vld1q_f32 (out.distanceAttenPercent + o), onePercent));
+            const float32x4_t attenuationDb = clamp (vaddq_f32 (inputAtten, scaled), -92.0f, 0.0f);
+            const float32x4_t distanceOnlyDb = clamp (scaled, -92.0f, 0.0f);
+
+            // HF
+            const float32x4_t hfOutput = vmulq_f32 (vld1q_f32 (out.hfDamping + o), inputToSpeaker);
+            float32x4_t hfDirectivity = zero;
+
+            if (directivity)
+            {
+                const float32x4_t invDist = vdivq_f32 (one, rawDistance);
+                float32x4_t facingDot = vaddq_f32 (vaddq_f32 (vmulq_f32 (vdupq_n_f32 (in.facingX), vmulq_f32 (sdx, invDist)),
+                                                              vmulq_f32 (vdupq_n_f32 (in.facingY), vmulq_f32 (sdy, invDist))),
+                                                   vmulq_f32 (vdupq_n_f32 (in.facingZ), vmulq_f32 (sdz, invDist)));
+                facingDot = clamp (facingDot, -1.0f, 1.0f);
+                const float32x4_t angleToSpeaker = Neon::acos (facingDot);
+                const float32x4_t halfDirectivity = vdupq_n_f32 (in.halfDirectivity);
+
+                float32x4_t progress = vdivq_f32 (vsubq_f32 (angleToSpeaker, halfDirectivity), vdupq_n_f32 (in.transitionRange));
+                progress = vminq_f32 (one, progress);
+                const float32x4_t falloff = vsqrtq_f32 (vmaxq_f32 (zero, Neon::sin (vmulq_f32 (progress,
+                                                                                               vdupq_n_f32 (juce::MathConstants<float>::pi * 0.5f)))));
+                const uint32x4_t outsideCone = vandq_u32 (vcgtq_f32 (rawDistance, minDistance),
+                                                          vcgtq_f32 (angleToSpeaker, halfDirectivity));
+                hfDirectivity = andMask (outsideCone, vmulq_f32 (vdupq_n_f32 (in.hfShelfDb), falloff));
+            }
+
+            const float32x4_t hf = clamp (vaddq_f32 (vaddq_f32 (hfOutput, hfDirectivity), vdupq_n_f32 (in.hfOffsetDb)),
+                                          -60.0f, 0.0f);
+
+            vst1q_f32 (r.delayMs + o, andMask (active, delayMs));
+            vst1q_f32 (r.level + o, andMask (active, one));
+            vst1q_f32 (r.hfDb + o, andMask (active, hf));
+            vst1q_f32 (r.attenuationDb + o, vbslq_f32 (active, attenuationDb, vdupq_n_f32 (-92.0f)));
+            vst1q_f32 (r.distanceAttenDb + o, andMask (active, distanceOnlyDb));
+            vst1q_f32 (r.angularAtten + o, andMask (active, angular));
+            storeMask (r.validForMinLatency + o, vandq_u32 (active, miniLatency));
+            storeMask (r.validForCommonAtten + o, active);
+        }
+
+        processRangeScalar (in, out, r, o, numOutputs);
+    }
+   #endif
+
+    //==========================================================================
+    // Runtime selection
+    //==========================================================================
+
+    using RowFunction = void (*) (const InputTerms&, const OutputTerms&, const RowResults&, int);
+
+    /** Picks the widest row kernel this CPU supports, or the scalar reference
+        when allowVector is false. */
+    inline RowFunction selectRowFunction (bool allowVector)
+    {
+        if (allowVector)
+        {
+           #if WFS_MATRIX_KERNEL_AVX2
+            if (juce::SystemStats::hasAVX2())
+                return processRowAVX2;
+           #elif WFS_MATRIX_KERNEL_NEON
+            return processRowNEON;
+           #endif
+        }
+
+        return processRowScalar;
+    }
+
+    /** Name of the kernel selectRowFunction() returns, for logs and harnesses. */
+    inline const char* getRowFunctionName (bool allowVector)
+    {
+        const auto fn = selectRowFunction (allowVector);
+       #if WFS_MATRIX_KERNEL_AVX2
+        if (fn == processRowAVX2)
+            return "avx2";
+       #elif WFS_MATRIX_KERNEL_NEON
+        if (fn == processRowNEON)
+            return "neon";
+       #endif
+        juce::ignoreUnused (fn);
+        return "scalar";
+    }
+
+    /** Runs a row kernel over outputs [begin, end) only. Every per-output array
+        is indexed by output, so a column range is the same row with all
+        pointers advanced. */
+    inline void processColumns (RowFunction fn, const InputTerms& in, const OutputTerms& out,
+                                const RowResults& r, int begin, int end)
+    {
+        const auto b = static_cast<size_t> (begin);
+
+        InputTerms inB = in;
+        inB.routingMuted += b;
+
+        OutputTerms outB = out;
+        for (auto* p : { &outB.speakerX, &outB.speakerY, &outB.speakerZ,
+                         &outB.listenerX, &outB.listenerY, &outB.listenerZ,
+                         &outB.speakerToListener, &outB.distanceAttenPercent, &outB.hfDamping,
+                         &outB.angularRearX, &outB.angularRearY, &outB.angularRearZ,
+                         &outB.angularOnRad, &outB.angularMuteRad })
+            *p += b;
+        outB.miniLatencyEnable += b;
+        outB.angularAlwaysOn += b;
+
+        RowResults rB = r;
+        for (auto* p : { &rB.delayMs, &rB.level, &rB.hfDb, &rB.attenuationDb,
+                         &rB.distanceAttenDb, &rB.angularAtten })
+            *p += b;
+        rB.validForMinLatency += b;
+        rB.validForCommonAtten += b;
+
+        fn (inB, outB, rB, end - begin);
+    }
+
+    /** True when a row computed with terms a equals one computed with b
+        (routing mutes aside, compared separately by the caller). z can be
+        left out when nothing in the row reads it: height factor 0, no
+        directivity cone and no output with angular zones. */
+    inline bool sameInputTerms (const InputTerms& a, const InputTerms& b, bool compareZ)
+    {
+        return a.x == b.x && a.y == b.y && (! compareZ || a.z == b.z)
+            && a.heightFactor == b.heightFactor
+            && a.attenuationDb == b.attenuationDb
+            && a.attenuationLaw == b.attenuationLaw
+            && a.distanceAttenuation == b.distanceAttenuation
+            && a.distanceRatio == b.distanceRatio
+            && a.directivityActive == b.directivityActive
+            && a.facingX == b.facingX && a.facingY == b.facingY && a.facingZ == b.facingZ
+            && a.halfDirectivity == b.halfDirectivity
+            && a.transitionRange == b.transitionRange
+            && a.hfShelfDb == b.hfShelfDb
+            && a.hfOffsetDb == b.hfOffsetDb;
+    }
+}
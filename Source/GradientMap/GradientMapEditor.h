@@ -557,6 +557,11 @@ public:
     /** Callback when gradient maps change (for rasterization trigger) */
     std::function<void()> onGradientMapsChanged;
 
+    /** Callback on every drag step of a shape edit, with the layer as it looks
+        mid-drag (for a low-resolution preview; onGradientMapsChanged follows
+        on mouse up) */
+    std::function<void (int layerIndex, const GradientMap::Layer& layer)> onLayerPreview;
+
     /** Callback when active layer or shape selection changes (for StreamDeck sync) */
     std::function<void()> onActiveLayerChanged;
     std::function<void()> onSelectionChanged;
@@ -1312,6 +1317,25 @@ public:
         if (e.eventComponent != this)
             return;
 
+        handleMouseDrag (e);
+
+        if (isEditingShapes() && onLayerPreview)
+            onLayerPreview (activeLayer, currentLayerData);
+    }
+
+    /** True while a drag is changing the active layer's shapes */
+    bool isEditingShapes() const
+    {
+        return isDraggingOriginHandle
+            || (editVerticesMode && draggedVertexIndex >= 0)
+            || isRotating
+            || draggingScaleHandle >= 0
+            || draggingGradientHandle >= 0
+            || (isDragging && ! selectedShapeIndices.empty());
+    }
+
+    void handleMouseDrag (const juce::MouseEvent& e)
+    {
         auto canvasBounds = getCanvasBounds();
 
         if (isPanning)
@@ -3,14 +3,28 @@
 #include <JuceHeader.h>
 #include "GradientMapData.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
 /**
  * Gradient Map Evaluator
  *
- * Rasterizes vector shapes to greyscale bitmaps for O(1) position lookup.
- * Each layer is cached as a juce::Image. Re-rasterization only occurs when
- * shapes are edited, not per-frame.
+ * Rasterizes vector shapes to greyscale for O(1) position lookup.
+ * Re-rasterization only occurs when shapes are edited, not per-frame.
+ *
+ * Each layer is cached as a single-channel uint16 grid holding the grey value
+ * with the layer's curve already applied, cropped to the painted area
+ * (everything outside it is grey 0). The ARGB image the shapes are drawn
+ * into only lives during rasterization. Grids are immutable once built and
+ * held by shared_ptr, so inputs with identical layers can share one
+ * (GradientMapRasterizer builds them in the background and dedupes them).
  *
- * Runtime lookup: stage (x,y) → bitmap pixel → greyscale → curve → parameter offset
+ * Runtime lookup: stage (x,y) → bilinear grid sample → offset = black + grey * (white - black)
  */
 class GradientMapEvaluator
 {
@@ -26,6 +40,89 @@ public:
         float hfShelfDb     = 0.0f;
     };
 
+    //==========================================================================
+    // Layer Grid
+    //==========================================================================
+
+    /** One layer's grey values (curve applied) on the raster's pixel grid,
+        stored only over the painted area's bounding box. */
+    struct LayerGrid
+    {
+        static constexpr float maxLevel = 65535.0f;
+
+        std::vector<uint16_t> cells;       // Row-major cropW x cropH, 0..65535
+        int cropX = 0, cropY = 0, cropW = 0, cropH = 0;
+
+        // Stage (x,y) → continuous pixel coords (pixel centres at integers)
+        float originX = 0.0f, originY = 0.0f;   // stageMinX, stageMaxY
+        float scaleX = 0.0f, scaleY = 0.0f;     // (bmpW - 1) / stageW, (bmpH - 1) / stageH
+
+        // offset = offsetBase + offsetScale * stored level
+        float offsetBase = 0.0f;
+        float offsetScale = 0.0f;
+
+        GradientMap::TargetParam param = GradientMap::TargetParam::Attenuation;
+
+        size_t getMemoryBytes() const noexcept { return cells.size() * sizeof (uint16_t); }
+
+        /** Stored level at pixel (px,py); 0 outside the painted area */
+        float level (int px, int py) const noexcept
+        {
+            px -= cropX;
+            py -= cropY;
+            if (px < 0 || px >= cropW || py < 0 || py >= cropH)
+                return 0.0f;
+            return static_cast<float> (cells[static_cast<size_t> (py * cropW + px)]);
+        }
+
+        /** The four taps around (x,y) and the fractional position between them */
+        void taps (float x, float y, float& t00, float& t10, float& t01, float& t11,
+                   float& tx, float& ty) const noexcept
+        {
+            const float fx = (x - originX) * scaleX;
+            const float fy = (originY - y) * scaleY;   // Y inverted
+            const float x0f = std::floor (fx);
+            const float y0f = std::floor (fy);
+
+            // Far off the raster: every tap is outside the painted area
+            if (x0f < -2.0f || y0f < -2.0f || x0f > static_cast<float> (cropX + cropW)
+                || y0f > static_cast<float> (cropY + cropH))
+            {
+                t00 = t10 = t01 = t11 = tx = ty = 0.0f;
+                return;
+            }
+
+            const int x0 = static_cast<int> (x0f);
+            const int y0 = static_cast<int> (y0f);
+            t00 = level (x0,     y0);
+            t10 = level (x0 + 1, y0);
+            t01 = level (x0,     y0 + 1);
+            t11 = level (x0 + 1, y0 + 1);
+            tx = fx - x0f;
+            ty = fy - y0f;
+        }
+
+        /** Bilinear level at stage (x,y) */
+        float sample (float x, float y) const noexcept
+        {
+            float t00, t10, t01, t11, tx, ty;
+            taps (x, y, t00, t10, t01, t11, tx, ty);
+            const float top    = t00 + tx * (t10 - t00);
+            const float bottom = t01 + tx * (t11 - t01);
+            return top + ty * (bottom - top);
+        }
+    };
+
+    using GridPtr = std::shared_ptr<const LayerGrid>;
+
+    /** Stage rectangle and raster resolution a grid is built for */
+    struct StageSpec
+    {
+        float minX = -10.0f, maxX = 10.0f;
+        float minY = -10.0f, maxY = 0.0f;
+        float pixelsPerMeter = WFSParameterDefaults::gmBitmapPixelsPerMeter;
+    };
+
     //==========================================================================
     // Construction
     //==========================================================================
@@ -38,79 +135,125 @@ public:
 
     void setStageBounds (float minX, float maxX, float minY, float maxY)
     {
-        stageMinX = minX;
-        stageMaxX = maxX;
-        stageMinY = minY;
-        stageMaxY = maxY;
+        stage.minX = minX;
+        stage.maxX = maxX;
+        stage.minY = minY;
+        stage.maxY = maxY;
     }
 
     void setPixelsPerMeter (float ppm)
     {
-        pixelsPerMeter = juce::jmax (1.0f, ppm);
+        stage.pixelsPerMeter = juce::jmax (1.0f, ppm);
     }
 
+    const StageSpec& getStageSpec() const noexcept { return stage; }
+
     //==========================================================================
     // Rasterization (called on shape edit, NOT per-frame)
     //==========================================================================
 
-    /** Rasterize a single layer's shapes to its cached bitmap */
+    /** Rasterize a single layer's shapes to its cached grid (synchronous) */
     void rasterizeLayer (int layerIndex, const GradientMap::Layer& layer)
     {
         if (layerIndex < 0 || layerIndex >= 3)
             return;
 
-        auto& cache = layerCaches[static_cast<size_t> (layerIndex)];
-        cache.enabled    = layer.enabled;
-        cache.param      = layer.param;
-        cache.whiteValue = layer.whiteValue;
-        cache.blackValue = layer.blackValue;
-        cache.curve      = layer.curve;
+        beginLayerUpdate (layerIndex);
+        layerGrids[static_cast<size_t> (layerIndex)] = rasterize (layer, stage);
+    }
 
-        if (! layer.enabled || layer.shapes.empty())
-        {
-            cache.bitmap = juce::Image();
-            return;
-        }
+    /** Whether a layer produces a grid at all (enabled, with shapes) */
+    static bool needsRaster (const GradientMap::Layer& layer)
+    {
+        return layer.enabled && ! layer.shapes.empty();
+    }
+
+    /** Build a layer's grid for a stage. Touches no evaluator state, so it
+        runs on any thread. Returns nullptr when the layer has no effect. */
+    static GridPtr rasterize (const GradientMap::Layer& layer, const StageSpec& spec)
+    {
+        if (! needsRaster (layer))
+            return nullptr;
 
         // Calculate bitmap dimensions
-        float stageW = stageMaxX - stageMinX;
-        float stageH = stageMaxY - stageMinY;
+        float stageW = spec.maxX - spec.minX;
+        float stageH = spec.maxY - spec.minY;
 
         if (stageW <= 0.0f || stageH <= 0.0f)
-        {
-            cache.bitmap = juce::Image();
-            return;
-        }
+            return nullptr;
 
-        int bmpW = juce::jmax (1, juce::roundToInt (stageW * pixelsPerMeter));
-        int bmpH = juce::jmax (1, juce::roundToInt (stageH * pixelsPerMeter));
+        int bmpW = juce::jmax (1, juce::roundToInt (stageW * spec.pixelsPerMeter));
+        int bmpH = juce::jmax (1, juce::roundToInt (stageH * spec.pixelsPerMeter));
 
         // Cap bitmap size to prevent excessive memory usage
         constexpr int maxBitmapDim = 2048;
         bmpW = juce::jmin (bmpW, maxBitmapDim);
         bmpH = juce::jmin (bmpH, maxBitmapDim);
 
-        // Create bitmap (ARGB for alpha compositing, clear to transparent black)
-        cache.bitmap = juce::Image (juce::Image::ARGB, bmpW, bmpH, true);
-        juce::Graphics g (cache.bitmap);
+        // Draw into a temporary ARGB image (software, so its pixels can be
+        // read directly and it can be drawn off the message thread; clear to
+        // transparent black)
+        juce::Image bitmap (juce::Image::ARGB, bmpW, bmpH, true, juce::SoftwareImageType());
+        {
+            juce::Graphics g (bitmap);
 
-        // Transform from stage coords to bitmap coords:
-        // bitmap_x = (stage_x - stageMinX) / stageW * bmpW
-        // bitmap_y = (stageMaxY - stage_y) / stageH * bmpH  (Y inverted)
-        float scaleXFactor = static_cast<float> (bmpW) / stageW;
-        float scaleYFactor = static_cast<float> (bmpH) / stageH;
+            // Transform from stage coords to bitmap coords:
+            // bitmap_x = (stage_x - stageMinX) / stageW * bmpW
+            // bitmap_y = (stageMaxY - stage_y) / stageH * bmpH  (Y inverted)
+            float scaleXFactor = static_cast<float> (bmpW) / stageW;
+            float scaleYFactor = static_cast<float> (bmpH) / stageH;
 
-        auto stageToBitmapTransform = juce::AffineTransform::translation (-stageMinX, -stageMaxY)
-                                        .scaled (scaleXFactor, -scaleYFactor);
+            auto stageToBitmapTransform = juce::AffineTransform::translation (-spec.minX, -spec.maxY)
+                                            .scaled (scaleXFactor, -scaleYFactor);
 
-        // Paint shapes in order (painter's algorithm)
-        for (const auto& shape : layer.shapes)
-        {
-            if (! shape.enabled)
-                continue;
+            // Paint shapes in order (painter's algorithm)
+            for (const auto& shape : layer.shapes)
+            {
+                if (! shape.enabled)
+                    continue;
 
-            renderShapeToBitmap (g, shape, stageToBitmapTransform, bmpW, bmpH);
+                renderShapeToBitmap (g, shape, stageToBitmapTransform, bmpW, bmpH, spec.pixelsPerMeter);
+            }
         }
+
+        auto grid = std::make_shared<LayerGrid>();
+        buildGrid (*grid, bitmap, layer, spec, stageW, stageH);
+        return grid;
+    }
+
+    //==========================================================================
+    // Asynchronous Updates (grids built elsewhere, swapped in whole)
+    //==========================================================================
+
+    /** Start a new version of a layer; returns its generation. Grids for older
+        generations are ignored by acceptLayerGrid(). Generations are unique
+        across evaluators, so a grid requested for an evaluator that has since
+        been replaced can't match its successor. */
+    uint32_t beginLayerUpdate (int layerIndex)
+    {
+        static std::atomic<uint32_t> nextGeneration { 0 };
+        return layerGenerations[static_cast<size_t> (layerIndex)] = ++nextGeneration;
+    }
+
+    /** Swap in a grid if it is for the layer's latest generation */
+    bool acceptLayerGrid (int layerIndex, uint32_t generation, GridPtr grid)
+    {
+        if (layerIndex < 0 || layerIndex >= 3
+            || layerGenerations[static_cast<size_t> (layerIndex)] != generation)
+            return false;
+
+        layerGrids[static_cast<size_t> (layerIndex)] = std::move (grid);
+        return true;
+    }
+
+    /** Set a layer's grid directly (e.g. nullptr for a disabled layer) */
+    void setLayerGrid (int layerIndex, GridPtr grid)
+    {
+        if (layerIndex < 0 || layerIndex >= 3)
+            return;
+
+        beginLayerUpdate (layerIndex);
+        layerGrids[static_cast<size_t> (layerIndex)] = std::move (grid);
     }
 
     /** Rasterize all 3 layers from an InputGradientMap */
@@ -121,7 +264,7 @@ public:
     }
 
     //==========================================================================
-    // Runtime Evaluation — O(1) bitmap lookup
+    // Runtime Evaluation — O(1) bilinear grid lookup
     //==========================================================================
 
     /** Evaluate all enabled layers at stage position (x,y).
@@ -130,118 +273,205 @@ public:
     {
         Offsets result;
 
-        for (const auto& cache : layerCaches)
+        for (const auto& grid : layerGrids)
         {
-            if (! cache.enabled || ! cache.bitmap.isValid())
+            if (grid == nullptr)
                 continue;
 
-            float greyValue = sampleBitmap (cache, x, y);
+            // Map grey [0,1] → parameter offset [blackValue, whiteValue]
+            addOffset (result, grid->param, grid->offsetBase + grid->offsetScale * grid->sample (x, y));
+        }
 
-            // Apply curve: value = pow(value, 2^(-curve))
-            // curve=-1 → exp=2 (compresses toward black)
-            // curve=0  → exp=1 (linear)
-            // curve=+1 → exp=0.5 (compresses toward white)
-            if (cache.curve != 0.0f && greyValue > 0.0f && greyValue < 1.0f)
+        return result;
+    }
+
+    /** Scratch for evaluateBatch(), reused across calls to avoid allocation */
+    struct BatchScratch
+    {
+        std::vector<float> t00, t10, t01, t11, tx, ty, base, scale;
+        std::vector<float> toAtt, toHeight, toHF;
+
+        void resize (size_t n)
+        {
+            for (auto* v : { &t00, &t10, &t01, &t11, &tx, &ty, &base, &scale, &toAtt, &toHeight, &toHF })
+                v->resize (n);
+        }
+    };
+
+    /** Evaluate n inputs at once: out[i] = evaluators[i]->evaluate (xs[i], ys[i]).
+        Each layer is done in two passes over all inputs: a scalar pass that
+        finds the four grid taps of every input (each input has its own
+        grids), then a branch-free pass that blends and routes them, which
+        the compiler vectorises. */
+    static void evaluateBatch (const GradientMapEvaluator* const* evaluators,
+                               const float* xs, const float* ys, int n,
+                               Offsets* out, BatchScratch& scratch)
+    {
+        const auto count = static_cast<size_t> (juce::jmax (0, n));
+        scratch.resize (count);
+        for (size_t i = 0; i < count; ++i)
+            out[i] = {};
+
+        for (size_t layer = 0; layer < 3; ++layer)
+        {
+            for (size_t i = 0; i < count; ++i)
             {
-                float exponent = std::pow (2.0f, -cache.curve);
-                greyValue = std::pow (greyValue, exponent);
+                const auto* grid = evaluators[i]->layerGrids[layer].get();
+                const bool active = grid != nullptr;
+
+                float t00 = 0.0f, t10 = 0.0f, t01 = 0.0f, t11 = 0.0f, tx = 0.0f, ty = 0.0f;
+                if (active)
+                    grid->taps (xs[i], ys[i], t00, t10, t01, t11, tx, ty);
+
+                scratch.t00[i] = t00;
+                scratch.t10[i] = t10;
+                scratch.t01[i] = t01;
+                scratch.t11[i] = t11;
+                scratch.tx[i]  = tx;
+                scratch.ty[i]  = ty;
+                scratch.base[i]  = active ? grid->offsetBase : 0.0f;
+                scratch.scale[i] = active ? grid->offsetScale : 0.0f;
+                scratch.toAtt[i]    = active && grid->param == GradientMap::TargetParam::Attenuation ? 1.0f : 0.0f;
+                scratch.toHeight[i] = active && grid->param == GradientMap::TargetParam::Height ? 1.0f : 0.0f;
+                scratch.toHF[i]     = active && grid->param == GradientMap::TargetParam::HFShelf ? 1.0f : 0.0f;
             }
 
-            // Map grey [0,1] → parameter offset [blackValue, whiteValue]
-            float offset = cache.blackValue + greyValue * (cache.whiteValue - cache.blackValue);
-
-            switch (cache.param)
+            for (size_t i = 0; i < count; ++i)
             {
-                case GradientMap::TargetParam::Attenuation:
-                    result.attenuationDb += offset;
-                    break;
-                case GradientMap::TargetParam::Height:
-                    result.heightMeters += offset;
-                    break;
-                case GradientMap::TargetParam::HFShelf:
-                    result.hfShelfDb += offset;
-                    break;
+                const float top    = scratch.t00[i] + scratch.tx[i] * (scratch.t10[i] - scratch.t00[i]);
+                const float bottom = scratch.t01[i] + scratch.tx[i] * (scratch.t11[i] - scratch.t01[i]);
+                const float grey   = top + scratch.ty[i] * (bottom - top);
+                const float offset = scratch.base[i] + scratch.scale[i] * grey;
+
+                out[i].attenuationDb += scratch.toAtt[i] * offset;
+                out[i].heightMeters  += scratch.toHeight[i] * offset;
+                out[i].hfShelfDb     += scratch.toHF[i] * offset;
             }
         }
-
-        return result;
     }
 
-    /** Check if any layer has a valid bitmap */
-    bool hasAnyActiveBitmap() const
+    /** Check if any layer has a rasterized grid */
+    bool hasAnyActiveLayer() const
     {
-        for (const auto& cache : layerCaches)
-            if (cache.enabled && cache.bitmap.isValid())
+        for (const auto& grid : layerGrids)
+            if (grid != nullptr)
                 return true;
         return false;
     }
 
-    /** Get the rasterized bitmap for a layer (for debug/preview overlay) */
-    const juce::Image& getLayerBitmap (int layerIndex) const
+    /** Bytes held by the rasterized grids (shared grids counted in full) */
+    size_t getMemoryBytes() const
     {
-        static const juce::Image emptyImage;
+        size_t bytes = 0;
+        for (const auto& grid : layerGrids)
+            if (grid != nullptr)
+                bytes += grid->getMemoryBytes();
+        return bytes;
+    }
+
+    const GridPtr& getLayerGrid (int layerIndex) const
+    {
+        static const GridPtr none;
         if (layerIndex < 0 || layerIndex >= 3)
-            return emptyImage;
-        return layerCaches[static_cast<size_t> (layerIndex)].bitmap;
+            return none;
+        return layerGrids[static_cast<size_t> (layerIndex)];
     }
 
 private:
-    //==========================================================================
-    // Layer Cache
-    //==========================================================================
+    std::array<GridPtr, 3> layerGrids;
+    std::array<uint32_t, 3> layerGenerations {};
 
-    struct LayerCache
-    {
-        juce::Image bitmap;
-        GradientMap::TargetParam param = GradientMap::TargetParam::Attenuation;
-        float whiteValue = 0.0f;
-        float blackValue = 0.0f;
-        float curve = 0.0f;
-        bool enabled = false;
-    };
+    StageSpec stage;
 
-    std::array<LayerCache, 3> layerCaches;
-
-    float stageMinX = -10.0f, stageMaxX = 10.0f;
-    float stageMinY = -10.0f, stageMaxY = 0.0f;
-    float pixelsPerMeter = WFSParameterDefaults::gmBitmapPixelsPerMeter;
+    static void addOffset (Offsets& result, GradientMap::TargetParam param, float offset) noexcept
+    {
+        switch (param)
+        {
+            case GradientMap::TargetParam::Attenuation:
+                result.attenuationDb += offset;
+                break;
+            case GradientMap::TargetParam::Height:
+                result.heightMeters += offset;
+                break;
+            case GradientMap::TargetParam::HFShelf:
+                result.hfShelfDb += offset;
+                break;
+        }
+    }
 
     //==========================================================================
-    // Bitmap Sampling
+    // Grid Building
     //==========================================================================
 
-    /** Sample a layer bitmap at stage coordinates. Returns 0-1 greyscale. */
-    float sampleBitmap (const LayerCache& cache, float stageX, float stageY) const
+    /** Convert a rendered layer to its grid: grey, curve and quantisation per
+        pixel, cropped to the pixels that end up non-zero. */
+    static void buildGrid (LayerGrid& grid, const juce::Image& bitmap, const GradientMap::Layer& layer,
+                           const StageSpec& spec, float stageW, float stageH)
     {
-        float stageW = stageMaxX - stageMinX;
-        float stageH = stageMaxY - stageMinY;
-
-        if (stageW <= 0.0f || stageH <= 0.0f)
-            return 0.0f;
+        const int bmpW = bitmap.getWidth();
+        const int bmpH = bitmap.getHeight();
 
-        // Stage to normalised [0,1]
-        float normX = (stageX - stageMinX) / stageW;
-        float normY = (stageMaxY - stageY) / stageH;  // Y inverted
+        // Apply curve: value = pow(value, 2^(-curve))
+        // curve=-1 → exp=2 (compresses toward black)
+        // curve=0  → exp=1 (linear)
+        // curve=+1 → exp=0.5 (compresses toward white)
+        const float exponent = std::pow (2.0f, -layer.curve);
 
-        // To pixel coords
-        int px = juce::roundToInt (normX * static_cast<float> (cache.bitmap.getWidth() - 1));
-        int py = juce::roundToInt (normY * static_cast<float> (cache.bitmap.getHeight() - 1));
-
-        // Bounds check — outside bitmap = 0 (black / no effect)
-        if (px < 0 || px >= cache.bitmap.getWidth() || py < 0 || py >= cache.bitmap.getHeight())
-            return 0.0f;
-
-        // Read pixel and convert to greyscale [0-1]
-        // We use the alpha channel as the "painted" indicator and brightness as the value.
-        // For shapes painted with greyscale colours on a transparent background:
-        auto pixel = cache.bitmap.getPixelAt (px, py);
-        float alpha = pixel.getFloatAlpha();
+        std::vector<uint16_t> full (static_cast<size_t> (bmpW) * static_cast<size_t> (bmpH), 0);
+        int minX = bmpW, minY = bmpH, maxX = -1, maxY = -1;
+        {
+            const juce::Image::BitmapData data (bitmap, juce::Image::BitmapData::readOnly);
 
-        if (alpha < 0.001f)
-            return 0.0f;  // Transparent = no shape here = return 0 (black default)
+            for (int py = 0; py < bmpH; ++py)
+            {
+                for (int px = 0; px < bmpW; ++px)
+                {
+                    // Alpha is the "painted" indicator and brightness the value;
+                    // brightness weighted by alpha for proper compositing
+                    auto pixel = data.getPixelColour (px, py);
+                    float alpha = pixel.getFloatAlpha();
+
+                    if (alpha < 0.001f)
+                        continue;  // Transparent = no shape here = 0 (black default)
+
+                    float greyValue = pixel.getBrightness() * alpha;
+                    if (layer.curve != 0.0f && greyValue > 0.0f && greyValue < 1.0f)
+                        greyValue = std::pow (greyValue, exponent);
+
+                    const auto q = static_cast<uint16_t> (juce::roundToInt (juce::jlimit (0.0f, 1.0f, greyValue)
+                                                                            * LayerGrid::maxLevel));
+                    if (q == 0)
+                        continue;
+
+                    full[static_cast<size_t> (py * bmpW + px)] = q;
+                    minX = juce::jmin (minX, px);
+                    maxX = juce::jmax (maxX, px);
+                    minY = juce::jmin (minY, py);
+                    maxY = juce::jmax (maxY, py);
+                }
+            }
+        }
 
-        // Return brightness weighted by alpha for proper compositing
-        return pixel.getBrightness() * alpha;
+        grid.param = layer.param;
+        grid.originX = spec.minX;
+        grid.originY = spec.maxY;
+        grid.scaleX = static_cast<float> (bmpW - 1) / stageW;
+        grid.scaleY = static_cast<float> (bmpH - 1) / stageH;
+        grid.offsetBase  = layer.blackValue;
+        grid.offsetScale = (layer.whiteValue - layer.blackValue) / LayerGrid::maxLevel;
+
+        if (maxX < 0)
+            return;   // Nothing painted: the whole stage is grey 0
+
+        grid.cropX = minX;
+        grid.cropY = minY;
+        grid.cropW = maxX - minX + 1;
+        grid.cropH = maxY - minY + 1;
+        grid.cells.resize (static_cast<size_t> (grid.cropW) * static_cast<size_t> (grid.cropH));
+
+        for (int row = 0; row < grid.cropH; ++row)
+            std::copy_n (full.begin() + (minY + row) * bmpW + minX, grid.cropW,
+                         grid.cells.begin() + row * grid.cropW);
     }
 
     //==========================================================================
@@ -249,9 +479,9 @@ private:
     //==========================================================================
 
     /** Render a single shape to the bitmap graphics context */
-    void renderShapeToBitmap (juce::Graphics& g, const GradientMap::Shape& shape,
-                              const juce::AffineTransform& stageToBitmap,
-                              int bmpW, int bmpH) const
+    static void renderShapeToBitmap (juce::Graphics& g, const GradientMap::Shape& shape,
+                                     const juce::AffineTransform& stageToBitmap,
+                                     int bmpW, int bmpH, float pixelsPerMeter)
     {
         // Get the shape path in stage coords
         juce::Path path = shape.getPath();
@@ -262,7 +492,7 @@ private:
         // Handle edge blur
         if (shape.blur > 0.0f)
         {
-            renderShapeWithBlur (g, shape, path, stageToBitmap, bmpW, bmpH);
+            renderShapeWithBlur (g, shape, path, stageToBitmap, bmpW, bmpH, pixelsPerMeter);
             return;
         }
 
@@ -272,10 +502,10 @@ private:
     }
 
     /** Render a shape with edge blur by rasterizing to a temp image and applying gaussian blur */
-    void renderShapeWithBlur (juce::Graphics& g, const GradientMap::Shape& shape,
-                              const juce::Path& bitmapPath,
-                              const juce::AffineTransform& stageToBitmap,
-                              int bmpW, int bmpH) const
+    static void renderShapeWithBlur (juce::Graphics& g, const GradientMap::Shape& shape,
+                                     const juce::Path& bitmapPath,
+                                     const juce::AffineTransform& stageToBitmap,
+                                     int bmpW, int bmpH, float pixelsPerMeter)
     {
         // Use software image to avoid Direct2D BitmapData assertion in applyToImage
         juce::Image tempImage (juce::Image::ARGB, bmpW, bmpH, true,
@@ -300,9 +530,9 @@ private:
     }
 
     /** Set the appropriate fill colour/gradient on a Graphics context for a shape */
-    void applyFill (juce::Graphics& g, const GradientMap::Shape& shape,
-                    const juce::Path& /*bitmapPath*/,
-                    const juce::AffineTransform& stageToBitmap) const
+    static void applyFill (juce::Graphics& g, const GradientMap::Shape& shape,
+                           const juce::Path& /*bitmapPath*/,
+                           const juce::AffineTransform& stageToBitmap)
     {
         switch (shape.fillType)
         {
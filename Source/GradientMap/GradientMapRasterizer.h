@@ -0,0 +1,231 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "GradientMapEvaluator.h"
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Background rasterizer and shared cache for gradient-map layer grids.
+ *
+ * Grids are keyed by a hash of everything that shapes them (the layer's
+ * shapes, curve, white/black values and target, the stage bounds and the
+ * resolution), so inputs carrying identical layers share one immutable grid
+ * and a layer is only ever rasterized once per version. A key already being
+ * built is not queued twice; later requesters just wait on the same job.
+ *
+ * Each request names the (input, layer) slot and the generation the
+ * evaluator handed out for it (GradientMapEvaluator::beginLayerUpdate). Jobs
+ * whose requesters have all moved on to a newer generation are dropped
+ * unbuilt, so a burst of drag previews only costs the latest one.
+ *
+ * Threads: request()/takeCompleted() from the message thread; the grids are
+ * swapped into evaluators there (GradientMapEvaluator::acceptLayerGrid).
+ */
+class GradientMapRasterizer : private juce::Thread
+{
+public:
+    using GridPtr = GradientMapEvaluator::GridPtr;
+
+    /** Preview grids are built at this fraction of the stage resolution */
+    static constexpr float previewScale = 0.25f;
+
+    struct Completed
+    {
+        int input = 0;
+        int layer = 0;
+        uint32_t generation = 0;
+        GridPtr grid;
+    };
+
+    GradientMapRasterizer() : juce::Thread ("GradientMapRasterizer") {}
+
+    ~GradientMapRasterizer() override
+    {
+        stopThread (4000);
+    }
+
+    /** Ask for a layer's grid. Returns it straight away when an identical
+        layer is already built (nothing comes back from takeCompleted() then);
+        otherwise returns nullptr and queues it. */
+    GridPtr request (int input, int layerIndex, uint32_t generation,
+                     const GradientMap::Layer& layer,
+                     GradientMapEvaluator::StageSpec spec, bool preview)
+    {
+        if (preview)
+            spec.pixelsPerMeter = juce::jmax (1.0f, spec.pixelsPerMeter * previewScale);
+
+        const auto key = makeKey (layer, spec);
+        const Waiter waiter { input, layerIndex, generation };
+
+        {
+            const std::lock_guard<std::mutex> sl (lock);
+            latest[slotOf (waiter)] = generation;
+
+            const auto built = grids.find (key);
+            if (built != grids.end())
+                if (auto grid = built->second.lock())
+                    return grid;
+
+            const auto inFlight = waiters.find (key);
+            if (inFlight != waiters.end())
+            {
+                inFlight->second.push_back (waiter);
+                return nullptr;
+            }
+
+            waiters[key].push_back (waiter);
+            queue.push_back ({ key, layer, spec });
+        }
+
+        if (! isThreadRunning())
+            startThread (juce::Thread::Priority::low);
+        notify();
+        return nullptr;
+    }
+
+    std::vector<Completed> takeCompleted()
+    {
+        const std::lock_guard<std::mutex> sl (lock);
+        std::vector<Completed> done;
+        done.swap (completed);
+        return done;
+    }
+
+    /** Distinct grids currently alive, and the bytes they hold */
+    void getCacheStats (int& numGrids, size_t& bytes) const
+    {
+        const std::lock_guard<std::mutex> sl (lock);
+        numGrids = 0;
+        bytes = 0;
+        for (const auto& entry : grids)
+        {
+            if (auto grid = entry.second.lock())
+            {
+                ++numGrids;
+                bytes += grid->getMemoryBytes();
+            }
+        }
+    }
+
+private:
+    struct Waiter
+    {
+        int input;
+        int layer;
+        uint32_t generation;
+    };
+
+    struct Job
+    {
+        uint64_t key = 0;
+        GradientMap::Layer layer;
+        GradientMapEvaluator::StageSpec spec;
+    };
+
+    void run() override
+    {
+        while (! threadShouldExit())
+        {
+            Job job;
+            bool haveJob = false;
+            {
+                const std::lock_guard<std::mutex> sl (lock);
+                while (! queue.empty() && ! haveJob)
+                {
+                    job = std::move (queue.front());
+                    queue.pop_front();
+
+                    if (pruneStaleWaitersLocked (job.key))
+                        haveJob = true;
+                    else
+                        waiters.erase (job.key);
+                }
+            }
+
+            if (! haveJob)
+            {
+                wait (-1);
+                continue;
+            }
+
+            auto grid = GradientMapEvaluator::rasterize (job.layer, job.spec);
+
+            const std::lock_guard<std::mutex> sl (lock);
+            pruneExpiredLocked();
+            if (grid != nullptr)
+                grids[job.key] = grid;
+
+            const auto it = waiters.find (job.key);
+            if (it == waiters.end())
+                continue;
+
+            for (const auto& w : it->second)
+                completed.push_back ({ w.input, w.layer, w.generation, grid });
+            waiters.erase (it);
+        }
+    }
+
+    // Drop waiters that have been superseded; true if any remain.
+    bool pruneStaleWaitersLocked (uint64_t key)
+    {
+        const auto it = waiters.find (key);
+        if (it == waiters.end())
+            return false;
+
+        auto& list = it->second;
+        list.erase (std::remove_if (list.begin(), list.end(),
+                                    [this] (const Waiter& w) { return latest[slotOf (w)] != w.generation; }),
+                    list.end());
+        return ! list.empty();
+    }
+
+    void pruneExpiredLocked()
+    {
+        for (auto it = grids.begin(); it != grids.end();)
+            it = it->second.expired() ? grids.erase (it) : std::next (it);
+    }
+
+    static uint64_t slotOf (const Waiter& w) noexcept
+    {
+        return (static_cast<uint64_t> (static_cast<uint32_t> (w.input)) << 8) | static_cast<uint32_t> (w.layer);
+    }
+
+    // 64-bit FNV-1a over the serialized shapes, layer mapping and stage.
+    static uint64_t makeKey (const GradientMap::Layer& layer, const GradientMapEvaluator::StageSpec& spec)
+    {
+        juce::MemoryOutputStream out;
+        for (const auto& shape : layer.shapes)
+            shape.toValueTree().writeToStream (out);
+
+        out.writeInt (static_cast<int> (layer.enabled));
+        out.writeInt (static_cast<int> (layer.param));
+        out.writeFloat (layer.whiteValue);
+        out.writeFloat (layer.blackValue);
+        out.writeFloat (layer.curve);
+        out.writeFloat (spec.minX);
+        out.writeFloat (spec.maxX);
+        out.writeFloat (spec.minY);
+        out.writeFloat (spec.maxY);
+        out.writeFloat (spec.pixelsPerMeter);
+
+        uint64_t h = 14695981039346656037ull;
+        const auto* bytes = static_cast<const uint8_t*> (out.getData());
+        for (size_t i = 0; i < out.getDataSize(); ++i)
+            h = (h ^ bytes[i]) * 1099511628211ull;
+        return h;
+    }
+
+    mutable std::mutex lock;
+    std::deque<Job> queue;
+    std::unordered_map<uint64_t, std::vector<Waiter>> waiters;
+    std::unordered_map<uint64_t, std::weak_ptr<const GradientMapEvaluator::LayerGrid>> grids;
+    std::unordered_map<uint64_t, uint32_t> latest;
+    std::vector<Completed> completed;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (GradientMapRasterizer)
+};
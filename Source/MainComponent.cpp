@@ -5,6 +5,7 @@
 #include "Localization/LocalizationManager.h"
 #include "Accessibility/TTSManager.h"
 #include "Network/QLabCueBuilder.h"
+#include "Network/MCP/tools/DiagnosticsTools.h"
 #include "Controllers/DialsAndButtons/pages/InputsTabPages.h"
 #include "Controllers/DialsAndButtons/pages/GradientMapPages.h"
 #include "Controllers/DialsAndButtons/pages/NetworkTabPages.h"
@@ -582,6 +583,12 @@ MainComponent::MainComponent()
         rebuildGradientMapForInput (ch);
     };
 
+    // Low-resolution preview while a shape is being dragged
+    inputsTab->getGradientMapEditor().onLayerPreview = [this] (int layerIndex, const GradientMap::Layer& layer) {
+        int ch = inputsTab->getCurrentChannel() - 1;
+        requestGradientMapLayer (ch, layerIndex, layer, true);
+    };
+
     // Bidirectional sync: editor → StreamDeck
     inputsTab->getGradientMapEditor().onActiveLayerChanged = [this]()
     {
@@ -766,6 +773,8 @@ MainComponent::MainComponent()
     // Initialize OSC Manager for network communication
     oscManager = std::make_unique<WFSNetwork::OSCManager>(parameters.getValueTreeState());
     oscManager->setDirtyTracker(&parameters.getDirtyTracker());
+    oscManager->setLocalControlRingEnabled(AppSettings::getLocalControlRing());
+    oscManager->setTimetagPlayoutMs(AppSettings::getOscTimetagPlayoutMs());
 
     // Initialize MCP server (AI control surface). Phase 2 Block 1: also
     // loads the auto-generated tool surface from generated_tools.json.
@@ -854,6 +863,28 @@ MainComponent::MainComponent()
                                                         oscManager->getLogger(),
                                                         generatedToolsJson,
                                                         knowledgeResourcesDir);
+    // App-owned diagnostics the server cannot reach on its own
+    mcpServer->getToolRegistry().registerTool (
+        WFSNetwork::Tools::Diagnostics::describeMotionLatency (motionLatency));
+    mcpServer->getToolRegistry().registerTool (
+        WFSNetwork::Tools::Diagnostics::describeControlRate ([this] (bool resetPeaks)
+        {
+            auto result = std::make_unique<juce::DynamicObject>();
+            if (controlRateWorker != nullptr)
+            {
+                result->setProperty ("worker", ControlTickStats::toVar (controlRateWorker->getStats()));
+                if (resetPeaks)
+                    controlRateWorker->resetPeaks();
+            }
+            else
+            {
+                result->setProperty ("worker", juce::var());
+            }
+            result->setProperty ("messageThread", ControlTickStats::toVar (messageControlStats.getStats()));
+            if (resetPeaks)
+                messageControlStats.resetPeaks();
+            return juce::var (result.release());
+        }));
     if (! mcpServer->start (WFSNetwork::MCPServer::kDefaultPort, /*loopbackOnly*/ true))
     {
         // Non-fatal: the app runs fine without MCP. But it used to report
@@ -1765,6 +1796,35 @@ MainComponent::MainComponent()
     // Initialize WFS Calculation Engine for DSP parameter generation
     calculationEngine = std::make_unique<WFSCalculationEngine>(parameters.getValueTreeState());
 
+    calculationEngine->setLatencyTracer (&motionLatency);
+
+    // Engine-stride copy the reverb feed thread keeps a pointer to
+    reverbFeedLevels.assign (static_cast<size_t> (calculationEngine->getNumInputs()
+                                                  * calculationEngine->getNumReverbs()), 0.0f);
+
+    // Tracked offsets reach the engine per frame; the ValueTree copy is
+    // committed by the fast path at its own rate
+    if (oscManager != nullptr)
+    {
+        auto* engine = calculationEngine.get();
+        oscManager->getTrackingFastPath().setEngineHooks (
+            [engine] (int inputIndex, float x, float y, float z, juce::int64 receiptTicks, juce::int64 routedTicks)
+            {
+                engine->setTrackedOffset (inputIndex, x, y, z, receiptTicks, routedTicks);
+            },
+            [engine] (int inputIndex) { engine->releaseTrackedOffset (inputIndex); },
+            [engine] (int inputIndex, juce::int64 receiptTicks, juce::int64 routedTicks)
+            {
+                engine->notePositionFrame (inputIndex, receiptTicks, routedTicks);
+            });
+
+        // OSC / Remote position writes go through the ValueTree; stamp them too
+        oscManager->setPositionFrameHook ([engine] (int channelIndex, juce::int64 receiptTicks, juce::int64 routedTicks)
+        {
+            engine->notePositionFrame (channelIndex, receiptTicks, routedTicks);
+        });
+    }
+
     // Initialize Binaural Solo Monitoring
     binauralCalcEngine = std::make_unique<BinauralCalculationEngine>(
         parameters.getValueTreeState(), *calculationEngine);
@@ -1811,6 +1871,7 @@ MainComponent::MainComponent()
     // Initialize AutomOtion Processor for programmed input position movement
     automOtionProcessor = std::make_unique<AutomOtionProcessor>(parameters.getValueTreeState(), 64);
     automOtionProcessor->setDirtyTracker(&parameters.getDirtyTracker());
+    automOtionProcessor->getOnsetDetector().prepare (currentDeviceSampleRate.load (std::memory_order_relaxed));
 
     // Initialize Input Speed Limiter for smooth position movement
     speedLimiter = std::make_unique<InputSpeedLimiter>();
@@ -2215,13 +2276,14 @@ MainComponent::MainComponent()
         if (channelId < 1 || channelId > parameters.getNumInputChannels())
             return;
 
+        const auto matrices = calculationEngine->readMatrices();
         oscManager->sendRemoteVisRows(channelId,
-                                      calculationEngine->getDelayTimesMs(),
-                                      calculationEngine->getLevels(),
+                                      matrices->delayTimesMs.data(),
+                                      matrices->levels.data(),
                                       calculationEngine->getNumOutputs(),
                                       parameters.getNumOutputChannels(),
-                                      calculationEngine->getInputReverbDelayTimesMs(),
-                                      calculationEngine->getInputReverbLevels(),
+                                      matrices->inputReverbDelayTimesMs.data(),
+                                      matrices->inputReverbLevels.data(),
                                       calculationEngine->getNumReverbs(),
                                       parameters.getNumReverbChannels(),
                                       targetIndex);
@@ -2381,6 +2443,15 @@ MainComponent::MainComponent()
             std::memory_order_relaxed);
     }
 
+    // Matrix recalculation runs on its own clock from here on
+    startControlRateWorker();
+
+    // Stages of the 50 Hz message-thread tick, in MessageControlStage order
+    for (auto* name : { "oscRamps", "speedLimiter", "lfo", "clusterLfo", "automotion",
+                        "metering", "offsets", "gradientMaps", "lsTamer" })
+        messageControlStats.addStage (name);
+    messageControlStats.setRateHz (50);
+
     // Start timer for device monitoring and parameter smoothing
     startTimer(5); // 5ms timer for smooth parameter updates
 
@@ -2392,6 +2463,19 @@ MainComponent::~MainComponent()
 {
     WFSLogger::getInstance().logInfo ("Session ending - saving settings");
 
+    // The control-rate worker writes into our target arrays: stop it before
+    // anything else is torn down
+    if (controlRateWorker != nullptr)
+        controlRateWorker->stop();
+
+    // The tracking fast path calls into calculationEngine, which is destroyed
+    // before oscManager: commit pending offsets and drop the hooks now
+    if (oscManager != nullptr)
+    {
+        oscManager->getTrackingFastPath().setEngineHooks (nullptr, nullptr, nullptr);
+        oscManager->setPositionFrameHook (nullptr);
+    }
+
     // Invalidate in-flight SOFA loader callbacks (they capture this).
     *sofaLoadAlive = false;
 
@@ -2613,11 +2697,12 @@ void MainComponent::resizeRoutingMatrices()
 {
     const int matrixSize = numInputChannels * numOutputChannels;
 
+    // Audio is stopped here; its first block refills the HF/FR arrays
+    audioMatrixGenerationSeen = 0;
+
     delayTimesMs.assign(matrixSize, 0.0f);
     levels.assign(matrixSize, 0.0f);
     hfAttenuation.assign(matrixSize, 0.0f);
-    targetDelayTimesMs.assign(matrixSize, 0.0f);
-    targetLevels.assign(matrixSize, 0.0f);
     finalTargetDelayTimesMs.assign(matrixSize, 0.0f);
     finalTargetLevels.assign(matrixSize, 0.0f);
     startDelayTimesMs.assign(matrixSize, 0.0f);
@@ -2626,7 +2711,6 @@ void MainComponent::resizeRoutingMatrices()
     // Floor Reflection matrices
     frDelayTimesMs.assign(matrixSize, 0.0f);
     frLevels.assign(matrixSize, 0.0f);
-    targetFRLevels.assign(matrixSize, 0.0f);
     frHFAttenuation.assign(matrixSize, 0.0f);
 
     // Initialize with zeros - WFSCalculationEngine will provide real values
@@ -2643,6 +2727,175 @@ void MainComponent::resizeRoutingMatrices()
     updateGradientMapStageBounds();
 }
 
+void MainComponent::startControlRateWorker()
+{
+    if (calculationEngine == nullptr || controlRateWorker != nullptr)
+        return;
+
+    postLSGainsToWorker();
+
+    // Matrix rows spread over a small pool; auto leaves cores for the audio
+    // callback and the reverb engine's own pool
+    int recalcWorkers = AppSettings::getMatrixRecalcWorkers();
+    if (recalcWorkers < 0)
+        recalcWorkers = juce::jlimit (0, 3, (juce::SystemStats::getNumCpus() - 2) / 2);
+    calculationEngine->setRecalcWorkers (recalcWorkers);
+
+    controlRateWorker = std::make_unique<ControlRateWorker>();
+
+    // Decays the compensation offsets of inputMinimalLatency / inputCommonAtten changes
+    controlRateWorker->addStage ("ramps", [this] (float dt)
+    {
+        calculationEngine->updateDelayModeRamps (dt);
+    });
+
+    // Only recalculate if something set the dirty flag. LS gains are the latest
+    // copy posted by the message thread; a fresh copy always requests a pass so
+    // gains that land after a pass cleared the flag are never left unapplied.
+    controlRateWorker->addStage ("matrix", [this] (float)
+    {
+        {
+            const juce::ScopedLock sl (lsGainsMailboxLock);
+            if (lsGainsMailboxFresh)
+            {
+                workerLSGains = lsGainsMailbox;
+                lsGainsMailboxFresh = false;
+                calculationEngine->markLSGainsDirty();
+            }
+        }
+
+        calculationEngine->recalculateMatrixIfDirty (&workerLSGains);
+    });
+
+    // Announces a new engine generation to timerCallback (no copies)
+    controlRateWorker->addStage ("publish", [this] (float)
+    {
+        publishMatrixTargets();
+    });
+
+    controlRateWorker->start (AppSettings::getControlRateHz());
+    delayLeadPeriodSeconds.store (AppSettings::getDelayExtrapolation()
+                                      ? 1.0f / static_cast<float> (controlRateWorker->getRateHz()) : 0.0f);
+    WFSLogger::getInstance().logInfo ("Control-rate worker started at "
+        + juce::String (controlRateWorker->getRateHz()) + " Hz, "
+        + juce::String (calculationEngine->getRecalcWorkers()) + " matrix worker(s)");
+}
+
+void MainComponent::postLSGainsToWorker()
+{
+    if (lsTamerEngine == nullptr)
+        return;
+
+    // Sparse, so the copy is the speakers inside active LS radii, not in x out
+    const juce::ScopedLock sl (lsGainsMailboxLock);
+    lsGainsMailbox = lsTamerEngine->getLSGainOverlay();
+    lsGainsMailboxFresh = true;
+}
+
+void MainComponent::publishMatrixTargets()
+{
+    // Called every worker tick, and from the message thread after a forced
+    // recalculation (channel count change, config reload). Only announces a
+    // new generation to timerCallback; the audio callback copies what the
+    // algorithms read from the generation it pins (applyMatrixGeneration()).
+    const auto generation = calculationEngine->getMatrixGeneration();
+    if (publishedMatrixGeneration.exchange (generation) != generation)
+        matrixPublishGeneration.fetch_add (1, std::memory_order_release);
+}
+
+void MainComponent::applyMatrixGeneration (const WFSCalculationEngine::MatrixSet& matrices)
+{
+    // Audio thread, once per generation, from the block's pinned set. The
+    // CPU algorithms read these arrays inside this callback, the GPU pumps
+    // and the reverb feed thread between callbacks, exactly like the
+    // smoothed delay/level arrays: one writer, at a block boundary, and
+    // every value of one block from the same generation.
+    // Note: Calculation engine uses maxOutputChannels for stride,
+    // but our local arrays use numOutputChannels (user-configured)
+    const int calcStride = calculationEngine->getNumOutputs();
+    const int numIn = juce::jmin (numInputChannels, calculationEngine->getNumInputs());
+    const int numOut = juce::jmin (numOutputChannels, calcStride);
+    if (static_cast<size_t> (numIn * numOutputChannels) > hfAttenuation.size())
+        return;
+
+    const float* calcHF = matrices.hfAttenuationDb.data();
+    const float* calcFRDelays = matrices.frDelayTimesMs.data();
+    const float* calcFRHF = matrices.frHFAttenuationDb.data();
+
+    for (int inIdx = 0; inIdx < numIn; ++inIdx)
+    {
+        for (int outIdx = 0; outIdx < numOut; ++outIdx)
+        {
+            const int srcIdx = inIdx * calcStride + outIdx;
+            const int dstIdx = inIdx * numOutputChannels + outIdx;
+            hfAttenuation[dstIdx] = calcHF[srcIdx];  // HF doesn't need smoothing - filter handles it
+
+            // FR delays/HF apply directly (delay changes are smoothed
+            // per-processor; HF steps are filter-coefficient updates). The
+            // FR level is ramped with the direct level - an instant FR level
+            // at engage produced a loud coherent onset (tap starts at the
+            // direct delay before sliding away).
+            frDelayTimesMs[dstIdx] = calcFRDelays[srcIdx];
+            frHFAttenuation[dstIdx] = calcFRHF[srcIdx];
+        }
+    }
+
+    // Same stride as the engine. Written before this block's
+    // notifyInputAvailable(): unless it is overrunning, the feed thread has
+    // finished the previous batch and is waiting for that notification
+    const size_t numFeedLevels = juce::jmin (matrices.inputReverbLevels.size(), reverbFeedLevels.size());
+    std::copy_n (matrices.inputReverbLevels.begin(), numFeedLevels, reverbFeedLevels.begin());
+}
+
+void MainComponent::updateInputsVisualisation (int numReverbs)
+{
+    if (inputsTab == nullptr || calculationEngine == nullptr)
+        return;
+
+    // Re-stride one generation to the user-configured channel counts
+    // (the engine uses the max counts for its strides)
+    std::vector<float> delays (static_cast<size_t> (numInputChannels * numOutputChannels));
+    std::vector<float> levelsVec (delays.size());
+    std::vector<float> hf (delays.size());
+    std::vector<float> reverbDelays (static_cast<size_t> (numInputChannels * numReverbs));
+    std::vector<float> reverbLevels (reverbDelays.size());
+    std::vector<float> reverbHF (reverbDelays.size());
+
+    {
+        const auto matrices = calculationEngine->readMatrices();
+        const int calcStride = calculationEngine->getNumOutputs();
+        const int calcReverbStride = calculationEngine->getNumReverbs();
+        const int numIn = juce::jmin (numInputChannels, calculationEngine->getNumInputs());
+        const int numOut = juce::jmin (numOutputChannels, calcStride);
+        const int numRev = juce::jmin (numReverbs, calcReverbStride);
+
+        for (int inIdx = 0; inIdx < numIn; ++inIdx)
+        {
+            for (int outIdx = 0; outIdx < numOut; ++outIdx)
+            {
+                int srcIdx = inIdx * calcStride + outIdx;
+                int dstIdx = inIdx * numOutputChannels + outIdx;
+                delays[dstIdx] = matrices->delayTimesMs[srcIdx];
+                levelsVec[dstIdx] = matrices->levels[srcIdx];
+                hf[dstIdx] = matrices->hfAttenuationDb[srcIdx];
+            }
+
+            for (int revIdx = 0; revIdx < numRev; ++revIdx)
+            {
+                int srcIdx = inIdx * calcReverbStride + revIdx;
+                int dstIdx = inIdx * numReverbs + revIdx;
+                reverbDelays[dstIdx] = matrices->inputReverbDelayTimesMs[srcIdx];
+                reverbLevels[dstIdx] = matrices->inputReverbLevels[srcIdx];
+                reverbHF[dstIdx] = matrices->inputReverbHFAttenuationDb[srcIdx];
+            }
+        }
+    }
+
+    inputsTab->updateVisualisation(
+        delays.data(), levelsVec.data(), hf.data(),
+        reverbDelays.data(), reverbLevels.data(), reverbHF.data());
+}
+
 void MainComponent::stopProcessingForConfigurationChange()
 {
     if (!audioEngineStarted)
@@ -3139,52 +3392,10 @@ void MainComponent::handleChannelCountChange(int inputs, int outputs, int reverb
         calculationEngine->recalculateAllInputPositions();
         calculationEngine->recalculateAllReverbPositions();
         rebuildAllGradientMaps();
-        calculationEngine->recalculateMatrix(lsTamerEngine ? lsTamerEngine->getLSGains() : nullptr);
-
-        const float* calcDelays = calculationEngine->getDelayTimesMs();
-        const float* calcLevels = calculationEngine->getLevels();
-        const float* calcHF = calculationEngine->getHFAttenuationDb();
-        const int calcStride = calculationEngine->getNumOutputs();
+        calculationEngine->recalculateMatrix(lsTamerEngine ? &lsTamerEngine->getLSGainOverlay() : nullptr);
+        publishMatrixTargets();
 
-        for (int inIdx = 0; inIdx < numInputChannels; ++inIdx)
-        {
-            for (int outIdx = 0; outIdx < numOutputChannels; ++outIdx)
-            {
-                int srcIdx = inIdx * calcStride + outIdx;
-                int dstIdx = inIdx * numOutputChannels + outIdx;
-                targetDelayTimesMs[dstIdx] = calcDelays[srcIdx];
-                targetLevels[dstIdx] = calcLevels[srcIdx];
-                hfAttenuation[dstIdx] = calcHF[srcIdx];
-            }
-        }
-
-        const float* calcReverbDelays = calculationEngine->getInputReverbDelayTimesMs();
-        const float* calcReverbLevels = calculationEngine->getInputReverbLevels();
-        const float* calcReverbHF = calculationEngine->getInputReverbHFAttenuationDb();
-        const int calcReverbStride = calculationEngine->getNumReverbs();
-
-        std::vector<float> reverbDelays(numInputChannels * reverbs);
-        std::vector<float> reverbLevelsVec(numInputChannels * reverbs);
-        std::vector<float> reverbHF(numInputChannels * reverbs);
-
-        for (int inIdx = 0; inIdx < numInputChannels; ++inIdx)
-        {
-            for (int revIdx = 0; revIdx < reverbs; ++revIdx)
-            {
-                int srcIdx = inIdx * calcReverbStride + revIdx;
-                int dstIdx = inIdx * reverbs + revIdx;
-                reverbDelays[dstIdx] = calcReverbDelays[srcIdx];
-                reverbLevelsVec[dstIdx] = calcReverbLevels[srcIdx];
-                reverbHF[dstIdx] = calcReverbHF[srcIdx];
-            }
-        }
-
-        if (inputsTab != nullptr)
-        {
-            inputsTab->updateVisualisation(
-                targetDelayTimesMs.data(), targetLevels.data(), hfAttenuation.data(),
-                reverbDelays.data(), reverbLevelsVec.data(), reverbHF.data());
-        }
+        updateInputsVisualisation (reverbs);
 
         // Mirror the new channel counts and fresh matrix to connected tablets
         // (sendVisualisationToRemotes carries config + selection + rows)
@@ -3263,12 +3474,14 @@ void MainComponent::sendVisualisationToRemotes(int targetIndex)
     oscManager->sendRemoteVisSelection(primary, clusterId, selection, targetIndex);
 
     // Rows straight from the engine matrices (max-channel stride) — independent
-    // of windowVisible and of the GUI's re-strided copies.
-    const float* delays  = calculationEngine->getDelayTimesMs();
-    const float* levels  = calculationEngine->getLevels();
+    // of windowVisible and of the GUI's re-strided copies. One generation for
+    // every row sent in this update.
+    const auto matrices = calculationEngine->readMatrices();
+    const float* delays  = matrices->delayTimesMs.data();
+    const float* levels  = matrices->levels.data();
     const int    stride  = calculationEngine->getNumOutputs();
-    const float* rDelays = calculationEngine->getInputReverbDelayTimesMs();
-    const float* rLevels = calculationEngine->getInputReverbLevels();
+    const float* rDelays = matrices->inputReverbDelayTimesMs.data();
+    const float* rLevels = matrices->inputReverbLevels.data();
     const int    rStride = calculationEngine->getNumReverbs();
 
     std::set<int> channels(selection.begin(), selection.end());
@@ -3634,15 +3847,17 @@ void MainComponent::handleConfigReloaded()
         // Rebuild all gradient map bitmaps after config reload
         rebuildAllGradientMaps();
 
-        // Force immediate recalculation (don't wait for next timer tick)
-        calculationEngine->recalculateMatrix(lsTamerEngine ? lsTamerEngine->getLSGains() : nullptr);
+        // Force immediate recalculation (don't wait for the next worker tick)
+        calculationEngine->recalculateMatrix(lsTamerEngine ? &lsTamerEngine->getLSGainOverlay() : nullptr);
+        publishMatrixTargets();
 
         // Immediately update visualization with recalculated values
         if (inputsTab != nullptr)
         {
-            const float* calcDelays = calculationEngine->getDelayTimesMs();
-            const float* calcLevels = calculationEngine->getLevels();
-            const float* calcHF = calculationEngine->getHFAttenuationDb();
+            const auto matrices = calculationEngine->readMatrices();
+
+            const float* calcDelays = matrices->delayTimesMs.data();
+            const float* calcLevels = matrices->levels.data();
             const int calcStride = calculationEngine->getNumOutputs();
 
             // Debug: Print calculated levels for input 0
@@ -3654,47 +3869,9 @@ void MainComponent::handleConfigReloaded()
                 juce::Logger::writeToLog("Output " + juce::String(outIdx+1) + ": level=" + juce::String(levelDb, 1)
                     + " dB, delay=" + juce::String(calcDelays[idx], 2) + " ms");
             }
-
-            // Copy to local arrays with correct stride
-            for (int inIdx = 0; inIdx < numInputChannels; ++inIdx)
-            {
-                for (int outIdx = 0; outIdx < numOutputChannels; ++outIdx)
-                {
-                    int srcIdx = inIdx * calcStride + outIdx;
-                    int dstIdx = inIdx * numOutputChannels + outIdx;
-                    targetDelayTimesMs[dstIdx] = calcDelays[srcIdx];
-                    targetLevels[dstIdx] = calcLevels[srcIdx];
-                    hfAttenuation[dstIdx] = calcHF[srcIdx];
-                }
-            }
-
-            // Create reverb arrays with correct stride
-            const float* calcReverbDelays = calculationEngine->getInputReverbDelayTimesMs();
-            const float* calcReverbLevels = calculationEngine->getInputReverbLevels();
-            const float* calcReverbHF = calculationEngine->getInputReverbHFAttenuationDb();
-            const int calcReverbStride = calculationEngine->getNumReverbs();
-            int numReverbs = parameters.getNumReverbChannels();
-
-            std::vector<float> reverbDelays(numInputChannels * numReverbs);
-            std::vector<float> reverbLevels(numInputChannels * numReverbs);
-            std::vector<float> reverbHF(numInputChannels * numReverbs);
-
-            for (int inIdx = 0; inIdx < numInputChannels; ++inIdx)
-            {
-                for (int revIdx = 0; revIdx < numReverbs; ++revIdx)
-                {
-                    int srcIdx = inIdx * calcReverbStride + revIdx;
-                    int dstIdx = inIdx * numReverbs + revIdx;
-                    reverbDelays[dstIdx] = calcReverbDelays[srcIdx];
-                    reverbLevels[dstIdx] = calcReverbLevels[srcIdx];
-                    reverbHF[dstIdx] = calcReverbHF[srcIdx];
-                }
-            }
-
-            inputsTab->updateVisualisation(
-                targetDelayTimesMs.data(), targetLevels.data(), hfAttenuation.data(),
-                reverbDelays.data(), reverbLevels.data(), reverbHF.data());
         }
+
+        updateInputsVisualisation (parameters.getNumReverbChannels());
     }
 
     // Re-apply controller device settings from loaded config
@@ -4258,7 +4435,8 @@ void MainComponent::openLevelMeterWindow()
 
         levelMeterWindow = std::make_unique<LevelMeterWindow>(*levelMeteringManager,
                                                                  parameters.getValueTreeState(),
-                                                                 calculationEngine.get());
+                                                                 calculationEngine.get(),
+                                                                 &motionLatency);
     }
     else
     {
@@ -4548,7 +4726,7 @@ void MainComponent::setupSharedInputFeed (int blockSize, double sampleRate)
         {
             reverbFeedThread = std::make_unique<ReverbFeedThread>();
             reverbFeedThread->prepare (sharedInputBuffers, reverbEngine.get(),
-                                       calculationEngine->getInputReverbLevels(),
+                                       reverbFeedLevels.data(),
                                        calculationEngine->getNumReverbs(),
                                        numInputChannels, numReverbs,
                                        blockSize, reverbSRRatio);
@@ -4789,6 +4967,9 @@ void MainComponent::prepareToPlay (int samplesPerBlockExpected, double sampleRat
     currentDeviceSampleRate.store (sampleRate > 0.0 ? sampleRate : 48000.0,
                                    std::memory_order_relaxed);
 
+    if (automOtionProcessor != nullptr)
+        automOtionProcessor->getOnsetDetector().prepare (sampleRate);
+
     // This function will be called when the audio device is started, or when
     // its settings (i.e. sample rate, block size, etc) are changed.
 
@@ -4937,6 +5118,8 @@ void MainComponent::prepareToPlay (int samplesPerBlockExpected, double sampleRat
     // Prepare sampler manager
     if (samplerManager == nullptr)
         samplerManager = std::make_unique<SamplerManager>();
+    samplerManager->setPinnedHeadMs (AppSettings::getSamplerPinnedHeadMs());
+    samplerManager->setStreamThresholdSeconds (AppSettings::getSamplerStreamThresholdSeconds());
     samplerManager->prepare (sampleRate, samplesPerBlockExpected, numInputChannels);
 
     // Activate sampler channels that are already enabled and load their data
@@ -5013,6 +5196,23 @@ void MainComponent::getNextAudioBlock (const juce::AudioSourceChannelInfo& buffe
     // Process WFS audio if engine is started AND processing is enabled
     if (audioEngineStarted && processingEnabled)
     {
+        // One matrix generation for the whole block: the ramp targets, the
+        // delay leads and the reverb returns below all read this pinned set,
+        // so a publish by the worker mid-block cannot mix two generations
+        const auto blockMatrices = calculationEngine != nullptr ? calculationEngine->readMatrices()
+                                                                : WFSCalculationEngine::MatrixReadHandle();
+
+        // First block on a new generation: the "applied" stamp, and the copy
+        // into the arrays the algorithms and the reverb feed thread hold
+        // pointers to (before either reads them this block)
+        if (blockMatrices && blockMatrices->generation != audioMatrixGenerationSeen)
+        {
+            audioMatrixGenerationSeen = blockMatrices->generation;
+            audioSecondsSinceMatrixTargets = 0.0;
+            applyMatrixGeneration (*blockMatrices);
+            motionLatency.pushApplied (blockMatrices->generation, juce::Time::getHighResolutionTicks());
+        }
+
         // Apply input patching: hardware channels → WFS channels (single copy into patchedInputBuffer)
         applyInputPatch(bufferToFill);
 
@@ -5031,6 +5231,12 @@ void MainComponent::getNextAudioBlock (const juce::AudioSourceChannelInfo& buffe
             }
         }
 
+        // AutomOtion audio-trigger onsets, sample-accurate on the actual inputs
+        if (automOtionProcessor != nullptr)
+            automOtionProcessor->getOnsetDetector().process (patchedInputBuffer,
+                                                             bufferToFill.startSample,
+                                                             bufferToFill.numSamples);
+
         // Apply AutomOtion return fade gain (50ms fade out/in during position snap-back)
         if (automOtionProcessor != nullptr)
         {
@@ -5072,14 +5278,47 @@ void MainComponent::getNextAudioBlock (const juce::AudioSourceChannelInfo& buffe
 
         // Parameter smoothing (runs on ASIO thread, immune to message-pump
         // throttling when the window is minimized)
-        if (processingEnabled)
-        {
-            int matrixSize = numInputChannels * numOutputChannels;
-            for (int i = 0; i < matrixSize; ++i)
+        if (processingEnabled && blockMatrices)
+        {
+            // Every pair ramps towards the same generation: the worker may
+            // publish the next one meanwhile, but a pinned set is never rewritten
+            const auto& targets = blockMatrices;
+
+            // Sub-tick delay targets: carry each pair along its delay rate for
+            // up to one control tick, hold through one late tick, then fade
+            // the lead out over a third (a source that stopped triggers no
+            // recalculation, so its last rate must not linger)
+            const float tick = delayLeadPeriodSeconds.load (std::memory_order_relaxed);
+            float leadSeconds = 0.0f;
+            if (tick > 0.0f)
+            {
+                const auto age = static_cast<float> (audioSecondsSinceMatrixTargets);
+                leadSeconds = age <= 2.0f * tick ? juce::jmin (age, tick)
+                                                 : juce::jmax (0.0f, 3.0f * tick - age);
+            }
+            audioSecondsSinceMatrixTargets += bufferToFill.numSamples
+                                              / currentDeviceSampleRate.load (std::memory_order_relaxed);
+
+            // Engine arrays use the max-channel stride, ours the configured one
+            const float* targetDelays = targets->delayTimesMs.data();
+            const float* targetDelayRates = targets->delayRatesMsPerS.data();
+            const float* targetLevels = targets->levels.data();
+            const float* targetFRLevels = targets->frLevels.data();
+            const int calcStride = calculationEngine->getNumOutputs();
+            const int numIn = juce::jmin (numInputChannels, calculationEngine->getNumInputs());
+            const int numOut = juce::jmin (numOutputChannels, calcStride);
+
+            for (int inIdx = 0; inIdx < numIn; ++inIdx)
             {
-                delayTimesMs[i] += (targetDelayTimesMs[i] - delayTimesMs[i]) * delaySmoothingFactor;
-                levels[i] += (targetLevels[i] - levels[i]) * levelSmoothingFactor;
-                frLevels[i] += (targetFRLevels[i] - frLevels[i]) * levelSmoothingFactor;
+                for (int outIdx = 0; outIdx < numOut; ++outIdx)
+                {
+                    const int srcIdx = inIdx * calcStride + outIdx;
+                    const int dstIdx = inIdx * numOutputChannels + outIdx;
+                    const float delayTarget = targetDelays[srcIdx] + targetDelayRates[srcIdx] * leadSeconds;
+                    delayTimesMs[dstIdx] += (delayTarget - delayTimesMs[dstIdx]) * delaySmoothingFactor;
+                    levels[dstIdx] += (targetLevels[srcIdx] - levels[dstIdx]) * levelSmoothingFactor;
+                    frLevels[dstIdx] += (targetFRLevels[srcIdx] - frLevels[dstIdx]) * levelSmoothingFactor;
+                }
             }
         }
 
@@ -5130,7 +5369,7 @@ void MainComponent::getNextAudioBlock (const juce::AudioSourceChannelInfo& buffe
 #endif
 
         // Mix reverb returns into WFS output (after WFS processing wrote speaker data)
-        if (numReverbs > 0 && reverbEngine && calculationEngine)
+        if (numReverbs > 0 && reverbEngine && blockMatrices)
         {
             // Solo Reverbs: clear direct sound so only reverb returns are heard
             if (soloReverbs.load (std::memory_order_relaxed))
@@ -5141,7 +5380,8 @@ void MainComponent::getNextAudioBlock (const juce::AudioSourceChannelInfo& buffe
 
             // Pull wet reverb output and mix into WFS outputs
             // Index: [reverbIndex * calcOutputStride + outputIndex]
-            const float* reverbOutputLevelsPtr = calculationEngine->getReverbOutputLevels();
+            // Same generation as the ramp targets above
+            const float* reverbOutputLevelsPtr = blockMatrices->reverbOutputLevels.data();
             const int calcOutputStride = calculationEngine->getNumOutputs();
             bool isPostMuted = muteReverbPost.load (std::memory_order_relaxed);
 
@@ -5559,6 +5799,42 @@ void MainComponent::timerCallback()
         }
     }
 #endif
+
+    motionLatency.collect();
+
+    // Once per second: surface control-rate trouble on either clock (missed
+    // ticks, or a tick starting more than half a period late). Quiet while
+    // healthy; peaks are only cleared after they were logged, so
+    // diagnostics_get_control_rate sees them otherwise.
+    if (++controlRateStatTick >= 200) // 5 ms timer
+    {
+        controlRateStatTick = 0;
+
+        auto logIfUnhealthy = [] (const juce::String& clock, const ControlTickStats::Stats& stats,
+                                  juce::uint64& overrunsLogged) -> bool
+        {
+            const float periodUs = 1.0e6f / static_cast<float> (juce::jmax (1, stats.rateHz));
+            if (stats.overruns <= overrunsLogged && stats.peakJitterUs <= 0.5f * periodUs)
+                return false;
+
+            juce::String msg (clock + " " + juce::String (stats.rateHz) + " Hz: overruns +"
+                + juce::String (stats.overruns - overrunsLogged)
+                + ", jitter peak " + juce::String (stats.peakJitterUs, 0)
+                + " / mean " + juce::String (stats.meanJitterUs, 0) + " us; stage mean/peak");
+            for (const auto& st : stats.stages)
+                msg << " " << st.name << " " << juce::String (st.meanUs, 0) << "/" << juce::String (st.peakUs, 0) << " us";
+            WFSLogger::getInstance().logInfo (msg);
+            overrunsLogged = stats.overruns;
+            return true;
+        };
+
+        if (controlRateWorker != nullptr
+            && logIfUnhealthy ("Control rate worker", controlRateWorker->getStats(), controlRateOverrunsLogged))
+            controlRateWorker->resetPeaks();
+
+        if (logIfUnhealthy ("Control rate message thread", messageControlStats.getStats(), messageControlOverrunsLogged))
+            messageControlStats.resetPeaks();
+    }
     // Check once whether the window is visible — skip all repaints and
     // visual-only updates when minimized to avoid message-queue congestion
     // that can starve the audio thread's parameter updates.
@@ -5615,10 +5891,24 @@ void MainComponent::timerCallback()
     // Recalculate matrix from input/output positions and update target values
     if (calculationEngine != nullptr && (timerTicksSinceLastRandom % 4) == 0)
     {
+        // Stage timing (diagnostics_get_control_rate). A tick more than one
+        // period late means a tick was lost to a busy message thread.
+        double stageStartMs = juce::Time::getMillisecondCounterHiRes();
+        const double tickIntervalMs = lastMessageControlTickMs > 0.0 ? stageStartMs - lastMessageControlTickMs : 20.0;
+        lastMessageControlTickMs = stageStartMs;
+        messageControlStats.recordTickStart (static_cast<float> ((tickIntervalMs - 20.0) * 1000.0));
+        auto endControlStage = [this, &stageStartMs] (int stage)
+        {
+            const double now = juce::Time::getMillisecondCounterHiRes();
+            messageControlStats.recordStage (stage, static_cast<float> ((now - stageStartMs) * 1000.0));
+            stageStartMs = now;
+        };
+
         // Step OSC-driven parameter ramps (3rd-float "transition time in seconds")
         // BEFORE everything else so the 50 Hz recalculation below sees the latest values.
         if (oscManager != nullptr)
             oscManager->processParameterRamps();
+        endControlStage (mcsOscRamps);
 
         // Process Input Speed Limiter at 50Hz (BEFORE flip/offset/LFO)
         if (speedLimiter != nullptr)
@@ -5655,6 +5945,10 @@ void MainComponent::timerCallback()
             // Override positions for channels with active sampler playback
             if (samplerManager != nullptr)
             {
+                // Attach cell audio decoded in the background since last tick
+                samplerManager->applyPendingAudioLoads();
+                samplerManager->releaseRetiredSamples();
+
                 for (int i = 0; i < numInputChannels; ++i)
                 {
                     float sx, sy, sz;
@@ -5671,6 +5965,18 @@ void MainComponent::timerCallback()
                             WFSLogger::getInstance().logWarning ("Sampler: input " + juce::String (i + 1)
                                 + " trigger rejected - cell has no audio loaded ("
                                 + juce::String (rejected) + "x)");
+
+                        // Streamed cells whose read-ahead fell behind the playhead
+                        int underruns = engine->fetchAndClearStreamUnderruns();
+                        if (underruns > 0)
+                        {
+                            const auto msg = LOC("inputs.messages.samplerStreamUnderrun")
+                                                .replace ("{channel}", juce::String (i + 1))
+                                                .replace ("{count}",   juce::String (underruns));
+                            WFSLogger::getInstance().logWarning (msg);
+                            if (statusBar != nullptr)
+                                statusBar->showTemporaryMessage (msg, 5000);
+                        }
                     }
                 }
             }
@@ -5706,11 +6012,23 @@ void MainComponent::timerCallback()
             }
         }
 
-        // Process LFO at 50Hz (control rate)
+        endControlStage (mcsSpeedLimiter);
+
+        // LFOs advance by the measured time since the previous tick, so timer
+        // jitter does not turn into rate error. Capped at 100 ms: after a longer
+        // stall (modal dialog, window drag) they resume instead of jumping.
+        const float lfoDeltaSeconds = static_cast<float> (juce::jlimit (0.0, 100.0, tickIntervalMs) * 0.001);
+
         if (lfoProcessor != nullptr)
         {
-            lfoProcessor->process(0.02f);  // 20ms delta time (50Hz)
+            lfoProcessor->process (lfoDeltaSeconds);
         }
+        endControlStage (mcsLfo);
+
+        // Cluster LFOs on the same clock (ClustersTab maps them onto member inputs)
+        if (clustersTab != nullptr)
+            clustersTab->processClusterLFOs (lfoDeltaSeconds);
+        endControlStage (mcsClusterLfo);
 
         // Collect audio levels for AutomOtion triggering
         if (automOtionProcessor != nullptr)
@@ -5759,6 +6077,7 @@ void MainComponent::timerCallback()
             if (mapVisible && automOtionProcessor->isAnyActive() && mapTab != nullptr)
                 mapTab->repaint();
         }
+        endControlStage (mcsAutomOtion);
 
         // Update level metering at 50Hz (20ms)
         if (levelMeteringManager != nullptr && levelMeteringManager->isMeteringActive())
@@ -5789,6 +6108,7 @@ void MainComponent::timerCallback()
             if (mapVisible && levelMeteringManager->isMapOverlayEnabled() && mapTab != nullptr)
                 mapTab->repaint();
         }
+        endControlStage (mcsMetering);
 
         // Pass combined LFO + AutomOtion offsets and gyrophone offsets to calculation engine for DSP
         for (int i = 0; i < numInputChannels; ++i)
@@ -5827,18 +6147,30 @@ void MainComponent::timerCallback()
             }
         }
 
-        // Update delay mode ramps (decays compensation offset for smooth mode transitions)
-        calculationEngine->updateDelayModeRamps(0.02f);  // 20ms delta time (50Hz)
+        endControlStage (mcsOffsets);
+
+        // Delay mode ramps now run on the control-rate worker
+
+        // Swap in gradient-map grids rasterized in the background since last tick
+        applyRasterizedGradientMaps();
+
+        // Evaluate gradient maps at composite input positions (one batch over
+        // every input with an active layer, bilinear grid lookup)
+        gradientMapBatchEvaluators.clear();
+        gradientMapBatchInputs.clear();
+        gradientMapBatchX.clear();
+        gradientMapBatchY.clear();
 
-        // Evaluate gradient maps at composite input positions (O(1) bitmap lookup per input)
         for (int i = 0; i < numInputChannels && i < static_cast<int> (gradientMapEvaluators.size()); ++i)
         {
-            if (gradientMapEvaluators[static_cast<size_t> (i)]->hasAnyActiveBitmap())
+            const auto* evaluator = gradientMapEvaluators[static_cast<size_t> (i)].get();
+            if (evaluator->hasAnyActiveLayer())
             {
                 auto pos = calculationEngine->getCompositeInputPosition (i);
-                auto offsets = gradientMapEvaluators[static_cast<size_t> (i)]->evaluate (pos.x, pos.y);
-                calculationEngine->setGradientMapOffsets (i, offsets.attenuationDb,
-                                                          offsets.heightMeters, offsets.hfShelfDb);
+                gradientMapBatchEvaluators.push_back (evaluator);
+                gradientMapBatchInputs.push_back (i);
+                gradientMapBatchX.push_back (pos.x);
+                gradientMapBatchY.push_back (pos.y);
             }
             else
             {
@@ -5846,6 +6178,24 @@ void MainComponent::timerCallback()
             }
         }
 
+        if (! gradientMapBatchInputs.empty())
+        {
+            const int n = static_cast<int> (gradientMapBatchInputs.size());
+            gradientMapBatchOut.resize (gradientMapBatchInputs.size());
+            GradientMapEvaluator::evaluateBatch (gradientMapBatchEvaluators.data(),
+                                                 gradientMapBatchX.data(), gradientMapBatchY.data(), n,
+                                                 gradientMapBatchOut.data(), gradientMapBatchScratch);
+
+            for (size_t k = 0; k < gradientMapBatchInputs.size(); ++k)
+            {
+                const auto& offsets = gradientMapBatchOut[k];
+                calculationEngine->setGradientMapOffsets (gradientMapBatchInputs[k], offsets.attenuationDb,
+                                                          offsets.heightMeters, offsets.hfShelfDb);
+            }
+        }
+
+        endControlStage (mcsGradientMaps);
+
         // Process Live Source Tamer at 50Hz
         if (lsTamerEngine != nullptr)
         {
@@ -5910,6 +6260,10 @@ void MainComponent::timerCallback()
             // Process LS gains
             lsTamerEngine->process(peakGRs, slowGRs);
 
+            // Hand the new gains to the worker before marking inputs dirty below,
+            // so a recalc triggered by the dirty flag never uses the previous gains
+            postLSGainsToWorker();
+
             // Push LS GR to InputsTab meter display (gated on enable flags)
             if (windowVisible && inputsTab != nullptr)
             {
@@ -5927,16 +6281,22 @@ void MainComponent::timerCallback()
                 }
             }
 
-            // Mark only inputs that were active at start of LS processing
-            // This is more efficient than marking all inputs, and ensures
-            // the final ramp-out tick triggers visualization update
+            // Request a pass while any input was active at start of LS
+            // processing (so the final ramp-out tick still lands). The engine
+            // diffs the gains itself and only rewrites the pairs that moved.
             for (int i = 0; i < numInputChannels; ++i)
             {
                 if (lsTamerEngine->inputNeedsRecalculation(i))
-                    calculationEngine->markInputDirty(i);
+                {
+                    calculationEngine->markLSGainsDirty();
+                    break;
+                }
             }
         }
 
+        endControlStage (mcsLsTamer);
+        messageControlStats.recordTickEnd (tickIntervalMs > 40.0);
+
         // Sync binaural processor enabled state from ValueTree.
         // Ordering matters: the worker may already be running (started gated-off in
         // prepareToPlay), so quiesce it, rebuild buffers, publish the RT snapshot,
@@ -6030,44 +6390,12 @@ void MainComponent::timerCallback()
             }
         }
 
-        // Only recalculate WFS matrix if input positions have changed (dirty flag set).
-        // LS gains are supplied fresh each call (never cached by the engine).
-        if (calculationEngine->recalculateMatrixIfDirty(lsTamerEngine ? lsTamerEngine->getLSGains() : nullptr))
+        // The control-rate worker recalculates the matrix and copies it into the
+        // target arrays; react here once per new publication
+        const auto matrixGeneration = matrixPublishGeneration.load (std::memory_order_acquire);
+        if (matrixGeneration != matrixGenerationSeen)
         {
-
-            // Copy calculated values to target arrays
-            // Note: Calculation engine uses maxOutputChannels (64) for stride,
-            // but our local arrays use numOutputChannels (user-configured)
-            const float* calcDelays = calculationEngine->getDelayTimesMs();
-            const float* calcLevels = calculationEngine->getLevels();
-            const float* calcHF = calculationEngine->getHFAttenuationDb();
-            const int calcStride = calculationEngine->getNumOutputs();  // maxOutputChannels (64)
-
-            // Copy FR matrices from calculation engine
-            const float* calcFRDelays = calculationEngine->getFRDelayTimesMs();
-            const float* calcFRLevels = calculationEngine->getFRLevels();
-            const float* calcFRHF = calculationEngine->getFRHFAttenuationDb();
-
-            for (int inIdx = 0; inIdx < numInputChannels; ++inIdx)
-            {
-                for (int outIdx = 0; outIdx < numOutputChannels; ++outIdx)
-                {
-                    int srcIdx = inIdx * calcStride + outIdx;
-                    int dstIdx = inIdx * numOutputChannels + outIdx;
-                    targetDelayTimesMs[dstIdx] = calcDelays[srcIdx];
-                    targetLevels[dstIdx] = calcLevels[srcIdx];
-                    hfAttenuation[dstIdx] = calcHF[srcIdx];  // HF doesn't need smoothing - filter handles it
-
-                    // Copy FR matrices. Delays/HF apply directly (delay changes are
-                    // smoothed per-processor; HF steps are filter-coefficient updates),
-                    // but the LEVEL goes through the same one-pole fade as the direct
-                    // level - an instant FR level at engage produced a loud coherent
-                    // onset (tap starts at the direct delay before sliding away).
-                    frDelayTimesMs[dstIdx] = calcFRDelays[srcIdx];
-                    targetFRLevels[dstIdx] = calcFRLevels[srcIdx];
-                    frHFAttenuation[dstIdx] = calcFRHF[srcIdx];
-                }
-            }
+            matrixGenerationSeen = matrixGeneration;
 
             // Update FR filter parameters for each input
             for (int i = 0; i < numInputChannels; ++i)
@@ -6116,38 +6444,8 @@ void MainComponent::timerCallback()
             }
 
             // Update visualisation with current DSP matrix values (skip when minimized)
-            // Use our correctly-strided local arrays (targetDelayTimesMs has numOutputChannels stride)
-            if (windowVisible && inputsTab != nullptr)
-            {
-                // Create temporary reverb arrays with correct stride for visualization
-                // Calculation engine uses maxReverbChannels (16) stride, but user may have fewer
-                const float* calcReverbDelays = calculationEngine->getInputReverbDelayTimesMs();
-                const float* calcReverbLevels = calculationEngine->getInputReverbLevels();
-                const float* calcReverbHF = calculationEngine->getInputReverbHFAttenuationDb();
-                const int calcReverbStride = calculationEngine->getNumReverbs();  // maxReverbChannels (16)
-                int numReverbs = parameters.getNumReverbChannels();
-
-                // Reindex reverb data with user-configured stride
-                std::vector<float> reverbDelays(numInputChannels * numReverbs);
-                std::vector<float> reverbLevels(numInputChannels * numReverbs);
-                std::vector<float> reverbHF(numInputChannels * numReverbs);
-
-                for (int inIdx = 0; inIdx < numInputChannels; ++inIdx)
-                {
-                    for (int revIdx = 0; revIdx < numReverbs; ++revIdx)
-                    {
-                        int srcIdx = inIdx * calcReverbStride + revIdx;
-                        int dstIdx = inIdx * numReverbs + revIdx;
-                        reverbDelays[dstIdx] = calcReverbDelays[srcIdx];
-                        reverbLevels[dstIdx] = calcReverbLevels[srcIdx];
-                        reverbHF[dstIdx] = calcReverbHF[srcIdx];
-                    }
-                }
-
-                inputsTab->updateVisualisation(
-                    targetDelayTimesMs.data(), targetLevels.data(), hfAttenuation.data(),
-                    reverbDelays.data(), reverbLevels.data(), reverbHF.data());
-            }
+            if (windowVisible)
+                updateInputsVisualisation (parameters.getNumReverbChannels());
 
             // Tablet mirroring is throttled below and must run even when the
             // window is hidden, so only mark the recalc here.
@@ -7581,7 +7879,39 @@ void MainComponent::rebuildGradientMapForInput (int channelIndex)
         return;
 
     auto map = GradientMap::InputGradientMap::fromValueTree (gmTree);
-    gradientMapEvaluators[static_cast<size_t> (channelIndex)]->rasterizeAll (map);
+    for (int layer = 0; layer < 3; ++layer)
+        requestGradientMapLayer (channelIndex, layer, map.layers[static_cast<size_t> (layer)], false);
+}
+
+void MainComponent::requestGradientMapLayer (int channelIndex, int layerIndex,
+                                             const GradientMap::Layer& layer, bool preview)
+{
+    if (channelIndex < 0 || channelIndex >= static_cast<int> (gradientMapEvaluators.size()))
+        return;
+
+    auto& evaluator = *gradientMapEvaluators[static_cast<size_t> (channelIndex)];
+
+    // Disabled or empty layers have no grid: clear them at once
+    if (! GradientMapEvaluator::needsRaster (layer))
+    {
+        evaluator.setLayerGrid (layerIndex, nullptr);
+        return;
+    }
+
+    // Keep the current grid until the new one is ready; a shared grid for an
+    // identical layer is reused straight away
+    const auto generation = evaluator.beginLayerUpdate (layerIndex);
+    if (auto grid = gradientMapRasterizer.request (channelIndex, layerIndex, generation, layer,
+                                                   evaluator.getStageSpec(), preview))
+        evaluator.acceptLayerGrid (layerIndex, generation, std::move (grid));
+}
+
+void MainComponent::applyRasterizedGradientMaps()
+{
+    for (auto& done : gradientMapRasterizer.takeCompleted())
+        if (done.input >= 0 && done.input < static_cast<int> (gradientMapEvaluators.size()))
+            gradientMapEvaluators[static_cast<size_t> (done.input)]->acceptLayerGrid (done.layer, done.generation,
+                                                                                        std::move (done.grid));
 }
 
 void MainComponent::repaintActiveTab()
@@ -9,6 +9,8 @@
 #endif
 #include "../spatcore/wfs/OutputBufferAlgorithm.h"
 #include "DSP/WFSCalculationEngine.h"
+#include "DSP/ControlRateWorker.h"
+#include "DSP/MotionLatencyTracer.h"
 #include "DSP/LFOProcessor.h"
 #include "Automation/AutomOtionProcessor.h"
 #include "../spatcore/dsp/InputSpeedLimiter.h"
@@ -55,6 +57,7 @@
 #include "Controllers/PositionControl/ControllerManager.h"
 #include "../spatcore/controllers/lightpad/LightpadManager.h"
 #include "GradientMap/GradientMapEvaluator.h"
+#include "GradientMap/GradientMapRasterizer.h"
 #include "GradientMap/GradientMapData.h"
 #include "Sampler/SamplerManager.h"
 
@@ -183,6 +186,8 @@ public:
     void updateGradientMapStageBounds();
     void rebuildGradientMapForInput (int channelIndex);
     void rebuildAllGradientMaps();
+    void requestGradientMapLayer (int channelIndex, int layerIndex, const GradientMap::Layer& layer, bool preview);
+    void applyRasterizedGradientMaps();
 
 private:
     //==============================================================================
@@ -279,6 +284,12 @@ private:
     // Parameter management system
     WfsParameters parameters;
 
+    // Position-to-audio latency (receivers, engine and audio callback push;
+    // the 5 ms timer collects). Declared first so it outlives all of them.
+    MotionLatencyTracer motionLatency;
+    juce::uint64 audioMatrixGenerationSeen = 0;     // Audio thread (reset while audio is stopped)
+    double audioSecondsSinceMatrixTargets = 0.0;    // Audio thread only: age of the current targets
+
     // Network OSC management
     std::unique_ptr<WFSNetwork::OSCManager> oscManager;
 
@@ -310,6 +321,42 @@ private:
     // WFS calculation engine (computes delays, levels, HF attenuation)
     std::unique_ptr<WFSCalculationEngine> calculationEngine;
 
+    // Control-rate worker: delay-mode ramps and matrix recalculation run here
+    // at AppSettings::getControlRateHz() instead of on the message thread.
+    // Stopped first in our destructor. The message thread keeps the
+    // ValueTree-bound stages (OSC ramps, speed limiter, LFO, LS Tamer...) and
+    // reacts to matrixPublishGeneration; the audio thread copies each new
+    // generation into the HF/FR arrays itself (applyMatrixGeneration()).
+    std::unique_ptr<ControlRateWorker> controlRateWorker;
+    std::atomic<juce::uint64> publishedMatrixGeneration { 0 };   // Engine generation last announced
+    std::atomic<juce::uint32> matrixPublishGeneration { 0 };
+    juce::uint32 matrixGenerationSeen = 0;          // Message thread only
+    juce::CriticalSection lsGainsMailboxLock;       // Message thread posts LS gains, worker takes them
+    LSGainOverlay lsGainsMailbox;                   // Sparse: only pairs inside an LS radius
+    bool lsGainsMailboxFresh = false;
+    LSGainOverlay workerLSGains;                    // Worker thread only
+    int controlRateStatTick = 0;                    // 5 ms timer ticks -> 1 s stat cadence
+    juce::uint64 controlRateOverrunsLogged = 0;
+
+    // Timing of the 50 Hz stages that still run on the message-thread timer
+    // (they read and write the ValueTree or GUI state). Jitter is how late a
+    // tick came vs 20 ms after the previous one. Read by the health log and
+    // diagnostics_get_control_rate.
+    enum MessageControlStage
+    {
+        mcsOscRamps, mcsSpeedLimiter, mcsLfo, mcsClusterLfo, mcsAutomOtion,
+        mcsMetering, mcsOffsets, mcsGradientMaps, mcsLsTamer, numMessageControlStages
+    };
+    ControlTickStats messageControlStats;
+    double lastMessageControlTickMs = 0.0;          // Message thread only
+    juce::uint64 messageControlOverrunsLogged = 0;
+
+    void startControlRateWorker();
+    void postLSGainsToWorker();
+    void publishMatrixTargets();
+    void applyMatrixGeneration (const WFSCalculationEngine::MatrixSet& matrices);
+    void updateInputsVisualisation (int numReverbs);
+
     // Binaural solo monitoring
     std::unique_ptr<BinauralCalculationEngine> binauralCalcEngine;
     std::unique_ptr<BinauralProcessor> binauralProcessor;
@@ -355,9 +402,19 @@ private:
     // Input speed limiter for smooth position movement
     std::unique_ptr<InputSpeedLimiter> speedLimiter;
 
-    // Gradient map evaluators (one per input channel, bitmap-based O(1) lookup)
+    // Gradient map evaluators (one per input channel, grid-based O(1) lookup)
     std::vector<std::unique_ptr<GradientMapEvaluator>> gradientMapEvaluators;
 
+    // Builds evaluator grids off the message thread, shared across identical layers
+    GradientMapRasterizer gradientMapRasterizer;
+
+    // 50Hz batch evaluation scratch (message thread)
+    std::vector<const GradientMapEvaluator*> gradientMapBatchEvaluators;
+    std::vector<int> gradientMapBatchInputs;
+    std::vector<float> gradientMapBatchX, gradientMapBatchY;
+    std::vector<GradientMapEvaluator::Offsets> gradientMapBatchOut;
+    GradientMapEvaluator::BatchScratch gradientMapBatchScratch;
+
     // Per-channel sampler engine manager
     std::unique_ptr<SamplerManager> samplerManager;
 
@@ -410,15 +467,17 @@ private:
     std::vector<float> frLevels;         // Linear gain for reflected signal
     std::vector<float> frHFAttenuation;  // HF attenuation for reflected path (dB)
 
+    // Input → reverb feed levels at the engine's stride, for the reverb feed
+    // thread (sized once, so its pointer stays valid; audio thread writes)
+    std::vector<float> reverbFeedLevels;
+
     // Random generator with ramping and exponential smoothing (temporary for testing)
-    std::vector<float> targetDelayTimesMs;      // Current ramp targets (updated every tick)
-    std::vector<float> targetLevels;            // Current ramp targets (updated every tick)
-    std::vector<float> targetFRLevels;          // FR level ramp targets (FR fades in/out like direct)
     std::vector<float> finalTargetDelayTimesMs; // Final destination for 1-second ramp
     std::vector<float> finalTargetLevels;       // Final destination for 1-second ramp
     std::vector<float> startDelayTimesMs;       // Starting values for 1-second ramp
     std::vector<float> startLevels;             // Starting values for 1-second ramp
     float delaySmoothingFactor = 0.03f;          // ~100ms time constant (slow for Doppler-free delay changes)
+    std::atomic<float> delayLeadPeriodSeconds { 0.0f };  // One control tick; 0 = no extrapolation
     float levelSmoothingFactor = 0.05f;          // ~50ms time constant (faster for levels, less artifact-prone)
     int timerTicksSinceLastRandom = 0;
     const int rampDurationTicks = 200;          // 1 second at 5ms per tick
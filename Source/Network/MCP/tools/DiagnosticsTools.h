@@ -0,0 +1,105 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "../MCPCompat.h"
+#include "../../../DSP/MotionLatencyTracer.h"
+#include <functional>
+
+namespace WFSNetwork::Tools::Diagnostics
+{
+
+//==============================================================================
+// diagnostics_get_motion_latency — position input -> audio latency percentiles
+//==============================================================================
+
+inline juce::var motionLatencySchema()
+{
+    auto reset = std::make_unique<juce::DynamicObject>();
+    reset->setProperty ("type", "boolean");
+    reset->setProperty ("description",
+        "Optional. Clear the sample windows after reading, so the next call "
+        "covers only traffic sent in between.");
+
+    auto props = std::make_unique<juce::DynamicObject>();
+    props->setProperty ("reset", juce::var (reset.release()));
+
+    auto schema = std::make_unique<juce::DynamicObject>();
+    schema->setProperty ("type", "object");
+    schema->setProperty ("properties", juce::var (props.release()));
+    schema->setProperty ("additionalProperties", false);
+    return juce::var (schema.release());
+}
+
+/** Registered by MainComponent, which owns the tracer. */
+inline ToolDescriptor describeMotionLatency (MotionLatencyTracer& tracer)
+{
+    ToolDescriptor d;
+    d.name        = "diagnostics_get_motion_latency";
+    d.description = "Read-only. Latency from a tracking frame or OSC/Remote "
+                    "input position write arriving to the audio callback first "
+                    "rendering the matrix that includes it, as p50/p95/p99/max "
+                    "in ms over the last samples. Stages: queue (arrival -> "
+                    "applied on the message thread), engine (-> matrix "
+                    "published), render (-> first audio block), total.";
+    d.inputSchema   = motionLatencySchema();
+    d.modifiesState = false;
+    d.tier        = 1;
+    d.handler = [&tracer] (const juce::var& args, ChangeRecord*) -> ToolResult
+    {
+        auto result = tracer.toVar();
+        if (args.isObject() && static_cast<bool> (args.getProperty ("reset", false)))
+            tracer.reset();
+        return ToolResult::ok (result);
+    };
+    return d;
+}
+
+//==============================================================================
+// diagnostics_get_control_rate — tick jitter and per-stage cost of both clocks
+//==============================================================================
+
+inline juce::var controlRateSchema()
+{
+    auto reset = std::make_unique<juce::DynamicObject>();
+    reset->setProperty ("type", "boolean");
+    reset->setProperty ("description",
+        "Optional. Clear the peak values after reading, so the next call "
+        "reports peaks since this one.");
+
+    auto props = std::make_unique<juce::DynamicObject>();
+    props->setProperty ("reset", juce::var (reset.release()));
+
+    auto schema = std::make_unique<juce::DynamicObject>();
+    schema->setProperty ("type", "object");
+    schema->setProperty ("properties", juce::var (props.release()));
+    schema->setProperty ("additionalProperties", false);
+    return juce::var (schema.release());
+}
+
+/** Registered by MainComponent. The provider returns the stats of both
+    clocks and clears their peaks when asked to. */
+inline ToolDescriptor describeControlRate (std::function<juce::var (bool resetPeaks)> provider)
+{
+    ToolDescriptor d;
+    d.name        = "diagnostics_get_control_rate";
+    d.description = "Read-only. Timing of the two control-rate clocks. worker: "
+                    "the dedicated thread that steps parameter ramps, "
+                    "recalculates the routing matrices and publishes them. "
+                    "messageThread: the 50 Hz stages still on the GUI timer "
+                    "(speed limiter, LFOs, AutomOtion, metering, gradient maps, "
+                    "LS Tamer). Each gives ticks, overruns, tick jitter "
+                    "(lateness vs the period, us) and per-stage cost "
+                    "(last/peak/mean us). Peaks cover the time since the last "
+                    "reset or logged overrun.";
+    d.inputSchema   = controlRateSchema();
+    d.modifiesState = false;
+    d.tier        = 1;
+    d.handler = [provider = std::move (provider)] (const juce::var& args, ChangeRecord*) -> ToolResult
+    {
+        const bool reset = args.isObject() && static_cast<bool> (args.getProperty ("reset", false));
+        return ToolResult::ok (provider (reset));
+    };
+    return d;
+}
+
+} // namespace WFSNetwork::Tools::Diagnostics
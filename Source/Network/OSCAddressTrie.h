@@ -0,0 +1,167 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "OSCParameterBounds.h"
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+namespace WFSNetwork
+{
+
+/**
+ * Everything the parsers need to know about one routable parameter once the
+ * address is resolved: the ID plus the per-parameter facts that otherwise
+ * cost a set/map lookup per message (ramp capability, bounds) or a string
+ * compare on the name (EQ band argument).
+ */
+struct OSCParamRoute
+{
+    juce::Identifier paramId;
+    bool rampCapable = false;        // Input: optional trailing transition time
+    bool eqInQueryForm = false;      // /wfs/<family>/{ch}/<param> <band> <value>
+    bool eqInStandardForm = false;   // /wfs/<family>/<param> <ch> <band> <value>
+    std::optional<ParamBounds> bounds;
+};
+
+/**
+ * OSCAddressTrie
+ *
+ * Byte trie over the complete set of routable OSC addresses, built once from
+ * the router's address maps. find() walks the raw UTF-8 bytes of an address
+ * and returns its route without creating any String, so the per-message cost
+ * is one pass over the address.
+ *
+ * Nodes marked with allowChannelSegment() additionally accept the OSCQuery
+ * form "<digits>/" before the rest of the path (/wfs/input/3/attenuation);
+ * the digits are returned as the channel.
+ *
+ * Built on first use and read-only afterwards, so find() is safe from any
+ * thread (the OSC receiver threads and the message thread both route).
+ */
+class OSCAddressTrie
+{
+public:
+    struct Match
+    {
+        const OSCParamRoute* route = nullptr;
+        int channel = 0;
+        bool channelInAddress = false;
+    };
+
+    OSCAddressTrie()
+    {
+        nodes.emplace_back();   // Root
+    }
+
+    void add (const juce::String& address, OSCParamRoute route)
+    {
+        const int node = insertPath (address);
+        if (nodes[(size_t) node].route < 0)
+        {
+            nodes[(size_t) node].route = static_cast<int> (routes.size());
+            routes.push_back (std::move (route));
+        }
+    }
+
+    /** After this prefix, an optional "<digits>/" segment names the channel. */
+    void allowChannelSegment (const juce::String& prefix)
+    {
+        nodes[(size_t) insertPath (prefix)].channelSegment = true;
+    }
+
+    Match find (const juce::String& address) const noexcept
+    {
+        Match match;
+        auto* p = reinterpret_cast<const unsigned char*> (address.getCharPointer().getAddress());
+        int node = 0;
+        bool channelTaken = false;
+
+        for (;;)
+        {
+            const auto& n = nodes[(size_t) node];
+
+            if (n.channelSegment && ! channelTaken && *p >= '0' && *p <= '9')
+            {
+                // Longer runs fall back to the String path (same overflow as getIntValue)
+                int channel = 0, digits = 0;
+                while (*p >= '0' && *p <= '9' && digits < maxChannelDigits)
+                {
+                    channel = channel * 10 + (*p++ - '0');
+                    ++digits;
+                }
+                if (*p != '/')
+                    return {};
+                ++p;
+                match.channel = channel;
+                match.channelInAddress = true;
+                channelTaken = true;
+                continue;
+            }
+
+            if (*p == 0)
+            {
+                if (n.route < 0)
+                    return {};
+                match.route = &routes[(size_t) n.route];
+                return match;
+            }
+
+            node = childOf (n, *p++);
+            if (node < 0)
+                return {};
+        }
+    }
+
+    int getNumRoutes() const noexcept { return static_cast<int> (routes.size()); }
+
+private:
+    static constexpr int maxChannelDigits = 9;
+
+    struct Node
+    {
+        std::vector<std::pair<unsigned char, int>> children;   // Sorted by byte
+        int route = -1;
+        bool channelSegment = false;
+    };
+
+    int childOf (const Node& n, unsigned char c) const noexcept
+    {
+        for (const auto& [byte, child] : n.children)
+        {
+            if (byte == c)
+                return child;
+            if (byte > c)
+                break;
+        }
+        return -1;
+    }
+
+    int insertPath (const juce::String& path)
+    {
+        int node = 0;
+        for (auto* p = reinterpret_cast<const unsigned char*> (path.toRawUTF8()); *p != 0; ++p)
+        {
+            int next = childOf (nodes[(size_t) node], *p);
+            if (next < 0)
+            {
+                next = static_cast<int> (nodes.size());
+                nodes.emplace_back();
+                auto& children = nodes[(size_t) node].children;
+                const auto pos = std::lower_bound (children.begin(), children.end(), *p,
+                    [] (const std::pair<unsigned char, int>& e, unsigned char c) { return e.first < c; });
+                children.insert (pos, { *p, next });
+            }
+            node = next;
+        }
+        return node;
+    }
+
+    std::vector<Node> nodes;
+    std::vector<OSCParamRoute> routes;
+
+    JUCE_DECLARE_NON_COPYABLE (OSCAddressTrie)
+};
+
+} // namespace WFSNetwork
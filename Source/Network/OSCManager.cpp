@@ -8,6 +8,7 @@
 #include "../WFSLogger.h"
 #include <thread>
 #include <chrono>
+#include <limits>
 
 namespace WFSNetwork
 {
@@ -52,11 +53,23 @@ OSCManager::OSCManager(WFSValueTreeState& valueTreeState)
     {
         if (targetIndex >= 0 && targetIndex < MAX_TARGETS)
         {
-            if (connections[static_cast<size_t>(targetIndex)])
+            if (isOutboundBatched(targetIndex))
+            {
+                // Collected per target and sent as bundles by outboundFlushTimer
+                {
+                    const juce::ScopedLock sl(outboundLock);
+                    if (outboundBatchers[static_cast<size_t>(targetIndex)].add(message))
+                        ++outboundDeduplicated;
+                }
+                if (! outboundFlushTimer.isTimerRunning())
+                    outboundFlushTimer.startTimerHz(OUTBOUND_FLUSH_HZ);
+            }
+            else if (connections[static_cast<size_t>(targetIndex)])
             {
                 if (connections[static_cast<size_t>(targetIndex)]->send(message))
                 {
                     ++messagesSent;
+                    ++datagramsSent;
                     const auto& config = targetConfigs[static_cast<size_t>(targetIndex)];
                     logger.logSentWithDetails(targetIndex, message, config.protocol,
                                               config.ipAddress, config.port, config.mode);
@@ -114,6 +127,16 @@ OSCManager::OSCManager(WFSValueTreeState& valueTreeState)
             + " messages total");
     });
 
+    // Integer keys for the inbound write ring: every parameter an OSC or
+    // Remote address can write. Anything else falls back to the locked map.
+    for (const auto* addressMap : { &OSCMessageRouter::getInputAddressMap(),
+                                    &OSCMessageRouter::getOutputAddressMap(),
+                                    &OSCMessageRouter::getReverbAddressMap(),
+                                    &OSCMessageRouter::getConfigAddressMap(),
+                                    &OSCMessageRouter::getRemoteAddressMap() })
+        for (const auto& entry : *addressMap)
+            writeKeys.addParam(entry.second);
+
     // Start status polling timer
     startTimer(500);  // Check connection status every 500ms
 }
@@ -122,6 +145,9 @@ OSCManager::~OSCManager()
 {
     stopTimer();
     clusterMemberFlushTimer.stopTimer();
+    outboundFlushTimer.stopTimer();
+    timedWriteTimer.stopTimer();
+    closeLocalControlRing();
     stopListening();
     disconnectAll();
     state.removeListener(this);
@@ -230,9 +256,10 @@ bool OSCManager::startListening()
     {
         auto* queuePtr = ingestQueue.get();
         const int udpPort = globalConfig.udpReceivePort;
-        udpReceiver->setRawDataCallback([queuePtr, udpPort]
+        udpReceiver->setRawDataCallback([queuePtr, receipt = &ingestReceipt, udpPort]
             (juce::MemoryBlock data, juce::String senderIP, int /*senderPort*/)
         {
+            receipt->markArrival();
             queuePtr->push(std::move(data), std::move(senderIP),
                            udpPort, ConnectionMode::UDP);
         });
@@ -250,9 +277,10 @@ bool OSCManager::startListening()
     {
         auto* queuePtr = ingestQueue.get();
         const int tcpPort = globalConfig.tcpReceivePort;
-        tcpReceiver->setRawDataCallback([queuePtr, tcpPort]
+        tcpReceiver->setRawDataCallback([queuePtr, receipt = &ingestReceipt, tcpPort]
             (juce::MemoryBlock data, juce::String senderIP, int /*senderPort*/)
         {
+            receipt->markArrival();
             queuePtr->push(std::move(data), std::move(senderIP),
                            tcpPort, ConnectionMode::TCP);
         });
@@ -446,6 +474,7 @@ void OSCManager::sendMessageDirect (int targetIndex, const juce::OSCMessage& mes
         if (connections[static_cast<size_t> (targetIndex)]->send (message))
         {
             ++messagesSent;
+            ++datagramsSent;
             const auto& config = targetConfigs[static_cast<size_t> (targetIndex)];
             logger.logSentWithDetails (targetIndex, message, config.protocol,
                                        config.ipAddress, config.port, config.mode);
@@ -478,6 +507,105 @@ void OSCManager::broadcastMessage(const juce::OSCMessage& message)
 void OSCManager::flushMessages()
 {
     rateLimiter.flushAll();
+    flushOutboundBatches();
+}
+
+bool OSCManager::isOutboundBatched(int targetIndex) const
+{
+    // Only the Remote tablet app is known to parse bundles (it already gets
+    // its state dumps that way); plain OSC, ADM-OSC and QLab peers can be any
+    // third-party receiver and keep one datagram per message.
+    const auto& config = targetConfigs[static_cast<size_t>(targetIndex)];
+    return outboundBundlingEnabled.load(std::memory_order_relaxed)
+        && config.protocol == Protocol::Remote;
+}
+
+void OSCManager::setOutboundBundlingEnabled(bool enabled)
+{
+    outboundBundlingEnabled = enabled;
+    if (! enabled)
+        flushOutboundBatches();
+}
+
+void OSCManager::setOutboundFlushBudgetBytes(int bytesPerFlush)
+{
+    const juce::ScopedLock sl(outboundLock);
+    for (auto& batcher : outboundBatchers)
+        batcher.setFlushBudgetBytes(static_cast<size_t>(juce::jmax(0, bytesPerFlush)));
+}
+
+void OSCManager::flushOutboundBatches()
+{
+    std::array<std::vector<juce::OSCBundle>, MAX_TARGETS> ready;
+    bool anyLeft = false;
+    {
+        const juce::ScopedLock sl(outboundLock);
+        for (size_t i = 0; i < MAX_TARGETS; ++i)
+        {
+            auto& batcher = outboundBatchers[i];
+            if (batcher.isEmpty())
+                continue;
+
+            // A target switched away from Remote (or disabled) since queueing:
+            // its leftovers are stale feedback for a peer that no longer wants it.
+            if (! isOutboundBatched(static_cast<int>(i)) || ! targetConfigs[i].txEnabled)
+            {
+                batcher.clear();
+                continue;
+            }
+
+            ready[i] = batcher.takeBundles();
+            anyLeft = anyLeft || ! batcher.isEmpty();
+        }
+    }
+
+    const bool loggingEnabled = logger.getEnabled();
+    for (size_t i = 0; i < MAX_TARGETS; ++i)
+    {
+        if (ready[i].empty() || ! connections[i])
+            continue;
+
+        const auto& config = targetConfigs[i];
+        for (const auto& bundle : ready[i])
+        {
+            if (connections[i]->send(bundle))
+            {
+                messagesSent += bundle.size();
+                ++datagramsSent;
+                if (loggingEnabled)
+                {
+                    for (const auto& element : bundle)
+                    {
+                        if (element.isMessage())
+                            logger.logSentWithDetails(static_cast<int>(i), element.getMessage(),
+                                                      config.protocol, config.ipAddress,
+                                                      config.port, config.mode);
+                    }
+                }
+            }
+            else
+            {
+                logger.logText("Send failed: target " + juce::String(static_cast<int>(i) + 1)
+                    + " (" + config.ipAddress + ":" + juce::String(config.port)
+                    + ") bundle of " + juce::String(bundle.size()) + " messages");
+            }
+        }
+    }
+
+    if (! anyLeft)
+    {
+        const juce::ScopedLock sl(outboundLock);
+        bool allEmpty = true;
+        for (const auto& batcher : outboundBatchers)
+            allEmpty = allEmpty && batcher.isEmpty();
+        if (allEmpty)
+            outboundFlushTimer.stopTimer();
+    }
+}
+
+void OSCManager::OutboundFlushTimer::timerCallback()
+{
+    owner.flushOutboundBatches();
 }
 
 //==============================================================================
@@ -511,6 +639,8 @@ bool OSCManager::startOSCQuery(int oscPort, int httpPort)
     if (oscQueryServer->start(oscPort, httpPort))
     {
         logger.logText("OSC Query server started on HTTP port " + juce::String(httpPort));
+        if (localControlEnabled)
+            openLocalControlRing(httpPort);
         return true;
     }
 
@@ -519,6 +649,7 @@ bool OSCManager::startOSCQuery(int oscPort, int httpPort)
 
 void OSCManager::stopOSCQuery()
 {
+    closeLocalControlRing();
     if (oscQueryServer)
     {
         oscQueryServer->stop();
@@ -526,6 +657,146 @@ void OSCManager::stopOSCQuery()
     }
 }
 
+void OSCManager::openLocalControlRing(int httpPort)
+{
+    closeLocalControlRing();
+
+    const auto segmentFile = LocalControlRing::getDefaultSegmentFile(httpPort);
+    if (! localControl.create(segmentFile))
+    {
+        logger.logText("Local plugin transport unavailable: cannot map " + segmentFile.getFullPathName());
+        return;
+    }
+
+    if (localControlPatterns.empty())
+        for (const auto* path : LocalControlRing::paramPaths())
+            localControlPatterns.emplace_back(juce::String(path));
+
+    oscQueryServer->setLocalControlRing(segmentFile.getFullPathName(), localControl.getSession());
+    localControlDrainTimer.startTimerHz(LOCAL_CONTROL_IDLE_HZ);
+    logger.logText("Local plugin transport offered at " + segmentFile.getFullPathName());
+}
+
+void OSCManager::closeLocalControlRing()
+{
+    localControlDrainTimer.stopTimer();
+    if (! localControl.isOpen())
+        return;
+
+    // Anything still queued was sent before the close: apply it.
+    drainLocalControlRing();
+    if (oscQueryServer)
+        oscQueryServer->setLocalControlRing({}, 0);
+    localControl.close();
+}
+
+void OSCManager::LocalControlDrainTimer::timerCallback()
+{
+    owner.drainLocalControlRing();
+
+    // Polling is the only wake-up across processes: poll fast only while a
+    // Master instance is attached.
+    const int hz = owner.localControl.getNumClaimedRings() > 0 ? LOCAL_CONTROL_DRAIN_HZ
+                                                               : LOCAL_CONTROL_IDLE_HZ;
+    if (getTimerInterval() != 1000 / hz)
+        startTimerHz(hz);
+}
+
+void OSCManager::drainLocalControlRing()
+{
+    localControl.drain([this] (const LocalControlRing::Record& record)
+    {
+        if (record.paramHandle >= localControlPatterns.size())
+            return;
+
+        juce::OSCMessage message(localControlPatterns[record.paramHandle],
+                                 static_cast<juce::int32>(record.inputId), record.value);
+        if (record.rampSeconds > 0.0f)
+            message.addFloat32(record.rampSeconds);
+
+        if (record.timeTag != 0 && timetagSchedulingEnabled)
+        {
+            scheduleTimedMessage(message, record.timeTag, "127.0.0.1", 0, ConnectionMode::UDP);
+            return;
+        }
+
+        // Same gates, ramps, coalescing and OSCQuery echo suppression as the
+        // UDP datagram from the same plugin on this host.
+        handleIncomingMessage(message, "127.0.0.1", 0, ConnectionMode::UDP);
+    }, static_cast<int>(LocalControlRing::ringCapacity));
+}
+
+//==============================================================================
+// Timetagged messages
+//==============================================================================
+
+void OSCManager::setTimetagPlayoutMs(int ms)
+{
+    timetagSchedulingEnabled = ms >= 0;
+    timedScheduler.setPlayoutMs(static_cast<double>(ms));
+}
+
+void OSCManager::scheduleTimedMessage(const juce::OSCMessage& message,
+                                      uint64_t ntpTimeTag,
+                                      const juce::String& senderIP,
+                                      int port,
+                                      ConnectionMode transport)
+{
+    // Gates and logging happen on arrival, like any other message; only the
+    // parameter write waits for the timetag.
+    juce::String rejectReason;
+    if (! OSCMessageRouter::hasOnlyFiniteFloats(message, rejectReason))
+    {
+        logger.logRejected(message.getAddressPattern().toString(),
+                          senderIP, port, transport, rejectReason);
+        return;
+    }
+
+    ++messagesReceived;
+    logger.logReceivedWithDetails(message, Protocol::OSC, senderIP, port, transport);
+
+    if (! timedScheduler.post(message, ntpTimeTag, senderIP, port, transport,
+                              juce::Time::getMillisecondCounterHiRes()))
+    {
+        applyScheduledMessage(message, senderIP, port, transport);
+        return;
+    }
+
+    if (! timedWriteTimer.isTimerRunning())
+        timedWriteTimer.startTimerHz(TIMED_APPLY_HZ);
+}
+
+void OSCManager::applyScheduledMessage(const juce::OSCMessage& message,
+                                       const juce::String& senderIP,
+                                       int port,
+                                       ConnectionMode transport)
+{
+    OriginTagScope originScope { OriginTag::OSC };
+    if (oscQueryServer)
+        oscQueryServer->beginIncomingOSC(senderIP);
+    handleStandardOSCMessage(message, senderIP, port, transport);
+    if (oscQueryServer)
+        oscQueryServer->endIncomingOSC();
+}
+
+void OSCManager::applyDueTimedMessages()
+{
+    timedScheduler.applyDue(juce::Time::getMillisecondCounterHiRes(),
+        [this] (const juce::OSCMessage& message, const juce::String& senderIP,
+                int port, ConnectionMode transport)
+        {
+            applyScheduledMessage(message, senderIP, port, transport);
+        });
+
+    if (timedScheduler.isEmpty())
+        timedWriteTimer.stopTimer();
+}
+
+void OSCManager::TimedWriteTimer::timerCallback()
+{
+    owner.applyDueTimedMessages();
+}
+
 bool OSCManager::isOSCQueryRunning() const
 {
     return oscQueryServer && oscQueryServer->isRunning();
@@ -548,6 +819,8 @@ bool OSCManager::startTrackingReceiver(int port, const juce::String& pathPattern
     trackingReceiver = std::make_unique<TrackingOSCReceiver>(state);
     trackingFilter.resize(state.getNumInputChannels());
     trackingReceiver->setPositionFilter(&trackingFilter);
+    trackingReceiver->setTrackingFastPath(&trackingFastPath);
+    trackingReceiver->setTrackingPredictor(&trackingPredictor);
     trackingReceiver->setLogger(&logger);
     trackingReceiver->setDirtyTracker(dirtyTracker);
 
@@ -611,6 +884,8 @@ bool OSCManager::startPSNReceiver(int port,
     psnReceiver = std::make_unique<TrackingPSNReceiver>(state);
     trackingFilter.resize(state.getNumInputChannels());
     psnReceiver->setPositionFilter(&trackingFilter);
+    psnReceiver->setTrackingFastPath(&trackingFastPath);
+    psnReceiver->setTrackingPredictor(&trackingPredictor);
     psnReceiver->setLogger(&logger);
     psnReceiver->setDirtyTracker(dirtyTracker);
 
@@ -665,6 +940,8 @@ bool OSCManager::startRTTrPReceiver(int port)
     rttrpReceiver = std::make_unique<TrackingRTTrPReceiver>(state);
     trackingFilter.resize(state.getNumInputChannels());
     rttrpReceiver->setPositionFilter(&trackingFilter);
+    rttrpReceiver->setTrackingFastPath(&trackingFastPath);
+    rttrpReceiver->setTrackingPredictor(&trackingPredictor);
     rttrpReceiver->setLogger(&logger);
     rttrpReceiver->setDirtyTracker(dirtyTracker);
 
@@ -717,6 +994,8 @@ bool OSCManager::startMQTTReceiver(const juce::String& host, int port, const juc
     mqttReceiver = std::make_unique<TrackingMQTTReceiver>(state);
     trackingFilter.resize(state.getNumInputChannels());
     mqttReceiver->setPositionFilter(&trackingFilter);
+    mqttReceiver->setTrackingFastPath(&trackingFastPath);
+    mqttReceiver->setTrackingPredictor(&trackingPredictor);
     mqttReceiver->setLogger(&logger);
     mqttReceiver->setDirtyTracker(dirtyTracker);
 
@@ -795,6 +1074,14 @@ OSCManager::Statistics OSCManager::getStatistics() const
     stats.messagesReceived = messagesReceived.load();
     stats.messagesCoalesced = static_cast<int>(rateLimiter.getTotalCoalesced());
     stats.parseErrors = parseErrors.load();
+    stats.datagramsSent = datagramsSent.load();
+    stats.outboundDeduplicated = outboundDeduplicated.load();
+    stats.messagesSentPerSecond = messagesSentPerSecond.load();
+    stats.datagramsSentPerSecond = datagramsSentPerSecond.load();
+    stats.paramWritesQueued = paramWritesQueued.load();
+    stats.paramWritesCoalesced = paramWritesCoalesced.load();
+    stats.paramWritesApplied = paramWritesApplied.load();
+    stats.paramWritesOverflowed = paramWritesOverflowed.load();
     return stats;
 }
 
@@ -803,6 +1090,15 @@ void OSCManager::resetStatistics()
     messagesSent = 0;
     messagesReceived = 0;
     parseErrors = 0;
+    datagramsSent = 0;
+    outboundDeduplicated = 0;
+    rateSampleMessages = 0;
+    rateSampleDatagrams = 0;
+    paramWritesQueued = 0;
+    paramWritesCoalesced = 0;
+    paramWritesApplied = 0;
+    paramWritesOverflowed = 0;
+    paramWritesOverflowedReported = 0;
     rateLimiter.resetStats();
 }
 
@@ -1312,6 +1608,24 @@ void OSCManager::timerCallback()
 {
     auto now = juce::Time::currentTimeMillis();
 
+    // Outbound rates: messages handed to the transport vs datagrams on the
+    // wire. Without bundling the two are equal; the gap is what batching saves.
+    if (rateSampleTimeMs == 0)
+    {
+        rateSampleTimeMs = now;
+    }
+    else if (now - rateSampleTimeMs >= 1000)
+    {
+        const int sentNow = messagesSent.load();
+        const int datagramsNow = datagramsSent.load();
+        const float seconds = static_cast<float>(now - rateSampleTimeMs) * 0.001f;
+        messagesSentPerSecond = static_cast<float>(sentNow - rateSampleMessages) / seconds;
+        datagramsSentPerSecond = static_cast<float>(datagramsNow - rateSampleDatagrams) / seconds;
+        rateSampleMessages = sentNow;
+        rateSampleDatagrams = datagramsNow;
+        rateSampleTimeMs = now;
+    }
+
     // Poll connection statuses and handle Remote handshake/heartbeat
     for (int i = 0; i < MAX_TARGETS; ++i)
     {
@@ -1418,7 +1732,8 @@ void OSCManager::dispatchIngestedItem(const juce::MemoryBlock& data,
     // Mirrors the legacy parseOSCData -> notifyMessage flow but routes
     // straight into handleIncomingMessage/Bundle so we keep IP filter,
     // NaN gate, range gate, OriginTagScope, and the existing
-    // pendingParamUpdates coalesce behaviour intact.
+    // parameter write-ring coalesce behaviour intact.
+    dispatchReceiptTicks = ingestReceipt.takeForDrain();
     try
     {
         const char* dataPtr = static_cast<const char*>(data.getData());
@@ -1441,6 +1756,7 @@ void OSCManager::dispatchIngestedItem(const juce::MemoryBlock& data,
         DBG("OSCManager::dispatchIngestedItem: parse error from " << senderIP);
         ++parseErrors;
     }
+    dispatchReceiptTicks = 0;
 }
 
 void OSCManager::handleIncomingMessage(const juce::OSCMessage& message,
@@ -1629,6 +1945,11 @@ void OSCManager::handleIncomingBundle(const juce::OSCBundle& bundle,
         return;
     }
 
+    // Timetagged parameter writes (the plugins' sampled DAW automation) are
+    // replayed at their timetag by timedScheduler; everything else in the
+    // bundle applies on arrival.
+    const bool timed = timetagSchedulingEnabled && ! bundle.getTimeTag().isImmediately();
+
     for (const auto& element : bundle)
     {
         if (element.isMessage())
@@ -1636,6 +1957,13 @@ void OSCManager::handleIncomingBundle(const juce::OSCBundle& bundle,
             const auto& message = element.getMessage();
             juce::String address = message.getAddressPattern().toString();
 
+            if (timed && (OSCMessageRouter::isInputAddress(address) || OSCMessageRouter::isOutputAddress(address)
+                          || OSCMessageRouter::isReverbAddress(address) || OSCMessageRouter::isConfigAddress(address)))
+            {
+                scheduleTimedMessage(message, bundle.getTimeTag().getRawTimeTag(), senderIP, port, transport);
+                continue;
+            }
+
             // Reject NaN/Inf floats before dispatch (matches handleIncomingMessage).
             {
                 juce::String rejectReason;
@@ -1704,32 +2032,386 @@ void OSCManager::handleIncomingBundle(const juce::OSCBundle& bundle,
     }
 }
 
+void OSCManager::queueParamWrite(OSCWriteKind kind,
+                                 const juce::Identifier& paramId,
+                                 int channelIndex,
+                                 int band,
+                                 const juce::var& value,
+                                 const juce::String& senderIP)
+{
+    const int paramKey = writeKeys.findParam(paramId);
+    const bool numeric = value.isDouble() || value.isInt() || value.isInt64() || value.isBool();
+
+    if (paramKey >= 0 && numeric
+        && channelIndex >= -1 && channelIndex < std::numeric_limits<int16_t>::max()
+        && band >= 0 && band <= 0xff)
+    {
+        OSCWriteRecord record;
+        record.kind = kind;
+        record.valueType = value.isBool() ? OSCWriteRecord::ValueType::Bool
+                         : value.isDouble() ? OSCWriteRecord::ValueType::Double
+                                            : OSCWriteRecord::ValueType::Int;
+        record.band = static_cast<uint8_t>(band);
+        record.paramKey = static_cast<uint16_t>(paramKey);
+        record.senderKey = static_cast<uint16_t>(writeKeys.internSender(senderIP));
+        record.channelIndex = static_cast<int16_t>(channelIndex);
+        record.value = static_cast<double>(value);
+        record.receiptTicks = dispatchReceiptTicks;
+        record.sequence = paramWriteSequence.fetch_add(1, std::memory_order_relaxed) + 1;
+
+        if (! writeRing.push(record))
+        {
+            // The drain is behind by a whole ring. Dropping would leave the
+            // parameter stale, so keep the newest write per key in the locked
+            // overflow map instead; the drain reports the overflow count.
+            ++paramWritesOverflowed;
+            const juce::ScopedLock sl(pendingParamLock);
+            auto [it, inserted] = overflowParamWrites.try_emplace(record.getCoalesceKey(), record);
+            if (! inserted && record.isNewerThan(it->second))
+                it->second = record;
+        }
+    }
+    else
+    {
+        const juce::String key = paramId.toString() + ":" + juce::String(channelIndex) + ":" + juce::String(band);
+        const juce::ScopedLock sl(pendingParamLock);
+        pendingParamUpdates[key] = { kind, paramId, channelIndex, band, value, senderIP,
+                                     paramWriteSequence.fetch_add(1, std::memory_order_relaxed) + 1 };
+    }
+
+    ++paramWritesQueued;
+    if (! paramDrainScheduled.exchange(true))
+        juce::MessageManager::callAsync([this]() { drainPendingParamUpdates(); });
+}
+
 void OSCManager::drainPendingParamUpdates()
 {
-    std::map<juce::String, PendingParamUpdate> updates;
+    // Clear the flag before popping: a write pushed from here on schedules a
+    // fresh drain instead of being stranded behind this one.
+    paramDrainScheduled = false;
+
+    // At most one ring's worth per pass keeps the coalescer bounded and the
+    // message thread responsive under a sustained flood.
+    writeCoalescer.clear();
+    OSCWriteRecord record;
+    int popped = 0;
+    int coalesced = 0;
+    while (popped < writeRing.getCapacity() && writeRing.pop(record))
+    {
+        ++popped;
+        if (writeCoalescer.add(record))
+            ++coalesced;
+    }
+    // When the pass stopped at capacity, the writes left in the ring were
+    // queued after the last one popped
+    const bool ringBacklog = popped == writeRing.getCapacity();
+    const uint32_t lastPoppedSequence = record.sequence;
+
+    // Overflow writes join the same table after the ring records they may
+    // supersede (or be superseded by: the coalescer keeps the newer sequence)
+    std::map<juce::String, PendingParamUpdate> fallbackUpdates;
+    bool overflowLeft = false;
     {
         const juce::ScopedLock sl(pendingParamLock);
-        updates.swap(pendingParamUpdates);
-        paramDrainScheduled = false;
+        fallbackUpdates.swap(pendingParamUpdates);
+
+        int taken = 0;
+        for (auto it = overflowParamWrites.begin();
+             it != overflowParamWrites.end() && taken < paramWriteRingCapacity; ++taken)
+        {
+            if (writeCoalescer.add(it->second))
+                ++coalesced;
+            it = overflowParamWrites.erase(it);
+        }
+        overflowLeft = ! overflowParamWrites.empty();
     }
 
-    if (updates.empty())
+    if ((popped == writeRing.getCapacity() || overflowLeft) && ! paramDrainScheduled.exchange(true))
+        juce::MessageManager::callAsync([this]() { drainPendingParamUpdates(); });
+
+    paramWritesCoalesced += coalesced;
+
+    const int overflowed = paramWritesOverflowed.load();
+    if (overflowed != paramWritesOverflowedReported)
+    {
+        paramWritesOverflowedReported = overflowed;
+        logger.logRejected("[param write ring]", "(internal)", 0, ConnectionMode::UDP,
+            "ring full, " + juce::String(overflowed) + " writes total went through the overflow map");
+    }
+
+    const auto& latest = writeCoalescer.getLatest();
+    if (latest.empty() && fallbackUpdates.empty())
         return;
 
-    ScopedIncomingProtocol incomingGuard (*this, Protocol::OSC);
+    // One undo transaction per domain for the whole drain.
+    std::array<bool, static_cast<size_t>(UndoDomain::COUNT)> transactionOpen {};
 
-    // Apply all updates — use setParameter which auto-routes to the correct scope.
-    // Suppression must be per-update: coalesced updates can come from different
-    // senders, and each write must record its own origin so the OSCQuery push
-    // skips exactly the client that sent it.
-    for (const auto& [key, upd] : updates)
+    const auto routedTicks = juce::Time::getHighResolutionTicks();
+    for (const auto& write : latest)
     {
-        if (oscQueryServer) oscQueryServer->beginIncomingOSC(upd.senderIP);
-        state.setParameter(upd.paramId, upd.value, upd.channelId);
-        if (oscQueryServer) oscQueryServer->endIncomingOSC();
+        const auto& paramId = writeKeys.getParam(write.paramKey);
+        applyParamWrite(write.kind, paramId, write.channelIndex,
+                        write.band, write.getValue(), writeKeys.getSender(write.senderKey),
+                        transactionOpen);
+
+        if (positionFrameHook
+            && (paramId == WFSParameterIDs::inputPositionX || paramId == WFSParameterIDs::inputPositionY
+                || paramId == WFSParameterIDs::inputPositionZ || paramId == WFSParameterIDs::inputOffsetX
+                || paramId == WFSParameterIDs::inputOffsetY || paramId == WFSParameterIDs::inputOffsetZ))
+            positionFrameHook(write.channelIndex, write.receiptTicks, routedTicks);
     }
 
-    incomingGuard.release();
+    // Ring writes went first; a fallback write is applied after them only if
+    // no newer ring write to the same key was kept, and waits for the next
+    // pass while the ring still holds older writes, so arrival order holds
+    int fallbackApplied = 0;
+    std::vector<std::pair<juce::String, PendingParamUpdate>> deferred;
+    for (const auto& [key, upd] : fallbackUpdates)
+    {
+        if (ringBacklog && static_cast<int32_t>(upd.sequence - lastPoppedSequence) > 0)
+        {
+            deferred.emplace_back(key, upd);
+            continue;
+        }
+
+        const int paramKey = writeKeys.findParam(upd.paramId);
+        if (paramKey >= 0
+            && upd.channelId >= -1 && upd.channelId < std::numeric_limits<int16_t>::max()
+            && upd.band >= 0 && upd.band <= 0xff)
+        {
+            const auto* ringWrite = writeCoalescer.find(OSCWriteRecord::makeCoalesceKey(
+                static_cast<uint16_t>(paramKey), static_cast<int16_t>(upd.channelId), static_cast<uint8_t>(upd.band)));
+            if (ringWrite != nullptr && ringWrite->isNewerThan(upd.sequence))
+            {
+                ++paramWritesCoalesced;
+                continue;
+            }
+        }
+
+        applyParamWrite(upd.kind, upd.paramId, upd.channelId, upd.band, upd.value, upd.senderIP,
+                        transactionOpen);
+        ++fallbackApplied;
+    }
+
+    if (! deferred.empty())
+    {
+        // A write queued since the swap is newer and keeps its slot
+        const juce::ScopedLock sl(pendingParamLock);
+        for (auto& [key, upd] : deferred)
+            pendingParamUpdates.try_emplace(key, std::move(upd));
+    }
+
+    paramWritesApplied += static_cast<int>(latest.size()) + fallbackApplied;
+}
+
+void OSCManager::applyParamWrite(OSCWriteKind kind,
+                                 const juce::Identifier& paramId,
+                                 int channelIndex,
+                                 int band,
+                                 const juce::var& value,
+                                 const juce::String& senderIP,
+                                 std::array<bool, static_cast<size_t>(UndoDomain::COUNT)>& transactionOpen)
+{
+    UndoDomain domain = UndoDomain::Input;
+    const char* transactionName = "OSC Input";
+    switch (kind)
+    {
+        case OSCWriteKind::Input:
+        case OSCWriteKind::InputSpecial:
+        case OSCWriteKind::RemoteSet:
+            break;
+        case OSCWriteKind::Output:
+            domain = UndoDomain::Output;
+            transactionName = "OSC Output";
+            break;
+        case OSCWriteKind::Reverb:
+        case OSCWriteKind::ReverbEQ:
+            domain = UndoDomain::Reverb;
+            transactionName = "OSC Reverb";
+            break;
+        case OSCWriteKind::Config:
+            domain = UndoDomain::Reverb;
+            transactionName = "OSC Reverb Config";
+            break;
+    }
+
+    WFSValueTreeState::ScopedUndoDomain scope (state, domain);
+    auto& open = transactionOpen[static_cast<size_t>(domain)];
+    if (! open)
+    {
+        state.beginUndoTransaction (transactionName);
+        open = true;
+    }
+
+    // Suppression must be per-write: coalesced writes can come from different
+    // senders, and each must record its own origin so the OSCQuery push skips
+    // exactly the client that sent it.
+    const bool remote = (kind == OSCWriteKind::RemoteSet);
+    OriginTagScope originScope { remote ? OriginTag::Remote : OriginTag::OSC };
+    ScopedIncomingProtocol incomingGuard (*this, remote ? Protocol::Remote : Protocol::OSC);
+    if (! remote && oscQueryServer)
+        oscQueryServer->beginIncomingOSC(senderIP);
+
+    switch (kind)
+    {
+        case OSCWriteKind::Input:
+        case OSCWriteKind::Output:
+        case OSCWriteKind::Reverb:
+            // setParameter auto-routes to the correct scope
+            state.setParameter(paramId, value, channelIndex);
+            break;
+        case OSCWriteKind::InputSpecial:
+            applyInputSpecialWrite(paramId, channelIndex, value);
+            break;
+        case OSCWriteKind::ReverbEQ:
+            applyReverbEQWrite(paramId, channelIndex, band, value);
+            break;
+        case OSCWriteKind::Config:
+            applyConfigWrite(paramId, value);
+            break;
+        case OSCWriteKind::RemoteSet:
+            applyRemoteParameterSet(paramId, channelIndex, value);
+            break;
+    }
+
+    if (! remote && oscQueryServer)
+        oscQueryServer->endIncomingOSC();
+}
+
+void OSCManager::applyInputSpecialWrite(const juce::Identifier& paramId,
+                                        int channelIndex,
+                                        const juce::var& value)
+{
+    if (paramId == WFSParameterIDs::inputPositionX ||
+        paramId == WFSParameterIDs::inputPositionY ||
+        paramId == WFSParameterIDs::inputPositionZ)
+    {
+        float floatValue = static_cast<float>(static_cast<double>(value));
+
+        if (paramId == WFSParameterIDs::inputPositionX)
+            floatValue = applyConstraintX(channelIndex, floatValue);
+        else if (paramId == WFSParameterIDs::inputPositionY)
+            floatValue = applyConstraintY(channelIndex, floatValue);
+        else if (paramId == WFSParameterIDs::inputPositionZ)
+            floatValue = applyConstraintZ(channelIndex, floatValue);
+
+        juce::var xVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputPositionX);
+        juce::var yVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputPositionY);
+        juce::var zVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputPositionZ);
+        float x = varToFloat(xVar), y = varToFloat(yVar), z = varToFloat(zVar);
+
+        if (paramId == WFSParameterIDs::inputPositionX) x = floatValue;
+        else if (paramId == WFSParameterIDs::inputPositionY) y = floatValue;
+        else if (paramId == WFSParameterIDs::inputPositionZ) z = floatValue;
+
+        applyConstraintDistance(channelIndex, x, y, z);
+        state.setInputParameter(channelIndex, WFSParameterIDs::inputPositionX, x);
+        state.setInputParameter(channelIndex, WFSParameterIDs::inputPositionY, y);
+        state.setInputParameter(channelIndex, WFSParameterIDs::inputPositionZ, z);
+
+        if (onRemoteWaypointCapture)
+            onRemoteWaypointCapture(channelIndex, x, y, z);
+    }
+    else if (paramId == WFSParameterIDs::gmLayer0Enabled ||
+             paramId == WFSParameterIDs::gmLayer1Enabled ||
+             paramId == WFSParameterIDs::gmLayer2Enabled)
+    {
+        int layerIdx = (paramId == WFSParameterIDs::gmLayer0Enabled) ? 0
+                     : (paramId == WFSParameterIDs::gmLayer1Enabled) ? 1 : 2;
+        auto layerTree = state.getInputGradientLayer(channelIndex, layerIdx);
+        if (layerTree.isValid())
+        {
+            int enabled = (value.isDouble() && static_cast<double>(value) >= 0.5) ? 1 : 0;
+            layerTree.setProperty(WFSParameterIDs::gmLayerEnabled, enabled, nullptr);
+        }
+    }
+    else if (paramId == WFSParameterIDs::inputSamplerActiveSet)
+    {
+        int setIdx = static_cast<int> (static_cast<double> (value)) - 1;
+        if (setIdx >= 0)
+            state.setInputParameter(channelIndex, paramId, setIdx);
+    }
+}
+
+void OSCManager::applyReverbEQWrite(const juce::Identifier& paramId,
+                                    int channelIndex,
+                                    int band,
+                                    const juce::var& value)
+{
+    auto reverbState = state.getReverbState(channelIndex);
+    if (! reverbState.isValid())
+        return;
+
+    auto eqSection = reverbState.getChildWithName(WFSParameterIDs::EQ);
+    if (eqSection.isValid() && band >= 1 && band <= 4)
+    {
+        auto bandSection = eqSection.getChildWithName(
+            juce::Identifier("Band" + juce::String(band)));
+        if (bandSection.isValid())
+            bandSection.setProperty(paramId, value, state.getActiveUndoManager());
+    }
+}
+
+void OSCManager::applyConfigWrite(const juce::Identifier& paramId, const juce::var& value)
+{
+    // Check if this is a reverb algorithm parameter (stored in ReverbAlgorithm section)
+    auto algoSection = state.ensureReverbAlgorithmSection();
+    if (algoSection.isValid() && algoSection.hasProperty(paramId))
+    {
+        algoSection.setProperty(paramId, value, state.getActiveUndoManager());
+    }
+    // Check if this is a reverb pre-compressor parameter (stored in ReverbPreComp section)
+    else if (paramId == WFSParameterIDs::reverbPreCompBypass ||
+             paramId == WFSParameterIDs::reverbPreCompThreshold ||
+             paramId == WFSParameterIDs::reverbPreCompRatio ||
+             paramId == WFSParameterIDs::reverbPreCompAttack ||
+             paramId == WFSParameterIDs::reverbPreCompRelease)
+    {
+        auto preComp = state.ensureReverbPreCompSection();
+        if (preComp.isValid())
+            preComp.setProperty(paramId, value, state.getActiveUndoManager());
+    }
+    // Check if this is a reverb post-EQ parameter (stored in ReverbPostEQ section)
+    else if (paramId == WFSParameterIDs::reverbPostEQenable)
+    {
+        auto postEQ = state.ensureReverbPostEQSection();
+        if (postEQ.isValid())
+            postEQ.setProperty(paramId, value, state.getActiveUndoManager());
+    }
+    else if (paramId == WFSParameterIDs::reverbPostEQshape ||
+             paramId == WFSParameterIDs::reverbPostEQfreq ||
+             paramId == WFSParameterIDs::reverbPostEQgain ||
+             paramId == WFSParameterIDs::reverbPostEQq ||
+             paramId == WFSParameterIDs::reverbPostEQslope)
+    {
+        // PostEQ band params — for now apply to all bands (band ID not in OSC message)
+        auto postEQ = state.ensureReverbPostEQSection();
+        if (postEQ.isValid())
+        {
+            for (int b = 0; b < postEQ.getNumChildren(); ++b)
+            {
+                auto band = postEQ.getChild(b);
+                if (band.isValid())
+                    band.setProperty(paramId, value, state.getActiveUndoManager());
+            }
+        }
+    }
+    // Check if this is a reverb post-expander parameter (stored in ReverbPostExp section)
+    else if (paramId == WFSParameterIDs::reverbPostExpBypass ||
+             paramId == WFSParameterIDs::reverbPostExpThreshold ||
+             paramId == WFSParameterIDs::reverbPostExpRatio ||
+             paramId == WFSParameterIDs::reverbPostExpAttack ||
+             paramId == WFSParameterIDs::reverbPostExpRelease)
+    {
+        auto postExp = state.ensureReverbPostExpSection();
+        if (postExp.isValid())
+            postExp.setProperty(paramId, value, state.getActiveUndoManager());
+    }
+    else
+    {
+        // Standard config parameter
+        state.setParameter(paramId, value);
+    }
 }
 
 void OSCManager::handleStandardOSCMessage(const juce::OSCMessage& message,
@@ -2064,81 +2746,13 @@ void OSCManager::handleStandardOSCMessage(const juce::OSCMessage& message,
 
             if (needsSpecialHandling)
             {
-                juce::MessageManager::callAsync([this, parsed, channelIndex, senderIP]()
-                {
-                    ScopedIncomingProtocol incomingGuard (*this, Protocol::OSC);
-                    if (oscQueryServer) oscQueryServer->beginIncomingOSC(senderIP);
-                    WFSValueTreeState::ScopedUndoDomain scope (state, UndoDomain::Input);
-                    state.beginUndoTransaction ("OSC Input");
-
-                    if (channelIndex >= 0)
-                    {
-                        if (parsed.paramId == WFSParameterIDs::inputPositionX ||
-                            parsed.paramId == WFSParameterIDs::inputPositionY ||
-                            parsed.paramId == WFSParameterIDs::inputPositionZ)
-                        {
-                            float floatValue = static_cast<float>(static_cast<double>(parsed.value));
-
-                            if (parsed.paramId == WFSParameterIDs::inputPositionX)
-                                floatValue = applyConstraintX(channelIndex, floatValue);
-                            else if (parsed.paramId == WFSParameterIDs::inputPositionY)
-                                floatValue = applyConstraintY(channelIndex, floatValue);
-                            else if (parsed.paramId == WFSParameterIDs::inputPositionZ)
-                                floatValue = applyConstraintZ(channelIndex, floatValue);
-
-                            juce::var xVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputPositionX);
-                            juce::var yVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputPositionY);
-                            juce::var zVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputPositionZ);
-                            float x = varToFloat(xVar), y = varToFloat(yVar), z = varToFloat(zVar);
-
-                            if (parsed.paramId == WFSParameterIDs::inputPositionX) x = floatValue;
-                            else if (parsed.paramId == WFSParameterIDs::inputPositionY) y = floatValue;
-                            else if (parsed.paramId == WFSParameterIDs::inputPositionZ) z = floatValue;
-
-                            applyConstraintDistance(channelIndex, x, y, z);
-                            state.setInputParameter(channelIndex, WFSParameterIDs::inputPositionX, x);
-                            state.setInputParameter(channelIndex, WFSParameterIDs::inputPositionY, y);
-                            state.setInputParameter(channelIndex, WFSParameterIDs::inputPositionZ, z);
-
-                            if (onRemoteWaypointCapture)
-                                onRemoteWaypointCapture(channelIndex, x, y, z);
-                        }
-                        else if (parsed.paramId == WFSParameterIDs::gmLayer0Enabled ||
-                                 parsed.paramId == WFSParameterIDs::gmLayer1Enabled ||
-                                 parsed.paramId == WFSParameterIDs::gmLayer2Enabled)
-                        {
-                            int layerIdx = (parsed.paramId == WFSParameterIDs::gmLayer0Enabled) ? 0
-                                         : (parsed.paramId == WFSParameterIDs::gmLayer1Enabled) ? 1 : 2;
-                            auto layerTree = state.getInputGradientLayer(channelIndex, layerIdx);
-                            if (layerTree.isValid())
-                            {
-                                int enabled = (parsed.value.isDouble() && static_cast<double>(parsed.value) >= 0.5) ? 1 : 0;
-                                layerTree.setProperty(WFSParameterIDs::gmLayerEnabled, enabled, nullptr);
-                            }
-                        }
-                        else if (parsed.paramId == WFSParameterIDs::inputSamplerActiveSet)
-                        {
-                            int setIdx = static_cast<int> (static_cast<double> (parsed.value)) - 1;
-                            if (setIdx >= 0)
-                                state.setInputParameter(channelIndex, parsed.paramId, setIdx);
-                        }
-                    }
-                    incomingGuard.release();
-                    if (oscQueryServer) oscQueryServer->endIncomingOSC();
-                });
+                if (channelIndex >= 0)
+                    queueParamWrite(OSCWriteKind::InputSpecial, parsed.paramId, channelIndex, 0, parsed.value, senderIP);
             }
             else if (channelIndex >= 0 && (parsed.value.isDouble() || parsed.value.isString()))
             {
                 // Generic parameters: coalesce — only the latest value per param+channel is applied
-                juce::String key = parsed.paramId.toString() + ":" + juce::String(channelIndex);
-                {
-                    const juce::ScopedLock sl(pendingParamLock);
-                    pendingParamUpdates[key] = { parsed.paramId, channelIndex, parsed.value, senderIP };
-                }
-                if (!paramDrainScheduled.exchange(true))
-                {
-                    juce::MessageManager::callAsync([this]() { drainPendingParamUpdates(); });
-                }
+                queueParamWrite(OSCWriteKind::Input, parsed.paramId, channelIndex, 0, parsed.value, senderIP);
             }
         }
         else
@@ -2156,13 +2770,7 @@ void OSCManager::handleStandardOSCMessage(const juce::OSCMessage& message,
             int channelIndex = parsed.channelId - 1;
             if (channelIndex >= 0 && (parsed.value.isDouble() || parsed.value.isString()))
             {
-                juce::String key = parsed.paramId.toString() + ":" + juce::String(channelIndex);
-                {
-                    const juce::ScopedLock sl(pendingParamLock);
-                    pendingParamUpdates[key] = { parsed.paramId, channelIndex, parsed.value, senderIP };
-                }
-                if (!paramDrainScheduled.exchange(true))
-                    juce::MessageManager::callAsync([this]() { drainPendingParamUpdates(); });
+                queueParamWrite(OSCWriteKind::Output, parsed.paramId, channelIndex, 0, parsed.value, senderIP);
             }
         }
         else
@@ -2181,39 +2789,14 @@ void OSCManager::handleStandardOSCMessage(const juce::OSCMessage& message,
             if (channelIndex >= 0 && !parsed.isEQparam)
             {
                 // Coalesce generic reverb params
-                juce::String key = parsed.paramId.toString() + ":" + juce::String(channelIndex);
-                {
-                    const juce::ScopedLock sl(pendingParamLock);
-                    pendingParamUpdates[key] = { parsed.paramId, channelIndex, parsed.value, senderIP };
-                }
-                if (!paramDrainScheduled.exchange(true))
-                    juce::MessageManager::callAsync([this]() { drainPendingParamUpdates(); });
+                queueParamWrite(OSCWriteKind::Reverb, parsed.paramId, channelIndex, 0, parsed.value, senderIP);
             }
             else if (parsed.isEQparam)
             {
-                // EQ params need special handling — keep direct callAsync
-                juce::MessageManager::callAsync([this, parsed, channelIndex, senderIP]()
-                {
-                    ScopedIncomingProtocol incomingGuard (*this, Protocol::OSC);
-                    if (oscQueryServer) oscQueryServer->beginIncomingOSC(senderIP);
-                    WFSValueTreeState::ScopedUndoDomain scope (state, UndoDomain::Reverb);
-                    if (channelIndex >= 0)
-                    {
-                        auto reverbState = state.getReverbState(channelIndex);
-                        if (reverbState.isValid())
-                        {
-                            auto eqSection = reverbState.getChildWithName(WFSParameterIDs::EQ);
-                            if (eqSection.isValid() && parsed.bandIndex >= 1 && parsed.bandIndex <= 4)
-                            {
-                                auto bandSection = eqSection.getChildWithName(
-                                    juce::Identifier("Band" + juce::String(parsed.bandIndex)));
-                                if (bandSection.isValid())
-                                    bandSection.setProperty(parsed.paramId, parsed.value, state.getActiveUndoManager());
-                            }
-                        }
-                    }
-                    if (oscQueryServer) oscQueryServer->endIncomingOSC();
-                });
+                // EQ params address a band child; the band is part of the coalesce key
+                if (channelIndex >= 0)
+                    queueParamWrite(OSCWriteKind::ReverbEQ, parsed.paramId, channelIndex,
+                                    parsed.bandIndex, parsed.value, senderIP);
             }
         }
         else
@@ -2228,73 +2811,7 @@ void OSCManager::handleStandardOSCMessage(const juce::OSCMessage& message,
         auto parsed = OSCMessageRouter::parseConfigMessage(message);
         if (parsed.valid)
         {
-            juce::MessageManager::callAsync([this, parsed, senderIP]()
-            {
-                ScopedIncomingProtocol incomingGuard (*this, Protocol::OSC);
-                if (oscQueryServer) oscQueryServer->beginIncomingOSC(senderIP);
-                WFSValueTreeState::ScopedUndoDomain scope (state, UndoDomain::Reverb);
-                state.beginUndoTransaction ("OSC Reverb Config");
-
-                // Check if this is a reverb algorithm parameter (stored in ReverbAlgorithm section)
-                auto algoSection = state.ensureReverbAlgorithmSection();
-                if (algoSection.isValid() && algoSection.hasProperty(parsed.paramId))
-                {
-                    algoSection.setProperty(parsed.paramId, parsed.value, state.getActiveUndoManager());
-                }
-                // Check if this is a reverb pre-compressor parameter (stored in ReverbPreComp section)
-                else if (parsed.paramId == WFSParameterIDs::reverbPreCompBypass ||
-                         parsed.paramId == WFSParameterIDs::reverbPreCompThreshold ||
-                         parsed.paramId == WFSParameterIDs::reverbPreCompRatio ||
-                         parsed.paramId == WFSParameterIDs::reverbPreCompAttack ||
-                         parsed.paramId == WFSParameterIDs::reverbPreCompRelease)
-                {
-                    auto preComp = state.ensureReverbPreCompSection();
-                    if (preComp.isValid())
-                        preComp.setProperty(parsed.paramId, parsed.value, state.getActiveUndoManager());
-                }
-                // Check if this is a reverb post-EQ parameter (stored in ReverbPostEQ section)
-                else if (parsed.paramId == WFSParameterIDs::reverbPostEQenable)
-                {
-                    auto postEQ = state.ensureReverbPostEQSection();
-                    if (postEQ.isValid())
-                        postEQ.setProperty(parsed.paramId, parsed.value, state.getActiveUndoManager());
-                }
-                else if (parsed.paramId == WFSParameterIDs::reverbPostEQshape ||
-                         parsed.paramId == WFSParameterIDs::reverbPostEQfreq ||
-                         parsed.paramId == WFSParameterIDs::reverbPostEQgain ||
-                         parsed.paramId == WFSParameterIDs::reverbPostEQq ||
-                         parsed.paramId == WFSParameterIDs::reverbPostEQslope)
-                {
-                    // PostEQ band params — for now apply to all bands (band ID not in OSC message)
-                    auto postEQ = state.ensureReverbPostEQSection();
-                    if (postEQ.isValid())
-                    {
-                        for (int b = 0; b < postEQ.getNumChildren(); ++b)
-                        {
-                            auto band = postEQ.getChild(b);
-                            if (band.isValid())
-                                band.setProperty(parsed.paramId, parsed.value, state.getActiveUndoManager());
-                        }
-                    }
-                }
-                // Check if this is a reverb post-expander parameter (stored in ReverbPostExp section)
-                else if (parsed.paramId == WFSParameterIDs::reverbPostExpBypass ||
-                         parsed.paramId == WFSParameterIDs::reverbPostExpThreshold ||
-                         parsed.paramId == WFSParameterIDs::reverbPostExpRatio ||
-                         parsed.paramId == WFSParameterIDs::reverbPostExpAttack ||
-                         parsed.paramId == WFSParameterIDs::reverbPostExpRelease)
-                {
-                    auto postExp = state.ensureReverbPostExpSection();
-                    if (postExp.isValid())
-                        postExp.setProperty(parsed.paramId, parsed.value, state.getActiveUndoManager());
-                }
-                else
-                {
-                    // Standard config parameter
-                    state.setParameter(parsed.paramId, parsed.value);
-                }
-                if (oscQueryServer) oscQueryServer->endIncomingOSC();
-            });
+            queueParamWrite(OSCWriteKind::Config, parsed.paramId, -1, 0, parsed.value, senderIP);
         }
         else
         {
@@ -2423,115 +2940,114 @@ void OSCManager::handleRemotePositionDelta(const OSCMessageRouter::ParsedRemoteI
 
 void OSCManager::handleRemoteParameterSet(const OSCMessageRouter::ParsedRemoteInput& parsed)
 {
-    // Set parameter to absolute value
-    juce::MessageManager::callAsync([this, parsed]()
-    {
-        ScopedIncomingProtocol incomingGuard (*this, Protocol::Remote);
-        WFSValueTreeState::ScopedUndoDomain scope (state, UndoDomain::Input);
-        state.beginUndoTransaction ("OSC Input");
-
-        // Remote uses 1-based channel IDs, but internal API uses 0-based
-        int channelIndex = parsed.channelId - 1;
-        if (channelIndex >= 0)
-        {
-            juce::var valueToSet = parsed.value;
-
-            // Apply constraints to position parameters
-            if (parsed.paramId == WFSParameterIDs::inputPositionX ||
-                parsed.paramId == WFSParameterIDs::inputPositionY ||
-                parsed.paramId == WFSParameterIDs::inputPositionZ)
-            {
-                float floatValue = varToFloat(parsed.value);
-
-                // Apply single-axis constraint
-                if (parsed.paramId == WFSParameterIDs::inputPositionX)
-                    floatValue = applyConstraintX(channelIndex, floatValue);
-                else if (parsed.paramId == WFSParameterIDs::inputPositionY)
-                    floatValue = applyConstraintY(channelIndex, floatValue);
-                else if (parsed.paramId == WFSParameterIDs::inputPositionZ)
-                    floatValue = applyConstraintZ(channelIndex, floatValue);
+    // Set parameter to absolute value. Remote uses 1-based channel IDs, but
+    // internal API uses 0-based. Queued like any other absolute write, so a
+    // tablet fader drag coalesces to the latest value per drain.
+    const int channelIndex = parsed.channelId - 1;
+    if (channelIndex >= 0)
+        queueParamWrite(OSCWriteKind::RemoteSet, parsed.paramId, channelIndex, 0, parsed.value, {});
+}
 
-                // Check if distance constraint is enabled for this channel
-                juce::var coordModeVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputCoordinateMode);
-                int coordMode = varToInt(coordModeVar);
-                juce::var constraintDistVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputConstraintDistance);
-                int constraintDist = varToInt(constraintDistVar);
-                bool distanceConstraintActive = (coordMode == 1 || coordMode == 2) && constraintDist != 0;
+void OSCManager::applyRemoteParameterSet(const juce::Identifier& paramId,
+                                         int channelIndex,
+                                         const juce::var& value)
+{
+    juce::var valueToSet = value;
 
-                if (distanceConstraintActive)
-                {
-                    // Distance constraint is active - read all axes and check if constraint applies
-                    juce::var xVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputPositionX);
-                    juce::var yVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputPositionY);
-                    juce::var zVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputPositionZ);
-                    float x = varToFloat(xVar);
-                    float y = varToFloat(yVar);
-                    float z = varToFloat(zVar);
+    // Apply constraints to position parameters
+    if (paramId == WFSParameterIDs::inputPositionX ||
+        paramId == WFSParameterIDs::inputPositionY ||
+        paramId == WFSParameterIDs::inputPositionZ)
+    {
+        float floatValue = varToFloat(value);
 
-                    // Update with new value being set
-                    if (parsed.paramId == WFSParameterIDs::inputPositionX)
-                        x = floatValue;
-                    else if (parsed.paramId == WFSParameterIDs::inputPositionY)
-                        y = floatValue;
-                    else if (parsed.paramId == WFSParameterIDs::inputPositionZ)
-                        z = floatValue;
+        // Apply single-axis constraint
+        if (paramId == WFSParameterIDs::inputPositionX)
+            floatValue = applyConstraintX(channelIndex, floatValue);
+        else if (paramId == WFSParameterIDs::inputPositionY)
+            floatValue = applyConstraintY(channelIndex, floatValue);
+        else if (paramId == WFSParameterIDs::inputPositionZ)
+            floatValue = applyConstraintZ(channelIndex, floatValue);
 
-                    // Store unconstrained values
-                    float origX = x, origY = y, origZ = z;
+        // Check if distance constraint is enabled for this channel
+        juce::var coordModeVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputCoordinateMode);
+        int coordMode = varToInt(coordModeVar);
+        juce::var constraintDistVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputConstraintDistance);
+        int constraintDist = varToInt(constraintDistVar);
+        bool distanceConstraintActive = (coordMode == 1 || coordMode == 2) && constraintDist != 0;
 
-                    // Apply distance constraint (modifies x, y, z in place)
-                    applyConstraintDistance(channelIndex, x, y, z);
+        if (distanceConstraintActive)
+        {
+            // Distance constraint is active - read all axes and check if constraint applies
+            juce::var xVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputPositionX);
+            juce::var yVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputPositionY);
+            juce::var zVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputPositionZ);
+            float x = varToFloat(xVar);
+            float y = varToFloat(yVar);
+            float z = varToFloat(zVar);
 
-                    // Only set all 3 values if constraint actually modified position
-                    bool wasConstrained = !juce::approximatelyEqual(x, origX) ||
-                                          !juce::approximatelyEqual(y, origY) ||
-                                          !juce::approximatelyEqual(z, origZ);
+            // Update with new value being set
+            if (paramId == WFSParameterIDs::inputPositionX)
+                x = floatValue;
+            else if (paramId == WFSParameterIDs::inputPositionY)
+                y = floatValue;
+            else if (paramId == WFSParameterIDs::inputPositionZ)
+                z = floatValue;
 
-                    if (wasConstrained)
-                    {
-                        // Constraint modified position - set all axes
-                        state.setInputParameter(channelIndex, WFSParameterIDs::inputPositionX, x);
-                        state.setInputParameter(channelIndex, WFSParameterIDs::inputPositionY, y);
-                        state.setInputParameter(channelIndex, WFSParameterIDs::inputPositionZ, z);
-                    }
-                    else
-                    {
-                        // No constraint modification - just set single axis (faster)
-                        state.setInputParameter(channelIndex, parsed.paramId, floatValue);
-                    }
+            // Store unconstrained values
+            float origX = x, origY = y, origZ = z;
 
-                    // Notify for waypoint capture (path mode)
-                    if (onRemoteWaypointCapture)
-                        onRemoteWaypointCapture(channelIndex, x, y, z);
-                }
-                else
-                {
-                    // No distance constraint - just set the single axis
-                    state.setInputParameter(channelIndex, parsed.paramId, floatValue);
+            // Apply distance constraint (modifies x, y, z in place)
+            applyConstraintDistance(channelIndex, x, y, z);
 
-                    // Notify for waypoint capture (path mode)
-                    if (onRemoteWaypointCapture)
-                    {
-                        juce::var xVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputPositionX);
-                        juce::var yVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputPositionY);
-                        juce::var zVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputPositionZ);
-                        float x = varToFloat(xVar);
-                        float y = varToFloat(yVar);
-                        float z = varToFloat(zVar);
-                        onRemoteWaypointCapture(channelIndex, x, y, z);
-                    }
-                }
+            // Only set all 3 values if constraint actually modified position
+            bool wasConstrained = !juce::approximatelyEqual(x, origX) ||
+                                  !juce::approximatelyEqual(y, origY) ||
+                                  !juce::approximatelyEqual(z, origZ);
 
-                // Notify UI to repaint map
-                if (onRemotePositionReceived)
-                    onRemotePositionReceived();
+            if (wasConstrained)
+            {
+                // Constraint modified position - set all axes
+                state.setInputParameter(channelIndex, WFSParameterIDs::inputPositionX, x);
+                state.setInputParameter(channelIndex, WFSParameterIDs::inputPositionY, y);
+                state.setInputParameter(channelIndex, WFSParameterIDs::inputPositionZ, z);
             }
             else
             {
-                state.setInputParameter(channelIndex, parsed.paramId, valueToSet);
+                // No constraint modification - just set single axis (faster)
+                state.setInputParameter(channelIndex, paramId, floatValue);
             }
+
+            // Notify for waypoint capture (path mode)
+            if (onRemoteWaypointCapture)
+                onRemoteWaypointCapture(channelIndex, x, y, z);
         }
-    });
+        else
+        {
+            // No distance constraint - just set the single axis
+            state.setInputParameter(channelIndex, paramId, floatValue);
+
+            // Notify for waypoint capture (path mode)
+            if (onRemoteWaypointCapture)
+            {
+                juce::var xVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputPositionX);
+                juce::var yVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputPositionY);
+                juce::var zVar = state.getInputParameter(channelIndex, WFSParameterIDs::inputPositionZ);
+                float x = varToFloat(xVar);
+                float y = varToFloat(yVar);
+                float z = varToFloat(zVar);
+                onRemoteWaypointCapture(channelIndex, x, y, z);
+            }
+        }
+
+        // Notify UI to repaint map
+        if (onRemotePositionReceived)
+            onRemotePositionReceived();
+    }
+    else
+    {
+        state.setInputParameter(channelIndex, paramId, valueToSet);
+    }
 }
 
 void OSCManager::handleRemoteParameterDelta(const OSCMessageRouter::ParsedRemoteInput& parsed)
@@ -3613,6 +4129,7 @@ void OSCManager::sendAllTrackingStatesToRemote()
                     if (connections[static_cast<size_t>(i)]->send(msg))
                     {
                         ++messagesSent;
+                        ++datagramsSent;
                         logger.logSentWithDetails(i, msg, config.protocol,
                                                   config.ipAddress, config.port, config.mode);
                     }
@@ -3639,6 +4156,7 @@ void OSCManager::sendAllClusterConfigsToRemote(int targetIndex)
         if (connections[static_cast<size_t>(targetIndex)]->send(msg))
         {
             ++messagesSent;
+            ++datagramsSent;
             logger.logSentWithDetails(targetIndex, msg, config.protocol,
                                       config.ipAddress, config.port, config.mode);
         }
@@ -4199,6 +4717,7 @@ void OSCManager::sendAllInputPositionsToRemote(int targetIndex)
         if (connections[static_cast<size_t>(targetIndex)]->send(msg))
         {
             ++messagesSent;
+            ++datagramsSent;
             logger.logSentWithDetails(targetIndex, msg, config.protocol,
                                       config.ipAddress, config.port, config.mode);
         }
@@ -4345,6 +4864,7 @@ void OSCManager::sendAllInputParametersToRemote(int targetIndex)
             if (connections[static_cast<size_t>(targetIndex)]->send(msg))
             {
                 ++messagesSent;
+                ++datagramsSent;
                 logger.logSentWithDetails(targetIndex, msg, config.protocol,
                                           config.ipAddress, config.port, config.mode);
             }
@@ -4750,6 +5270,7 @@ void OSCManager::sendInputPositionXYToRemote(int channelId, float x, float y)
                 if (connections[static_cast<size_t>(i)]->send(msg))
                 {
                     ++messagesSent;
+                    ++datagramsSent;
                     logger.logSentWithDetails(i, msg, config.protocol,
                                               config.ipAddress, config.port, config.mode);
                 }
@@ -4804,6 +5325,7 @@ void OSCManager::sendClusterMembersBundle(int clusterId)
                 if (connections[static_cast<size_t>(i)]->send(bundle))
                 {
                     messagesSent += bundle.size();
+                    ++datagramsSent;
                     for (const auto& element : bundle)
                     {
                         if (element.isMessage())
@@ -4839,6 +5361,7 @@ void OSCManager::sendRemoteVisBundle(const juce::OSCBundle& bundle, int targetIn
             if (connections[static_cast<size_t>(i)]->send(bundle))
             {
                 messagesSent += bundle.size();
+                ++datagramsSent;
                 for (const auto& element : bundle)
                 {
                     if (element.isMessage())
@@ -4959,40 +5482,6 @@ std::vector<std::pair<int, int>> OSCManager::getConnectedRemoteVisPins() const
     return pins;
 }
 
-namespace
-{
-    // Conservative serialized-size estimate for a juce::OSCMessage.
-    // Matches OSC 1.0 wire format: address (null-terminated, 4-byte aligned) +
-    // type-tag string (',' + tags + null, 4-byte aligned) + each argument.
-    static size_t estimateOSCMessageSize(const juce::OSCMessage& msg)
-    {
-        auto pad4 = [](size_t s) { return (s + 3u) & ~size_t(3u); };
-
-        // Address pattern: UTF-8 bytes + null terminator, padded to 4 bytes.
-        const auto address = msg.getAddressPattern().toString();
-        size_t total = pad4(static_cast<size_t>(address.getNumBytesAsUTF8()) + 1);
-
-        // Type tag string: ',' + one char per arg + null terminator, padded.
-        const size_t numArgs = static_cast<size_t>(msg.size());
-        total += pad4(1 + numArgs + 1);
-
-        for (const auto& arg : msg)
-        {
-            if (arg.isInt32() || arg.isFloat32())
-                total += 4;
-            else if (arg.isString())
-                total += pad4(static_cast<size_t>(arg.getString().getNumBytesAsUTF8()) + 1);
-            else if (arg.isBlob())
-                total += 4 + pad4(static_cast<size_t>(arg.getBlob().getSize()));
-            else if (arg.isColour())
-                total += 4;
-            else
-                total += 4; // safe default for unknown arg types
-        }
-        return total;
-    }
-}
-
 void OSCManager::sendMessagesAsBundles(int targetIndex, const std::vector<juce::OSCMessage>& messages)
 {
     if (targetIndex < 0 || targetIndex >= MAX_TARGETS)
@@ -5047,6 +5536,7 @@ void OSCManager::sendMessagesAsBundles(int targetIndex, const std::vector<juce::
         if (connection->send(current))
         {
             messagesSent += current.size();
+            ++datagramsSent;
             if (loggingEnabled)
             {
                 for (const auto& element : current)
@@ -5630,9 +6120,10 @@ void OSCManager::updateADMOSCListeners()
             // from coalesce + bounded FIFO.
             auto* queuePtr = ingestQueue.get();
             const int admPort = port;
-            el.receiver->setRawDataCallback ([queuePtr, admPort]
+            el.receiver->setRawDataCallback ([queuePtr, receipt = &ingestReceipt, admPort]
                 (juce::MemoryBlock data, juce::String senderIP, int /*senderPort*/)
             {
+                receipt->markArrival();
                 queuePtr->push (std::move (data), std::move (senderIP),
                                 admPort, ConnectionMode::UDP);
             });
@@ -13,11 +13,18 @@
 #include "../../spatcore/control/osc/OSCTCPReceiver.h"
 #include "OSCQueryServer.h"
 #include "OSCParameterRamper.h"
+#include "OSCOutboundBatcher.h"
+#include "OSCWriteRing.h"
+#include "OSCTimedScheduler.h"
+#include "TrackingFastPath.h"
+#include "TrackingPredictor.h"
+#include "../DSP/MotionLatencyTracer.h"
 #include "TrackingOSCReceiver.h"
 #include "TrackingPSNReceiver.h"
 #include "TrackingRTTrPReceiver.h"
 #include "TrackingMQTTReceiver.h"
 #include "ADMOSCMapping.h"
+#include "../Shared/LocalControlRing.h"
 #include "../Parameters/WFSValueTreeState.h"
 #include "../../spatcore/dsp/TrackingPositionFilter.h"
 
@@ -100,7 +107,26 @@ public:
      * Provide the snapshot-scope dirty tracker so tracking receivers can suppress
      * dirty flagging while writing live (transient) position/rotation updates.
      */
-    void setDirtyTracker(ParameterDirtyTracker* tracker) { dirtyTracker = tracker; }
+    void setDirtyTracker(ParameterDirtyTracker* tracker)
+    {
+        dirtyTracker = tracker;
+        trackingFastPath.setDirtyTracker(tracker);
+    }
+
+    /**
+     * Tracking fast path shared by all tracking receivers. The owner of the
+     * calculation engine installs its hooks; without them tracked offsets are
+     * written to the ValueTree per frame as before.
+     */
+    TrackingFastPath& getTrackingFastPath() { return trackingFastPath; }
+
+    /**
+     * Called once per applied OSC / Remote input position or offset write
+     * with its arrival and apply ticks, so the calculation engine can stamp
+     * the frame for MotionLatencyTracer. Message thread.
+     */
+    using PositionFrameHook = std::function<void(int channelIndex, juce::int64 receiptTicks, juce::int64 routedTicks)>;
+    void setPositionFrameHook(PositionFrameHook hook) { positionFrameHook = std::move(hook); }
 
     /**
      * Connect a specific target.
@@ -142,6 +168,17 @@ public:
      */
     void flushMessages();
 
+    /**
+     * Feedback to Remote targets is collected per target after the rate
+     * limiter and sent once per tick as MTU-sized bundles, latest value per
+     * address/channel (see OSCOutboundBatcher). Enabled by default; the
+     * byte budget caps what one target receives per tick, the rest follows
+     * on the next ticks.
+     */
+    void setOutboundBundlingEnabled(bool enabled);
+    bool isOutboundBundlingEnabled() const { return outboundBundlingEnabled.load(); }
+    void setOutboundFlushBudgetBytes(int bytesPerFlush);
+
     //==========================================================================
     // REMOTE Protocol
     //==========================================================================
@@ -257,6 +294,25 @@ public:
      */
     int getOSCQueryHttpPort() const;
 
+    /**
+     * Offer the same-host plugin transport (Source/Shared/LocalControlRing.h)
+     * in HOST_INFO the next time the OSC Query server starts. Off by default;
+     * MainComponent sets it from AppSettings::getLocalControlRing().
+     */
+    void setLocalControlRingEnabled(bool enabled) { localControlEnabled = enabled; }
+
+    /** Master plugin instances currently writing through the ring. */
+    int getLocalControlProducerCount() const { return localControl.getNumClaimedRings(); }
+
+    /**
+     * Playout delay for timetagged bundles and ring records (the plugins'
+     * sampled DAW automation): each message is applied at its timetag plus
+     * this delay on the app's clock. Negative applies them on arrival like
+     * untimed messages. MainComponent sets it from
+     * AppSettings::getOscTimetagPlayoutMs().
+     */
+    void setTimetagPlayoutMs(int ms);
+
     //==========================================================================
     // Tracking OSC
     //==========================================================================
@@ -397,6 +453,19 @@ public:
         int messagesReceived = 0;
         int messagesCoalesced = 0;
         int parseErrors = 0;
+
+        // Outbound transport: messagesSent counts OSC messages, datagramsSent
+        // counts packets (a bundle is one). Rates are sampled once a second.
+        int datagramsSent = 0;
+        int outboundDeduplicated = 0;   // Replaced by a newer value before the bundle flush
+        float messagesSentPerSecond = 0.0f;
+        float datagramsSentPerSecond = 0.0f;
+
+        // Inbound parameter writes (write ring -> drain)
+        int paramWritesQueued = 0;
+        int paramWritesCoalesced = 0;   // Superseded by a newer write before the drain
+        int paramWritesApplied = 0;
+        int paramWritesOverflowed = 0;  // Ring full, carried by the locked overflow map
     };
 
     Statistics getStatistics() const;
@@ -749,6 +818,9 @@ private:
     // Inbound coalesce + bounded FIFO. UDP and TCP receivers push raw
     // bytes here; the queue posts a single drain callAsync per tick.
     std::unique_ptr<OSCIngestQueue> ingestQueue;
+    MotionLatencyTracer::ReceiptStamp ingestReceipt;   // Oldest undrained datagram
+    juce::int64 dispatchReceiptTicks = 0;              // Set while an ingested item is dispatched
+    PositionFrameHook positionFrameHook;
 
     // Connections (one per target)
     std::array<std::unique_ptr<OSCConnection>, MAX_TARGETS> connections;
@@ -770,21 +842,60 @@ private:
     // OSC Query server
     std::unique_ptr<OSCQueryServer> oscQueryServer;
 
-    // Coalescing: pending incoming standard OSC updates (latest value per param+channel wins)
-    struct PendingParamUpdate { juce::Identifier paramId; int channelId; juce::var value; juce::String senderIP; };
-    std::map<juce::String, PendingParamUpdate> pendingParamUpdates;  // key = "paramId:channelId", latest value + sender win
-    juce::CriticalSection pendingParamLock;
+    // Inbound parameter writes. Every handler pushes a POD record into one
+    // MPSC ring (receiver threads and the message thread both produce) and a
+    // single drain callAsync is kept in flight; the drain coalesces latest-wins
+    // per (param, channel, band) and applies the survivors in one undo
+    // transaction per domain. When the ring is full the record goes to a
+    // locked map coalesced on the same key instead of being dropped; the
+    // sequence stamp keeps the newer of a ring and an overflow write.
+    static constexpr int paramWriteRingCapacity = 4096;
+    OSCWriteKeyTable writeKeys;
+    OSCWriteRing writeRing { paramWriteRingCapacity };
+    OSCWriteCoalescer writeCoalescer { paramWriteRingCapacity * 2 };   // Ring + overflow per drain
+    std::atomic<uint32_t> paramWriteSequence { 0 };
     std::atomic<bool> paramDrainScheduled { false };
+    std::atomic<int> paramWritesQueued { 0 };
+    std::atomic<int> paramWritesCoalesced { 0 };
+    std::atomic<int> paramWritesApplied { 0 };
+    std::atomic<int> paramWritesOverflowed { 0 };
+    int paramWritesOverflowedReported = 0;   // Message thread only
+    std::unordered_map<uint64_t, OSCWriteRecord> overflowParamWrites;   // Coalesce key -> newest (pendingParamLock)
+
+    // Writes the ring cannot carry (string values, IDs outside the key table)
+    // keep the locked map; they are rare and drained in the same pass. They
+    // take a stamp from the same sequence, so the drain drops one that a newer
+    // ring write to the same key supersedes.
+    // pendingParamLock also guards overflowParamWrites.
+    struct PendingParamUpdate { OSCWriteKind kind; juce::Identifier paramId; int channelId; int band; juce::var value; juce::String senderIP; uint32_t sequence; };
+    std::map<juce::String, PendingParamUpdate> pendingParamUpdates;  // key = "paramId:channelId:band", latest value + sender win
+    juce::CriticalSection pendingParamLock;
 
     // Smooth ramps for input parameters that accept an optional 3rd OSC float
     // argument ("transition time in seconds"). Stepped at 50 Hz by MainComponent.
     OSCParameterRamper parameterRamper { state };
+
+    void queueParamWrite(OSCWriteKind kind, const juce::Identifier& paramId, int channelIndex,
+                         int band, const juce::var& value, const juce::String& senderIP);
     void drainPendingParamUpdates();
+    void applyParamWrite(OSCWriteKind kind, const juce::Identifier& paramId, int channelIndex,
+                         int band, const juce::var& value, const juce::String& senderIP,
+                         std::array<bool, static_cast<size_t>(UndoDomain::COUNT)>& transactionOpen);
+    void applyInputSpecialWrite(const juce::Identifier& paramId, int channelIndex, const juce::var& value);
+    void applyReverbEQWrite(const juce::Identifier& paramId, int channelIndex, int band, const juce::var& value);
+    void applyConfigWrite(const juce::Identifier& paramId, const juce::var& value);
+    void applyRemoteParameterSet(const juce::Identifier& paramId, int channelIndex, const juce::var& value);
 
 
     // Tracking position filter (shared by all tracking receivers)
     TrackingPositionFilter trackingFilter;
 
+    // Tracked offsets to the engine per frame, to the ValueTree at a commit rate
+    TrackingFastPath trackingFastPath;
+
+    // Optional per-input extrapolation of tracked positions (shared by all tracking receivers)
+    TrackingPredictor trackingPredictor;
+
     // Tracking OSC receiver
     std::unique_ptr<TrackingOSCReceiver> trackingReceiver;
 
@@ -928,8 +1039,83 @@ private:
     // payload to arrive as fast as possible without flooding the receiver as N tiny packets.
     void sendMessagesAsBundles(int targetIndex, const std::vector<juce::OSCMessage>& messages);
 
+    // Outbound bundling (Remote targets): rate-limited feedback is collected
+    // per target and flushed as bundles at OUTBOUND_FLUSH_HZ while anything is pending.
+    static constexpr int OUTBOUND_FLUSH_HZ = 50;
+    std::array<OSCOutboundBatcher, MAX_TARGETS> outboundBatchers;
+    juce::CriticalSection outboundLock;
+    std::atomic<bool> outboundBundlingEnabled { true };
+    bool isOutboundBatched(int targetIndex) const;
+    void flushOutboundBatches();
+
+    class OutboundFlushTimer : public juce::Timer
+    {
+    public:
+        explicit OutboundFlushTimer (OSCManager& o) : owner (o) {}
+        void timerCallback() override;
+    private:
+        OSCManager& owner;
+    };
+    OutboundFlushTimer outboundFlushTimer { *this };
+
+    // Same-host plugin transport: Master plugins write fixed-size records into
+    // rings in a mapped segment the app owns while the OSC Query server runs.
+    // Drained on the message thread into handleIncomingMessage, so a record is
+    // applied exactly like the UDP message it replaces.
+    static constexpr int LOCAL_CONTROL_DRAIN_HZ = 500;   // While a plugin holds a ring
+    static constexpr int LOCAL_CONTROL_IDLE_HZ = 10;     // Waiting for the first claim
+    bool localControlEnabled = false;
+    LocalControlRing::Consumer localControl;
+    std::vector<juce::OSCAddressPattern> localControlPatterns;   // One per param handle
+    void openLocalControlRing(int httpPort);
+    void closeLocalControlRing();
+    void drainLocalControlRing();
+
+    class LocalControlDrainTimer : public juce::Timer
+    {
+    public:
+        explicit LocalControlDrainTimer (OSCManager& o) : owner (o) {}
+        void timerCallback() override;
+    private:
+        OSCManager& owner;
+    };
+    LocalControlDrainTimer localControlDrainTimer { *this };
+
+    // Timetagged inbound messages wait in timedScheduler until due and are
+    // applied by timedWriteTimer, which only runs while something is queued.
+    static constexpr int TIMED_APPLY_HZ = 250;
+    bool timetagSchedulingEnabled = true;
+    OSCTimedScheduler timedScheduler;
+    void scheduleTimedMessage(const juce::OSCMessage& message,
+                              uint64_t ntpTimeTag,
+                              const juce::String& senderIP,
+                              int port,
+                              ConnectionMode transport);
+    void applyScheduledMessage(const juce::OSCMessage& message,
+                               const juce::String& senderIP,
+                               int port,
+                               ConnectionMode transport);
+    void applyDueTimedMessages();
+
+    class TimedWriteTimer : public juce::Timer
+    {
+    public:
+        explicit TimedWriteTimer (OSCManager& o) : owner (o) {}
+        void timerCallback() override;
+    private:
+        OSCManager& owner;
+    };
+    TimedWriteTimer timedWriteTimer { *this };
+
     // Statistics
     std::atomic<int> messagesSent { 0 };
+    std::atomic<int> datagramsSent { 0 };
+    std::atomic<int> outboundDeduplicated { 0 };
+    std::atomic<float> messagesSentPerSecond { 0.0f };
+    std::atomic<float> datagramsSentPerSecond { 0.0f };
+    juce::int64 rateSampleTimeMs = 0;   // Message thread (timerCallback) only
+    int rateSampleMessages = 0;
+    int rateSampleDatagrams = 0;
     std::atomic<int> messagesReceived { 0 };
     std::atomic<int> parseErrors { 0 };
 
@@ -36,6 +36,9 @@ const std::map<juce::Identifier, OSCMessageBuilder::ParamMapping>& OSCMessageBui
         { WFSParameterIDs::inputTrackingActive,   { "/wfs/input/trackingActive",   "/remoteInput/trackingActive" } },
         { WFSParameterIDs::inputTrackingID,       { "/wfs/input/trackingID",       "/remoteInput/trackingID" } },
         { WFSParameterIDs::inputTrackingSmooth,   { "/wfs/input/trackingSmooth",   "/remoteInput/trackingSmooth" } },
+        { WFSParameterIDs::inputTrackingPredict,  { "/wfs/input/trackingPredict",  "/remoteInput/trackingPredict" } },
+        { WFSParameterIDs::inputTrackingPredictHorizon, { "/wfs/input/trackingPredictHorizon", "/remoteInput/trackingPredictHorizon" } },
+        { WFSParameterIDs::inputTrackingPredictMaxLead, { "/wfs/input/trackingPredictMaxLead", "/remoteInput/trackingPredictMaxLead" } },
         { WFSParameterIDs::inputMaxSpeedActive,   { "/wfs/input/maxSpeedActive",   "/remoteInput/maxSpeedActive" } },
         { WFSParameterIDs::inputMaxSpeed,         { "/wfs/input/maxSpeed",         "/remoteInput/maxSpeed" } },
         { WFSParameterIDs::inputPathModeActive,   { "/wfs/input/pathModeActive",   "/remoteInput/pathModeActive" } },
@@ -1,7 +1,10 @@
 #include "OSCMessageRouter.h"
 #include "OSCParameterBounds.h"
+#include "OSCAddressTrie.h"
 
+#include <atomic>
 #include <cmath>
+#include <optional>
 #include <set>
 
 namespace WFSNetwork
@@ -40,6 +43,9 @@ const std::map<juce::String, juce::Identifier>& OSCMessageRouter::getInputAddres
         { "trackingActive",   WFSParameterIDs::inputTrackingActive },
         { "trackingID",       WFSParameterIDs::inputTrackingID },
         { "trackingSmooth",   WFSParameterIDs::inputTrackingSmooth },
+        { "trackingPredict",  WFSParameterIDs::inputTrackingPredict },
+        { "trackingPredictHorizon", WFSParameterIDs::inputTrackingPredictHorizon },
+        { "trackingPredictMaxLead", WFSParameterIDs::inputTrackingPredictMaxLead },
         { "maxSpeedActive",   WFSParameterIDs::inputMaxSpeedActive },
         { "maxSpeed",         WFSParameterIDs::inputMaxSpeed },
         { "pathModeActive",   WFSParameterIDs::inputPathModeActive },
@@ -325,6 +331,9 @@ const std::map<juce::String, juce::Identifier>& OSCMessageRouter::getRemoteAddre
         { "trackingActive",   WFSParameterIDs::inputTrackingActive },
         { "trackingID",       WFSParameterIDs::inputTrackingID },
         { "trackingSmooth",   WFSParameterIDs::inputTrackingSmooth },
+        { "trackingPredict",  WFSParameterIDs::inputTrackingPredict },
+        { "trackingPredictHorizon", WFSParameterIDs::inputTrackingPredictHorizon },
+        { "trackingPredictMaxLead", WFSParameterIDs::inputTrackingPredictMaxLead },
 
         // Sidelines
         { "sidelinesActive",  WFSParameterIDs::inputSidelinesActive },
@@ -603,12 +612,12 @@ namespace
     // and return false. Parameters with no entry in the bounds table
     // pass through as well.
     static bool valueWithinBounds (const juce::Identifier& paramId,
+                                   const std::optional<WFSNetwork::ParamBounds>& b,
                                    const juce::var& value,
                                    juce::String& outReason)
     {
         if (value.isString())
             return true;
-        auto b = WFSNetwork::getBounds (paramId);
         if (! b.has_value())
             return true;
         const double d = static_cast<double> (value);
@@ -620,118 +629,302 @@ namespace
         return true;
     }
 
+    static bool valueWithinBounds (const juce::Identifier& paramId,
+                                   const juce::var& value,
+                                   juce::String& outReason)
+    {
+        return valueWithinBounds (paramId, WFSNetwork::getBounds (paramId), value, outReason);
+    }
+
     // Clamp the optional ramp-time arg to a sane window [0, 600] s. We
     // clamp rather than reject so a bad ramp doesn't drop the value.
     static float clampRampSeconds (float v)
     {
         return juce::jlimit (0.0f, 600.0f, v);
     }
-}
 
-//==============================================================================
-// Message Parsing
-//==============================================================================
+    //==========================================================================
+    // Address resolution
+    //==========================================================================
 
-OSCMessageRouter::ParsedInputMessage OSCMessageRouter::parseInputMessage(const juce::OSCMessage& message)
-{
-    ParsedInputMessage result;
+    std::atomic<bool> addressTrieEnabled { true };
 
-    juce::String address = message.getAddressPattern().toString();
+    enum class ChannelFamily { Input, Output, Reverb };
 
-    if (!isInputAddress(address))
-        return result;
+    constexpr const char* reverbPrefix = "/wfs/reverb/";
 
-    // Check for OSCQuery format first: /wfs/input/{channelID}/{param} <value> [rampTimeSec]
-    // e.g. /wfs/input/1/attenuation -5.0
-    juce::String suffix = address.fromFirstOccurrenceOf("/wfs/input/", false, true);
-    int slashIdx = suffix.indexOf("/");
-    if (slashIdx > 0)
+    // The per-parameter facts the parsers used to derive from the name on
+    // every message. Reverb keeps its historical asymmetry: the OSCQuery form
+    // treats preEQ* as band parameters, the standard form tests for EQ*.
+    static WFSNetwork::OSCParamRoute makeRoute (ChannelFamily family,
+                                                const juce::String& paramName,
+                                                const juce::Identifier& paramId)
     {
-        juce::String firstSeg = suffix.substring(0, slashIdx);
-        juce::String paramName = suffix.substring(slashIdx + 1);
+        WFSNetwork::OSCParamRoute route;
+        route.paramId = paramId;
+        route.bounds = WFSNetwork::getBounds (paramId);
 
-        if (firstSeg.containsOnly("0123456789") && paramName.isNotEmpty())
+        const bool eqName = paramName.startsWith ("EQ") && paramName != "EQenable";
+        switch (family)
+        {
+            case ChannelFamily::Input:
+                route.rampCapable = WFSNetwork::OSCMessageRouter::isInputParamRampCapable (paramId);
+                break;
+            case ChannelFamily::Output:
+                route.eqInQueryForm = eqName;
+                route.eqInStandardForm = eqName;
+                break;
+            case ChannelFamily::Reverb:
+                route.eqInQueryForm = paramName.startsWith ("preEQ") && paramName != "preEQenable";
+                route.eqInStandardForm = eqName;
+                break;
+        }
+        return route;
+    }
+
+    struct BuiltAddressTrie : WFSNetwork::OSCAddressTrie
+    {
+        BuiltAddressTrie()
         {
-            const auto& addrMap = getInputAddressMap();
-            auto it = addrMap.find(paramName);
-            if (it != addrMap.end() && message.size() >= 1)
+            using Router = WFSNetwork::OSCMessageRouter;
+
+            auto addFamily = [this] (ChannelFamily family, const juce::String& prefix,
+                                     const std::map<juce::String, juce::Identifier>& addressMap)
             {
-                result.paramId = it->second;
-                result.channelId = firstSeg.getIntValue();
-
-                // Numeric strings are coerced to floats — QLab custom messages
-                // may type every argument as a string. inputName legitimately
-                // takes arbitrary text and is exempt.
-                if (message[0].isString()
-                    && (result.paramId == WFSParameterIDs::inputName
-                        || ! isNumericString (message[0].getString())))
-                    result.value = extractString(message[0]);
-                else
-                    result.value = extractFloatLenient(message[0]);
-
-                // Optional ramp time: /wfs/input/{channelID}/{param} <value> <rampTimeSec>
-                if (message.size() >= 2)
-                {
-                    const bool fadeIsNumeric = message[1].isFloat32() || message[1].isInt32()
-                        || (message[1].isString() && isNumericString (message[1].getString()));
-
-                    if (fadeIsNumeric && isInputParamRampCapable(result.paramId))
-                    {
-                        result.rampTimeSecRequested = extractFloatLenient (message[1]);
-                        result.rampTimeSec = clampRampSeconds (result.rampTimeSecRequested);
-                    }
-                    else if (fadeIsNumeric)
-                        result.rampArgIgnored = true;
-                }
+                for (const auto& [name, paramId] : addressMap)
+                    add (prefix + name, makeRoute (family, name, paramId));
+                allowChannelSegment (prefix);
+            };
 
-                if (! valueWithinBounds (result.paramId, result.value, result.invalidReason))
-                    return result;
+            addFamily (ChannelFamily::Input,  WFSNetwork::OSCPaths::INPUT_PREFIX,  Router::getInputAddressMap());
+            addFamily (ChannelFamily::Output, WFSNetwork::OSCPaths::OUTPUT_PREFIX, Router::getOutputAddressMap());
+            addFamily (ChannelFamily::Reverb, reverbPrefix,                        Router::getReverbAddressMap());
 
-                result.valid = true;
-                return result;
+            for (const auto& [path, paramId] : Router::getConfigAddressMap())
+            {
+                WFSNetwork::OSCParamRoute route;
+                route.paramId = paramId;
+                route.bounds = WFSNetwork::getBounds (paramId);
+                add (path, std::move (route));
             }
         }
+    };
+
+    static const WFSNetwork::OSCAddressTrie& getAddressTrie()
+    {
+        static const BuiltAddressTrie trie;
+        return trie;
     }
 
-    // Standard format: /wfs/input/{param} <channelID> <value> [rampTimeSec]
-    result.paramId = getInputParamId(address);
-    if (result.paramId.isValid() && message.size() >= 2)
+    struct AddressMatch
     {
-        result.channelId = extractInt(message[0]);
+        const WFSNetwork::OSCParamRoute* route = nullptr;
+        int channel = 0;
+        bool channelInAddress = false;   // OSCQuery form /wfs/<family>/{channelID}/{param}
+    };
 
-        // Numeric strings are coerced to floats — QLab custom messages may
-        // type every argument as a string. inputName legitimately takes
-        // arbitrary text and is exempt (as are the "inc"/"dec" directives,
-        // which are non-numeric and therefore stay strings).
-        if (message[1].isString()
-            && (result.paramId == WFSParameterIDs::inputName
-                || ! isNumericString (message[1].getString())))
-            result.value = extractString(message[1]);
-        else
-            result.value = extractFloatLenient(message[1]);
+    // Resolve a /wfs/input|output|reverb/ address. The trie answers every
+    // address it was built from; anything else (deep paths, unusual channel
+    // spellings) takes the original String path so it resolves as it always
+    // has. legacyRoute is the storage for a String-path result.
+    static AddressMatch resolveChannelAddress (ChannelFamily family,
+                                               const juce::String& address,
+                                               const char* prefix,
+                                               const std::map<juce::String, juce::Identifier>& addressMap,
+                                               WFSNetwork::OSCParamRoute& legacyRoute)
+    {
+        if (addressTrieEnabled.load (std::memory_order_relaxed))
+        {
+            const auto m = getAddressTrie().find (address);
+            if (m.route != nullptr)
+                return { m.route, m.channel, m.channelInAddress };
+        }
 
-        // Optional ramp time argument — only accepted for parameters listed as
-        // ramp-capable in Documentation/WFS-UI_input.csv.
-        if (message.size() >= 3)
+        // OSCQuery format: /wfs/<family>/{channelID}/{param}
+        juce::String suffix = address.fromFirstOccurrenceOf (prefix, false, true);
+        int slashIdx = suffix.indexOf ("/");
+        if (slashIdx > 0)
         {
-            const bool fadeIsNumeric = message[2].isFloat32() || message[2].isInt32()
-                || (message[2].isString() && isNumericString (message[2].getString()));
+            juce::String firstSeg = suffix.substring (0, slashIdx);
+            juce::String paramName = suffix.substring (slashIdx + 1);
 
-            if (fadeIsNumeric && isInputParamRampCapable(result.paramId))
+            if (firstSeg.containsOnly ("0123456789") && paramName.isNotEmpty())
             {
-                result.rampTimeSecRequested = extractFloatLenient (message[2]);
-                result.rampTimeSec = clampRampSeconds (result.rampTimeSecRequested);
+                auto it = addressMap.find (paramName);
+                if (it != addressMap.end())
+                {
+                    legacyRoute = makeRoute (family, paramName, it->second);
+                    return { &legacyRoute, firstSeg.getIntValue(), true };
+                }
             }
-            else if (fadeIsNumeric)
-                result.rampArgIgnored = true;
         }
 
-        if (! valueWithinBounds (result.paramId, result.value, result.invalidReason))
+        // Standard format: /wfs/<family>/{param}
+        juce::String paramName = WFSNetwork::OSCMessageRouter::extractParamName (address);
+        auto it = addressMap.find (paramName);
+        if (it != addressMap.end())
+        {
+            legacyRoute = makeRoute (family, paramName, it->second);
+            return { &legacyRoute, 0, false };
+        }
+
+        return {};
+    }
+
+    // Output and reverb share one layout:
+    //   OSCQuery: /wfs/<family>/{channelID}/{param} [<band>] <value>
+    //   Standard: /wfs/<family>/{param} <channelID> [<band>] <value>
+    template <typename Parsed>
+    static Parsed parseChannelParamMessage (const juce::OSCMessage& message, const AddressMatch& match)
+    {
+        using Router = WFSNetwork::OSCMessageRouter;
+
+        Parsed result;
+        if (match.route == nullptr)
             return result;
 
-        result.valid = true;
+        const auto& route = *match.route;
+        result.paramId = route.paramId;
+
+        auto extractValue = [] (const juce::OSCArgument& arg) -> juce::var
+        {
+            if (arg.isString())
+                return Router::extractString (arg);
+            return Router::extractFloat (arg);
+        };
+
+        if (match.channelInAddress)
+        {
+            result.channelId = match.channel;
+
+            if (route.eqInQueryForm && message.size() >= 2)
+            {
+                result.isEQparam = true;
+                result.bandIndex = Router::extractInt (message[0]);
+                result.value = extractValue (message[1]);
+            }
+            else if (! route.eqInQueryForm && message.size() >= 1)
+            {
+                result.value = extractValue (message[0]);
+            }
+            else
+            {
+                return result;
+            }
+
+            if (valueWithinBounds (result.paramId, route.bounds, result.value, result.invalidReason))
+                result.valid = true;
+            return result;
+        }
+
+        if (route.eqInStandardForm)
+        {
+            if (message.size() < 3)
+                return result;
+
+            result.isEQparam = true;
+            result.channelId = Router::extractInt (message[0]);
+            result.bandIndex = Router::extractInt (message[1]);
+            result.value = extractValue (message[2]);
+        }
+        else
+        {
+            if (message.size() < 2)
+                return result;
+
+            result.channelId = Router::extractInt (message[0]);
+            result.value = extractValue (message[1]);
+        }
+
+        if (valueWithinBounds (result.paramId, route.bounds, result.value, result.invalidReason))
+            result.valid = true;
+        return result;
     }
+}
 
+void OSCMessageRouter::setAddressTrieEnabled(bool enabled)
+{
+    addressTrieEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool OSCMessageRouter::isAddressTrieEnabled()
+{
+    return addressTrieEnabled.load(std::memory_order_relaxed);
+}
+
+//==============================================================================
+// Message Parsing
+//==============================================================================
+
+OSCMessageRouter::ParsedInputMessage OSCMessageRouter::parseInputMessage(const juce::OSCMessage& message)
+{
+    ParsedInputMessage result;
+
+    const juce::String address = message.getAddressPattern().toString();
+
+    if (!isInputAddress(address))
+        return result;
+
+    OSCParamRoute legacyRoute;
+    const auto match = resolveChannelAddress(ChannelFamily::Input, address, OSCPaths::INPUT_PREFIX,
+                                             getInputAddressMap(), legacyRoute);
+    if (match.route == nullptr)
+        return result;
+
+    const auto& route = *match.route;
+    result.paramId = route.paramId;
+
+    // OSCQuery format: /wfs/input/{channelID}/{param} <value> [rampTimeSec]
+    //   e.g. /wfs/input/1/attenuation -5.0
+    // Standard format: /wfs/input/{param} <channelID> <value> [rampTimeSec]
+    // An OSCQuery address without arguments is read as the standard form
+    // (and so rejected for lack of a value), as it always has been.
+    const bool queryForm = match.channelInAddress && message.size() >= 1;
+    const int valueArg = queryForm ? 0 : 1;
+
+    if (queryForm)
+    {
+        result.channelId = match.channel;
+    }
+    else
+    {
+        if (message.size() < 2)
+            return result;
+        result.channelId = extractInt(message[0]);
+    }
+
+    // Numeric strings are coerced to floats — QLab custom messages may
+    // type every argument as a string. inputName legitimately takes
+    // arbitrary text and is exempt (as are the "inc"/"dec" directives,
+    // which are non-numeric and therefore stay strings).
+    if (message[valueArg].isString()
+        && (result.paramId == WFSParameterIDs::inputName
+            || ! isNumericString (message[valueArg].getString())))
+        result.value = extractString(message[valueArg]);
+    else
+        result.value = extractFloatLenient(message[valueArg]);
+
+    // Optional ramp time argument — only accepted for parameters listed as
+    // ramp-capable in Documentation/WFS-UI_input.csv.
+    const int fadeArg = valueArg + 1;
+    if (message.size() > fadeArg)
+    {
+        const bool fadeIsNumeric = message[fadeArg].isFloat32() || message[fadeArg].isInt32()
+            || (message[fadeArg].isString() && isNumericString (message[fadeArg].getString()));
+
+        if (fadeIsNumeric && route.rampCapable)
+        {
+            result.rampTimeSecRequested = extractFloatLenient (message[fadeArg]);
+            result.rampTimeSec = clampRampSeconds (result.rampTimeSecRequested);
+        }
+        else if (fadeIsNumeric)
+            result.rampArgIgnored = true;
+    }
+
+    if (! valueWithinBounds (result.paramId, route.bounds, result.value, result.invalidReason))
+        return result;
+
+    result.valid = true;
     return result;
 }
 
@@ -797,212 +990,59 @@ bool OSCMessageRouter::isInputParamRampCapable(const juce::Identifier& paramId)
     return rampCapable.find (paramId) != rampCapable.end();
 }
 
+
 OSCMessageRouter::ParsedOutputMessage OSCMessageRouter::parseOutputMessage(const juce::OSCMessage& message)
 {
-    ParsedOutputMessage result;
-
-    juce::String address = message.getAddressPattern().toString();
+    const juce::String address = message.getAddressPattern().toString();
 
     if (!isOutputAddress(address))
-        return result;
-
-    // Check OSCQuery format first: /wfs/output/{channelID}/{param} <value>
-    juce::String suffix = address.fromFirstOccurrenceOf("/wfs/output/", false, true);
-    int slashIdx = suffix.indexOf("/");
-    if (slashIdx > 0)
-    {
-        juce::String firstSeg = suffix.substring(0, slashIdx);
-        juce::String paramName = suffix.substring(slashIdx + 1);
-
-        if (firstSeg.containsOnly("0123456789") && paramName.isNotEmpty())
-        {
-            const auto& addrMap = getOutputAddressMap();
-            auto it = addrMap.find(paramName);
-            if (it != addrMap.end())
-            {
-                result.paramId = it->second;
-                result.channelId = firstSeg.getIntValue();
+        return {};
 
-                bool isEQ = paramName.startsWith("EQ") && paramName != "EQenable";
-                if (isEQ && message.size() >= 2)
-                {
-                    result.isEQparam = true;
-                    result.bandIndex = extractInt(message[0]);
-                    if (message[1].isString())
-                        result.value = extractString(message[1]);
-                    else
-                        result.value = extractFloat(message[1]);
-                    if (! valueWithinBounds (result.paramId, result.value, result.invalidReason))
-                        return result;
-                    result.valid = true;
-                }
-                else if (!isEQ && message.size() >= 1)
-                {
-                    if (message[0].isString())
-                        result.value = extractString(message[0]);
-                    else
-                        result.value = extractFloat(message[0]);
-                    if (! valueWithinBounds (result.paramId, result.value, result.invalidReason))
-                        return result;
-                    result.valid = true;
-                }
-                return result;
-            }
-        }
-    }
-
-    // Standard format: /wfs/output/{param} <channelID> <value>
-    result.paramId = getOutputParamId(address);
-    if (result.paramId.isValid())
-    {
-        juce::String paramName = extractParamName(address);
-        bool isEQParam = paramName.startsWith("EQ") && paramName != "EQenable";
-
-        if (isEQParam)
-        {
-            if (message.size() < 3)
-                return result;
-
-            result.isEQparam = true;
-            result.channelId = extractInt(message[0]);
-            result.bandIndex = extractInt(message[1]);
-
-            if (message[2].isString())
-                result.value = extractString(message[2]);
-            else
-                result.value = extractFloat(message[2]);
-        }
-        else
-        {
-            if (message.size() < 2)
-                return result;
-
-            result.channelId = extractInt(message[0]);
-
-            if (message[1].isString())
-                result.value = extractString(message[1]);
-            else
-                result.value = extractFloat(message[1]);
-        }
-
-        if (! valueWithinBounds (result.paramId, result.value, result.invalidReason))
-            return result;
-
-        result.valid = true;
-    }
-
-    return result;
+    OSCParamRoute legacyRoute;
+    return parseChannelParamMessage<ParsedOutputMessage>(message,
+        resolveChannelAddress(ChannelFamily::Output, address, OSCPaths::OUTPUT_PREFIX,
+                              getOutputAddressMap(), legacyRoute));
 }
 
 OSCMessageRouter::ParsedReverbMessage OSCMessageRouter::parseReverbMessage(const juce::OSCMessage& message)
 {
-    ParsedReverbMessage result;
-
-    juce::String address = message.getAddressPattern().toString();
+    const juce::String address = message.getAddressPattern().toString();
 
     if (!isReverbAddress(address))
-        return result;
-
-    // Check OSCQuery format first: /wfs/reverb/{channelID}/{param} <value>
-    juce::String suffix = address.fromFirstOccurrenceOf("/wfs/reverb/", false, true);
-    int slashIdx = suffix.indexOf("/");
-    if (slashIdx > 0)
-    {
-        juce::String firstSeg = suffix.substring(0, slashIdx);
-        juce::String paramName = suffix.substring(slashIdx + 1);
-
-        if (firstSeg.containsOnly("0123456789") && paramName.isNotEmpty())
-        {
-            const auto& addrMap = getReverbAddressMap();
-            auto it = addrMap.find(paramName);
-            if (it != addrMap.end())
-            {
-                result.paramId = it->second;
-                result.channelId = firstSeg.getIntValue();
-
-                bool isEQ = paramName.startsWith("preEQ") && paramName != "preEQenable";
-                if (isEQ && message.size() >= 2)
-                {
-                    result.isEQparam = true;
-                    result.bandIndex = extractInt(message[0]);
-                    if (message[1].isString())
-                        result.value = extractString(message[1]);
-                    else
-                        result.value = extractFloat(message[1]);
-                    if (! valueWithinBounds (result.paramId, result.value, result.invalidReason))
-                        return result;
-                    result.valid = true;
-                }
-                else if (!isEQ && message.size() >= 1)
-                {
-                    if (message[0].isString())
-                        result.value = extractString(message[0]);
-                    else
-                        result.value = extractFloat(message[0]);
-                    if (! valueWithinBounds (result.paramId, result.value, result.invalidReason))
-                        return result;
-                    result.valid = true;
-                }
-                return result;
-            }
-        }
-    }
-
-    // Standard format: /wfs/reverb/{param} <channelID> <value>
-    result.paramId = getReverbParamId(address);
-    if (result.paramId.isValid())
-    {
-        juce::String paramName = extractParamName(address);
-        bool isEQParam = paramName.startsWith("EQ") && paramName != "EQenable";
-
-        if (isEQParam)
-        {
-            if (message.size() < 3)
-                return result;
-
-            result.isEQparam = true;
-            result.channelId = extractInt(message[0]);
-            result.bandIndex = extractInt(message[1]);
+        return {};
 
-            if (message[2].isString())
-                result.value = extractString(message[2]);
-            else
-                result.value = extractFloat(message[2]);
-        }
-        else
-        {
-            if (message.size() < 2)
-                return result;
-
-            result.channelId = extractInt(message[0]);
-
-            if (message[1].isString())
-                result.value = extractString(message[1]);
-            else
-                result.value = extractFloat(message[1]);
-        }
-
-        if (! valueWithinBounds (result.paramId, result.value, result.invalidReason))
-            return result;
-
-        result.valid = true;
-    }
-
-    return result;
+    OSCParamRoute legacyRoute;
+    return parseChannelParamMessage<ParsedReverbMessage>(message,
+        resolveChannelAddress(ChannelFamily::Reverb, address, reverbPrefix,
+                              getReverbAddressMap(), legacyRoute));
 }
 
 OSCMessageRouter::ParsedConfigMessage OSCMessageRouter::parseConfigMessage(const juce::OSCMessage& message)
 {
     ParsedConfigMessage result;
 
-    juce::String address = message.getAddressPattern().toString();
+    const juce::String address = message.getAddressPattern().toString();
 
     if (!isConfigAddress(address))
         return result;
 
-    result.paramId = getConfigParamId(address);
-    if (!result.paramId.isValid())
-        return result;
+    // Config addresses are full paths: the trie holds them verbatim
+    std::optional<ParamBounds> bounds;
+    const auto match = addressTrieEnabled.load(std::memory_order_relaxed)
+                           ? getAddressTrie().find(address)
+                           : OSCAddressTrie::Match {};
+    if (match.route != nullptr && ! match.channelInAddress)
+    {
+        result.paramId = match.route->paramId;
+        bounds = match.route->bounds;
+    }
+    else
+    {
+        result.paramId = getConfigParamId(address);
+        if (!result.paramId.isValid())
+            return result;
+        bounds = getBounds(result.paramId);
+    }
 
     // Config messages have format: /wfs/config/... <value>
     // No channel ID - just a single value
@@ -1019,7 +1059,7 @@ OSCMessageRouter::ParsedConfigMessage OSCMessageRouter::parseConfigMessage(const
     else
         return result;
 
-    if (! valueWithinBounds (result.paramId, result.value, result.invalidReason))
+    if (! valueWithinBounds (result.paramId, bounds, result.value, result.invalidReason))
         return result;
 
     result.valid = true;
@@ -227,6 +227,15 @@ public:
      */
     static bool isInputParamRampCapable(const juce::Identifier& paramId);
 
+    /**
+     * Resolve input/output/reverb/config addresses through the precompiled
+     * address trie (OSCAddressTrie.h, the default) or through the original
+     * String path. Both give identical results; the switch exists for A/B
+     * runs of tools/validation/osc-route-bench.
+     */
+    static void setAddressTrieEnabled(bool enabled);
+    static bool isAddressTrieEnabled();
+
     //==========================================================================
     // Value Extraction
     //==========================================================================
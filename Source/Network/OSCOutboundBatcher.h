@@ -0,0 +1,169 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace WFSNetwork
+{
+
+/**
+ * Conservative serialized-size estimate for a juce::OSCMessage.
+ * Matches OSC 1.0 wire format: address (null-terminated, 4-byte aligned) +
+ * type-tag string (',' + tags + null, 4-byte aligned) + each argument.
+ */
+inline size_t estimateOSCMessageSize (const juce::OSCMessage& msg)
+{
+    auto pad4 = [] (size_t s) { return (s + 3u) & ~size_t (3u); };
+
+    // Address pattern: UTF-8 bytes + null terminator, padded to 4 bytes.
+    const auto address = msg.getAddressPattern().toString();
+    size_t total = pad4 (static_cast<size_t> (address.getNumBytesAsUTF8()) + 1);
+
+    // Type tag string: ',' + one char per arg + null terminator, padded.
+    const size_t numArgs = static_cast<size_t> (msg.size());
+    total += pad4 (1 + numArgs + 1);
+
+    for (const auto& arg : msg)
+    {
+        if (arg.isInt32() || arg.isFloat32())
+            total += 4;
+        else if (arg.isString())
+            total += pad4 (static_cast<size_t> (arg.getString().getNumBytesAsUTF8()) + 1);
+        else if (arg.isBlob())
+            total += 4 + pad4 (static_cast<size_t> (arg.getBlob().getSize()));
+        else if (arg.isColour())
+            total += 4;
+        else
+            total += 4; // safe default for unknown arg types
+    }
+    return total;
+}
+
+/**
+ * OSCOutboundBatcher
+ *
+ * Per-target accumulator for outbound feedback. Messages added between two
+ * flushes are deduplicated latest-wins by address plus their leading int32
+ * arguments (the channel / band selectors of every WFS feedback address, so
+ * "/remoteInput/positionX 3 <x>" and "... 4 <x>" stay distinct), keep their
+ * first-arrival order, and leave as MTU-sized OSCBundles.
+ *
+ * takeBundles() spends at most the per-flush byte budget; whatever does not
+ * fit stays queued for the next flush, where newer values keep replacing it
+ * in place, so a long recall degrades to "latest state, a few ticks later"
+ * instead of a datagram burst the receiver drops.
+ *
+ * Not thread-safe: the owner serialises add() and takeBundles().
+ */
+class OSCOutboundBatcher
+{
+public:
+    // 1200 bytes leaves headroom under typical Ethernet MTU (1500 - IP/UDP
+    // headers) so each bundle fits in one UDP datagram without fragmentation.
+    static constexpr size_t maxBundleBytes = 1200;
+    static constexpr size_t bundleHeaderBytes = 16;   // "#bundle\0" (8) + timetag (8)
+    static constexpr size_t defaultFlushBudgetBytes = 16 * maxBundleBytes;
+
+    void setFlushBudgetBytes (size_t bytes) noexcept   { flushBudgetBytes = juce::jmax (maxBundleBytes, bytes); }
+
+    /** Returns true when the message replaced a queued one (deduplicated). */
+    bool add (const juce::OSCMessage& message)
+    {
+        auto key = makeKey (message);
+        const auto it = index.find (key);
+        if (it != index.end())
+        {
+            pending[it->second] = { message, estimateOSCMessageSize (message) };
+            return true;
+        }
+
+        index.emplace (std::move (key), pending.size());
+        pending.push_back ({ message, estimateOSCMessageSize (message) });
+        return false;
+    }
+
+    bool isEmpty() const noexcept           { return pending.empty(); }
+    int getNumPending() const noexcept      { return static_cast<int> (pending.size()); }
+
+    /** Packs queued messages into bundles up to the flush budget. */
+    std::vector<juce::OSCBundle> takeBundles()
+    {
+        std::vector<juce::OSCBundle> bundles;
+        juce::OSCBundle current;
+        size_t currentBytes = bundleHeaderBytes;
+        size_t spent = 0;
+        size_t taken = 0;
+
+        for (; taken < pending.size(); ++taken)
+        {
+            const size_t addedBytes = 4 + pending[taken].bytes;   // 4-byte size prefix + message
+
+            if (currentBytes + addedBytes > maxBundleBytes && current.size() > 0)
+            {
+                spent += currentBytes;
+                bundles.push_back (std::move (current));
+                current = juce::OSCBundle{};
+                currentBytes = bundleHeaderBytes;
+            }
+
+            // Always make progress: the first message of a flush goes out even
+            // when it alone exceeds the budget.
+            if (spent + currentBytes + addedBytes > flushBudgetBytes && (spent > 0 || current.size() > 0))
+                break;
+
+            current.addElement (pending[taken].message);
+            currentBytes += addedBytes;
+        }
+
+        if (current.size() > 0)
+            bundles.push_back (std::move (current));
+
+        if (taken == pending.size())
+        {
+            pending.clear();
+            index.clear();
+        }
+        else
+        {
+            pending.erase (pending.begin(), pending.begin() + static_cast<std::ptrdiff_t> (taken));
+            index.clear();
+            for (size_t i = 0; i < pending.size(); ++i)
+                index.emplace (makeKey (pending[i].message), i);
+        }
+
+        return bundles;
+    }
+
+    void clear()
+    {
+        pending.clear();
+        index.clear();
+    }
+
+private:
+    struct Entry
+    {
+        juce::OSCMessage message;
+        size_t bytes = 0;
+    };
+
+    static std::string makeKey (const juce::OSCMessage& message)
+    {
+        std::string key = message.getAddressPattern().toString().toStdString();
+        for (int i = 0; i + 1 < message.size() && message[i].isInt32(); ++i)
+        {
+            key += '\0';
+            key += std::to_string (message[i].getInt32());
+        }
+        return key;
+    }
+
+    std::vector<Entry> pending;
+    std::unordered_map<std::string, size_t> index;
+    size_t flushBudgetBytes = defaultFlushBudgetBytes;
+};
+
+} // namespace WFSNetwork
@@ -166,6 +166,9 @@ namespace
             BIND_BOOL (inputTrackingActive);
             BIND_I_AS (inputTrackingID, inputTrackingID);
             BIND_I (inputTrackingSmooth);
+            BIND_I (inputTrackingPredict);
+            BIND_I (inputTrackingPredictHorizon);
+            BIND_F (inputTrackingPredictMaxLead);
             BIND_BOOL (inputMaxSpeedActive);
             BIND_F (inputMaxSpeed);
             BIND_BOOL (inputPathModeActive);
@@ -7,6 +7,9 @@
 namespace WFSNetwork
 {
 
+// Container names under /wfs, indexed by OSCQueryServer::Category
+static const char* const categoryNames[] = { "input", "output", "reverb", "config" };
+
 //==============================================================================
 // Construction / Destruction
 //==============================================================================
@@ -36,6 +39,9 @@ bool OSCQueryServer::start(int oscPortParam, int httpPortParam)
     oscPort = oscPortParam;
     httpPort = httpPortParam;
 
+    // Build the namespace before the first request can arrive
+    rebuildNamespace();
+
     wsServer = std::make_unique<SimpleWebSocketServer>();
     wsServer->addHTTPRequestHandler(this);
     wsServer->addWebSocketListener(this);
@@ -89,10 +95,16 @@ void OSCQueryServer::stop()
         wsServer.reset();
     }
 
-    // Clear subscriptions
+    // Clear subscriptions and queued pushes (handles stay valid)
     {
-        const juce::ScopedLock sl(subscriptionLock);
-        subscriptions.clear();
+        const juce::ScopedLock sl(namespaceLock);
+        for (auto& slot : params)
+        {
+            slot.listeners.clear();
+            slot.pendingIndex = -1;
+        }
+        handlesByConnection.clear();
+        pendingPushes.clear();
     }
 
     DBG("OSCQueryServer: Stopped");
@@ -121,73 +133,134 @@ bool OSCQueryServer::handleHTTPRequest(std::shared_ptr<HttpServer::Response> res
         return true;
     }
 
-    // Build full tree and walk to requested path
-    juce::DynamicObject::Ptr rootPtr(buildFullTree());
-    juce::DynamicObject::Ptr targetPtr = rootPtr;
+    juce::String ifNoneMatch;
+    {
+        auto it = request->header.find("If-None-Match");
+        if (it != request->header.end())
+            ifNoneMatch = juce::String(it->second);
+    }
 
-    if (path != "/" && path.isNotEmpty())
+    // Walk the cached tree under the lock, but serialize after releasing it:
+    // the message thread patches values under the same lock on every change.
+    // A body that carries VALUE fields (a node tree, ?VALUE) is tagged with
+    // the structure and value versions; one that doesn't (?TYPE, ?RANGE...)
+    // with the structure version only. Both versions are namespace-wide, so
+    // the tag is valid for any path. The path is resolved first: an unknown
+    // path is a 404, never a 304.
+    int status = 200;
+    juce::String body, etag;
+    juce::var snapshot;                      // Deep copy to serialize unlocked
+    bool snapshotIsRoot = false;
+    juce::uint64 snapshotStructureVersion = 0, snapshotValueVersion = 0;
     {
-        auto segments = juce::StringArray::fromTokens(path.substring(1), "/", "");
+        const juce::ScopedLock sl(namespaceLock);
+
+        juce::DynamicObject::Ptr targetPtr = namespaceRoot;
 
-        for (const auto& seg : segments)
+        if (targetPtr != nullptr && path != "/" && path.isNotEmpty())
         {
-            const auto& contentsVar = targetPtr->getProperty("CONTENTS");
-            auto* contentsObj = contentsVar.getDynamicObject();
-            if (contentsObj == nullptr)
+            auto segments = juce::StringArray::fromTokens(path.substring(1), "/", "");
+
+            for (const auto& seg : segments)
             {
-                sendJsonResponse(response, 404,
-                    "{\"ERROR\": \"Path not found: " + path + "\"}");
-                return true;
+                const auto& contentsVar = targetPtr->getProperty("CONTENTS");
+                auto* contentsObj = contentsVar.getDynamicObject();
+                auto* childObj = contentsObj != nullptr
+                                     ? contentsObj->getProperty(juce::Identifier(seg)).getDynamicObject()
+                                     : nullptr;
+                if (childObj == nullptr)
+                {
+                    targetPtr = nullptr;
+                    break;
+                }
+
+                targetPtr = childObj;
             }
+        }
+
+        const juce::String attr = query.toUpperCase();
+        const bool knownAttr = attr == "VALUE" || attr == "TYPE" || attr == "RANGE" ||
+                               attr == "ACCESS" || attr == "DESCRIPTION" || attr == "CLIPMODE";
+
+        if (namespaceRoot == nullptr)
+        {
+            status = 404;
+            body = "{\"ERROR\": \"Namespace not available\"}";
+        }
+        else if (targetPtr == nullptr)
+        {
+            status = 404;
+            body = "{\"ERROR\": \"Path not found: " + path + "\"}";
+        }
+        else if (query.isNotEmpty() && ! knownAttr)
+        {
+            status = 400;
+            body = "{\"ERROR\": \"Unrecognized attribute: " + query + "\"}";
+        }
+        else
+        {
+            const bool carriesValues = query.isEmpty() || attr == "VALUE";
+            etag = "\"" + juce::String(structureVersion)
+                 + (carriesValues ? "-" + juce::String(valueVersion) : juce::String())
+                 + "\"";
 
-            const auto& childVar = contentsObj->getProperty(juce::Identifier(seg));
-            auto* childObj = childVar.getDynamicObject();
-            if (childObj == nullptr)
+            if (ifNoneMatch == etag)
             {
-                sendJsonResponse(response, 404,
-                    "{\"ERROR\": \"Path not found: " + path + "\"}");
-                return true;
+                status = 304;
+            }
+            else if (query.isNotEmpty())
+            {
+                // Attribute query (?VALUE, ?RANGE, ?TYPE, ?ACCESS, ?DESCRIPTION, ?CLIPMODE)
+                body = extractAttribute(targetPtr.get(), attr);
+                status = body.isNotEmpty() ? 200 : 204;
+            }
+            else if (targetPtr == namespaceRoot
+                     && serializedStructureVersion == structureVersion
+                     && serializedValueVersion == valueVersion)
+            {
+                body = namespaceJson;   // Nothing changed since the last full serialization
+            }
+            else
+            {
+                snapshot = juce::var(targetPtr.get()).clone();
+                snapshotIsRoot = targetPtr == namespaceRoot;
+                snapshotStructureVersion = structureVersion;
+                snapshotValueVersion = valueVersion;
             }
-
-            targetPtr = childObj;
         }
     }
 
-    // Attribute query (?VALUE, ?RANGE, ?TYPE, ?ACCESS, ?DESCRIPTION, ?CLIPMODE)
-    if (query.isNotEmpty())
+    if (snapshot.isObject())
     {
-        juce::String attr = query.toUpperCase();
+        body = juce::JSON::toString(snapshot, false);
 
-        if (attr == "VALUE" || attr == "TYPE" || attr == "RANGE" ||
-            attr == "ACCESS" || attr == "DESCRIPTION" || attr == "CLIPMODE")
+        // Keep the full namespace for the next request if nothing moved meanwhile
+        if (snapshotIsRoot)
         {
-            juce::String result = extractAttribute(targetPtr.get(), attr);
-            if (result.isNotEmpty())
-                sendJsonResponse(response, 200, result);
-            else
-                sendJsonResponse(response, 204, "");
-            return true;
+            const juce::ScopedLock sl(namespaceLock);
+            if (snapshotStructureVersion == structureVersion && snapshotValueVersion == valueVersion)
+            {
+                namespaceJson = body;
+                serializedStructureVersion = snapshotStructureVersion;
+                serializedValueVersion = snapshotValueVersion;
+            }
         }
-
-        sendJsonResponse(response, 400,
-            "{\"ERROR\": \"Unrecognized attribute: " + query + "\"}");
-        return true;
     }
 
-    // Full node response
-    juce::var targetVar(targetPtr.get());
-    sendJsonResponse(response, 200, juce::JSON::toString(targetVar, false));
+    sendJsonResponse(response, status, body, etag);
     return true;
 }
 
 void OSCQueryServer::sendJsonResponse(std::shared_ptr<HttpServer::Response> response,
-                                       int statusCode, const juce::String& body)
+                                       int statusCode, const juce::String& body,
+                                       const juce::String& etag)
 {
     SimpleWeb::StatusCode code;
     switch (statusCode)
     {
         case 200: code = SimpleWeb::StatusCode::success_ok; break;
         case 204: code = SimpleWeb::StatusCode::success_no_content; break;
+        case 304: code = SimpleWeb::StatusCode::redirection_not_modified; break;
         case 400: code = SimpleWeb::StatusCode::client_error_bad_request; break;
         case 404: code = SimpleWeb::StatusCode::client_error_not_found; break;
         default:  code = SimpleWeb::StatusCode::server_error_internal_server_error; break;
@@ -196,6 +269,11 @@ void OSCQueryServer::sendJsonResponse(std::shared_ptr<HttpServer::Response> resp
     SimpleWeb::CaseInsensitiveMultimap header;
     header.emplace("Content-Type", "application/json");
     header.emplace("Access-Control-Allow-Origin", "*");
+    if (etag.isNotEmpty())
+    {
+        header.emplace("ETag", etag.toStdString());
+        header.emplace("Cache-Control", "no-cache");  // Always revalidate
+    }
 
     response->write(code, body.toStdString(), header);
 }
@@ -248,124 +326,217 @@ void OSCQueryServer::connectionError(const juce::String& id, const juce::String&
 // Subscription Management
 //==============================================================================
 
+int OSCQueryServer::internPath(const juce::String& oscPath)
+{
+    auto it = handleByPath.find(oscPath);
+    if (it != handleByPath.end())
+        return it->second;
+
+    const int handle = static_cast<int>(params.size());
+    params.push_back({});
+    params.back().oscPath = oscPath;
+    paramCategories.push_back(numCategories);  // Unknown until a builder registers it
+    handleByPath.emplace(oscPath, handle);
+    return handle;
+}
+
 void OSCQueryServer::handleListenCommand(const juce::String& connectionId, const juce::String& path)
 {
-    const juce::ScopedLock sl(subscriptionLock);
+    const juce::ScopedLock sl(namespaceLock);
 
-    auto& listeners = subscriptions[path];
+    const int handle = internPath(path);
+    auto& listeners = params[static_cast<size_t>(handle)].listeners;
     if (!listeners.contains(connectionId))
     {
         listeners.add(connectionId);
+        handlesByConnection[connectionId].push_back(handle);
         DBG("OSCQueryServer: LISTEN " << path << " from " << connectionId);
     }
 }
 
 void OSCQueryServer::handleIgnoreCommand(const juce::String& connectionId, const juce::String& path)
 {
-    const juce::ScopedLock sl(subscriptionLock);
+    const juce::ScopedLock sl(namespaceLock);
+
+    auto it = handleByPath.find(path);
+    if (it == handleByPath.end())
+        return;
+
+    const int handle = it->second;
+    params[static_cast<size_t>(handle)].listeners.removeString(connectionId);
 
-    auto it = subscriptions.find(path);
-    if (it != subscriptions.end())
+    auto conn = handlesByConnection.find(connectionId);
+    if (conn != handlesByConnection.end())
     {
-        it->second.removeString(connectionId);
-        if (it->second.isEmpty())
-            subscriptions.erase(it);
-        DBG("OSCQueryServer: IGNORE " << path << " from " << connectionId);
+        auto& handles = conn->second;
+        handles.erase(std::remove(handles.begin(), handles.end(), handle), handles.end());
+        if (handles.empty())
+            handlesByConnection.erase(conn);
     }
+    DBG("OSCQueryServer: IGNORE " << path << " from " << connectionId);
 }
 
 void OSCQueryServer::removeAllSubscriptions(const juce::String& connectionId)
 {
-    const juce::ScopedLock sl(subscriptionLock);
+    const juce::ScopedLock sl(namespaceLock);
 
-    for (auto it = subscriptions.begin(); it != subscriptions.end(); )
-    {
-        it->second.removeString(connectionId);
-        if (it->second.isEmpty())
-            it = subscriptions.erase(it);
-        else
-            ++it;
-    }
+    auto conn = handlesByConnection.find(connectionId);
+    if (conn == handlesByConnection.end())
+        return;
+
+    for (const int handle : conn->second)
+        params[static_cast<size_t>(handle)].listeners.removeString(connectionId);
+    handlesByConnection.erase(conn);
 }
 
 //==============================================================================
 // Value Change Push (binary OSC via WebSocket)
 //==============================================================================
 
-void OSCQueryServer::pushValueChange(const juce::String& oscPath, const juce::var& value,
-                                     const juce::String& skipIP)
+namespace
 {
-    if (!wsServer || !running.load())
-        return;
-
-    // Build raw OSC packet manually (address + type tag + argument, all 4-byte aligned)
-    juce::MemoryOutputStream stream;
-
-    // Address
-    auto addressStr = oscPath.toStdString();
-    stream.write(addressStr.c_str(), addressStr.size() + 1);
-    // Pad to 4-byte boundary
-    while (stream.getDataSize() % 4 != 0)
-        stream.writeByte(0);
-
-    // Type tag
-    if (value.isInt() || value.isInt64())
+    void writeBigEndian32(juce::MemoryOutputStream& stream, uint32_t v)
     {
-        stream.write(",i\0\0", 4);
-        // Write int32 big-endian
-        int32_t v = (int32_t)(int)value;
-        uint8_t bytes[4] = {
+        const uint8_t bytes[4] = {
             (uint8_t)((v >> 24) & 0xFF), (uint8_t)((v >> 16) & 0xFF),
             (uint8_t)((v >> 8) & 0xFF),  (uint8_t)(v & 0xFF)
         };
         stream.write(bytes, 4);
     }
-    else if (value.isString())
+
+    void padTo4(juce::MemoryOutputStream& stream)
     {
-        stream.write(",s\0\0", 4);
-        auto str = value.toString().toStdString();
-        stream.write(str.c_str(), str.size() + 1);
         while (stream.getDataSize() % 4 != 0)
             stream.writeByte(0);
     }
-    else
+
+    /** Raw OSC message: address + type tag + one argument, all 4-byte aligned */
+    juce::MemoryBlock encodeOSCMessage(const juce::String& oscPath, const juce::var& value)
     {
-        // Float
-        stream.write(",f\0\0", 4);
-        float fv = (float)value;
-        uint32_t bits;
-        std::memcpy(&bits, &fv, 4);
-        uint8_t bytes[4] = {
-            (uint8_t)((bits >> 24) & 0xFF), (uint8_t)((bits >> 16) & 0xFF),
-            (uint8_t)((bits >> 8) & 0xFF),  (uint8_t)(bits & 0xFF)
-        };
-        stream.write(bytes, 4);
+        juce::MemoryOutputStream stream;
+
+        auto addressStr = oscPath.toStdString();
+        stream.write(addressStr.c_str(), addressStr.size() + 1);
+        padTo4(stream);
+
+        if (value.isInt() || value.isInt64())
+        {
+            stream.write(",i\0\0", 4);
+            writeBigEndian32(stream, (uint32_t)(int32_t)(int)value);
+        }
+        else if (value.isString())
+        {
+            stream.write(",s\0\0", 4);
+            auto str = value.toString().toStdString();
+            stream.write(str.c_str(), str.size() + 1);
+            padTo4(stream);
+        }
+        else
+        {
+            // Float
+            stream.write(",f\0\0", 4);
+            float fv = (float)value;
+            uint32_t bits;
+            std::memcpy(&bits, &fv, 4);
+            writeBigEndian32(stream, bits);
+        }
+
+        return stream.getMemoryBlock();
     }
 
-    juce::MemoryBlock oscData(stream.getData(), stream.getDataSize());
+    /** One connection's share of a flush. A single message goes out bare (what
+        clients predating the batching expect); more become one OSC bundle. */
+    struct ConnectionBatch
+    {
+        juce::String connectionId;
+        juce::MemoryOutputStream elements;   // [int32 size][message]...
+        const juce::MemoryBlock* first = nullptr;
+        int numMessages = 0;
 
-    // Send to all subscribed connections, skipping the IP that sent the OSC
-    juce::StringArray listeners;
+        void add(const juce::MemoryBlock& message)
+        {
+            if (numMessages++ == 0)
+                first = &message;
+            writeBigEndian32(elements, (uint32_t)message.getSize());
+            elements.write(message.getData(), message.getSize());
+        }
+
+        juce::MemoryBlock finish() const
+        {
+            if (numMessages == 1)
+                return *first;
+
+            juce::MemoryOutputStream bundle;
+            bundle.write("#bundle\0", 8);
+            writeBigEndian32(bundle, 0);
+            writeBigEndian32(bundle, 1);   // Time tag: immediately
+            bundle.write(elements.getData(), elements.getDataSize());
+            return bundle.getMemoryBlock();
+        }
+    };
+
+    bool isSenderConnection(const juce::String& connId, const juce::String& skipIP)
     {
-        const juce::ScopedLock sl(subscriptionLock);
-        auto it = subscriptions.find(oscPath);
-        if (it != subscriptions.end())
-            listeners = it->second;
+        // connId is "IP:port" — extract IP part and compare
+        if (skipIP.isEmpty())
+            return false;
+        juce::String connIP = connId.upToLastOccurrenceOf(":", false, true);
+        if (connIP.startsWith("::ffff:"))
+            connIP = connIP.substring(7);
+        return connIP == skipIP;
     }
+}
 
-    for (const auto& connId : listeners)
+void OSCQueryServer::flushPendingPushes()
+{
+    struct Flushed { juce::String oscPath; juce::var value; juce::String skipIP; juce::StringArray listeners; };
+    std::vector<Flushed> toFlush;
     {
-        // connId is "IP:port" — extract IP part and compare
-        if (skipIP.isNotEmpty())
+        const juce::ScopedLock sl(namespaceLock);
+        if (pendingPushes.empty())
+            return;
+
+        toFlush.reserve(pendingPushes.size());
+        for (const auto& pending : pendingPushes)
         {
-            juce::String connIP = connId.upToLastOccurrenceOf(":", false, true);
-            if (connIP.startsWith("::ffff:"))
-                connIP = connIP.substring(7);
-            if (connIP == skipIP)
-                continue;  // Skip — this client sent the OSC that caused this change
+            auto& slot = params[static_cast<size_t>(pending.handle)];
+            slot.pendingIndex = -1;
+            if (!slot.listeners.isEmpty())
+                toFlush.push_back({ slot.oscPath, pending.value, pending.skipIP, slot.listeners });
         }
-        wsServer->sendTo(oscData, connId);
+        pendingPushes.clear();
     }
+
+    // Encode each message once, then gather per connection, skipping the IP
+    // whose OSC write caused the change
+    std::vector<juce::MemoryBlock> messages;
+    messages.reserve(toFlush.size());
+    std::vector<std::unique_ptr<ConnectionBatch>> batches;
+
+    for (const auto& change : toFlush)
+    {
+        messages.push_back(encodeOSCMessage(change.oscPath, change.value));
+        const auto& message = messages.back();
+
+        for (const auto& connId : change.listeners)
+        {
+            if (isSenderConnection(connId, change.skipIP))
+                continue;
+
+            auto batch = std::find_if(batches.begin(), batches.end(),
+                                      [&connId](const auto& b) { return b->connectionId == connId; });
+            if (batch == batches.end())
+            {
+                batches.push_back(std::make_unique<ConnectionBatch>());
+                batches.back()->connectionId = connId;
+                batch = batches.end() - 1;
+            }
+            (*batch)->add(message);
+        }
+    }
+
+    for (const auto& batch : batches)
+        wsServer->sendTo(batch->finish(), batch->connectionId);
 }
 
 //==============================================================================
@@ -380,34 +551,40 @@ const std::map<juce::Identifier, OSCQueryServer::ReverseEntry>& OSCQueryServer::
     if (!built)
     {
         for (const auto& [name, id] : OSCMessageRouter::getInputAddressMap())
-            reverseMap[id] = { name, "input" };
+            reverseMap[id] = { name, "input", 0 };
         for (const auto& [name, id] : OSCMessageRouter::getOutputAddressMap())
-            reverseMap[id] = { name, "output" };
+            reverseMap[id] = { name, "output", 0 };
         for (const auto& [name, id] : OSCMessageRouter::getReverbAddressMap())
-            reverseMap[id] = { name, "reverb" };
+            reverseMap[id] = { name, "reverb", 0 };
         // Config params use full paths — store differently
         for (const auto& [fullPath, id] : OSCMessageRouter::getConfigAddressMap())
-            reverseMap[id] = { fullPath, "config" };
+            reverseMap[id] = { fullPath, "config", 0 };
+
+        int ordinal = 0;
+        for (auto& [id, entry] : reverseMap)
+            entry.ordinal = ordinal++;
         built = true;
     }
 
     return reverseMap;
 }
 
-juce::String OSCQueryServer::resolveOSCPath(const juce::ValueTree& tree,
-                                             const juce::Identifier& property) const
+bool OSCQueryServer::resolveParamKey(const juce::ValueTree& tree,
+                                     const juce::Identifier& property,
+                                     juce::uint64& key) const
 {
     const auto& reverseMap = getReverseMap();
     auto it = reverseMap.find(property);
     if (it == reverseMap.end())
-        return {};
+        return false;
 
     const auto& entry = it->second;
 
     if (entry.category == "config")
     {
-        // Config params use the full OSC path directly
-        return entry.oscName;
+        // Config params are global: one path each
+        key = makeParamKey(entry.ordinal, -1);
+        return true;
     }
 
     // The tree hierarchy is: Root > Inputs/Outputs/Reverbs > Channel_N > SubSection > property
@@ -415,7 +592,6 @@ juce::String OSCQueryServer::resolveOSCPath(const juce::ValueTree& tree,
     // Walk up to find the category container and channel index.
     auto current = tree;
 
-
     while (current.isValid())
     {
         auto parent = current.getParent();
@@ -425,119 +601,243 @@ juce::String OSCQueryServer::resolveOSCPath(const juce::ValueTree& tree,
         juce::String parentType = parent.getType().toString();
         if (parentType == "Inputs" || parentType == "Outputs" || parentType == "Reverbs")
         {
-            int channelIndex = parent.indexOf(current);
-            return "/wfs/" + entry.category + "/" + juce::String(channelIndex + 1) + "/" + entry.oscName;
+            key = makeParamKey(entry.ordinal, parent.indexOf(current));
+            return true;
         }
 
         current = parent;
     }
 
-    return {};
+    return false;
 }
 
 //==============================================================================
-// ValueTree::Listener — Push Changes
+// Cached Namespace
 //==============================================================================
 
-void OSCQueryServer::timerCallback()
+void OSCQueryServer::registerNodes(Category category, const std::vector<NodeRef>& refs)
 {
-    if (!running.load() || !wsServer)
-        return;
-
-    // Drain all pending pushes
-    std::map<juce::String, PendingPush> toDrain;
+    // Drop the category's old nodes (a shrunk channel count leaves slots without one)
+    for (size_t i = 0; i < params.size(); ++i)
     {
-        const juce::ScopedLock sl(pendingPushLock);
-        if (pendingPushes.empty())
-            return;
-        toDrain.swap(pendingPushes);
+        if (paramCategories[i] == category)
+        {
+            params[i].node = nullptr;
+            params[i].hasValue = false;
+        }
     }
 
-    for (const auto& [path, pending] : toDrain)
-        pushValueChange(pending.oscPath, pending.value, pending.skipIP);
+    for (const auto& ref : refs)
+    {
+        const int handle = internPath(ref.oscPath);
+        auto& slot = params[static_cast<size_t>(handle)];
+        if (paramCategories[static_cast<size_t>(handle)] == numCategories)
+        {
+            paramCategories[static_cast<size_t>(handle)] = category;
+            handlesByKey.emplace(ref.key, handle);
+        }
+        slot.node = ref.node;
+        slot.hasValue = ref.hasValue;
+    }
 }
 
-void OSCQueryServer::valueTreePropertyChanged(juce::ValueTree& tree,
-                                              const juce::Identifier& property)
+void OSCQueryServer::rebuildNamespace()
 {
-    if (!running.load() || !wsServer)
-        return;
+    NodeRefsByCategory refs;
+    juce::DynamicObject::Ptr root(buildFullTree(refs));
+
+    const juce::ScopedLock sl(namespaceLock);
+    namespaceRoot = root;
+    wfsContents = root->getProperty("CONTENTS").getDynamicObject()
+                      ->getProperty("wfs").getDynamicObject()
+                      ->getProperty("CONTENTS").getDynamicObject();
+
+    for (int c = 0; c < numCategories; ++c)
+        registerNodes(static_cast<Category>(c), refs[static_cast<size_t>(c)]);
+
+    // Wall-clock seed: an ETag cached against a previous run never matches
+    if (structureVersion == 0)
+        structureVersion = static_cast<juce::uint64>(juce::Time::currentTimeMillis());
+    ++structureVersion;
+    categoryDirty.fill(false);
+}
 
-    // Quick check: any subscriptions at all?
+void OSCQueryServer::rebuildDirtyCategories()
+{
+    for (int c = 0; c < numCategories; ++c)
     {
-        const juce::ScopedLock sl(subscriptionLock);
-        if (subscriptions.empty())
+        if (!categoryDirty[static_cast<size_t>(c)])
+            continue;
+        categoryDirty[static_cast<size_t>(c)] = false;
+
+        const auto category = static_cast<Category>(c);
+        std::vector<NodeRef> refs;
+        juce::var container(buildCategoryJson(category, refs));
+
+        const juce::ScopedLock sl(namespaceLock);
+        if (wfsContents == nullptr)
             return;
+        wfsContents->setProperty(categoryNames[c], container);
+        registerNodes(category, refs);
+        ++structureVersion;
     }
+}
 
-    // Resolve to OSC path
-    juce::String oscPath = resolveOSCPath(tree, property);
-    if (oscPath.isEmpty())
+void OSCQueryServer::markStructureDirty(const juce::ValueTree& parent, const juce::ValueTree& child)
+{
+    auto categoryOf = [](const juce::ValueTree& t) -> int
+    {
+        const auto type = t.getType().toString();
+        if (type == "Inputs")  return CategoryInput;
+        if (type == "Outputs") return CategoryOutput;
+        if (type == "Reverbs") return CategoryReverb;
+        return -1;
+    };
+
+    // A whole category container swapped in under the root
+    if (const int c = categoryOf(child); c >= 0)
+    {
+        categoryDirty[static_cast<size_t>(c)] = true;
         return;
+    }
 
-    // Check if anyone is subscribed to this path
+    // Anything inside a channel (channel added/removed, subsection replaced)
+    for (auto t = parent; t.isValid(); t = t.getParent())
     {
-        const juce::ScopedLock sl(subscriptionLock);
-        if (subscriptions.find(oscPath) == subscriptions.end())
+        if (const int c = categoryOf(t); c >= 0)
+        {
+            categoryDirty[static_cast<size_t>(c)] = true;
             return;
+        }
     }
 
-    // Accumulate for throttled push — latest value per path wins. Capture the
-    // origin IP NOW (the write happens inside the sender's begin/endIncomingOSC
-    // window on the message thread); reading it at flush time would race the
-    // window closing and echo the value back to its sender.
-    juce::var value = tree.getProperty(property);
-    {
-        const juce::ScopedLock sl(pendingPushLock);
-        pendingPushes[oscPath] = { oscPath, value, getCurrentOriginIP() };
-    }
+    // Outside the channel containers: config sections
+    categoryDirty[CategoryConfig] = true;
 }
 
-void OSCQueryServer::valueTreeChildAdded(juce::ValueTree& parent, juce::ValueTree& /*child*/)
+void OSCQueryServer::notifyPathChange(const juce::ValueTree& parent, int index, bool added)
 {
-    if (!running.load() || !wsServer)
+    juce::String parentType = parent.getType().toString();
+    juce::String containerPath;
+    if (parentType == "Inputs")       containerPath = "/wfs/input";
+    else if (parentType == "Outputs") containerPath = "/wfs/output";
+    else if (parentType == "Reverbs") containerPath = "/wfs/reverb";
+
+    if (containerPath.isEmpty())
         return;
 
-    // Notify all WebSocket clients of structure change
-    juce::String parentType = parent.getType().toString();
-    juce::String pathChanged;
-    if (parentType == "Inputs")       pathChanged = "/wfs/input";
-    else if (parentType == "Outputs") pathChanged = "/wfs/output";
-    else if (parentType == "Reverbs") pathChanged = "/wfs/reverb";
+    // Channels are numbered by position: a change at the end adds/removes one
+    // path, anywhere else it renumbers the container
+    const int numChannels = parent.getNumChildren();
+    const bool atEnd = added ? (index == numChannels - 1) : (index == numChannels);
 
-    if (pathChanged.isNotEmpty())
+    auto* cmd = new juce::DynamicObject();
+    if (atEnd)
+    {
+        cmd->setProperty("COMMAND", added ? "PATH_ADDED" : "PATH_REMOVED");
+        cmd->setProperty("DATA", containerPath + "/" + juce::String(index + 1));
+    }
+    else
     {
-        auto* cmd = new juce::DynamicObject();
         cmd->setProperty("COMMAND", "PATH_CHANGED");
-        cmd->setProperty("DATA", pathChanged);
-        wsServer->send(juce::JSON::toString(juce::var(cmd), false));
+        cmd->setProperty("DATA", containerPath);
     }
+    wsServer->send(juce::JSON::toString(juce::var(cmd), false));
 }
 
-void OSCQueryServer::valueTreeChildRemoved(juce::ValueTree& parent, juce::ValueTree& /*child*/, int /*index*/)
+//==============================================================================
+// ValueTree::Listener — Push Changes
+//==============================================================================
+
+void OSCQueryServer::timerCallback()
 {
     if (!running.load() || !wsServer)
         return;
 
-    juce::String parentType = parent.getType().toString();
-    juce::String pathChanged;
-    if (parentType == "Inputs")       pathChanged = "/wfs/input";
-    else if (parentType == "Outputs") pathChanged = "/wfs/output";
-    else if (parentType == "Reverbs") pathChanged = "/wfs/reverb";
+    rebuildDirtyCategories();
+    flushPendingPushes();
+}
 
-    if (pathChanged.isNotEmpty())
+void OSCQueryServer::valueTreePropertyChanged(juce::ValueTree& tree,
+                                              const juce::Identifier& property)
+{
+    if (!running.load() || !wsServer)
+        return;
+
+    juce::uint64 key = 0;
+    if (!resolveParamKey(tree, property, key))
+        return;
+
+    juce::var value;
+    const juce::ScopedLock sl(namespaceLock);
+
+    auto range = handlesByKey.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it)
     {
-        auto* cmd = new juce::DynamicObject();
-        cmd->setProperty("COMMAND", "PATH_CHANGED");
-        cmd->setProperty("DATA", pathChanged);
-        wsServer->send(juce::JSON::toString(juce::var(cmd), false));
+        auto& slot = params[static_cast<size_t>(it->second)];
+        if (value.isVoid())
+            value = tree.getProperty(property);
+
+        // Patch the cached namespace in place
+        if (slot.node != nullptr && slot.hasValue)
+        {
+            juce::Array<juce::var> valueArr;
+            valueArr.add(value);
+            slot.node->setProperty("VALUE", valueArr);
+            ++valueVersion;
+        }
+
+        if (slot.listeners.isEmpty())
+            continue;
+
+        // Accumulate for throttled push — latest value per handle wins. Capture
+        // the origin IP NOW (the write happens inside the sender's
+        // begin/endIncomingOSC window on the message thread); reading it at
+        // flush time would race the window closing and echo the value back
+        // to its sender.
+        PendingPush push { it->second, value, getCurrentOriginIP() };
+        if (slot.pendingIndex >= 0)
+        {
+            pendingPushes[static_cast<size_t>(slot.pendingIndex)] = std::move(push);
+        }
+        else
+        {
+            slot.pendingIndex = static_cast<int>(pendingPushes.size());
+            pendingPushes.push_back(std::move(push));
+        }
     }
 }
 
+void OSCQueryServer::valueTreeChildAdded(juce::ValueTree& parent, juce::ValueTree& child)
+{
+    if (!running.load() || !wsServer)
+        return;
+
+    // Rebuilt on the next timer tick, however many children a load adds
+    markStructureDirty(parent, child);
+    notifyPathChange(parent, parent.indexOf(child), true);
+}
+
+void OSCQueryServer::valueTreeChildRemoved(juce::ValueTree& parent, juce::ValueTree& child, int index)
+{
+    if (!running.load() || !wsServer)
+        return;
+
+    markStructureDirty(parent, child);
+    notifyPathChange(parent, index, false);
+}
+
 //==============================================================================
 // HOST_INFO
 //==============================================================================
 
+void OSCQueryServer::setLocalControlRing(const juce::String& segmentPath, juce::uint32 session)
+{
+    const juce::SpinLock::ScopedLockType sl(localControlLock);
+    localControlPath = segmentPath;
+    localControlSession = session;
+}
+
 juce::String OSCQueryServer::buildHostInfoJson()
 {
     auto* obj = new juce::DynamicObject();
@@ -556,6 +856,17 @@ juce::String OSCQueryServer::buildHostInfoJson()
     ext->setProperty("LISTEN", true);
     obj->setProperty("EXTENSIONS", juce::var(ext));
 
+    {
+        const juce::SpinLock::ScopedLockType sl(localControlLock);
+        if (localControlPath.isNotEmpty())
+        {
+            auto* local = new juce::DynamicObject();
+            local->setProperty("PATH", localControlPath);
+            local->setProperty("SESSION", static_cast<juce::int64>(localControlSession));
+            obj->setProperty("LOCAL_CONTROL", juce::var(local));
+        }
+    }
+
     return juce::JSON::toString(juce::var(obj), false);
 }
 
@@ -607,6 +918,17 @@ juce::DynamicObject* OSCQueryServer::makeParamNode(const juce::String& fullPath,
     return node;
 }
 
+juce::var OSCQueryServer::recordNode(std::vector<NodeRef>& refs, const juce::String& fullPath,
+                                     const juce::Identifier& paramId, int channelIndex,
+                                     juce::DynamicObject* node, bool hasValue)
+{
+    const auto& reverseMap = getReverseMap();
+    auto it = reverseMap.find(paramId);
+    if (it != reverseMap.end())
+        refs.push_back({ fullPath, makeParamKey(it->second.ordinal, channelIndex), node, hasValue });
+    return juce::var(node);
+}
+
 juce::String OSCQueryServer::getOSCTypeTag(const juce::var& value)
 {
     if (value.isInt() || value.isInt64())
@@ -650,6 +972,9 @@ OSCQueryServer::ParamRange OSCQueryServer::getParamRange(const juce::Identifier&
     if (paramId == inputTrackingActive)      return { 0, 1, true };
     if (paramId == inputTrackingID)          return { (float)inputTrackingIDMin, (float)inputTrackingIDMax, true };
     if (paramId == inputTrackingSmooth)      return { (float)inputTrackingSmoothMin, (float)inputTrackingSmoothMax, true };
+    if (paramId == inputTrackingPredict)     return { (float)inputTrackingPredictMin, (float)inputTrackingPredictMax, true };
+    if (paramId == inputTrackingPredictHorizon) return { (float)inputTrackingPredictHorizonMin, (float)inputTrackingPredictHorizonMax, true };
+    if (paramId == inputTrackingPredictMaxLead) return { inputTrackingPredictMaxLeadMin, inputTrackingPredictMaxLeadMax, true };
     if (paramId == inputMaxSpeedActive)      return { 0, 1, true };
     if (paramId == inputMaxSpeed)            return { inputMaxSpeedMin, inputMaxSpeedMax, true };
     if (paramId == inputPathModeActive)      return { 0, 1, true };
@@ -862,7 +1187,7 @@ juce::String OSCQueryServer::extractAttribute(juce::DynamicObject* node, const j
 // Namespace Tree Building
 //==============================================================================
 
-juce::DynamicObject* OSCQueryServer::buildFullTree()
+juce::DynamicObject* OSCQueryServer::buildFullTree(NodeRefsByCategory& refs)
 {
     auto* root = new juce::DynamicObject();
     root->setProperty("FULL_PATH", "/");
@@ -875,42 +1200,17 @@ juce::DynamicObject* OSCQueryServer::buildFullTree()
     wfs->setProperty("ACCESS", 0);
     wfs->setProperty("DESCRIPTION", "WFS Parameters");
 
-    auto* wfsContents = new juce::DynamicObject();
+    auto* contents = new juce::DynamicObject();
 
-    // /wfs/input (1-based channel numbers, matching standard OSC convention)
+    // /wfs/input, /wfs/output, /wfs/reverb, /wfs/config
+    for (int c = 0; c < numCategories; ++c)
     {
-        auto* container = makeContainerNode("/wfs/input", "Input Channels");
-        auto* contents = container->getProperties()["CONTENTS"].getDynamicObject();
-        int count = state.getNumInputChannels();
-        for (int i = 0; i < count; ++i)
-            contents->setProperty(juce::String(i + 1), juce::var(buildInputChannelJson(i)));
-        wfsContents->setProperty("input", juce::var(container));
+        const auto category = static_cast<Category>(c);
+        contents->setProperty(categoryNames[c],
+                              juce::var(buildCategoryJson(category, refs[static_cast<size_t>(c)])));
     }
 
-    // /wfs/output
-    {
-        auto* container = makeContainerNode("/wfs/output", "Output Channels");
-        auto* contents = container->getProperties()["CONTENTS"].getDynamicObject();
-        int count = state.getNumOutputChannels();
-        for (int i = 0; i < count; ++i)
-            contents->setProperty(juce::String(i + 1), juce::var(buildOutputChannelJson(i)));
-        wfsContents->setProperty("output", juce::var(container));
-    }
-
-    // /wfs/reverb
-    {
-        auto* container = makeContainerNode("/wfs/reverb", "Reverb Channels");
-        auto* contents = container->getProperties()["CONTENTS"].getDynamicObject();
-        int count = state.getNumReverbChannels();
-        for (int i = 0; i < count; ++i)
-            contents->setProperty(juce::String(i + 1), juce::var(buildReverbChannelJson(i)));
-        wfsContents->setProperty("reverb", juce::var(container));
-    }
-
-    // /wfs/config
-    wfsContents->setProperty("config", juce::var(buildConfigJson()));
-
-    wfs->setProperty("CONTENTS", juce::var(wfsContents));
+    wfs->setProperty("CONTENTS", juce::var(contents));
 
     auto* rootContents = new juce::DynamicObject();
     rootContents->setProperty("wfs", juce::var(wfs));
@@ -919,7 +1219,42 @@ juce::DynamicObject* OSCQueryServer::buildFullTree()
     return root;
 }
 
-juce::DynamicObject* OSCQueryServer::buildInputChannelJson(int channelIndex)
+juce::DynamicObject* OSCQueryServer::buildCategoryJson(Category category, std::vector<NodeRef>& refs)
+{
+    if (category == CategoryConfig)
+        return buildConfigJson(refs);
+
+    // 1-based channel numbers, matching standard OSC convention
+    juce::DynamicObject* container = nullptr;
+    int count = 0;
+    switch (category)
+    {
+        case CategoryInput:
+            container = makeContainerNode("/wfs/input", "Input Channels");
+            count = state.getNumInputChannels();
+            break;
+        case CategoryOutput:
+            container = makeContainerNode("/wfs/output", "Output Channels");
+            count = state.getNumOutputChannels();
+            break;
+        default:
+            container = makeContainerNode("/wfs/reverb", "Reverb Channels");
+            count = state.getNumReverbChannels();
+            break;
+    }
+
+    auto* contents = container->getProperties()["CONTENTS"].getDynamicObject();
+    for (int i = 0; i < count; ++i)
+    {
+        juce::DynamicObject* channel = category == CategoryInput  ? buildInputChannelJson(i, refs)
+                                     : category == CategoryOutput ? buildOutputChannelJson(i, refs)
+                                                                  : buildReverbChannelJson(i, refs);
+        contents->setProperty(juce::String(i + 1), juce::var(channel));
+    }
+    return container;
+}
+
+juce::DynamicObject* OSCQueryServer::buildInputChannelJson(int channelIndex, std::vector<NodeRef>& refs)
 {
     juce::String basePath = "/wfs/input/" + juce::String(channelIndex + 1);
     auto* channel = makeContainerNode(basePath, "Input " + juce::String(channelIndex + 1));
@@ -935,15 +1270,15 @@ juce::DynamicObject* OSCQueryServer::buildInputChannelJson(int channelIndex)
         auto range = getParamRange(paramId);
 
         if (range.hasRange)
-            contents->setProperty(oscName, juce::var(makeParamNode(fullPath, typeTag, value, range.min, range.max, oscName)));
+            contents->setProperty(oscName, recordNode(refs, fullPath, paramId, channelIndex, makeParamNode(fullPath, typeTag, value, range.min, range.max, oscName), true));
         else
-            contents->setProperty(oscName, juce::var(makeParamNode(fullPath, typeTag, value, 0, 0, oscName)));
+            contents->setProperty(oscName, recordNode(refs, fullPath, paramId, channelIndex, makeParamNode(fullPath, typeTag, value, 0, 0, oscName), true));
     }
 
     return channel;
 }
 
-juce::DynamicObject* OSCQueryServer::buildOutputChannelJson(int channelIndex)
+juce::DynamicObject* OSCQueryServer::buildOutputChannelJson(int channelIndex, std::vector<NodeRef>& refs)
 {
     juce::String basePath = "/wfs/output/" + juce::String(channelIndex + 1);
     auto* channel = makeContainerNode(basePath, "Output " + juce::String(channelIndex + 1));
@@ -976,7 +1311,7 @@ juce::DynamicObject* OSCQueryServer::buildOutputChannelJson(int channelIndex)
                 rangeArr.add(juce::var(rangeObj1));
                 node->setProperty("RANGE", rangeArr);
             }
-            contents->setProperty(oscName, juce::var(node));
+            contents->setProperty(oscName, recordNode(refs, fullPath, paramId, channelIndex, node, false));
         }
         else
         {
@@ -985,16 +1320,16 @@ juce::DynamicObject* OSCQueryServer::buildOutputChannelJson(int channelIndex)
             auto range = getParamRange(paramId);
 
             if (range.hasRange)
-                contents->setProperty(oscName, juce::var(makeParamNode(fullPath, typeTag, value, range.min, range.max, oscName)));
+                contents->setProperty(oscName, recordNode(refs, fullPath, paramId, channelIndex, makeParamNode(fullPath, typeTag, value, range.min, range.max, oscName), true));
             else
-                contents->setProperty(oscName, juce::var(makeParamNode(fullPath, typeTag, value, 0, 0, oscName)));
+                contents->setProperty(oscName, recordNode(refs, fullPath, paramId, channelIndex, makeParamNode(fullPath, typeTag, value, 0, 0, oscName), true));
         }
     }
 
     return channel;
 }
 
-juce::DynamicObject* OSCQueryServer::buildReverbChannelJson(int channelIndex)
+juce::DynamicObject* OSCQueryServer::buildReverbChannelJson(int channelIndex, std::vector<NodeRef>& refs)
 {
     juce::String basePath = "/wfs/reverb/" + juce::String(channelIndex + 1);
     auto* channel = makeContainerNode(basePath, "Reverb " + juce::String(channelIndex + 1));
@@ -1027,7 +1362,7 @@ juce::DynamicObject* OSCQueryServer::buildReverbChannelJson(int channelIndex)
                 rangeArr.add(juce::var(rangeObj1));
                 node->setProperty("RANGE", rangeArr);
             }
-            contents->setProperty(oscName, juce::var(node));
+            contents->setProperty(oscName, recordNode(refs, fullPath, paramId, channelIndex, node, false));
         }
         else
         {
@@ -1036,16 +1371,16 @@ juce::DynamicObject* OSCQueryServer::buildReverbChannelJson(int channelIndex)
             auto range = getParamRange(paramId);
 
             if (range.hasRange)
-                contents->setProperty(oscName, juce::var(makeParamNode(fullPath, typeTag, value, range.min, range.max, oscName)));
+                contents->setProperty(oscName, recordNode(refs, fullPath, paramId, channelIndex, makeParamNode(fullPath, typeTag, value, range.min, range.max, oscName), true));
             else
-                contents->setProperty(oscName, juce::var(makeParamNode(fullPath, typeTag, value, 0, 0, oscName)));
+                contents->setProperty(oscName, recordNode(refs, fullPath, paramId, channelIndex, makeParamNode(fullPath, typeTag, value, 0, 0, oscName), true));
         }
     }
 
     return channel;
 }
 
-juce::DynamicObject* OSCQueryServer::buildConfigJson()
+juce::DynamicObject* OSCQueryServer::buildConfigJson(std::vector<NodeRef>& refs)
 {
     auto* configContainer = makeContainerNode("/wfs/config", "System Configuration");
     auto* configContents = configContainer->getProperties()["CONTENTS"].getDynamicObject();
@@ -1098,14 +1433,14 @@ juce::DynamicObject* OSCQueryServer::buildConfigJson()
                 rangeArr.add(juce::var(rangeObj1));
                 node->setProperty("RANGE", rangeArr);
             }
-            subContents->setProperty(paramName, juce::var(node));
+            subContents->setProperty(paramName, recordNode(refs, fullOscPath, paramId, -1, node, false));
         }
         else
         {
             if (range.hasRange)
-                subContents->setProperty(paramName, juce::var(makeParamNode(fullOscPath, typeTag, value, range.min, range.max, paramName)));
+                subContents->setProperty(paramName, recordNode(refs, fullOscPath, paramId, -1, makeParamNode(fullOscPath, typeTag, value, range.min, range.max, paramName), true));
             else
-                subContents->setProperty(paramName, juce::var(makeParamNode(fullOscPath, typeTag, value, 0, 0, paramName)));
+                subContents->setProperty(paramName, recordNode(refs, fullOscPath, paramId, -1, makeParamNode(fullOscPath, typeTag, value, 0, 0, paramName), true));
         }
     }
 
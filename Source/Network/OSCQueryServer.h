@@ -4,6 +4,11 @@
 #include <juce_simpleweb/juce_simpleweb.h>
 #include "../Parameters/WFSValueTreeState.h"
 
+#include <array>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
 namespace WFSNetwork
 {
 
@@ -16,15 +21,19 @@ namespace WFSNetwork
  * Ref: https://github.com/Vidvox/OSCQueryProposal
  *
  * HTTP (query):
- * - GET / returns the full namespace tree
+ * - GET / returns the full namespace tree (built once, patched in place)
  * - GET /wfs/input/0/positionX returns a specific node
  * - GET /path?HOST_INFO returns server metadata
  * - GET /path?VALUE|TYPE|RANGE|ACCESS|DESCRIPTION|CLIPMODE returns a single attribute
+ * - Responses carry an ETag: structure + value version for bodies with VALUE
+ *   fields (node trees, ?VALUE), structure only for the other attributes;
+ *   If-None-Match answers 304 (unknown paths are still 404)
  *
  * WebSocket (subscription):
  * - LISTEN: client subscribes to value changes on a path
  * - IGNORE: client unsubscribes
- * - Server pushes binary OSC packets for subscribed parameters
+ * - Server pushes binary OSC for subscribed parameters: one frame per
+ *   connection per flush, a bundle when it holds more than one message
  * - Server sends PATH_CHANGED/PATH_ADDED/PATH_REMOVED notifications
  */
 class OSCQueryServer : public SimpleWebSocketServerBase::RequestHandler,
@@ -50,6 +59,10 @@ public:
     /** Call after applying the incoming OSC write */
     void endIncomingOSC();
 
+    /** Advertise the same-host plugin transport segment in HOST_INFO
+        (LOCAL_CONTROL: PATH, SESSION); an empty path withdraws it. */
+    void setLocalControlRing(const juce::String& segmentPath, juce::uint32 session);
+
 
 private:
     // --- HTTP Request Handler (SimpleWebSocketServerBase::RequestHandler) ---
@@ -64,15 +77,32 @@ private:
 
     // --- HTTP Response Helpers ---
     void sendJsonResponse(std::shared_ptr<HttpServer::Response> response,
-                          int statusCode, const juce::String& body);
+                          int statusCode, const juce::String& body,
+                          const juce::String& etag = {});
+
+    // --- Namespace categories (one cached container each under /wfs) ---
+    enum Category { CategoryInput = 0, CategoryOutput, CategoryReverb, CategoryConfig, numCategories };
+
+    /** A parameter node created by a builder, registered with its handle
+        once the new container is swapped into the cached namespace. */
+    struct NodeRef
+    {
+        juce::String oscPath;
+        juce::uint64 key;                 // See makeParamKey()
+        juce::DynamicObject::Ptr node;
+        bool hasValue;                    // false for band-indexed ("if") nodes
+    };
 
-    // --- JSON Builders (reused from previous implementation) ---
+    using NodeRefsByCategory = std::array<std::vector<NodeRef>, numCategories>;
+
+    // --- JSON Builders (message thread; values read from the state) ---
     juce::String buildHostInfoJson();
-    juce::DynamicObject* buildFullTree();
-    juce::DynamicObject* buildInputChannelJson(int channelIndex);
-    juce::DynamicObject* buildOutputChannelJson(int channelIndex);
-    juce::DynamicObject* buildReverbChannelJson(int channelIndex);
-    juce::DynamicObject* buildConfigJson();
+    juce::DynamicObject* buildFullTree(NodeRefsByCategory& refs);
+    juce::DynamicObject* buildCategoryJson(Category category, std::vector<NodeRef>& refs);
+    juce::DynamicObject* buildInputChannelJson(int channelIndex, std::vector<NodeRef>& refs);
+    juce::DynamicObject* buildOutputChannelJson(int channelIndex, std::vector<NodeRef>& refs);
+    juce::DynamicObject* buildReverbChannelJson(int channelIndex, std::vector<NodeRef>& refs);
+    juce::DynamicObject* buildConfigJson(std::vector<NodeRef>& refs);
 
     static juce::DynamicObject* makeParamNode(const juce::String& fullPath,
                                                const juce::String& type,
@@ -82,6 +112,9 @@ private:
     static juce::DynamicObject* makeContainerNode(const juce::String& fullPath,
                                                     const juce::String& description);
     static juce::String getOSCTypeTag(const juce::var& value);
+    static juce::var recordNode(std::vector<NodeRef>& refs, const juce::String& fullPath,
+                                const juce::Identifier& paramId, int channelIndex,
+                                juce::DynamicObject* node, bool hasValue);
 
     struct ParamRange { float min; float max; bool hasRange; };
     static ParamRange getParamRange(const juce::Identifier& paramId);
@@ -93,9 +126,56 @@ private:
     void handleIgnoreCommand(const juce::String& connectionId, const juce::String& path);
     void removeAllSubscriptions(const juce::String& connectionId);
 
-    // subscriptions: OSC path -> set of connection IDs
-    std::map<juce::String, juce::StringArray> subscriptions;
-    juce::CriticalSection subscriptionLock;
+    // --- Parameter handles ---
+    // Every parameter path gets a stable integer handle the first time the
+    // namespace builds it or a client LISTENs to it. Subscriptions, pending
+    // pushes and the cached namespace's value nodes are all indexed by it;
+    // handles survive channel count changes (a removed channel's slots just
+    // lose their node).
+    struct ParamSlot
+    {
+        juce::String oscPath;
+        juce::DynamicObject::Ptr node;    // Node in the cached namespace, null when absent
+        bool hasValue = false;
+        juce::StringArray listeners;      // Connection IDs
+        int pendingIndex = -1;            // Into pendingPushes, -1 when none
+    };
+
+    static juce::uint64 makeParamKey(int ordinal, int channelIndex)
+    {
+        return (static_cast<juce::uint64>(ordinal) << 16) | static_cast<juce::uint64>(channelIndex + 1);
+    }
+
+    int internPath(const juce::String& oscPath);        // Caller holds namespaceLock
+    void registerNodes(Category category, const std::vector<NodeRef>& refs);  // Caller holds namespaceLock
+    bool resolveParamKey(const juce::ValueTree& tree, const juce::Identifier& property,
+                         juce::uint64& key) const;
+
+    std::vector<ParamSlot> params;
+    std::vector<Category> paramCategories;               // Parallel to params
+    std::unordered_map<juce::String, int> handleByPath;
+    std::unordered_multimap<juce::uint64, int> handlesByKey;   // Aliases share a key
+    std::map<juce::String, std::vector<int>> handlesByConnection;
+
+    // --- Cached namespace ---
+    // Built on the message thread when the server starts, values patched in
+    // place as they change, a category container rebuilt when its channel
+    // count changes. HTTP requests clone what they serve under the lock and
+    // serialize the copy after releasing it; the full JSON text is kept while
+    // neither version moves.
+    juce::DynamicObject::Ptr namespaceRoot;
+    juce::DynamicObject::Ptr wfsContents;
+    juce::uint64 structureVersion = 0;                   // ETag: nodes added/removed
+    juce::uint64 valueVersion = 0;                       // ETag of VALUE-carrying bodies: VALUE patches
+    juce::uint64 serializedStructureVersion = 0;
+    juce::uint64 serializedValueVersion = 0;
+    juce::String namespaceJson;
+    juce::CriticalSection namespaceLock;                 // Guards everything from params down
+    std::array<bool, numCategories> categoryDirty {};    // Message thread only
+    void rebuildNamespace();
+    void rebuildDirtyCategories();
+    void markStructureDirty(const juce::ValueTree& parent, const juce::ValueTree& child);
+    void notifyPathChange(const juce::ValueTree& parent, int index, bool added);
 
     // IP of the last OSC sender — used to suppress WebSocket push-back to the same host
     juce::String lastOSCSenderIP;
@@ -109,23 +189,18 @@ private:
     juce::String getCurrentOriginIP() const;
 
     // --- Throttled Push ---
-    // Accumulate dirty paths, flush every ~30ms to avoid flooding the message queue
-    struct PendingPush { juce::String oscPath; juce::var value; juce::String skipIP; };
-    std::map<juce::String, PendingPush> pendingPushes;  // key = oscPath, latest value + origin win
-    juce::CriticalSection pendingPushLock;
+    // Accumulate changed handles (latest value + origin win, under
+    // namespaceLock), flush every ~30ms as one binary frame per connection
+    struct PendingPush { int handle; juce::var value; juce::String skipIP; };
+    std::vector<PendingPush> pendingPushes;
     void timerCallback() override;
+    void flushPendingPushes();
 
-    // --- Value Change Push ---
-    void pushValueChange(const juce::String& oscPath, const juce::var& value,
-                         const juce::String& skipIP);
-
-    // Reverse lookup: paramId -> OSC address name (built lazily)
-    struct ReverseEntry { juce::String oscName; juce::String category; /* "input","output","reverb" */ };
+    // Reverse lookup: paramId -> OSC address name (built lazily). ordinal is
+    // the parameter's part of its handle key.
+    struct ReverseEntry { juce::String oscName; juce::String category; /* "input","output","reverb","config" */ int ordinal; };
     static const std::map<juce::Identifier, ReverseEntry>& getReverseMap();
 
-    // Resolve a ValueTree property change to an OSC path
-    juce::String resolveOSCPath(const juce::ValueTree& tree, const juce::Identifier& property) const;
-
     // --- ValueTree::Listener ---
     void valueTreePropertyChanged(juce::ValueTree& tree,
                                   const juce::Identifier& property) override;
@@ -142,6 +217,10 @@ private:
     int oscPort = 0;
     int httpPort = 0;
 
+    juce::SpinLock localControlLock;     // HOST_INFO is built on the HTTP thread
+    juce::String localControlPath;
+    juce::uint32 localControlSession = 0;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(OSCQueryServer)
 };
 
@@ -0,0 +1,222 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "OSCProtocolTypes.h"
+
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <limits>
+#include <map>
+
+namespace WFSNetwork
+{
+
+/**
+ * OSCTimedScheduler
+ *
+ * Replays timetagged OSC messages (bundles with a non-immediate timetag, and
+ * timetagged local-ring records) at their timetag instead of on arrival, so
+ * a DAW automation curve sampled in the Track plugins' processBlock comes out
+ * with the spacing it was recorded with rather than the network's.
+ *
+ * Sender and app clocks are not assumed to be synchronised. Per sender the
+ * scheduler keeps the minimum of (arrival - timetag) over a rolling window:
+ * that is the sender's clock offset plus the fastest transit seen. A message
+ * is due at timetag + that offset + the playout delay, which absorbs the
+ * network and flush jitter on top of the fastest transit.
+ *
+ * Position and offset X/Y/Z ("<address> <id> <float>") are interpolated
+ * linearly between consecutive points, so the ramp between two samples is
+ * rendered at the apply rate; every other message is applied as is once due.
+ *
+ * Message thread only.
+ */
+class OSCTimedScheduler
+{
+public:
+    static constexpr size_t maxPendingMessages = 16384;
+    static constexpr double maxHoldMs = 1000.0;               // Clamp on how far ahead a message may be held
+    static constexpr double maxInterpolationGapMs = 250.0;    // Wider gaps are steps, not ramps
+    static constexpr double offsetWindowMs = 2000.0;
+
+    void setPlayoutMs (double ms) noexcept   { playoutMs = juce::jmax (0.0, ms); }
+    double getPlayoutMs() const noexcept     { return playoutMs; }
+
+    bool isEmpty() const noexcept            { return numPending == 0; }
+    size_t getNumPending() const noexcept    { return numPending; }
+
+    void clear()
+    {
+        queues.clear();
+        senders.clear();
+        numPending = 0;
+    }
+
+    /** Queues a message. Returns false when the scheduler is full; the caller
+        then applies the message immediately. */
+    bool post (const juce::OSCMessage& message, uint64_t ntpTimeTag,
+               const juce::String& senderIP, int port, ConnectionMode transport,
+               double nowMs)
+    {
+        if (numPending >= maxPendingMessages)
+            return false;
+
+        const double tagMs = ntpToMs (ntpTimeTag);
+        const double dueMs = juce::jlimit (nowMs - maxHoldMs, nowMs + maxHoldMs,
+                                           tagMs + senderOffset (senderIP, nowMs - tagMs, nowMs) + playoutMs);
+
+        auto& queue = queues[makeKey (message)];
+        queue.interpolate = isInterpolated (message);
+
+        // Points are kept in timetag order; UDP may reorder datagrams.
+        auto it = queue.points.end();
+        while (it != queue.points.begin() && std::prev (it)->dueMs > dueMs)
+            --it;
+        queue.points.insert (it, { message, senderIP, port, transport, dueMs });
+        ++numPending;
+        return true;
+    }
+
+    /** Applies everything due at nowMs: apply (message, senderIP, port, transport). */
+    template <typename ApplyFn>
+    void applyDue (double nowMs, ApplyFn&& apply)
+    {
+        for (auto it = queues.begin(); it != queues.end();)
+        {
+            auto& queue = it->second;
+            if (queue.interpolate)
+                applyInterpolated (queue, nowMs, apply);
+            else
+                applyStepped (queue, nowMs, apply);
+
+            if (queue.points.empty())
+                it = queues.erase (it);
+            else
+                ++it;
+        }
+    }
+
+private:
+    struct Point
+    {
+        juce::OSCMessage message;
+        juce::String senderIP;
+        int port = 0;
+        ConnectionMode transport = ConnectionMode::UDP;
+        double dueMs = 0.0;
+    };
+
+    struct Queue
+    {
+        std::deque<Point> points;
+        bool interpolate = false;
+        float lastApplied = std::numeric_limits<float>::quiet_NaN();
+    };
+
+    struct SenderClock
+    {
+        double currentMin = std::numeric_limits<double>::max();
+        double previousMin = std::numeric_limits<double>::max();
+        double windowStartMs = 0.0;
+    };
+
+    template <typename ApplyFn>
+    void applyStepped (Queue& queue, double nowMs, ApplyFn& apply)
+    {
+        while (! queue.points.empty() && queue.points.front().dueMs <= nowMs)
+        {
+            const auto& p = queue.points.front();
+            apply (p.message, p.senderIP, p.port, p.transport);
+            queue.points.pop_front();
+            --numPending;
+        }
+    }
+
+    template <typename ApplyFn>
+    void applyInterpolated (Queue& queue, double nowMs, ApplyFn& apply)
+    {
+        auto& points = queue.points;
+        while (points.size() >= 2 && points[1].dueMs <= nowMs)
+        {
+            points.pop_front();
+            --numPending;
+        }
+        if (points.empty() || points.front().dueMs > nowMs)
+            return;
+
+        const auto& p0 = points.front();
+        float value = p0.message[1].getFloat32();
+        if (points.size() >= 2)
+        {
+            const auto& p1 = points[1];
+            const double span = p1.dueMs - p0.dueMs;
+            if (span > 0.0 && span <= maxInterpolationGapMs)
+                value += (p1.message[1].getFloat32() - value)
+                         * static_cast<float> ((nowMs - p0.dueMs) / span);
+        }
+
+        if (value != queue.lastApplied)
+        {
+            queue.lastApplied = value;
+            apply (juce::OSCMessage (p0.message.getAddressPattern(), p0.message[0].getInt32(), value),
+                   p0.senderIP, p0.port, p0.transport);
+        }
+
+        // The last point has been reached: nothing left to ramp towards.
+        if (points.size() == 1)
+        {
+            points.pop_front();
+            --numPending;
+        }
+    }
+
+    double senderOffset (const juce::String& senderIP, double sample, double nowMs)
+    {
+        auto& clock = senders[senderIP];
+        if (nowMs - clock.windowStartMs > offsetWindowMs)
+        {
+            clock.previousMin = clock.currentMin;
+            clock.currentMin = std::numeric_limits<double>::max();
+            clock.windowStartMs = nowMs;
+        }
+        clock.currentMin = juce::jmin (clock.currentMin, sample);
+        return juce::jmin (clock.currentMin, clock.previousMin);
+    }
+
+    static double ntpToMs (uint64_t ntp) noexcept
+    {
+        // The NTP epoch is irrelevant here: the per-sender offset absorbs it.
+        return static_cast<double> (ntp >> 32) * 1000.0
+             + static_cast<double> (ntp & 0xffffffffull) * (1000.0 / 4294967296.0);
+    }
+
+    static bool isInterpolated (const juce::OSCMessage& message)
+    {
+        if (message.size() != 2 || ! message[0].isInt32() || ! message[1].isFloat32())
+            return false;
+
+        const auto address = message.getAddressPattern().toString();
+        if (! address.startsWith ("/wfs/input/"))
+            return false;
+        const auto param = address.substring (11);
+        return param == "positionX" || param == "positionY" || param == "positionZ"
+            || param == "offsetX"   || param == "offsetY"   || param == "offsetZ";
+    }
+
+    static juce::String makeKey (const juce::OSCMessage& message)
+    {
+        auto key = message.getAddressPattern().toString();
+        if (message.size() > 0 && message[0].isInt32())
+            key << ' ' << message[0].getInt32();
+        return key;
+    }
+
+    std::map<juce::String, Queue> queues;
+    std::map<juce::String, SenderClock> senders;
+    size_t numPending = 0;
+    double playoutMs = 30.0;
+};
+
+} // namespace WFSNetwork
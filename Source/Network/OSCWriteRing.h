@@ -0,0 +1,344 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace WFSNetwork
+{
+
+/** How a queued parameter write is applied once drained. */
+enum class OSCWriteKind : uint8_t
+{
+    Input,          // state.setParameter on an input channel
+    InputSpecial,   // Position (constraints), gradient layer enable, sampler set
+    Output,         // state.setParameter on an output channel
+    Reverb,         // state.setParameter on a reverb channel
+    ReverbEQ,       // Reverb pre-EQ band property (band in OSCWriteRecord::band)
+    Config,         // Global config / reverb processing sections
+    RemoteSet       // /remoteInput/<param> absolute set (Remote protocol)
+};
+
+/**
+ * One inbound parameter write. Fixed-size and trivially copyable so it can
+ * live in a preallocated ring: the parameter and the sender are integer keys
+ * into OSCWriteKeyTable, the value is a double tagged with its original type.
+ */
+struct OSCWriteRecord
+{
+    enum class ValueType : uint8_t { Double, Int, Bool };
+
+    OSCWriteKind kind = OSCWriteKind::Input;
+    ValueType valueType = ValueType::Double;
+    uint8_t band = 0;
+    uint16_t paramKey = 0;
+    uint16_t senderKey = 0;
+    int16_t channelIndex = -1;   // -1 for global (config) parameters
+    uint32_t sequence = 0;       // Queue order across the ring and its overflow (wraps)
+    double value = 0.0;
+    int64_t receiptTicks = 0;    // Arrival of the datagram (MotionLatencyTracer), 0 = unknown
+
+    juce::var getValue() const
+    {
+        switch (valueType)
+        {
+            case ValueType::Int:  return juce::var (static_cast<int> (value));
+            case ValueType::Bool: return juce::var (value != 0.0);
+            case ValueType::Double: break;
+        }
+        return juce::var (value);
+    }
+
+    /** True when this write was queued after other (wrap-safe). */
+    bool isNewerThan (const OSCWriteRecord& other) const noexcept
+    {
+        return isNewerThan (other.sequence);
+    }
+
+    /** True when this write was queued after the one stamped otherSequence
+        (wrap-safe); also used against writes that bypassed the ring. */
+    bool isNewerThan (uint32_t otherSequence) const noexcept
+    {
+        return static_cast<int32_t> (sequence - otherSequence) > 0;
+    }
+
+    /** Latest-wins identity: kind is deliberately not part of it, so an OSC
+        and a Remote write to the same input parameter coalesce to the newer. */
+    uint64_t getCoalesceKey() const noexcept
+    {
+        return makeCoalesceKey (paramKey, channelIndex, band);
+    }
+
+    static uint64_t makeCoalesceKey (uint16_t paramKey, int16_t channelIndex, uint8_t band) noexcept
+    {
+        return (static_cast<uint64_t> (paramKey) << 24)
+             | (static_cast<uint64_t> (static_cast<uint16_t> (channelIndex + 1)) << 8)
+             | band;
+    }
+};
+
+static_assert (std::is_trivially_copyable_v<OSCWriteRecord>, "OSCWriteRecord must stay POD");
+
+//==============================================================================
+/**
+ * OSCWriteRing
+ *
+ * Bounded multi-producer / single-consumer ring of OSCWriteRecord (Vyukov's
+ * sequence-per-cell queue). push() is lock-free and never allocates, so the
+ * OSC receiver threads and the message thread can all produce; pop() is only
+ * called from the drain on the message thread. A full ring rejects the push
+ * and the caller counts the drop.
+ */
+class OSCWriteRing
+{
+public:
+    explicit OSCWriteRing (int capacityPowerOfTwo)
+        : capacity (static_cast<size_t> (juce::nextPowerOfTwo (juce::jmax (2, capacityPowerOfTwo)))),
+          mask (capacity - 1),
+          cells (new Cell[capacity])
+    {
+        for (size_t i = 0; i < capacity; ++i)
+            cells[i].sequence.store (i, std::memory_order_relaxed);
+    }
+
+    bool push (const OSCWriteRecord& record) noexcept
+    {
+        Cell* cell = nullptr;
+        size_t pos = enqueuePos.load (std::memory_order_relaxed);
+
+        for (;;)
+        {
+            cell = &cells[pos & mask];
+            const size_t seq = cell->sequence.load (std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t> (seq) - static_cast<std::intptr_t> (pos);
+
+            if (diff == 0)
+            {
+                if (enqueuePos.compare_exchange_weak (pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+            {
+                return false;   // Full
+            }
+            else
+            {
+                pos = enqueuePos.load (std::memory_order_relaxed);
+            }
+        }
+
+        cell->record = record;
+        cell->sequence.store (pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** Single consumer only. */
+    bool pop (OSCWriteRecord& out) noexcept
+    {
+        Cell& cell = cells[dequeuePos & mask];
+        const size_t seq = cell.sequence.load (std::memory_order_acquire);
+        if (static_cast<std::intptr_t> (seq) - static_cast<std::intptr_t> (dequeuePos + 1) < 0)
+            return false;   // Empty (or the producer has not finished writing this cell)
+
+        out = cell.record;
+        cell.sequence.store (dequeuePos + capacity, std::memory_order_release);
+        ++dequeuePos;
+        return true;
+    }
+
+    int getCapacity() const noexcept { return static_cast<int> (capacity); }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence { 0 };
+        OSCWriteRecord record;
+    };
+
+    const size_t capacity;
+    const size_t mask;
+    std::unique_ptr<Cell[]> cells;
+    alignas (64) std::atomic<size_t> enqueuePos { 0 };
+    alignas (64) size_t dequeuePos = 0;
+
+    JUCE_DECLARE_NON_COPYABLE (OSCWriteRing)
+};
+
+//==============================================================================
+/**
+ * OSCWriteKeyTable
+ *
+ * Integer keys for OSCWriteRecord. Parameters are registered once at startup
+ * from the router's address maps and looked up by the Identifier's pooled
+ * string pointer. Sender IPs are interned on first sight into a small fixed
+ * table: lookups are lock-free, appends take a spin lock and publish the new
+ * count afterwards. Key 0 means "unknown sender" (no OSCQuery echo
+ * suppression), which is also what a full table degrades to.
+ */
+class OSCWriteKeyTable
+{
+public:
+    static constexpr int maxSenders = 64;
+
+    /** Build phase only (before any producer runs). Returns the key, or -1 when full. */
+    int addParam (const juce::Identifier& paramId)
+    {
+        if (paramId.isNull())
+            return -1;
+        if (const int existing = findParam (paramId); existing >= 0)
+            return existing;
+        if (params.size() >= 0xffff)
+            return -1;
+
+        const auto key = static_cast<uint16_t> (params.size());
+        params.push_back (paramId);
+        paramKeys.emplace (paramId.getCharPointer().getAddress(), key);
+        return key;
+    }
+
+    int findParam (const juce::Identifier& paramId) const noexcept
+    {
+        const auto it = paramKeys.find (paramId.getCharPointer().getAddress());
+        return it != paramKeys.end() ? static_cast<int> (it->second) : -1;
+    }
+
+    const juce::Identifier& getParam (int key) const noexcept  { return params[static_cast<size_t> (key)]; }
+    int getNumParams() const noexcept                          { return static_cast<int> (params.size()); }
+
+    int internSender (const juce::String& senderIP) noexcept
+    {
+        if (senderIP.isEmpty())
+            return 0;
+        if (const int key = findSender (senderIP); key > 0)
+            return key;
+
+        const juce::SpinLock::ScopedLockType lock (senderAppendLock);
+        if (const int key = findSender (senderIP); key > 0)
+            return key;
+
+        const int count = numSenders.load (std::memory_order_relaxed);
+        if (count >= maxSenders)
+            return 0;
+
+        senders[static_cast<size_t> (count)] = senderIP;
+        numSenders.store (count + 1, std::memory_order_release);
+        return count;
+    }
+
+    juce::String getSender (int key) const
+    {
+        return (key > 0 && key < numSenders.load (std::memory_order_acquire))
+                   ? senders[static_cast<size_t> (key)] : juce::String();
+    }
+
+private:
+    int findSender (const juce::String& senderIP) const noexcept
+    {
+        const int count = numSenders.load (std::memory_order_acquire);
+        for (int i = 1; i < count; ++i)
+            if (senders[static_cast<size_t> (i)] == senderIP)
+                return i;
+        return 0;
+    }
+
+    std::vector<juce::Identifier> params;
+    std::unordered_map<const void*, uint16_t> paramKeys;
+
+    std::array<juce::String, maxSenders> senders;
+    std::atomic<int> numSenders { 1 };   // Slot 0 is the unknown sender
+    juce::SpinLock senderAppendLock;
+};
+
+//==============================================================================
+/**
+ * OSCWriteCoalescer
+ *
+ * Drain-side latest-wins table. add() keeps the newest record (by sequence)
+ * per coalesce key in a flat open-addressed array (generation-stamped, so
+ * clear() is O(1)) and preserves first-arrival order, so unrelated writes
+ * apply in the order they were received. Capacity must exceed the number of
+ * records added per drain.
+ */
+class OSCWriteCoalescer
+{
+public:
+    explicit OSCWriteCoalescer (int maxRecordsPerDrain)
+        : tableMask (static_cast<size_t> (juce::nextPowerOfTwo (juce::jmax (2, maxRecordsPerDrain) * 2)) - 1),
+          slots (tableMask + 1)
+    {
+        latest.reserve (static_cast<size_t> (maxRecordsPerDrain));
+    }
+
+    /** Returns true when the key was already present: one of the two writes
+        was superseded (an older record arriving late is discarded). */
+    bool add (const OSCWriteRecord& record) noexcept
+    {
+        const uint64_t key = record.getCoalesceKey();
+        size_t i = static_cast<size_t> ((key * 0x9E3779B97F4A7C15ull) >> 40) & tableMask;
+
+        for (;; i = (i + 1) & tableMask)
+        {
+            auto& slot = slots[i];
+            if (slot.generation != generation)
+            {
+                slot = { key, static_cast<uint32_t> (latest.size()), generation };
+                latest.push_back (record);
+                return false;
+            }
+            if (slot.key == key)
+            {
+                if (record.isNewerThan (latest[slot.index]))
+                    latest[slot.index] = record;
+                return true;
+            }
+        }
+    }
+
+    const std::vector<OSCWriteRecord>& getLatest() const noexcept { return latest; }
+
+    /** The write kept for a coalesce key in this drain, or nullptr. */
+    const OSCWriteRecord* find (uint64_t key) const noexcept
+    {
+        for (size_t i = static_cast<size_t> ((key * 0x9E3779B97F4A7C15ull) >> 40) & tableMask;;
+             i = (i + 1) & tableMask)
+        {
+            const auto& slot = slots[i];
+            if (slot.generation != generation)
+                return nullptr;
+            if (slot.key == key)
+                return &latest[slot.index];
+        }
+    }
+
+    void clear() noexcept
+    {
+        latest.clear();
+        if (++generation == 0)
+        {
+            for (auto& slot : slots)
+                slot.generation = 0;
+            generation = 1;
+        }
+    }
+
+private:
+    struct Slot
+    {
+        uint64_t key = 0;
+        uint32_t index = 0;
+        uint32_t generation = 0;
+    };
+
+    const size_t tableMask;
+    std::vector<Slot> slots;
+    std::vector<OSCWriteRecord> latest;
+    uint32_t generation = 1;
+};
+
+} // namespace WFSNetwork
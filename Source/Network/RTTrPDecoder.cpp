@@ -132,6 +132,11 @@ bool Decoder::parseTrackable(const uint8_t* data, size_t size, size_t& offset)
                     return false;
                 break;
 
+            case MOD_CENTROID_ACC_VEL:
+                if (!parseCentroidAccVel(data, size, offset, trackable))
+                    return false;
+                break;
+
             case MOD_QUATERNION:
                 if (!parseQuaternion(data, size, offset, trackable))
                     return false;
@@ -190,6 +195,60 @@ bool Decoder::parseCentroid(const uint8_t* data, size_t size, size_t& offset, Tr
     return true;
 }
 
+bool Decoder::parseCentroidAccVel(const uint8_t* data, size_t size, size_t& offset, Trackable& t)
+{
+    // CentroidAccVelMod structure:
+    // - Size (2 bytes) - includes size field itself
+    // - X, Y, Z (3 x 8 bytes double)
+    // - Acceleration X, Y, Z (3 x 4 bytes float)
+    // - Velocity X, Y, Z (3 x 4 bytes float)
+    // Total: 50 bytes
+
+    if (offset + 50 > size)
+        return false;
+
+    uint16_t modSize = readUint16(data + offset, needsByteSwap);
+    if (modSize < 50)
+        return false;
+    const size_t moduleEnd = offset + modSize;  // Size counts itself, not the type byte
+    offset += 2;
+
+    const double x = readDouble(data + offset, needsByteSwap);
+    offset += 8;
+    const double y = readDouble(data + offset, needsByteSwap);
+    offset += 8;
+    const double z = readDouble(data + offset, needsByteSwap);
+    offset += 8;
+
+    // A plain CentroidMod in the same trackable wins for position
+    if (!t.hasPosition)
+    {
+        t.position = { x, y, z };
+        t.hasPosition = true;
+    }
+
+    t.acceleration.x = readFloat(data + offset, needsByteSwap);
+    offset += 4;
+    t.acceleration.y = readFloat(data + offset, needsByteSwap);
+    offset += 4;
+    t.acceleration.z = readFloat(data + offset, needsByteSwap);
+    offset += 4;
+
+    t.velocity.x = readFloat(data + offset, needsByteSwap);
+    offset += 4;
+    t.velocity.y = readFloat(data + offset, needsByteSwap);
+    offset += 4;
+    t.velocity.z = readFloat(data + offset, needsByteSwap);
+    offset += 4;
+
+    // Skip any trailing fields a newer spec revision appends
+    if (moduleEnd > offset && moduleEnd <= size)
+        offset = moduleEnd;
+
+    t.hasAccVel = true;
+    return true;
+}
+
 bool Decoder::parseQuaternion(const uint8_t* data, size_t size, size_t& offset, Trackable& t)
 {
     // QuatModule structure:
@@ -280,6 +339,14 @@ double Decoder::readDouble(const uint8_t* data, bool swap) const
     return val;
 }
 
+float Decoder::readFloat(const uint8_t* data, bool swap) const
+{
+    uint32_t bits = readUint32(data, swap);
+    float val;
+    std::memcpy(&val, &bits, 4);
+    return val;
+}
+
 uint32_t Decoder::readUint32(const uint8_t* data, bool swap) const
 {
     if (swap)
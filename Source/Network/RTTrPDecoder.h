@@ -53,9 +53,12 @@ struct Trackable
     int id = -1;
     juce::String name;
     Position position;
+    Position velocity;       // m/s (CentroidAccVelMod)
+    Position acceleration;   // m/s² (CentroidAccVelMod)
     Quaternion quaternion;
     EulerAngles euler;
     bool hasPosition = false;
+    bool hasAccVel = false;
     bool hasQuaternion = false;
     bool hasEuler = false;
 };
@@ -64,8 +67,9 @@ struct Trackable
  * RTTrP Decoder
  *
  * Minimal decoder for RTTrP (Real-Time Tracking Protocol) motion packets.
- * Parses position (CentroidMod), quaternion orientation (QuatModule),
- * and Euler orientation (EulerModule) from RTTrPM packets.
+ * Parses position (CentroidMod), position with acceleration and velocity
+ * (CentroidAccVelMod), quaternion orientation (QuatModule), and Euler
+ * orientation (EulerModule) from RTTrPM packets.
  *
  * Cross-platform: Uses only standard C++ and JUCE types.
  * Based on RTTrP v2.4.2.0 specification.
@@ -99,11 +103,13 @@ private:
     bool parsePacket(const uint8_t* data, size_t size);
     bool parseTrackable(const uint8_t* data, size_t size, size_t& offset);
     bool parseCentroid(const uint8_t* data, size_t size, size_t& offset, Trackable& t);
+    bool parseCentroidAccVel(const uint8_t* data, size_t size, size_t& offset, Trackable& t);
     bool parseQuaternion(const uint8_t* data, size_t size, size_t& offset, Trackable& t);
     bool parseEuler(const uint8_t* data, size_t size, size_t& offset, Trackable& t);
 
     // Byte-order aware reading helpers
     double readDouble(const uint8_t* data, bool swap) const;
+    float readFloat(const uint8_t* data, bool swap) const;
     uint32_t readUint32(const uint8_t* data, bool swap) const;
     uint16_t readUint16(const uint8_t* data, bool swap) const;
 
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "OSCProtocolTypes.h"
+#include "../Parameters/WFSValueTreeState.h"
+#include "../Parameters/WFSParameterIDs.h"
+#include "../Parameters/ParameterDirtyTracker.h"
+
+#include <functional>
+#include <vector>
+
+namespace WFSNetwork
+{
+
+/**
+ * TrackingFastPath
+ *
+ * Shared by the OSC, PSN, RTTrP and MQTT tracking receivers (wired by
+ * OSCManager, like TrackingPositionFilter). Each filtered tracking offset is
+ * handed straight to the calculation engine through the publish hook
+ * (WFSCalculationEngine::setTrackedOffset, a lock-free per-input slot), and
+ * the ValueTree copy of inputOffsetX/Y/Z — which every listener, the map, the
+ * OSCQuery server and Remote feedback react to — is committed only at
+ * commitRateHz.
+ *
+ * A channel that receives no frame for a whole commit period is released
+ * back to its ValueTree offset (which by then holds the last tracked value),
+ * so switching tracking off or losing the tracker hands control back within
+ * two commit periods.
+ *
+ * Without hooks, or when disabled, writeOffset() writes the ValueTree per
+ * frame exactly as the receivers used to. Message thread only.
+ */
+class TrackingFastPath : private juce::Timer
+{
+public:
+    using PublishHook = std::function<void (int inputIndex, float x, float y, float z,
+                                            juce::int64 receiptTicks, juce::int64 routedTicks)>;
+    using ReleaseHook = std::function<void (int inputIndex)>;
+    using NoteHook    = std::function<void (int inputIndex, juce::int64 receiptTicks, juce::int64 routedTicks)>;
+
+    static constexpr int defaultCommitRateHz = 10;
+
+    TrackingFastPath() = default;
+    ~TrackingFastPath() override { stopTimer(); }
+
+    /** Engine side. noteHook stamps frames that took the ValueTree route so
+        the latency of both routes can be compared. */
+    void setEngineHooks (PublishHook publish, ReleaseHook release, NoteHook note)
+    {
+        releaseAll();
+        publishHook = std::move (publish);
+        releaseHook = std::move (release);
+        noteHook = std::move (note);
+    }
+
+    void setDirtyTracker (ParameterDirtyTracker* tracker) { dirtyTracker = tracker; }
+
+    void setEnabled (bool shouldBeEnabled)
+    {
+        if (enabled == shouldBeEnabled)
+            return;
+        if (! shouldBeEnabled)
+            releaseAll();
+        enabled = shouldBeEnabled;
+    }
+
+    bool isEnabled() const noexcept { return enabled; }
+
+    void setCommitRateHz (int hz)
+    {
+        commitRateHz = juce::jlimit (1, 50, hz);
+        if (isTimerRunning())
+            startTimerHz (commitRateHz);
+    }
+
+    int getCommitRateHz() const noexcept { return commitRateHz; }
+
+    /** Route one filtered offset for an input. Missing axes keep their
+        current value (OSC tracking may carry a single axis per message).
+        receiptTicks is the receiver's MotionLatencyTracer::ReceiptStamp (0 = unknown). */
+    void writeOffset (int inputIndex, juce::ValueTree& posSection,
+                      float x, float y, float z,
+                      bool hasX, bool hasY, bool hasZ,
+                      juce::int64 receiptTicks)
+    {
+        const auto stamp = juce::Time::getHighResolutionTicks();
+
+        if (! enabled || ! publishHook || inputIndex < 0)
+        {
+            writeToTree (posSection, x, y, z, hasX, hasY, hasZ);
+            if (noteHook && inputIndex >= 0)
+                noteHook (inputIndex, receiptTicks, stamp);
+            return;
+        }
+
+        if (static_cast<size_t> (inputIndex) >= channels.size())
+            channels.resize (static_cast<size_t> (inputIndex) + 1);
+
+        auto& c = channels[static_cast<size_t> (inputIndex)];
+        if (! c.live)
+        {
+            c.x = static_cast<float> (posSection.getProperty (WFSParameterIDs::inputOffsetX, 0.0f));
+            c.y = static_cast<float> (posSection.getProperty (WFSParameterIDs::inputOffsetY, 0.0f));
+            c.z = static_cast<float> (posSection.getProperty (WFSParameterIDs::inputOffsetZ, 0.0f));
+            c.live = true;
+        }
+        if (hasX) c.x = x;
+        if (hasY) c.y = y;
+        if (hasZ) c.z = z;
+        c.section = posSection;
+        c.pending = true;
+
+        publishHook (inputIndex, c.x, c.y, c.z, receiptTicks, stamp);
+
+        if (! isTimerRunning())
+            startTimerHz (commitRateHz);
+    }
+
+    /** Commit every pending offset to the ValueTree now (e.g. before a snapshot store). */
+    void flush() { commitPending (false); }
+
+private:
+    struct Channel
+    {
+        float x = 0.0f, y = 0.0f, z = 0.0f;
+        juce::ValueTree section;
+        bool live = false;      // The engine slot is active
+        bool pending = false;   // Frame(s) since the last commit
+    };
+
+    void timerCallback() override { commitPending (true); }
+
+    void commitPending (bool releaseIdle)
+    {
+        bool anyLive = false;
+
+        for (size_t i = 0; i < channels.size(); ++i)
+        {
+            auto& c = channels[i];
+            if (! c.live)
+                continue;
+
+            if (c.pending)
+            {
+                if (c.section.isValid())
+                    writeToTree (c.section, c.x, c.y, c.z, true, true, true);
+                c.pending = false;
+            }
+            else if (releaseIdle)
+            {
+                // Idle for a full period: the ValueTree already holds the last value
+                if (releaseHook)
+                    releaseHook (static_cast<int> (i));
+                c.live = false;
+                c.section = {};
+            }
+
+            anyLive = anyLive || c.live;
+        }
+
+        if (! anyLive)
+            stopTimer();
+    }
+
+    void releaseAll()
+    {
+        commitPending (false);
+        for (size_t i = 0; i < channels.size(); ++i)
+        {
+            if (channels[i].live && releaseHook)
+                releaseHook (static_cast<int> (i));
+        }
+        channels.clear();
+        stopTimer();
+    }
+
+    void writeToTree (juce::ValueTree& posSection, float x, float y, float z,
+                      bool hasX, bool hasY, bool hasZ)
+    {
+        // Live tracking is transient — suppress dirty flagging in the snapshot
+        // scope, and tag as Tracking-origin for the MCP staleness/notifications path.
+        OriginTagScope originScope { OriginTag::Tracking };
+        ParameterDirtyTracker::ScopedInternalWrite guard (dirtyTracker);
+        if (hasX)
+            posSection.setProperty (WFSParameterIDs::inputOffsetX, x, nullptr);
+        if (hasY)
+            posSection.setProperty (WFSParameterIDs::inputOffsetY, y, nullptr);
+        if (hasZ)
+            posSection.setProperty (WFSParameterIDs::inputOffsetZ, z, nullptr);
+    }
+
+    PublishHook publishHook;
+    ReleaseHook releaseHook;
+    NoteHook noteHook;
+    ParameterDirtyTracker* dirtyTracker = nullptr;
+    std::vector<Channel> channels;
+    int commitRateHz = defaultCommitRateHz;
+    bool enabled = true;
+
+    JUCE_DECLARE_NON_COPYABLE (TrackingFastPath)
+};
+
+} // namespace WFSNetwork
@@ -1,6 +1,8 @@
 #include "TrackingMQTTReceiver.h"
 #include "../../spatcore/dsp/TrackingPositionFilter.h"
 #include "OSCLogger.h"
+#include "TrackingFastPath.h"
+#include "TrackingPredictor.h"
 #include "../../spatcore/control/osc/NetworkStringUtils.h"
 
 namespace WFSNetwork
@@ -18,6 +20,7 @@ TrackingMQTTReceiver::TrackingMQTTReceiver (WFSValueTreeState& valueTreeState)
     // existing (now message-thread-only) routing method. MQTT is position-only.
     ingestQueue.setApply ([this] (const TrackingUpdate& u)
     {
+        receipt.takeForDrain();
         if (u.hasPos) routePositionToInput (u.key, u.x, u.y, u.z, u.quality);
     });
 }
@@ -522,6 +525,7 @@ void TrackingMQTTReceiver::processJsonPayload (const juce::String& topic, const
     update.z       = z;
     update.quality = quality;
     update.hasPos  = true;
+    receipt.markArrival();
     ingestQueue.push (update);
 }
 
@@ -600,14 +604,26 @@ void TrackingMQTTReceiver::routePositionToInput (int inputIndex, float x, float
             return; // sample rejected
     }
 
+    // Optional extrapolation toward the render time (per-input horizon)
+    if (predictor != nullptr)
+        predictor->process (inputIndex, inputIndex + 1, TrackingPredictor::getSettings (posSection), fx, fy, fz,
+                            TrackingPredictor::ticksToSeconds (receipt.getDrainTicks()), nullptr);
+
     // Write filtered position to ValueTree.
     // Live tracking is transient — suppress dirty flagging in the snapshot scope.
     // Phase 5b: tag as Tracking-origin for the MCP staleness/notifications path.
-    OriginTagScope originScope { OriginTag::Tracking };
-    ParameterDirtyTracker::ScopedInternalWrite guard (dirtyTracker);
-    posSection.setProperty (WFSParameterIDs::inputOffsetX, fx, nullptr);
-    posSection.setProperty (WFSParameterIDs::inputOffsetY, fy, nullptr);
-    posSection.setProperty (WFSParameterIDs::inputOffsetZ, fz, nullptr);
+    if (fastPath != nullptr)
+    {
+        fastPath->writeOffset (inputIndex, posSection, fx, fy, fz, true, true, true, receipt.getDrainTicks());
+    }
+    else
+    {
+        OriginTagScope originScope { OriginTag::Tracking };
+        ParameterDirtyTracker::ScopedInternalWrite guard (dirtyTracker);
+        posSection.setProperty (WFSParameterIDs::inputOffsetX, fx, nullptr);
+        posSection.setProperty (WFSParameterIDs::inputOffsetY, fy, nullptr);
+        posSection.setProperty (WFSParameterIDs::inputOffsetZ, fz, nullptr);
+    }
 
     ++positionsRouted;
 }
@@ -4,13 +4,14 @@
 #include "../Parameters/WFSValueTreeState.h"
 #include "../Parameters/WFSParameterIDs.h"
 #include "../Parameters/ParameterDirtyTracker.h"
+#include "../DSP/MotionLatencyTracer.h"
 #include "../../spatcore/control/osc/TrackingIngestQueue.h"
 #include "../../spatcore/control/osc/NetworkStringUtils.h"
 #include <array>
 
 class TrackingPositionFilter;
 
-namespace WFSNetwork { class OSCLogger; }
+namespace WFSNetwork { class OSCLogger; class TrackingFastPath; class TrackingPredictor; }
 
 namespace WFSNetwork
 {
@@ -214,6 +215,12 @@ public:
     /** Set the position filter for smoothing. */
     void setPositionFilter (TrackingPositionFilter* filter) { positionFilter = filter; }
 
+    /** Route offsets through the tracking fast path (nullptr = write the ValueTree per frame). */
+    void setTrackingFastPath (TrackingFastPath* path) { fastPath = path; }
+
+    /** Extrapolate positions per the inputs' prediction settings (nullptr = never). */
+    void setTrackingPredictor (TrackingPredictor* p) { predictor = p; }
+
     /** Set the logger for tracking data visibility. */
     void setLogger (OSCLogger* l) { logger = l; }
 
@@ -321,6 +328,9 @@ private:
 
     // Position filter (shared, owned by OSCManager)
     TrackingPositionFilter* positionFilter = nullptr;
+    TrackingFastPath* fastPath = nullptr;
+    TrackingPredictor* predictor = nullptr;
+    MotionLatencyTracer::ReceiptStamp receipt;   // Oldest undrained arrival (latency tracing)
 
     // Snapshot-scope dirty tracker — wired up by OSCManager
     ParameterDirtyTracker* dirtyTracker = nullptr;
@@ -1,6 +1,8 @@
 #include "TrackingOSCReceiver.h"
 #include "../../spatcore/dsp/TrackingPositionFilter.h"
 #include "OSCLogger.h"
+#include "TrackingFastPath.h"
+#include "TrackingPredictor.h"
 
 namespace WFSNetwork
 {
@@ -99,6 +101,7 @@ void TrackingOSCReceiver::oscMessageReceived(const juce::OSCMessage& message,
                                               const juce::String& /*senderIP*/)
 {
     ++messagesReceived;
+    receiptTicks = juce::Time::getHighResolutionTicks();
     processTrackingMessage(message);
 }
 
@@ -213,18 +216,37 @@ void TrackingOSCReceiver::routeToInputs(int trackingId, float x, float y, float
                 continue; // sample rejected (jump detected)
         }
 
+        // Optional extrapolation toward the render time (per-input horizon).
+        // Axes this message does not carry are predicted from the current offset.
+        if (predictor != nullptr)
+        {
+            if (! hasX) fx = static_cast<float> (posSection.getProperty (WFSParameterIDs::inputOffsetX, 0.0f));
+            if (! hasY) fy = static_cast<float> (posSection.getProperty (WFSParameterIDs::inputOffsetY, 0.0f));
+            if (! hasZ) fz = static_cast<float> (posSection.getProperty (WFSParameterIDs::inputOffsetZ, 0.0f));
+            predictor->process (ch, trackingId, TrackingPredictor::getSettings (posSection), fx, fy, fz,
+                                TrackingPredictor::ticksToSeconds (receiptTicks), nullptr);
+        }
+
         // Update offset coordinates (tracking updates offset, not position)
         // Using setProperty triggers ValueTree listeners which updates map and broadcasts to targets.
         // Live tracking is transient — suppress dirty flagging in the snapshot scope.
         // Phase 5b: tag as Tracking-origin for the MCP staleness/notifications path.
-        OriginTagScope originScope { OriginTag::Tracking };
-        ParameterDirtyTracker::ScopedInternalWrite guard (dirtyTracker);
-        if (hasX)
-            posSection.setProperty(WFSParameterIDs::inputOffsetX, fx, nullptr);
-        if (hasY)
-            posSection.setProperty(WFSParameterIDs::inputOffsetY, fy, nullptr);
-        if (hasZ)
-            posSection.setProperty(WFSParameterIDs::inputOffsetZ, fz, nullptr);
+        // With a fast path the engine gets the offset now and the ValueTree at its commit rate.
+        if (fastPath != nullptr)
+        {
+            fastPath->writeOffset (ch, posSection, fx, fy, fz, hasX, hasY, hasZ, receiptTicks);
+        }
+        else
+        {
+            OriginTagScope originScope { OriginTag::Tracking };
+            ParameterDirtyTracker::ScopedInternalWrite guard (dirtyTracker);
+            if (hasX)
+                posSection.setProperty(WFSParameterIDs::inputOffsetX, fx, nullptr);
+            if (hasY)
+                posSection.setProperty(WFSParameterIDs::inputOffsetY, fy, nullptr);
+            if (hasZ)
+                posSection.setProperty(WFSParameterIDs::inputOffsetZ, fz, nullptr);
+        }
 
         anyRouted = true;
     }
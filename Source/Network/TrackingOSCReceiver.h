@@ -5,10 +5,11 @@
 #include "../Parameters/WFSValueTreeState.h"
 #include "../Parameters/WFSParameterIDs.h"
 #include "../Parameters/ParameterDirtyTracker.h"
+#include "../DSP/MotionLatencyTracer.h"
 
 class TrackingPositionFilter;
 
-namespace WFSNetwork { class OSCLogger; }
+namespace WFSNetwork { class OSCLogger; class TrackingFastPath; class TrackingPredictor; }
 
 namespace WFSNetwork
 {
@@ -268,6 +269,12 @@ public:
      */
     void setPositionFilter(TrackingPositionFilter* filter) { positionFilter = filter; }
 
+    /** Route offsets through the tracking fast path (nullptr = write the ValueTree per frame). */
+    void setTrackingFastPath(TrackingFastPath* path) { fastPath = path; }
+
+    /** Extrapolate positions per the inputs' prediction settings (nullptr = never). */
+    void setTrackingPredictor(TrackingPredictor* p) { predictor = p; }
+
     /** Set the logger for tracking data visibility in the Network Log Window. */
     void setLogger(OSCLogger* l) { logger = l; }
 
@@ -320,6 +327,9 @@ private:
 
     // Position filter (shared, owned by OSCManager)
     TrackingPositionFilter* positionFilter = nullptr;
+    TrackingFastPath* fastPath = nullptr;
+    TrackingPredictor* predictor = nullptr;
+    juce::int64 receiptTicks = 0;   // Arrival of the message being routed (latency tracing)
 
     // Logger (shared, owned by OSCManager)
     OSCLogger* logger = nullptr;
@@ -1,6 +1,8 @@
 #include "TrackingPSNReceiver.h"
 #include "../../spatcore/dsp/TrackingPositionFilter.h"
 #include "OSCLogger.h"
+#include "TrackingFastPath.h"
+#include "TrackingPredictor.h"
 
 namespace WFSNetwork
 {
@@ -17,6 +19,7 @@ TrackingPSNReceiver::TrackingPSNReceiver(WFSValueTreeState& valueTreeState)
     // existing (now message-thread-only) routing methods.
     ingestQueue.setApply ([this] (const TrackingUpdate& u)
     {
+        receipt.takeForDrain();
         if (u.hasPos) routePositionToInputs (u.key, u.x, u.y, u.z);
         if (u.hasOri) routeOrientationToInputs (u.key, u.rotation);
     });
@@ -172,6 +175,33 @@ void TrackingPSNReceiver::processTrackerData(const ::psn::tracker& tracker)
         update.y = y;
         update.z = z;
         update.hasPos = true;
+
+        // Speed / acceleration for the predictor: scale and flip only (no offset)
+        if (tracker.is_speed_set() || tracker.is_accel_set())
+        {
+            TrackingMotionHint hint;
+            const float sx = (flipX.load() ? -1.0f : 1.0f) * scaleX.load();
+            const float sy = (flipY.load() ? -1.0f : 1.0f) * scaleY.load();
+            const float sz = (flipZ.load() ? -1.0f : 1.0f) * scaleZ.load();
+
+            if (tracker.is_speed_set())
+            {
+                const auto speed = tracker.get_speed();
+                hint.vx = speed.x * sx;
+                hint.vy = speed.y * sy;
+                hint.vz = speed.z * sz;
+                hint.hasVelocity = true;
+            }
+            if (tracker.is_accel_set())
+            {
+                const auto accel = tracker.get_accel();
+                hint.ax = accel.x * sx;
+                hint.ay = accel.y * sy;
+                hint.az = accel.z * sz;
+                hint.hasAcceleration = true;
+            }
+            motionHints.store (update.key, hint);
+        }
     }
 
     // Process orientation if available
@@ -185,7 +215,10 @@ void TrackingPSNReceiver::processTrackerData(const ::psn::tracker& tracker)
     }
 
     if (update.hasPos || update.hasOri)
+    {
+        receipt.markArrival();
         ingestQueue.push (update);
+    }
 }
 
 void TrackingPSNReceiver::routePositionToInputs(int trackingId, float x, float y, float z)
@@ -222,16 +255,34 @@ void TrackingPSNReceiver::routePositionToInputs(int trackingId, float x, float y
                 continue; // sample rejected (jump detected)
         }
 
+        // Optional extrapolation toward the render time (per-input horizon)
+        if (predictor != nullptr)
+        {
+            TrackingMotionHint hint;
+            const bool hasHint = motionHints.fetch (trackingId, hint);
+            predictor->process (ch, trackingId, TrackingPredictor::getSettings (posSection), fx, fy, fz,
+                                TrackingPredictor::ticksToSeconds (receipt.getDrainTicks()),
+                                hasHint ? &hint : nullptr);
+        }
+
         // Update offset coordinates (tracking updates offset, not base position)
         // Using setProperty triggers ValueTree listeners which updates map and broadcasts to targets.
         // Live tracking is transient — suppress dirty flagging in the snapshot scope.
         // Phase 5b: tag as Tracking-origin so MCP staleness/notifications can
         // distinguish a live position update from a manual edit or AI write.
-        WFSNetwork::OriginTagScope originScope { WFSNetwork::OriginTag::Tracking };
-        ParameterDirtyTracker::ScopedInternalWrite guard (dirtyTracker);
-        posSection.setProperty(WFSParameterIDs::inputOffsetX, fx, nullptr);
-        posSection.setProperty(WFSParameterIDs::inputOffsetY, fy, nullptr);
-        posSection.setProperty(WFSParameterIDs::inputOffsetZ, fz, nullptr);
+        // With a fast path the engine gets the offset now and the ValueTree at its commit rate.
+        if (fastPath != nullptr)
+        {
+            fastPath->writeOffset (ch, posSection, fx, fy, fz, true, true, true, receipt.getDrainTicks());
+        }
+        else
+        {
+            WFSNetwork::OriginTagScope originScope { WFSNetwork::OriginTag::Tracking };
+            ParameterDirtyTracker::ScopedInternalWrite guard (dirtyTracker);
+            posSection.setProperty(WFSParameterIDs::inputOffsetX, fx, nullptr);
+            posSection.setProperty(WFSParameterIDs::inputOffsetY, fy, nullptr);
+            posSection.setProperty(WFSParameterIDs::inputOffsetZ, fz, nullptr);
+        }
 
         anyRouted = true;
     }
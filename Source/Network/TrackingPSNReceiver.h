@@ -4,11 +4,13 @@
 #include "../Parameters/WFSValueTreeState.h"
 #include "../Parameters/WFSParameterIDs.h"
 #include "../Parameters/ParameterDirtyTracker.h"
+#include "../DSP/MotionLatencyTracer.h"
+#include "TrackingPredictor.h"
 #include "../../spatcore/control/osc/TrackingIngestQueue.h"
 
 class TrackingPositionFilter;
 
-namespace WFSNetwork { class OSCLogger; }
+namespace WFSNetwork { class OSCLogger; class TrackingFastPath; }
 
 // PSN library - header-only implementation
 // Windows defines min/max macros that conflict with std::min/max used in PSN library
@@ -78,6 +80,12 @@ public:
      */
     void setPositionFilter(TrackingPositionFilter* filter) { positionFilter = filter; }
 
+    /** Route offsets through the tracking fast path (nullptr = write the ValueTree per frame). */
+    void setTrackingFastPath(TrackingFastPath* path) { fastPath = path; }
+
+    /** Extrapolate positions per the inputs' prediction settings (nullptr = never). */
+    void setTrackingPredictor(TrackingPredictor* p) { predictor = p; }
+
     /** Set the logger for tracking data visibility. */
     void setLogger(OSCLogger* l) { logger = l; }
 
@@ -116,6 +124,10 @@ private:
 
     // Position filter (shared, owned by OSCManager)
     TrackingPositionFilter* positionFilter = nullptr;
+    TrackingFastPath* fastPath = nullptr;
+    TrackingPredictor* predictor = nullptr;
+    MotionLatencyTracer::ReceiptStamp receipt;   // Oldest undrained arrival (latency tracing)
+    TrackingMotionHints motionHints;             // Reported velocity/acceleration per tracker ID
 
     // Logger (shared, owned by OSCManager)
     OSCLogger* logger = nullptr;
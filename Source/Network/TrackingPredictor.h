@@ -0,0 +1,271 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "../Parameters/WFSParameterIDs.h"
+#include "../Parameters/WFSParameterDefaults.h"
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace WFSNetwork
+{
+
+/**
+ * Velocity / acceleration a tracking protocol reports alongside a position
+ * (PSN speed + accel chunks, RTTrP centroid acc/vel module), already in the
+ * receiver's transformed (scaled, flipped) frame. m/s and m/s².
+ */
+struct TrackingMotionHint
+{
+    float vx = 0.0f, vy = 0.0f, vz = 0.0f;
+    float ax = 0.0f, ay = 0.0f, az = 0.0f;
+    bool hasVelocity = false;
+    bool hasAcceleration = false;
+};
+
+/**
+ * TrackingMotionHints
+ *
+ * Latest motion hint per tracking ID, written by a receiver's network thread
+ * and read when the ingest queue drains on the message thread. The queue's
+ * TrackingUpdate (spatcore) only carries position and orientation, so the
+ * hints travel beside it; both sides are non-realtime threads and hold the
+ * spin lock for a copy only.
+ */
+class TrackingMotionHints
+{
+public:
+    static constexpr int maxKeys = 64;
+
+    /** Network thread. A full table drops hints for new keys (prediction falls back to estimation). */
+    void store (int key, const TrackingMotionHint& hint) noexcept
+    {
+        const juce::SpinLock::ScopedLockType lock (tableLock);
+        for (int i = 0; i < numUsed; ++i)
+        {
+            if (slots[static_cast<size_t> (i)].key == key)
+            {
+                slots[static_cast<size_t> (i)].hint = hint;
+                return;
+            }
+        }
+        if (numUsed < maxKeys)
+            slots[static_cast<size_t> (numUsed++)] = { key, hint };
+    }
+
+    /** Message thread. */
+    bool fetch (int key, TrackingMotionHint& out) const noexcept
+    {
+        const juce::SpinLock::ScopedLockType lock (tableLock);
+        for (int i = 0; i < numUsed; ++i)
+        {
+            if (slots[static_cast<size_t> (i)].key == key)
+            {
+                out = slots[static_cast<size_t> (i)].hint;
+                return out.hasVelocity || out.hasAcceleration;
+            }
+        }
+        return false;
+    }
+
+private:
+    struct Slot
+    {
+        int key = 0;
+        TrackingMotionHint hint;
+    };
+
+    std::array<Slot, maxKeys> slots {};
+    int numUsed = 0;
+    mutable juce::SpinLock tableLock;
+};
+
+//==============================================================================
+/**
+ * TrackingPredictor
+ *
+ * Optional per-input extrapolation of tracked positions, applied after
+ * TrackingPositionFilter in every tracking receiver (shared, owned by
+ * OSCManager). A tracked position reaches the renderer one or two control
+ * ticks after it arrived; predicting it forward by the input's horizon hides
+ * that lag on fast-moving performers. Set the horizon to the total p50 that
+ * diagnostics_get_motion_latency reports.
+ *
+ * Modes (inputTrackingPredict):
+ *   Off               positions pass through untouched
+ *   ConstantVelocity  lead = v * horizon, v from the protocol's velocity when
+ *                     it reports one (PSN, RTTrP acc/vel), else the last step
+ *   AlphaBeta         alpha-beta filter on position/velocity, with the
+ *                     protocol's velocity fused in as a second measurement
+ *
+ * The lead is clamped to inputTrackingPredictMaxLead, and the model is
+ * reseeded whenever a measurement lands further than that from where it
+ * predicted (reversal, jump, tracker swap), so a wrong guess never carries
+ * over. Message thread only.
+ */
+class TrackingPredictor
+{
+public:
+    enum Mode { Off = 0, ConstantVelocity = 1, AlphaBeta = 2 };
+
+    struct Settings
+    {
+        int mode = Off;
+        float horizonSeconds = 0.0f;
+        float maxLead = 0.0f;       // Metres
+
+        bool isActive() const noexcept { return mode != Off && horizonSeconds > 0.0f && maxLead > 0.0f; }
+    };
+
+    static Settings getSettings (const juce::ValueTree& posSection)
+    {
+        using namespace WFSParameterDefaults;
+        Settings s;
+        s.mode = juce::jlimit (inputTrackingPredictMin, inputTrackingPredictMax,
+                               static_cast<int> (posSection.getProperty (WFSParameterIDs::inputTrackingPredict,
+                                                                         inputTrackingPredictDefault)));
+        s.horizonSeconds = 0.001f * juce::jlimit (static_cast<float> (inputTrackingPredictHorizonMin),
+                                                  static_cast<float> (inputTrackingPredictHorizonMax),
+                                                  static_cast<float> (posSection.getProperty (WFSParameterIDs::inputTrackingPredictHorizon,
+                                                                                              inputTrackingPredictHorizonDefault)));
+        s.maxLead = juce::jlimit (inputTrackingPredictMaxLeadMin, inputTrackingPredictMaxLeadMax,
+                                  static_cast<float> (posSection.getProperty (WFSParameterIDs::inputTrackingPredictMaxLead,
+                                                                              inputTrackingPredictMaxLeadDefault)));
+        return s;
+    }
+
+    /** Extrapolate one filtered sample in place. timeSeconds is the sample's
+        arrival time (any monotonic clock); hint may be nullptr. */
+    void process (int inputIndex, int trackingId, const Settings& settings,
+                  float& x, float& y, float& z, double timeSeconds,
+                  const TrackingMotionHint* hint)
+    {
+        if (inputIndex < 0)
+            return;
+        if (static_cast<size_t> (inputIndex) >= channels.size())
+            channels.resize (static_cast<size_t> (inputIndex) + 1);
+
+        auto& c = channels[static_cast<size_t> (inputIndex)];
+        if (! settings.isActive())
+        {
+            c.seeded = false;
+            return;
+        }
+
+        const Vec3 meas { x, y, z };
+        const double dt = timeSeconds - c.time;
+
+        if (! c.seeded || c.trackingId != trackingId || dt > maxGapSeconds)
+        {
+            reseed (c, trackingId, meas, timeSeconds, hint);
+        }
+        else if (dt >= minStepSeconds)
+        {
+            const auto dtf = static_cast<float> (dt);
+            const Vec3 expected = c.pos + c.vel * dtf;
+            const Vec3 residual = meas - expected;
+
+            if (residual.length() > settings.maxLead)
+            {
+                reseed (c, trackingId, meas, timeSeconds, hint);
+            }
+            else if (settings.mode == AlphaBeta)
+            {
+                c.pos = expected + residual * alpha;
+                c.vel = c.vel + residual * (beta / dtf);
+                if (hint != nullptr && hint->hasVelocity)
+                    c.vel = c.vel + (velocityOf (*hint) - c.vel) * hintWeight;
+                c.time = timeSeconds;
+            }
+            else
+            {
+                c.vel = (hint != nullptr && hint->hasVelocity) ? velocityOf (*hint)
+                                                              : (meas - c.pos) * (1.0f / dtf);
+                c.pos = meas;
+                c.time = timeSeconds;
+            }
+        }
+        else
+        {
+            // Same ingest batch (coarse arrival stamp): keep the velocity
+            c.pos = meas;
+            if (hint != nullptr && hint->hasVelocity)
+                c.vel = velocityOf (*hint);
+        }
+
+        const float h = settings.horizonSeconds;
+        Vec3 lead = c.vel * h;
+        if (hint != nullptr && hint->hasAcceleration)
+            lead = lead + Vec3 { hint->ax, hint->ay, hint->az } * (0.5f * h * h);
+
+        // The alpha-beta estimate trails noisy measurements less than it
+        // leads them: extrapolate from the filtered position, not the raw one.
+        const Vec3 base = settings.mode == AlphaBeta ? c.pos : meas;
+        Vec3 predicted = base + lead;
+        const Vec3 offset = predicted - meas;
+        if (const float len = offset.length(); len > settings.maxLead)
+            predicted = meas + offset * (settings.maxLead / len);
+
+        x = predicted.x;
+        y = predicted.y;
+        z = predicted.z;
+    }
+
+    /** Arrival stamp (MotionLatencyTracer::ReceiptStamp ticks, 0 = unknown) as process() time. */
+    static double ticksToSeconds (juce::int64 ticks) noexcept
+    {
+        return juce::Time::highResolutionTicksToSeconds (ticks != 0 ? ticks : juce::Time::getHighResolutionTicks());
+    }
+
+    /** Forget one input's motion (tracking switched off, ID changed). */
+    void reset (int inputIndex)
+    {
+        if (inputIndex >= 0 && static_cast<size_t> (inputIndex) < channels.size())
+            channels[static_cast<size_t> (inputIndex)].seeded = false;
+    }
+
+    void resetAll() { channels.clear(); }
+
+private:
+    struct Vec3
+    {
+        float x = 0.0f, y = 0.0f, z = 0.0f;
+
+        Vec3 operator+ (const Vec3& o) const noexcept { return { x + o.x, y + o.y, z + o.z }; }
+        Vec3 operator- (const Vec3& o) const noexcept { return { x - o.x, y - o.y, z - o.z }; }
+        Vec3 operator* (float k) const noexcept       { return { x * k, y * k, z * k }; }
+        float length() const noexcept                 { return std::sqrt (x * x + y * y + z * z); }
+    };
+
+    struct Channel
+    {
+        Vec3 pos, vel;
+        double time = 0.0;
+        int trackingId = -1;
+        bool seeded = false;
+    };
+
+    // Critically damped pair (beta = alpha^2 / (2 - alpha))
+    static constexpr float alpha = 0.5f;
+    static constexpr float beta = alpha * alpha / (2.0f - alpha);
+    static constexpr float hintWeight = 0.5f;
+    static constexpr double maxGapSeconds = 0.25;     // Longer silence: start over
+    static constexpr double minStepSeconds = 0.001;   // Closer samples share one arrival stamp
+
+    static Vec3 velocityOf (const TrackingMotionHint& h) noexcept { return { h.vx, h.vy, h.vz }; }
+
+    static void reseed (Channel& c, int trackingId, const Vec3& meas, double timeSeconds,
+                        const TrackingMotionHint* hint) noexcept
+    {
+        c.pos = meas;
+        c.vel = (hint != nullptr && hint->hasVelocity) ? velocityOf (*hint) : Vec3 {};
+        c.time = timeSeconds;
+        c.trackingId = trackingId;
+        c.seeded = true;
+    }
+
+    std::vector<Channel> channels;
+};
+
+} // namespace WFSNetwork
@@ -1,6 +1,8 @@
 #include "TrackingRTTrPReceiver.h"
 #include "../../spatcore/dsp/TrackingPositionFilter.h"
 #include "OSCLogger.h"
+#include "TrackingFastPath.h"
+#include "TrackingPredictor.h"
 #include <cmath>
 
 namespace WFSNetwork
@@ -18,6 +20,7 @@ TrackingRTTrPReceiver::TrackingRTTrPReceiver(WFSValueTreeState& valueTreeState)
     // existing (now message-thread-only) routing methods.
     ingestQueue.setApply ([this] (const TrackingUpdate& u)
     {
+        receipt.takeForDrain();
         if (u.hasPos) routePositionToInputs (u.key, u.x, u.y, u.z);
         if (u.hasOri) routeOrientationToInputs (u.key, u.rotation);
     });
@@ -157,6 +160,25 @@ void TrackingRTTrPReceiver::processTrackable(const RTTrP::Trackable& trackable)
         update.y = y;
         update.z = z;
         update.hasPos = true;
+
+        // Velocity / acceleration for the predictor: scale and flip only (no offset)
+        if (trackable.hasAccVel)
+        {
+            const float sx = (flipX.load() ? -1.0f : 1.0f) * scaleX.load();
+            const float sy = (flipY.load() ? -1.0f : 1.0f) * scaleY.load();
+            const float sz = (flipZ.load() ? -1.0f : 1.0f) * scaleZ.load();
+
+            TrackingMotionHint hint;
+            hint.vx = static_cast<float>(trackable.velocity.x) * sx;
+            hint.vy = static_cast<float>(trackable.velocity.y) * sy;
+            hint.vz = static_cast<float>(trackable.velocity.z) * sz;
+            hint.ax = static_cast<float>(trackable.acceleration.x) * sx;
+            hint.ay = static_cast<float>(trackable.acceleration.y) * sy;
+            hint.az = static_cast<float>(trackable.acceleration.z) * sz;
+            hint.hasVelocity = true;
+            hint.hasAcceleration = true;
+            motionHints.store (update.key, hint);
+        }
     }
 
     // Process orientation if available
@@ -174,7 +196,10 @@ void TrackingRTTrPReceiver::processTrackable(const RTTrP::Trackable& trackable)
     }
 
     if (update.hasPos || update.hasOri)
+    {
+        receipt.markArrival();
         ingestQueue.push (update);
+    }
 }
 
 float TrackingRTTrPReceiver::quaternionToYaw(const RTTrP::Quaternion& q) const
@@ -223,15 +248,33 @@ void TrackingRTTrPReceiver::routePositionToInputs(int trackingId, float x, float
                 continue; // sample rejected (jump detected)
         }
 
+        // Optional extrapolation toward the render time (per-input horizon)
+        if (predictor != nullptr)
+        {
+            TrackingMotionHint hint;
+            const bool hasHint = motionHints.fetch (trackingId, hint);
+            predictor->process (ch, trackingId, TrackingPredictor::getSettings (posSection), fx, fy, fz,
+                                TrackingPredictor::ticksToSeconds (receipt.getDrainTicks()),
+                                hasHint ? &hint : nullptr);
+        }
+
         // Update offset coordinates (tracking updates offset, not base position)
         // Using setProperty triggers ValueTree listeners which updates map and broadcasts to targets.
         // Live tracking is transient — suppress dirty flagging in the snapshot scope.
         // Phase 5b: tag as Tracking-origin for the MCP staleness/notifications path.
-        OriginTagScope originScope { OriginTag::Tracking };
-        ParameterDirtyTracker::ScopedInternalWrite guard (dirtyTracker);
-        posSection.setProperty(WFSParameterIDs::inputOffsetX, fx, nullptr);
-        posSection.setProperty(WFSParameterIDs::inputOffsetY, fy, nullptr);
-        posSection.setProperty(WFSParameterIDs::inputOffsetZ, fz, nullptr);
+        // With a fast path the engine gets the offset now and the ValueTree at its commit rate.
+        if (fastPath != nullptr)
+        {
+            fastPath->writeOffset (ch, posSection, fx, fy, fz, true, true, true, receipt.getDrainTicks());
+        }
+        else
+        {
+            OriginTagScope originScope { OriginTag::Tracking };
+            ParameterDirtyTracker::ScopedInternalWrite guard (dirtyTracker);
+            posSection.setProperty(WFSParameterIDs::inputOffsetX, fx, nullptr);
+            posSection.setProperty(WFSParameterIDs::inputOffsetY, fy, nullptr);
+            posSection.setProperty(WFSParameterIDs::inputOffsetZ, fz, nullptr);
+        }
 
         anyRouted = true;
     }
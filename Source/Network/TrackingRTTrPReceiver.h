@@ -4,12 +4,14 @@
 #include "../Parameters/WFSValueTreeState.h"
 #include "../Parameters/WFSParameterIDs.h"
 #include "../Parameters/ParameterDirtyTracker.h"
+#include "../DSP/MotionLatencyTracer.h"
+#include "TrackingPredictor.h"
 #include "../../spatcore/control/osc/TrackingIngestQueue.h"
 #include "RTTrPDecoder.h"
 
 class TrackingPositionFilter;
 
-namespace WFSNetwork { class OSCLogger; }
+namespace WFSNetwork { class OSCLogger; class TrackingFastPath; }
 
 namespace WFSNetwork
 {
@@ -65,6 +67,12 @@ public:
      */
     void setPositionFilter(TrackingPositionFilter* filter) { positionFilter = filter; }
 
+    /** Route offsets through the tracking fast path (nullptr = write the ValueTree per frame). */
+    void setTrackingFastPath(TrackingFastPath* path) { fastPath = path; }
+
+    /** Extrapolate positions per the inputs' prediction settings (nullptr = never). */
+    void setTrackingPredictor(TrackingPredictor* p) { predictor = p; }
+
     /** Set the logger for tracking data visibility. */
     void setLogger(OSCLogger* l) { logger = l; }
 
@@ -106,6 +114,10 @@ private:
 
     // Position filter (shared, owned by OSCManager)
     TrackingPositionFilter* positionFilter = nullptr;
+    TrackingFastPath* fastPath = nullptr;
+    TrackingPredictor* predictor = nullptr;
+    MotionLatencyTracer::ReceiptStamp receipt;   // Oldest undrained arrival (latency tracing)
+    TrackingMotionHints motionHints;             // Reported velocity/acceleration per tracker ID
 
     // Logger (shared, owned by OSCManager)
     OSCLogger* logger = nullptr;
@@ -1127,7 +1127,7 @@ const std::vector<WFSFileManager::ScopeItem>& WFSFileManager::ExtendedSnapshotSc
         { "constraints", "Constraints", Position, { inputConstraintX, inputConstraintY, inputConstraintZ, inputConstraintDistance, inputConstraintDistanceMin, inputConstraintDistanceMax } },
         { "flip", "Flip (XYZ)", Position, { inputFlipX, inputFlipY, inputFlipZ } },
         { "cluster", "Cluster", Position, { inputCluster } },
-        { "tracking", "Tracking", Position, { inputTrackingActive, inputTrackingID, inputTrackingSmooth } },
+        { "tracking", "Tracking", Position, { inputTrackingActive, inputTrackingID, inputTrackingSmooth, inputTrackingPredict, inputTrackingPredictHorizon, inputTrackingPredictMaxLead } },
         { "speedLimit", "Speed Limit", Position, { inputMaxSpeedActive, inputMaxSpeed } },
         { "pathMode", "Path Mode", Position, { inputPathModeActive } },
         { "heightFactor", "Height Factor", Position, { inputHeightFactor } },
@@ -362,6 +362,15 @@ namespace WFSParameterDefaults
     constexpr int inputTrackingSmoothDefault    = 100;
     constexpr int inputTrackingSmoothMin        = 0;
     constexpr int inputTrackingSmoothMax        = 100;
+    constexpr int inputTrackingPredictDefault   = 0;  // 0=Off, 1=Constant velocity, 2=Alpha-beta
+    constexpr int inputTrackingPredictMin       = 0;
+    constexpr int inputTrackingPredictMax       = 2;
+    constexpr int inputTrackingPredictHorizonDefault    = 30;     // ms
+    constexpr int inputTrackingPredictHorizonMin        = 0;
+    constexpr int inputTrackingPredictHorizonMax        = 200;
+    constexpr float inputTrackingPredictMaxLeadDefault  = 0.3f;   // meters
+    constexpr float inputTrackingPredictMaxLeadMin      = 0.0f;
+    constexpr float inputTrackingPredictMaxLeadMax      = 2.0f;
 
     constexpr int inputMaxSpeedActiveDefault    = 0;  // 0=OFF, 1=ON
     constexpr float inputMaxSpeedDefault        = 1.0f;
@@ -314,6 +314,9 @@ namespace WFSParameterIDs
     const juce::Identifier inputTrackingActive   ("inputTrackingActive");
     const juce::Identifier inputTrackingID       ("inputTrackingID");
     const juce::Identifier inputTrackingSmooth   ("inputTrackingSmooth");
+    const juce::Identifier inputTrackingPredict         ("inputTrackingPredict");         // 0=Off, 1=Constant velocity, 2=Alpha-beta
+    const juce::Identifier inputTrackingPredictHorizon  ("inputTrackingPredictHorizon");  // ms
+    const juce::Identifier inputTrackingPredictMaxLead  ("inputTrackingPredictMaxLead");  // meters
     const juce::Identifier inputMaxSpeedActive   ("inputMaxSpeedActive");
     const juce::Identifier inputMaxSpeed         ("inputMaxSpeed");
     const juce::Identifier inputPathModeActive   ("inputPathModeActive");   // 0=OFF, 1=ON
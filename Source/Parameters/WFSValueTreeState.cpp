@@ -2575,6 +2575,9 @@ juce::ValueTree WFSValueTreeState::createInputPositionSection (int index, int to
     position.setProperty (inputTrackingActive, inputTrackingActiveDefault, nullptr);
     position.setProperty (inputTrackingID, index + 1, nullptr);  // Default to channel index
     position.setProperty (inputTrackingSmooth, inputTrackingSmoothDefault, nullptr);
+    position.setProperty (inputTrackingPredict, inputTrackingPredictDefault, nullptr);
+    position.setProperty (inputTrackingPredictHorizon, inputTrackingPredictHorizonDefault, nullptr);
+    position.setProperty (inputTrackingPredictMaxLead, inputTrackingPredictMaxLeadDefault, nullptr);
     position.setProperty (inputMaxSpeedActive, inputMaxSpeedActiveDefault, nullptr);
     position.setProperty (inputMaxSpeed, inputMaxSpeedDefault, nullptr);
     position.setProperty (inputPathModeActive, inputPathModeActiveDefault, nullptr);
@@ -0,0 +1,437 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * Project-level sample cache for the Sampler.
+ *
+ * Each source file is decoded once, on a background thread, to a float32
+ * mono file at the session sample rate in the project's samples/.cache
+ * folder, then memory-mapped. Cells and inputs that use the same audio share
+ * one mapping: samples are keyed by a hash of the file contents plus the
+ * session rate, so a copy of a file under another name is shared too, and a
+ * later session at the same rate maps the cached file without decoding.
+ *
+ * The first pinnedHeadMs of every sample is copied to RAM so a NoteOn never
+ * waits on a page fault; the rest is read from the mapping.
+ *
+ * Threads: request()/takeCompleted()/findLoaded() from the message thread,
+ * Sample::getSample() from the audio thread. A Sample is immutable once
+ * published and stays valid while anything holds its shared_ptr.
+ */
+class SampleCache : private juce::Thread
+{
+public:
+    class Sample
+    {
+    public:
+        int getNumSamples() const noexcept      { return numSamples; }
+        double getSampleRate() const noexcept   { return sampleRate; }
+        bool isMapped() const noexcept          { return mapping != nullptr; }
+        size_t getPinnedBytes() const noexcept  { return head.size() * sizeof (float); }
+        int getPinnedLength() const noexcept    { return headLength; }
+
+        /** Audio thread. 0 <= pos < getNumSamples(). */
+        float getSample (int pos) const noexcept
+        {
+            return pos < headLength ? head[(size_t) pos] : body[pos];
+        }
+
+        /** Copy [start, start + n) out of the mapping (may fault pages in:
+            not for the audio thread). */
+        void copyTo (float* dest, int start, int n) const noexcept
+        {
+            std::memcpy (dest, body + start, (size_t) n * sizeof (float));
+        }
+
+    private:
+        friend class SampleCache;
+
+        std::unique_ptr<juce::MemoryMappedFile> mapping;
+        std::vector<float> heapSamples;   // Only when the cache file can't be written or mapped
+        std::vector<float> head;          // Pinned attack
+        const float* body = nullptr;      // Mapped samples, or heapSamples.data()
+        int headLength = 0;
+        int numSamples = 0;
+        double sampleRate = 0.0;
+    };
+
+    using SamplePtr = std::shared_ptr<const Sample>;
+
+    /** A finished request; sample is nullptr on failure (see error). */
+    struct Completed
+    {
+        juce::int64 tag = 0;
+        juce::File source;
+        SamplePtr sample;
+        juce::String error;
+    };
+
+    SampleCache() : juce::Thread ("SampleCache")
+    {
+        formatManager.registerBasicFormats();
+    }
+
+    ~SampleCache() override
+    {
+        stopThread (4000);
+    }
+
+    /** Rate every sample is resampled to. Requests made before a change keep
+        the rate they were made with. */
+    void setSessionSampleRate (double newRate)
+    {
+        const std::lock_guard<std::mutex> sl (lock);
+        sessionRate = newRate > 0.0 ? newRate : 48000.0;
+    }
+
+    /** RAM-pinned head per sample, in ms (0 = read everything from the mapping). */
+    void setPinnedHeadMs (double ms)
+    {
+        const std::lock_guard<std::mutex> sl (lock);
+        pinnedHeadMs = juce::jmax (0.0, ms);
+    }
+
+    /** samples/.cache in the project, or a temp folder for unsaved projects. */
+    static juce::File getCacheFolderFor (const juce::File& samplesFolder)
+    {
+        if (samplesFolder.isDirectory())
+            return samplesFolder.getChildFile (".cache");
+        return juce::File::getSpecialLocation (juce::File::tempDirectory).getChildFile ("WFS-DIY-sample-cache");
+    }
+
+    /** The sample for this file if it is already loaded (no I/O beyond a stat). */
+    SamplePtr findLoaded (const juce::File& source) const
+    {
+        const std::lock_guard<std::mutex> sl (lock);
+        return findLiveLocked (makeSourceKey (source, sessionRate));
+    }
+
+    /** Queue a background load; the result comes back from takeCompleted()
+        with the same tag. */
+    void request (const juce::File& source, const juce::File& cacheFolder, juce::int64 tag)
+    {
+        {
+            const std::lock_guard<std::mutex> sl (lock);
+            queue.push_back ({ source, cacheFolder, tag, sessionRate, pinnedHeadMs });
+            ++pending;
+        }
+
+        if (! isThreadRunning())
+            startThread (juce::Thread::Priority::low);
+        notify();
+    }
+
+    std::vector<Completed> takeCompleted()
+    {
+        const std::lock_guard<std::mutex> sl (lock);
+        std::vector<Completed> done;
+        done.swap (completed);
+        return done;
+    }
+
+    int getNumPending() const
+    {
+        const std::lock_guard<std::mutex> sl (lock);
+        return pending;
+    }
+
+    /** Synchronous load (the loader thread, and tools measuring it). */
+    SamplePtr loadNow (const juce::File& source, const juce::File& cacheFolder,
+                       double rate, double headMs, juce::String& error)
+    {
+        if (! source.existsAsFile())
+        {
+            error = "file not found";
+            return nullptr;
+        }
+
+        const auto sourceKey = makeSourceKey (source, rate);
+        {
+            const std::lock_guard<std::mutex> sl (lock);
+            if (auto live = findLiveLocked (sourceKey))
+                return live;
+        }
+
+        const auto contentHash = hashFileContents (source);
+        if (contentHash == 0)
+        {
+            error = "cannot read file";
+            return nullptr;
+        }
+
+        const auto contentKey = juce::String::toHexString ((juce::int64) contentHash)
+                              + "-" + juce::String (juce::roundToInt (rate));
+        {
+            const std::lock_guard<std::mutex> sl (lock);
+            contentKeyBySource[sourceKey] = contentKey;
+            if (auto live = findLiveLocked (sourceKey))
+                return live;
+        }
+
+        const int headSamples = juce::roundToInt (headMs * 0.001 * rate);
+        const auto cacheFile = cacheFolder.getChildFile (contentKey + ".f32");
+
+        std::shared_ptr<Sample> sample = openCacheFile (cacheFile, headSamples);
+        if (sample == nullptr)
+        {
+            std::vector<float> mono;
+            if (! decodeResampled (source, rate, mono, error))
+                return nullptr;
+
+            if (writeCacheFile (cacheFile, mono, rate))
+                sample = openCacheFile (cacheFile, headSamples);
+
+            if (sample == nullptr)
+            {
+                // Read-only project or failed mapping: keep it in RAM as before.
+                sample = std::make_shared<Sample>();
+                sample->heapSamples = std::move (mono);
+                sample->numSamples = (int) sample->heapSamples.size();
+                sample->sampleRate = rate;
+                sample->body = sample->heapSamples.data();
+            }
+        }
+
+        const std::lock_guard<std::mutex> sl (lock);
+        auto& slot = liveByContent[contentKey];
+        if (auto existing = slot.lock())
+            return existing;
+        slot = sample;
+        return sample;
+    }
+
+private:
+    struct Request
+    {
+        juce::File source;
+        juce::File cacheFolder;
+        juce::int64 tag = 0;
+        double sampleRate = 48000.0;
+        double headMs = 0.0;
+    };
+
+    // File layout: header, then numSamples little-endian float32.
+    struct CacheHeader
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t headerBytes;
+        double sampleRate;
+        int64_t numSamples;
+    };
+    static_assert (sizeof (CacheHeader) == 32, "cache header layout");
+    static constexpr const char* cacheMagic = "WFSSMPL";
+    static constexpr uint32_t cacheVersion = 1;
+
+    void run() override
+    {
+        while (! threadShouldExit())
+        {
+            Request req;
+            {
+                const std::lock_guard<std::mutex> sl (lock);
+                if (! queue.empty())
+                {
+                    req = std::move (queue.front());
+                    queue.pop_front();
+                }
+            }
+
+            if (req.source == juce::File())
+            {
+                wait (-1);
+                continue;
+            }
+
+            Completed done { req.tag, req.source, nullptr, {} };
+            done.sample = loadNow (req.source, req.cacheFolder, req.sampleRate, req.headMs, done.error);
+
+            const std::lock_guard<std::mutex> sl (lock);
+            completed.push_back (std::move (done));
+            --pending;
+        }
+    }
+
+    // Identity of a file version on disk; cheap to build on the message thread.
+    static juce::String makeSourceKey (const juce::File& source, double rate)
+    {
+        return source.getFullPathName() + "|" + juce::String (source.getSize())
+             + "|" + juce::String (source.getLastModificationTime().toMilliseconds())
+             + "|" + juce::String (juce::roundToInt (rate));
+    }
+
+    SamplePtr findLiveLocked (const juce::String& sourceKey) const
+    {
+        const auto ck = contentKeyBySource.find (sourceKey);
+        if (ck == contentKeyBySource.end())
+            return nullptr;
+        const auto live = liveByContent.find (ck->second);
+        return live != liveByContent.end() ? live->second.lock() : nullptr;
+    }
+
+    // 64-bit FNV-1a over the file bytes, seeded with the size.
+    static uint64_t hashFileContents (const juce::File& file)
+    {
+        juce::FileInputStream in (file);
+        if (! in.openedOk())
+            return 0;
+
+        uint64_t h = 14695981039346656037ull ^ (uint64_t) file.getSize();
+        std::vector<uint8_t> chunk (1 << 16);
+        for (;;)
+        {
+            const int n = in.read (chunk.data(), (int) chunk.size());
+            if (n <= 0)
+                break;
+            for (int i = 0; i < n; ++i)
+                h = (h ^ chunk[(size_t) i]) * 1099511628211ull;
+        }
+        return h == 0 ? 1 : h;
+    }
+
+    bool decodeResampled (const juce::File& source, double rate, std::vector<float>& out, juce::String& error)
+    {
+        std::unique_ptr<juce::AudioFormatReader> reader (formatManager.createReaderFor (source));
+        if (reader == nullptr)
+        {
+            error = "unsupported or unreadable audio format";
+            return false;
+        }
+
+        const auto numChannels = (int) reader->numChannels;
+        const auto total = (int) juce::jmin<juce::int64> (reader->lengthInSamples, std::numeric_limits<int>::max() - 16);
+        if (total <= 0 || numChannels <= 0)
+        {
+            error = "file has no samples";
+            return false;
+        }
+
+        // Mix down to mono in chunks: the multichannel file never sits in RAM
+        // whole. Same arithmetic as the old per-sample mixdown (channels
+        // summed in order, then scaled).
+        constexpr int interpolatorPadding = 8;
+        std::vector<float> mono ((size_t) total + interpolatorPadding, 0.0f);
+        const int chunkSize = 1 << 16;
+        juce::AudioBuffer<float> temp (numChannels, chunkSize);
+        const float scale = 1.0f / (float) numChannels;
+
+        for (int start = 0; start < total; start += chunkSize)
+        {
+            const int n = juce::jmin (chunkSize, total - start);
+            reader->read (&temp, 0, n, start, true, numChannels > 1);
+
+            float* dst = mono.data() + start;
+            juce::FloatVectorOperations::copy (dst, temp.getReadPointer (0), n);
+            if (numChannels > 1)
+            {
+                for (int ch = 1; ch < numChannels; ++ch)
+                    juce::FloatVectorOperations::add (dst, temp.getReadPointer (ch), n);
+                juce::FloatVectorOperations::multiply (dst, scale, n);
+            }
+        }
+
+        const double sourceRate = reader->sampleRate > 0.0 ? reader->sampleRate : rate;
+        if (std::abs (sourceRate - rate) < 0.5)
+        {
+            mono.resize ((size_t) total);
+            out = std::move (mono);
+            return true;
+        }
+
+        const double speedRatio = sourceRate / rate;
+        const int numOut = (int) std::floor ((double) total / speedRatio);
+        out.assign ((size_t) juce::jmax (1, numOut), 0.0f);
+
+        juce::LagrangeInterpolator interpolator;
+        interpolator.process (speedRatio, mono.data(), out.data(), (int) out.size());
+        return true;
+    }
+
+    static bool writeCacheFile (const juce::File& cacheFile, const std::vector<float>& samples, double rate)
+    {
+        if (! cacheFile.getParentDirectory().createDirectory())
+            return false;
+
+        // Written under a temp name and renamed, so a half-written file is
+        // never mapped (crash, or another instance loading the same project).
+        const auto tempFile = cacheFile.getSiblingFile (cacheFile.getFileName() + ".part");
+        bool written = false;
+        {
+            juce::FileOutputStream out (tempFile);
+            if (! out.openedOk())
+                return false;
+            out.setPosition (0);
+            out.truncate();
+
+            CacheHeader header {};
+            std::memcpy (header.magic, cacheMagic, 7);
+            header.version = cacheVersion;
+            header.headerBytes = sizeof (CacheHeader);
+            header.sampleRate = rate;
+            header.numSamples = (int64_t) samples.size();
+
+            written = out.write (&header, sizeof (header))
+                   && out.write (samples.data(), samples.size() * sizeof (float));
+            out.flush();
+            written = written && ! out.getStatus().failed();
+        }
+
+        if (written && tempFile.moveFileTo (cacheFile))
+            return true;
+
+        tempFile.deleteFile();
+        return false;
+    }
+
+    static std::shared_ptr<Sample> openCacheFile (const juce::File& cacheFile, int headSamples)
+    {
+        if (! cacheFile.existsAsFile())
+            return nullptr;
+
+        auto mapping = std::make_unique<juce::MemoryMappedFile> (cacheFile, juce::MemoryMappedFile::readOnly, false);
+        if (mapping->getData() == nullptr || mapping->getSize() < sizeof (CacheHeader))
+            return nullptr;
+
+        CacheHeader header;
+        std::memcpy (&header, mapping->getData(), sizeof (header));
+        if (std::memcmp (header.magic, cacheMagic, 7) != 0
+            || header.version != cacheVersion
+            || header.headerBytes != sizeof (CacheHeader)
+            || header.numSamples <= 0
+            || header.numSamples > std::numeric_limits<int>::max()
+            || mapping->getSize() < sizeof (CacheHeader) + (size_t) header.numSamples * sizeof (float))
+            return nullptr;
+
+        auto sample = std::make_shared<Sample>();
+        sample->numSamples = (int) header.numSamples;
+        sample->sampleRate = header.sampleRate;
+        sample->body = reinterpret_cast<const float*> (static_cast<const char*> (mapping->getData()) + sizeof (CacheHeader));
+        sample->headLength = juce::jlimit (0, sample->numSamples, headSamples);
+        sample->head.assign (sample->body, sample->body + sample->headLength);
+        sample->mapping = std::move (mapping);
+        return sample;
+    }
+
+    juce::AudioFormatManager formatManager;   // Loader thread only (after construction)
+
+    mutable std::mutex lock;
+    double sessionRate = 48000.0;
+    double pinnedHeadMs = 100.0;
+    std::deque<Request> queue;
+    std::vector<Completed> completed;
+    int pending = 0;
+    std::map<juce::String, juce::String> contentKeyBySource;            // Source key -> content key
+    std::map<juce::String, std::weak_ptr<const Sample>> liveByContent;  // Content key -> loaded sample
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SampleCache)
+};
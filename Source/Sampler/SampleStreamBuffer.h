@@ -0,0 +1,170 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "SampleCache.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * Per-voice read-ahead buffer for streamed Sampler cells.
+ *
+ * A long cell's pinned head is played straight from RAM, so a NoteOn is
+ * instant; everything after it comes through two segments that the
+ * SamplerStreamer thread fills from the memory-mapped cache file. The audio
+ * thread therefore never touches a mapped page that may not be resident.
+ *
+ * Each segment carries two tags, packed (generation << 32 | start sample):
+ * 'wanted', written by the audio thread, and 'ready', published by the
+ * streamer once the data for that tag is in place. The audio thread only
+ * reads a segment whose ready tag matches what it expects, and only changes
+ * a segment's wanted tag once it has stopped reading it, so the two threads
+ * never touch the same data at the same time. The generation is bumped on
+ * every trigger, so a fill for an earlier trigger can never be mistaken for
+ * the current one.
+ *
+ * A segment that isn't ready in time plays silence (playback keeps its
+ * timing) and counts one underrun.
+ */
+class SampleStreamBuffer
+{
+public:
+    static constexpr int segmentSamples = 16384;
+
+    //==========================================================================
+    // Audio thread
+
+    /** Start streaming a sample from the end of its pinned head. */
+    void start (uint32_t generation, const SampleCache::Sample& sample) noexcept
+    {
+        currentGeneration = generation;
+        numSamples = sample.getNumSamples();
+        current = 0;
+        currentStart = sample.getPinnedLength();
+        currentReady = false;
+        currentMissed = false;
+        request (0, currentStart);
+        request (1, currentStart + segmentSamples);
+    }
+
+    void stop() noexcept
+    {
+        segments[0].wanted.store (0, std::memory_order_release);
+        segments[1].wanted.store (0, std::memory_order_release);
+    }
+
+    /** Sample at pos; pos advances by one per call after start(). */
+    float read (const SampleCache::Sample& sample, int pos) noexcept
+    {
+        if (pos < sample.getPinnedLength())
+            return sample.getSample (pos);
+
+        while (pos >= currentStart + segmentSamples)
+            advance();
+
+        if (! currentReady)
+        {
+            currentReady = segments[(size_t) current].ready.load (std::memory_order_acquire)
+                           == pack (currentGeneration, currentStart);
+            if (! currentReady)
+            {
+                if (! currentMissed)
+                {
+                    currentMissed = true;
+                    underruns.fetch_add (1, std::memory_order_relaxed);
+                }
+                return 0.0f;
+            }
+        }
+
+        return segments[(size_t) current].data[(size_t) (pos - currentStart)];
+    }
+
+    /** Segments that were late since the last call (message thread). */
+    int fetchAndClearUnderruns() noexcept
+    {
+        return underruns.exchange (0, std::memory_order_relaxed);
+    }
+
+    //==========================================================================
+    // Streamer thread
+
+    /** True while a segment is wanted for any trigger. */
+    bool isActive() const noexcept
+    {
+        return segments[0].wanted.load (std::memory_order_acquire) != 0
+            || segments[1].wanted.load (std::memory_order_acquire) != 0;
+    }
+
+    /** True when a wanted segment hasn't been filled yet. */
+    bool needsFill() const noexcept
+    {
+        for (const auto& seg : segments)
+        {
+            const auto w = seg.wanted.load (std::memory_order_acquire);
+            if (w != 0 && seg.ready.load (std::memory_order_relaxed) != w)
+                return true;
+        }
+        return false;
+    }
+
+    /** Fill the wanted segments of this trigger from sample. Segments wanted
+        for another generation are left for the next pass. */
+    void fill (const SampleCache::Sample& sample, uint32_t generation) noexcept
+    {
+        for (auto& seg : segments)
+        {
+            const auto w = seg.wanted.load (std::memory_order_acquire);
+            if (w == 0 || seg.ready.load (std::memory_order_relaxed) == w
+                || static_cast<uint32_t> (w >> 32) != generation)
+                continue;
+
+            const int start = static_cast<int> (w & 0xffffffffu);
+            const int n = juce::jlimit (0, segmentSamples, sample.getNumSamples() - start);
+            sample.copyTo (seg.data.data(), start, n);
+            std::fill (seg.data.begin() + n, seg.data.end(), 0.0f);
+            seg.ready.store (w, std::memory_order_release);
+        }
+    }
+
+private:
+    struct Segment
+    {
+        std::atomic<uint64_t> wanted { 0 };
+        std::atomic<uint64_t> ready { 0 };
+        std::array<float, segmentSamples> data {};
+    };
+
+    static uint64_t pack (uint32_t generation, int start) noexcept
+    {
+        return (static_cast<uint64_t> (generation) << 32) | static_cast<uint32_t> (start);
+    }
+
+    void request (int segment, int start) noexcept
+    {
+        segments[(size_t) segment].wanted.store (start < numSamples ? pack (currentGeneration, start) : 0,
+                                                 std::memory_order_release);
+    }
+
+    void advance() noexcept
+    {
+        // Done with the current segment: queue it two segments ahead.
+        request (current, currentStart + 2 * segmentSamples);
+        current ^= 1;
+        currentStart += segmentSamples;
+        currentReady = false;
+        currentMissed = false;
+    }
+
+    std::array<Segment, 2> segments;
+    std::atomic<int> underruns { 0 };
+
+    // Audio thread only
+    uint32_t currentGeneration = 0;
+    int numSamples = 0;
+    int current = 0;
+    int currentStart = 0;
+    bool currentReady = false;
+    bool currentMissed = false;
+};
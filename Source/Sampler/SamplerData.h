@@ -3,6 +3,7 @@
 #include <JuceHeader.h>
 #include "../Parameters/WFSParameterIDs.h"
 #include "../Parameters/WFSParameterDefaults.h"
+#include "SampleCache.h"
 
 namespace SamplerData
 {
@@ -22,12 +23,19 @@ struct SampleCell
     float offsetZ = 0.0f;
     float attenuation = 0.0f;           // dB (0 = no change)
 
-    // Audio data (loaded on demand, nullptr when empty)
-    std::shared_ptr<juce::AudioBuffer<float>> audioBuffer;
+    // Audio data (mono, session rate, shared through the SampleCache; nullptr until loaded)
+    SampleCache::SamplePtr audio;
     double sampleRate = 0.0;
     int numSamples = 0;
 
-    bool hasAudio() const noexcept { return audioBuffer != nullptr && numSamples > 0; }
+    void setAudio (SampleCache::SamplePtr newAudio)
+    {
+        audio = std::move (newAudio);
+        sampleRate = audio != nullptr ? audio->getSampleRate() : 0.0;
+        numSamples = audio != nullptr ? audio->getNumSamples() : 0;
+    }
+
+    bool hasAudio() const noexcept { return audio != nullptr && numSamples > 0; }
     bool isEmpty() const noexcept { return relativeFilePath.isEmpty(); }
 
     /** Load cell properties from a ValueTree node */
@@ -2,12 +2,17 @@
 
 #include <JuceHeader.h>
 #include "SamplerData.h"
+#include "SampleStreamBuffer.h"
 #include "../../spatcore/dsp/WFSHighShelfFilter.h"
 
 /**
  * Per-channel monophonic sampler engine.
  * Plays one sample at a time with fade-in/out envelope and HF shelf filter.
  * Called from the audio thread — all methods must be real-time safe.
+ *
+ * Cells longer than the stream threshold are streamed: after the pinned head
+ * their audio comes through a SampleStreamBuffer that the SamplerStreamer
+ * thread keeps filled, instead of being read from the mapping directly.
  */
 class SamplerEngine
 {
@@ -46,15 +51,110 @@ public:
         fadeOutRemaining = 0;
         fadeInRemaining = 0;
         hfFilter.reset();
+        streaming = false;
+        stream.stop();
+    }
+
+    /** Cells longer than this many samples are streamed (0 = never). Message thread. */
+    void setStreamThreshold (int numSamples) noexcept
+    {
+        streamThresholdSamples.store (juce::jmax (0, numSamples), std::memory_order_relaxed);
+    }
+
+    /** Streamed segments that arrived too late since the last call (message thread). */
+    int fetchAndClearStreamUnderruns() noexcept
+    {
+        return stream.fetchAndClearUnderruns();
+    }
+
+    /**
+     * Refill this voice's stream buffer if it needs it. Called from the
+     * SamplerStreamer thread only. Returns true while the voice is streaming.
+     */
+    bool serviceStream()
+    {
+        if (! stream.needsFill())
+            return stream.isActive();
+
+        SampleCache::SamplePtr source;
+        uint32_t generation = 0;
+        {
+            juce::SpinLock::ScopedLockType lock (cellLock);
+            source = currentBuffer;
+            generation = streamGeneration;
+        }
+
+        if (source != nullptr)
+            stream.fill (*source, generation);
+        return true;
     }
 
     //==========================================================================
     /** Load cells and current set from data (called from message thread, guarded) */
     void loadCells (const std::vector<SamplerData::SampleCell>& newCells)
     {
-        // Copy cell data atomically (audio thread reads currentBuffer pointer)
-        juce::SpinLock::ScopedLockType lock (cellLock);
-        cells = newCells;
+        std::vector<SamplerData::SampleCell> previous (newCells);
+        {
+            // Swap cell data atomically (audio thread reads currentBuffer pointer)
+            juce::SpinLock::ScopedLockType lock (cellLock);
+            cells.swap (previous);
+        }
+
+        for (auto& cell : previous)
+            retireSample (std::move (cell.audio));
+    }
+
+    /** Attach audio that finished loading after loadCells() (message thread) */
+    void setCellAudio (int cellIndex, SampleCache::SamplePtr audio)
+    {
+        SampleCache::SamplePtr previous;
+        {
+            juce::SpinLock::ScopedLockType lock (cellLock);
+
+            if (cellIndex < 0 || cellIndex >= static_cast<int> (cells.size()))
+                return;
+
+            auto& cell = cells[static_cast<size_t> (cellIndex)];
+            previous = std::move (cell.audio);
+            cell.setAudio (std::move (audio));
+        }
+
+        retireSample (std::move (previous));
+    }
+
+    /**
+     * Free samples taken out of the cells once the voice no longer plays them
+     * (message thread, periodically). Until then the retired list keeps a
+     * reference, so the audio thread never drops the last one when it moves
+     * currentBuffer to another cell: that would unmap the cache file and free
+     * the Sample in the callback.
+     */
+    void releaseRetiredSamples()
+    {
+        if (retiredSamples.empty())
+            return;
+
+        std::vector<SampleCache::SamplePtr> released;
+        {
+            juce::SpinLock::ScopedLockType lock (cellLock);
+
+            // A retired sample is in no cell, so once it is not currentBuffer
+            // the audio thread cannot pick it up again
+            for (auto it = retiredSamples.begin(); it != retiredSamples.end();)
+            {
+                if (*it != currentBuffer)
+                {
+                    released.push_back (std::move (*it));
+                    it = retiredSamples.erase (it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+        // released goes out of scope here, outside the lock: the last
+        // reference may unmap a file
     }
 
     void loadSet (const SamplerData::SamplerSet& newSet)
@@ -94,12 +194,17 @@ public:
 
         if (! playing)
         {
+            if (streaming)
+            {
+                streaming = false;
+                stream.stop();
+            }
             juce::FloatVectorOperations::clear (output, numSamples);
             return;
         }
 
-        // Get current cell's audio buffer
-        std::shared_ptr<juce::AudioBuffer<float>> buf;
+        // Get current cell's audio
+        SampleCache::SamplePtr buf;
         float cellAtten = 0.0f;
         {
             juce::SpinLock::ScopedLockType lock (cellLock);
@@ -145,8 +250,8 @@ public:
         // Update HF shelf with pressure
         hfFilter.setGainDb (pressHFGain);
 
-        const float* src = buf->getReadPointer (0);
-        int totalSamples = buf->getNumSamples();
+        const auto& src = *buf;
+        int totalSamples = src.getNumSamples();
 
         for (int i = 0; i < numSamples; ++i)
         {
@@ -154,7 +259,8 @@ public:
 
             if (playbackPos < totalSamples)
             {
-                sample = src[playbackPos];
+                sample = streaming ? stream.read (src, playbackPos)
+                                   : src.getSample (playbackPos);
                 playbackPos++;
             }
             else
@@ -221,6 +327,12 @@ public:
 
 private:
     //==========================================================================
+    void retireSample (SampleCache::SamplePtr sample)
+    {
+        if (sample != nullptr)
+            retiredSamples.push_back (std::move (sample));
+    }
+
     void handleEvent (const TouchEvent& evt)
     {
         switch (evt.type)
@@ -260,8 +372,21 @@ private:
             return;
         }
 
-        currentBuffer = cell.audioBuffer;
+        // Never the last reference to the previous buffer: a replaced cell's
+        // sample stays in retiredSamples until releaseRetiredSamples() sees
+        // it is no longer current
+        currentBuffer = cell.audio;
         currentCellIndex = cellIndex;
+
+        // Long mapped cells play their head from RAM and the rest via the streamer
+        const int threshold = streamThresholdSamples.load (std::memory_order_relaxed);
+        streaming = threshold > 0 && cell.audio->isMapped() && cell.numSamples > threshold
+                    && cell.audio->getPinnedLength() < cell.numSamples;
+        if (streaming)
+            stream.start (++streamGeneration, *cell.audio);
+        else
+            stream.stop();
+
         currentPressure = pressure;
 
         // Calculate fade-in samples from inTime (ms)
@@ -372,7 +497,17 @@ private:
     // Cell data (protected by SpinLock for message→audio thread sync)
     juce::SpinLock cellLock;
     std::vector<SamplerData::SampleCell> cells;
-    std::shared_ptr<juce::AudioBuffer<float>> currentBuffer;
+    SampleCache::SamplePtr currentBuffer;
+
+    // Samples taken out of the cells, kept until currentBuffer moves off them
+    // (message thread only; compared against currentBuffer under cellLock)
+    std::vector<SampleCache::SamplePtr> retiredSamples;
+
+    // Streaming (streamGeneration changes with currentBuffer, under cellLock)
+    std::atomic<int> streamThresholdSamples { 0 };
+    uint32_t streamGeneration = 0;
+    bool streaming = false;
+    SampleStreamBuffer stream;
 
     // Set data
     juce::SpinLock setLock;
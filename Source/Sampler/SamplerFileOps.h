@@ -108,19 +108,32 @@ public:
                                                                 double& outSampleRate,
                                                                 int& outNumSamples)
     {
-        if (relativeFilePath.isEmpty())
+        auto file = resolveSampleFile (samplesFolder, relativeFilePath);
+        if (file == juce::File())
             return nullptr;
 
+        return loadAudioFile (file, outSampleRate, outNumSamples);
+    }
+
+    /**
+     * Resolve a cell's file path against the project samples/ folder.
+     * Returns an empty File when the path cannot be resolved.
+     */
+    static juce::File resolveSampleFile (const juce::File& samplesFolder,
+                                         const juce::String& relativeFilePath)
+    {
+        if (relativeFilePath.isEmpty())
+            return {};
+
         // Imports made without a valid project folder store absolute paths —
         // load those directly so the sampler works in unsaved projects too.
         if (juce::File::isAbsolutePath (relativeFilePath))
-            return loadAudioFile (juce::File (relativeFilePath), outSampleRate, outNumSamples);
+            return juce::File (relativeFilePath);
 
         if (! samplesFolder.isDirectory())
-            return nullptr;
+            return {};
 
-        juce::File file = samplesFolder.getChildFile (relativeFilePath);
-        return loadAudioFile (file, outSampleRate, outNumSamples);
+        return samplesFolder.getChildFile (relativeFilePath);
     }
 
     /** Get supported file extensions as a wildcard pattern for file choosers */
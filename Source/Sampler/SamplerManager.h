@@ -4,6 +4,8 @@
 #include "SamplerEngine.h"
 #include "SamplerFileOps.h"
 #include "SamplerData.h"
+#include "SampleCache.h"
+#include "SamplerStreamer.h"
 #include "../Parameters/WFSParameterIDs.h"
 #include "../Parameters/WFSParameterDefaults.h"
 #include "../WFSLogger.h"
@@ -12,6 +14,11 @@
  * Owns per-channel SamplerEngine instances.
  * Manages sample loading, engine lifecycle, and position override output.
  *
+ * Cell audio is loaded through the SampleCache: cells whose file is already
+ * mapped get it immediately, the rest are decoded in the background and
+ * attached by applyPendingAudioLoads(). Cells longer than the stream
+ * threshold are played through the SamplerStreamer read-ahead thread.
+ *
  * Thread safety:
  *   - Audio thread calls processChannel()
  *   - Message thread calls load/configure methods
@@ -28,21 +35,35 @@ public:
     {
         currentSampleRate = sampleRate;
         currentBlockSize = maxBlockSize;
+        sampleCache.setSessionSampleRate (sampleRate);
+        streamer.stop();
 
         WFSLogger::getInstance().logInfo ("Sampler: prepared " + juce::String (numChannels)
                                           + " engines @ " + juce::String (sampleRate, 0) + " Hz");
 
         engines.resize (static_cast<size_t> (numChannels));
         channelActive.resize (static_cast<size_t> (numChannels), false);
+        loadGenerations.resize (static_cast<size_t> (numChannels), 0);
 
         for (auto& engine : engines)
         {
             if (engine == nullptr)
                 engine = std::make_unique<SamplerEngine>();
             engine->prepare (sampleRate, maxBlockSize);
+            engine->setStreamThreshold (juce::roundToInt (streamThresholdSeconds * sampleRate));
         }
+
+        std::vector<SamplerEngine*> streamed;
+        if (streamThresholdSeconds > 0.0)
+            for (auto& engine : engines)
+                streamed.push_back (engine.get());
+        streamer.setEngines (std::move (streamed));
     }
 
+    /** Cells longer than this are streamed from disk (0 = play everything from
+        the mapping). Takes effect at the next prepare(). */
+    void setStreamThresholdSeconds (double seconds) { streamThresholdSeconds = juce::jmax (0.0, seconds); }
+
     /** Reset all engines */
     void reset()
     {
@@ -114,7 +135,10 @@ public:
         std::vector<SamplerData::SampleCell> cells;
         cells.resize (WFSParameterDefaults::samplerGridCells);
 
-        int cellsWithFile = 0, cellsLoaded = 0;
+        // Completions from an earlier call for this channel are stale from here on
+        const auto generation = ++loadGenerations[idx];
+        const auto cacheFolder = SampleCache::getCacheFolderFor (samplesFolder);
+        int cellsWithFile = 0, cellsLoaded = 0, cellsQueued = 0;
 
         for (int i = 0; i < samplerNode.getNumChildren(); ++i)
         {
@@ -131,18 +155,22 @@ public:
                     if (! cell.relativeFilePath.isEmpty())
                     {
                         ++cellsWithFile;
-                        cell.audioBuffer = fileOps.loadFromProject (
-                            samplesFolder, cell.relativeFilePath,
-                            cell.sampleRate, cell.numSamples);
-
-                        if (cell.audioBuffer != nullptr)
+                        auto file = SamplerFileOps::resolveSampleFile (samplesFolder, cell.relativeFilePath);
+
+                        if (file == juce::File())
+                        {
+                            logLoadFailure (channelIndex, id, cell.relativeFilePath, "no samples folder");
+                        }
+                        else if (auto audio = sampleCache.findLoaded (file))
+                        {
+                            cell.setAudio (std::move (audio));
                             ++cellsLoaded;
+                        }
                         else
-                            WFSLogger::getInstance().logWarning ("Sampler: input "
-                                + juce::String (channelIndex + 1) + " cell " + juce::String (id)
-                                + " failed to load \"" + cell.relativeFilePath + "\" (samples folder: "
-                                + (samplesFolder.isDirectory() ? samplesFolder.getFullPathName()
-                                                               : juce::String ("<none>")) + ")");
+                        {
+                            sampleCache.request (file, cacheFolder, makeLoadTag (generation, channelIndex, id));
+                            ++cellsQueued;
+                        }
                     }
                 }
             }
@@ -150,8 +178,10 @@ public:
 
         if (cellsWithFile > 0)
             WFSLogger::getInstance().logInfo ("Sampler: input " + juce::String (channelIndex + 1)
-                                              + " loaded audio for " + juce::String (cellsLoaded)
-                                              + "/" + juce::String (cellsWithFile) + " cells");
+                                              + " has audio for " + juce::String (cellsLoaded)
+                                              + "/" + juce::String (cellsWithFile) + " cells"
+                                              + (cellsQueued > 0 ? ", " + juce::String (cellsQueued) + " loading"
+                                                                 : juce::String()));
 
         engines[idx]->loadCells (cells);
     }
@@ -200,7 +230,7 @@ public:
     }
 
     //==========================================================================
-    /** Load audio data for a specific cell on a specific channel */
+    /** Load audio data for a specific cell on a specific channel (attached by applyPendingAudioLoads) */
     void loadCellAudio (int channelIndex, int cellIndex,
                         const juce::File& samplesFolder, const juce::String& relativeFilePath)
     {
@@ -208,44 +238,48 @@ public:
         if (idx >= engines.size() || engines[idx] == nullptr)
             return;
 
-        if (relativeFilePath.isEmpty())
+        auto file = SamplerFileOps::resolveSampleFile (samplesFolder, relativeFilePath);
+        if (file == juce::File())
             return;
 
-        double sr = 0.0;
-        int numSamples = 0;
-        auto buffer = fileOps.loadFromProject (samplesFolder, relativeFilePath, sr, numSamples);
-
-        if (buffer != nullptr)
-        {
-            // Resample if needed (simple case: just store with original rate info)
-            // The engine plays at whatever rate the sample was recorded.
-            // TODO: Add resampling if sample rate != engine sample rate
-
-            // Update the cell's audio data in the engine's cell array
-            juce::SpinLock::ScopedLockType lock (cellAudioLock);
-            pendingAudioLoads.push_back ({ channelIndex, cellIndex, buffer, sr, numSamples });
-        }
+        if (auto audio = sampleCache.findLoaded (file))
+            engines[idx]->setCellAudio (cellIndex, std::move (audio));
+        else
+            sampleCache.request (file, SampleCache::getCacheFolderFor (samplesFolder),
+                                 makeLoadTag (loadGenerations[idx], channelIndex, cellIndex));
     }
 
-    /** Apply any pending audio loads (call from message thread periodically) */
+    /** Attach audio that finished loading in the background (call from message thread periodically) */
     void applyPendingAudioLoads()
     {
-        juce::SpinLock::ScopedLockType lock (cellAudioLock);
-
-        for (auto& load : pendingAudioLoads)
+        for (auto& done : sampleCache.takeCompleted())
         {
-            auto idx = static_cast<size_t> (load.channelIndex);
-            if (idx >= engines.size() || engines[idx] == nullptr)
-                continue;
-
-            // The engine needs updated cell data with the new audio buffer
-            // This is a simplified approach — in practice, loadChannelCells should be called
-            // after updating the cell's audioBuffer in the data layer
+            const auto generation = static_cast<uint32_t> (static_cast<uint64_t> (done.tag) >> 32);
+            const int channelIndex = static_cast<int> ((done.tag >> 8) & 0xffffff);
+            const int cellIndex = static_cast<int> (done.tag & 0xff);
+
+            auto idx = static_cast<size_t> (channelIndex);
+            if (idx >= engines.size() || engines[idx] == nullptr || loadGenerations[idx] != generation)
+                continue;   // Channel reloaded since the request
+
+            if (done.sample == nullptr)
+                logLoadFailure (channelIndex, cellIndex, done.source.getFullPathName(), done.error);
+            else
+                engines[idx]->setCellAudio (cellIndex, std::move (done.sample));
         }
+    }
 
-        pendingAudioLoads.clear();
+    /** Free replaced cell audio that no voice is playing any more (message thread, periodically) */
+    void releaseRetiredSamples()
+    {
+        for (auto& engine : engines)
+            if (engine != nullptr)
+                engine->releaseRetiredSamples();
     }
 
+    /** RAM-pinned head of every sample, in ms (the rest is read from the mapped cache file) */
+    void setPinnedHeadMs (double ms) { sampleCache.setPinnedHeadMs (ms); }
+
     //==========================================================================
     /** Trigger the next cell from the active set for a channel (message thread) */
     bool triggerNextCell (int channelIndex, float pressure)
@@ -361,25 +395,32 @@ public:
     }
 
 private:
-    struct PendingAudioLoad
+    // Background load tag: generation (32 bits) | channel (24 bits) | cell (8 bits)
+    static juce::int64 makeLoadTag (uint32_t generation, int channelIndex, int cellIndex)
+    {
+        return static_cast<juce::int64> ((static_cast<uint64_t> (generation) << 32)
+                                         | (static_cast<uint64_t> (channelIndex & 0xffffff) << 8)
+                                         | static_cast<uint64_t> (cellIndex & 0xff));
+    }
+
+    static void logLoadFailure (int channelIndex, int cellIndex, const juce::String& path, const juce::String& reason)
     {
-        int channelIndex;
-        int cellIndex;
-        std::shared_ptr<juce::AudioBuffer<float>> buffer;
-        double sampleRate;
-        int numSamples;
-    };
+        WFSLogger::getInstance().logWarning ("Sampler: input " + juce::String (channelIndex + 1)
+                                             + " cell " + juce::String (cellIndex)
+                                             + " failed to load \"" + path + "\" (" + reason + ")");
+    }
 
     double currentSampleRate = 44100.0;
     int currentBlockSize = 512;
+    double streamThresholdSeconds = 0.0;
 
     std::vector<std::unique_ptr<SamplerEngine>> engines;
     std::vector<bool> channelActive;
+    SamplerStreamer streamer;   // After engines: stopped before they are destroyed
 
     SamplerFileOps fileOps;
-
-    juce::SpinLock cellAudioLock;
-    std::vector<PendingAudioLoad> pendingAudioLoads;
+    SampleCache sampleCache;
+    std::vector<uint32_t> loadGenerations;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SamplerManager)
 };
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include "SamplerEngine.h"
+
+#include <vector>
+
+/**
+ * Read-ahead thread for streamed Sampler cells.
+ *
+ * Polls every engine's stream buffer and copies the next segments out of the
+ * mapped cache file, so page faults on long ambience beds happen here and
+ * not on the audio thread. The audio thread never signals this thread (that
+ * would take a lock); it polls at activePollMs while anything streams and
+ * idlePollMs otherwise, which the pinned head and the second segment cover.
+ *
+ * The engine list is fixed while the thread runs: setEngines() stops it
+ * first.
+ */
+class SamplerStreamer : private juce::Thread
+{
+public:
+    static constexpr int activePollMs = 2;
+    static constexpr int idlePollMs = 20;
+
+    SamplerStreamer() : juce::Thread ("SamplerStreamer") {}
+
+    ~SamplerStreamer() override
+    {
+        stop();
+    }
+
+    /** Service these engines (message thread). An empty list leaves the thread stopped. */
+    void setEngines (std::vector<SamplerEngine*> newEngines)
+    {
+        stop();
+        engines = std::move (newEngines);
+        if (! engines.empty())
+            startThread (juce::Thread::Priority::high);
+    }
+
+    void stop()
+    {
+        stopThread (2000);
+    }
+
+private:
+    void run() override
+    {
+        while (! threadShouldExit())
+        {
+            bool active = false;
+            for (auto* engine : engines)
+                active = engine->serviceStream() || active;
+
+            wait (active ? activePollMs : idlePollMs);
+        }
+    }
+
+    std::vector<SamplerEngine*> engines;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SamplerStreamer)
+};
@@ -0,0 +1,435 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+/**
+ * Same-host control transport between the WFS-DIY plugin set and the app.
+ *
+ * This header is shared between the WFS-DIY app and the WFS-DIY plugin set.
+ * It MUST stay free of app-only deps (no WFSParameterIDs, no ValueTree).
+ * It depends only on juce_core.
+ *
+ * The app creates one memory-mapped segment (a file in the temp folder that
+ * both processes map, so a write never goes through the network stack)
+ * holding a fixed pool of single-producer / single-consumer rings. A Master
+ * plugin instance claims one ring for as long as it is connected and is its
+ * only producer; the app is the only consumer of every ring. The app
+ * advertises the segment in its OSCQuery HOST_INFO:
+ *
+ *   "LOCAL_CONTROL": { "PATH": "<segment file>", "SESSION": <int> }
+ *
+ * A plugin that cannot open the file, finds a different session (app
+ * restarted) or finds its ring full sends that value over UDP instead, so
+ * UDP stays the fallback for everything the ring does not carry.
+ *
+ * Records are fixed-size: the input's channel ID, a parameter handle (index
+ * into paramPaths()), the value, an optional ramp time and an optional NTP
+ * timetag. The app applies each one exactly as the equivalent
+ * /wfs/input/<param> <id> <value> [ramp] OSC message, inside a bundle with
+ * that timetag when it is set.
+ */
+namespace LocalControlRing
+{
+    constexpr uint32_t magic        = 0x43534657;   // "WFSC"
+    constexpr uint32_t version      = 3;
+    constexpr int      numRings     = 8;            // Concurrent Master instances
+    constexpr uint32_t ringCapacity = 4096;         // Records per ring, power of two
+
+    /** A claimed ring whose producer has not written for this long is
+        released by the app (the plugin reclaims one on its next write). */
+    constexpr juce::uint32 staleClaimMs = 5000;
+
+    /** Ring::claim values. A producer's token is even and non-zero; it holds
+        token | claimWriting for the whole of a write, so the app, which only
+        releases with a CAS on the bare token, can never free a ring under a
+        write in progress. claimReleasing keeps new claimants out while the app
+        drains what the old producer finished and empties the ring. */
+    constexpr uint32_t claimFree      = 0;
+    constexpr uint32_t claimReleasing = 1;
+    constexpr uint32_t claimWriting   = 1;
+
+    //==========================================================================
+    /** Parameters a record can address; the handle is the index. Append only:
+        the app and the plugins agree on handles through this table alone. */
+    inline const std::array<const char*, 13>& paramPaths()
+    {
+        static const std::array<const char*, 13> paths = {
+            "/wfs/input/positionX",
+            "/wfs/input/positionY",
+            "/wfs/input/positionZ",
+            "/wfs/input/attenuation",
+            "/wfs/input/attenuationLaw",
+            "/wfs/input/distanceAttenuation",
+            "/wfs/input/distanceRatio",
+            "/wfs/input/commonAtten",
+            "/wfs/input/directivity",
+            "/wfs/input/rotation",
+            "/wfs/input/tilt",
+            "/wfs/input/HFshelf",
+            "/wfs/input/LFOactive"
+        };
+        return paths;
+    }
+
+    /** -1 when the path has no handle (send it over UDP). */
+    inline int findParamHandle (const juce::String& oscPath) noexcept
+    {
+        const auto& paths = paramPaths();
+        for (size_t i = 0; i < paths.size(); ++i)
+            if (oscPath == paths[i])
+                return static_cast<int> (i);
+        return -1;
+    }
+
+    inline const char* getParamPath (int handle) noexcept
+    {
+        const auto& paths = paramPaths();
+        return (handle >= 0 && static_cast<size_t> (handle) < paths.size())
+                   ? paths[static_cast<size_t> (handle)] : nullptr;
+    }
+
+    //==========================================================================
+    struct Record
+    {
+        int32_t  inputId     = 0;      // 1-based channel ID, as in the OSC message
+        uint16_t paramHandle = 0;
+        uint16_t reserved    = 0;
+        float    value       = 0.0f;
+        float    rampSeconds = 0.0f;   // 0 = instant set
+        uint64_t timeTag     = 0;      // OSC/NTP timetag, 0 = apply on arrival
+    };
+
+    static_assert (sizeof (Record) == 24, "Record layout is shared between processes");
+    static_assert (std::is_trivially_copyable_v<Record>, "Record must stay POD");
+    static_assert (std::atomic<uint32_t>::is_always_lock_free,
+                   "Ring indices must be address-free to work across processes");
+
+    struct Ring
+    {
+        std::atomic<uint32_t> claim { 0 };       // claimFree, claimReleasing, token [| claimWriting]
+        std::atomic<uint32_t> heartbeat { 0 };   // Bumped by the producer on every write
+        std::atomic<uint32_t> dropped { 0 };     // Writes that found the ring full
+        alignas (64) std::atomic<uint32_t> head { 0 };   // Next write (producer)
+        alignas (64) std::atomic<uint32_t> tail { 0 };   // Next read (consumer)
+        alignas (64) Record records[ringCapacity];
+    };
+
+    struct Segment
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t ringCount;
+        uint32_t recordsPerRing;
+        uint32_t recordSize;
+        std::atomic<uint32_t> session;   // Published last; 0 = segment closed
+        alignas (64) Ring rings[numRings];
+    };
+
+    constexpr size_t segmentSize = sizeof (Segment);
+
+    /** The segment file for an app whose OSCQuery server is on httpPort. */
+    inline juce::File getDefaultSegmentFile (int httpPort)
+    {
+        return juce::File::getSpecialLocation (juce::File::tempDirectory)
+                   .getChildFile ("WFS-DIY-local-control-" + juce::String (httpPort) + ".shm");
+    }
+
+    //==========================================================================
+    /**
+     * Plugin side: maps an advertised segment and claims one ring. push() is
+     * wait-free and only ever called from one thread (the Master's rate
+     * limiter); false means "not delivered, use UDP", including whenever the
+     * app released the ring before the write could start. true means the app
+     * will apply the record.
+     */
+    class Producer
+    {
+    public:
+        ~Producer() { close(); }
+
+        bool open (const juce::File& segmentFile, uint32_t expectedSession)
+        {
+            close();
+            if (expectedSession == 0 || ! segmentFile.existsAsFile())
+                return false;
+
+            auto mapped = std::make_unique<juce::MemoryMappedFile> (segmentFile, juce::MemoryMappedFile::readWrite);
+            if (mapped->getData() == nullptr || mapped->getSize() < segmentSize)
+                return false;
+
+            auto* seg = static_cast<Segment*> (mapped->getData());
+            if (seg->magic != magic || seg->version != version
+                || seg->ringCount != static_cast<uint32_t> (numRings)
+                || seg->recordsPerRing != ringCapacity || seg->recordSize != sizeof (Record)
+                || seg->session.load (std::memory_order_acquire) != expectedSession)
+                return false;
+
+            file = std::move (mapped);
+            segment = seg;
+            session = expectedSession;
+            token = (static_cast<uint32_t> (juce::Random::getSystemRandom().nextInt()) & ~claimWriting) | 2u;
+            if (claimRing())
+                return true;
+
+            close();   // Every ring taken by other Master instances
+            return false;
+        }
+
+        void close()
+        {
+            // Free the ring only once the app has read everything we pushed;
+            // otherwise it releases the ring itself after draining it
+            if (segment != nullptr && ring != nullptr
+                && ring->tail.load (std::memory_order_acquire) == ring->head.load (std::memory_order_relaxed))
+            {
+                uint32_t expected = token;
+                ring->claim.compare_exchange_strong (expected, claimFree, std::memory_order_release);
+            }
+            ring = nullptr;
+            segment = nullptr;
+            file.reset();
+        }
+
+        bool isOpen() const noexcept { return segment != nullptr; }
+
+        bool push (int inputId, int paramHandle, float value,
+                   float rampSeconds = 0.0f, uint64_t timeTag = 0) noexcept
+        {
+            if (segment == nullptr || paramHandle < 0
+                || segment->session.load (std::memory_order_acquire) != session)
+                return false;
+
+            // The app released our ring after a long idle spell: take a free one.
+            if (! beginWrite())
+                if (! claimRing() || ! beginWrite())
+                    return false;
+
+            const uint32_t head = ring->head.load (std::memory_order_relaxed);
+            if (head - ring->tail.load (std::memory_order_acquire) >= ringCapacity)
+            {
+                ring->dropped.fetch_add (1, std::memory_order_relaxed);
+                endWrite();
+                return false;
+            }
+
+            auto& r = ring->records[head & (ringCapacity - 1)];
+            r.inputId = inputId;
+            r.paramHandle = static_cast<uint16_t> (paramHandle);
+            r.reserved = 0;
+            r.value = value;
+            r.rampSeconds = rampSeconds;
+            r.timeTag = timeTag;
+            ring->head.store (head + 1, std::memory_order_release);
+            ring->heartbeat.fetch_add (1, std::memory_order_relaxed);
+            endWrite();
+            return true;
+        }
+
+    private:
+        // Fails when the app released the ring: nothing may be written to it then
+        bool beginWrite() noexcept
+        {
+            if (ring == nullptr)
+                return false;
+
+            uint32_t expected = token;
+            return ring->claim.compare_exchange_strong (expected, token | claimWriting,
+                                                        std::memory_order_acq_rel);
+        }
+
+        // Only we move the claim out of the writing state
+        void endWrite() noexcept
+        {
+            ring->claim.store (token, std::memory_order_release);
+        }
+
+        bool claimRing() noexcept
+        {
+            ring = nullptr;
+            for (auto& candidate : segment->rings)
+            {
+                uint32_t expected = claimFree;
+                if (candidate.claim.compare_exchange_strong (expected, token, std::memory_order_acq_rel))
+                {
+                    ring = &candidate;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        std::unique_ptr<juce::MemoryMappedFile> file;
+        Segment* segment = nullptr;
+        Ring* ring = nullptr;
+        uint32_t session = 0;
+        uint32_t token = 0;
+    };
+
+    //==========================================================================
+    /**
+     * App side: creates the segment and drains every claimed ring. All calls
+     * on one thread.
+     */
+    class Consumer
+    {
+    public:
+        ~Consumer() { close(); }
+
+        bool create (const juce::File& segmentFile)
+        {
+            close();
+
+            // Size the file first (a plugin may still map a previous session's
+            // file, so it is rewritten in place rather than deleted).
+            {
+                juce::FileOutputStream out (segmentFile);
+                if (out.failedToOpen())
+                    return false;
+                out.setPosition (0);
+                out.truncate();
+                if (! out.writeRepeatedByte (0, segmentSize))
+                    return false;
+            }
+
+            auto mapped = std::make_unique<juce::MemoryMappedFile> (segmentFile, juce::MemoryMappedFile::readWrite);
+            if (mapped->getData() == nullptr || mapped->getSize() < segmentSize)
+                return false;
+
+            auto* seg = static_cast<Segment*> (mapped->getData());
+            seg->session.store (0, std::memory_order_release);
+            for (auto& r : seg->rings)
+            {
+                r.claim.store (0, std::memory_order_relaxed);
+                r.heartbeat.store (0, std::memory_order_relaxed);
+                r.dropped.store (0, std::memory_order_relaxed);
+                r.head.store (0, std::memory_order_relaxed);
+                r.tail.store (0, std::memory_order_relaxed);
+            }
+            seg->magic = magic;
+            seg->version = version;
+            seg->ringCount = static_cast<uint32_t> (numRings);
+            seg->recordsPerRing = ringCapacity;
+            seg->recordSize = sizeof (Record);
+
+            session = static_cast<uint32_t> (juce::Random::getSystemRandom().nextInt()) | 1u;
+            seg->session.store (session, std::memory_order_release);
+
+            file = std::move (mapped);
+            segment = seg;
+            path = segmentFile;
+            watch = {};
+            return true;
+        }
+
+        void close()
+        {
+            if (segment != nullptr)
+                segment->session.store (0, std::memory_order_release);
+            segment = nullptr;
+            file.reset();
+            if (path != juce::File())
+                path.deleteFile();   // Fails harmlessly while a plugin still maps it
+            path = juce::File();
+        }
+
+        bool isOpen() const noexcept                  { return segment != nullptr; }
+        uint32_t getSession() const noexcept          { return session; }
+        const juce::File& getSegmentFile() const noexcept { return path; }
+
+        /** Applies fn (const Record&) to at most maxRecords queued records,
+            ring by ring in arrival order, and releases stale claims (a ring
+            being released is always drained to the end, past maxRecords). */
+        template <typename Fn>
+        int drain (Fn&& fn, int maxRecords)
+        {
+            if (segment == nullptr)
+                return 0;
+
+            const auto now = juce::Time::getMillisecondCounter();
+            int drained = 0;
+            for (int i = 0; i < numRings; ++i)
+            {
+                auto& r = segment->rings[i];
+                auto& w = watch[static_cast<size_t> (i)];
+                const uint32_t claim = r.claim.load (std::memory_order_acquire);
+                if (claim == claimFree || claim == claimReleasing)
+                {
+                    w = {};
+                    continue;
+                }
+
+                uint32_t tail = r.tail.load (std::memory_order_relaxed);
+                const uint32_t head = r.head.load (std::memory_order_acquire);
+                while (tail != head && drained < maxRecords)
+                {
+                    fn (r.records[tail & (ringCapacity - 1)]);
+                    ++tail;
+                    ++drained;
+                }
+                r.tail.store (tail, std::memory_order_release);
+
+                const uint32_t beat = r.heartbeat.load (std::memory_order_relaxed);
+                if (beat != w.heartbeat || w.sinceMs == 0)
+                {
+                    w.heartbeat = beat;
+                    w.sinceMs = now;
+                }
+                else if (tail == head && now - w.sinceMs > staleClaimMs)
+                {
+                    // Producer gone (or idle): take the ring back unless a write
+                    // is in progress (then the CAS fails and we retry next
+                    // drain). Once it succeeds the producer cannot start another
+                    // write, so deliver whatever it finished since we looked,
+                    // and hand the ring back empty.
+                    uint32_t expected = claim & ~claimWriting;
+                    if (r.claim.compare_exchange_strong (expected, claimReleasing, std::memory_order_acq_rel))
+                    {
+                        for (const uint32_t last = r.head.load (std::memory_order_acquire); tail != last; ++tail, ++drained)
+                            fn (r.records[tail & (ringCapacity - 1)]);
+
+                        r.tail.store (tail, std::memory_order_release);
+                        r.claim.store (claimFree, std::memory_order_release);
+                    }
+                    w = {};
+                }
+            }
+            return drained;
+        }
+
+        int getNumClaimedRings() const noexcept
+        {
+            int n = 0;
+            if (segment != nullptr)
+                for (auto& r : segment->rings)
+                    n += r.claim.load (std::memory_order_relaxed) > claimReleasing ? 1 : 0;
+            return n;
+        }
+
+        uint32_t getDroppedTotal() const noexcept
+        {
+            uint32_t n = 0;
+            if (segment != nullptr)
+                for (auto& r : segment->rings)
+                    n += r.dropped.load (std::memory_order_relaxed);
+            return n;
+        }
+
+    private:
+        struct Watch
+        {
+            uint32_t heartbeat = 0;
+            juce::uint32 sinceMs = 0;
+        };
+
+        std::unique_ptr<juce::MemoryMappedFile> file;
+        Segment* segment = nullptr;
+        juce::File path;
+        uint32_t session = 0;
+        std::array<Watch, numRings> watch {};
+    };
+}
@@ -767,6 +767,13 @@ public:
     void sdActivateCurrentClusterLFO()       { activateCurrentClusterLFO(); }
     void sdStopAllClusterLFOs()              { stopAllClusterLFOs(); }
 
+    /** Advance all cluster LFOs and recompute their per-input offsets.
+        Called from the 50Hz block of MainComponent's message-thread timer with
+        the measured time since the previous tick, so they run while this tab
+        is hidden. A busy message thread delays ticks; stalls over 100 ms pause
+        the LFOs rather than advancing them. */
+    void processClusterLFOs (float deltaTimeSeconds) { processAllClusterLFOs (deltaTimeSeconds); }
+
     bool isAnyClusterLFOActive() const
     {
         for (int c = 1; c <= 10; ++c)
@@ -1896,9 +1903,9 @@ private:
     // MainComponent reads these offsets and feeds them to the calculation engine.
     //==========================================================================
 
-    void processAllClusterLFOs()
+    void processAllClusterLFOs (float deltaTimeSeconds)
     {
-        clusterLFOProcessor.process(0.02f);
+        clusterLFOProcessor.process (deltaTimeSeconds);
 
         int numInputs = parameters.getNumInputChannels();
 
@@ -2853,8 +2860,7 @@ private:
 
     void timerCallback() override
     {
-        // Process cluster LFOs for ALL clusters (even when no inputs selected)
-        processAllClusterLFOs();
+        // Cluster LFOs are processed on MainComponent's control tick
 
         // Update LFO UI indicators for the currently selected cluster
         updateLFOIndicators();
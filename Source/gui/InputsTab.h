@@ -444,6 +444,8 @@ public:
             { &offsetXEditor, &offsetYEditor, &offsetZEditor },
             // Distance range editors
             { &distanceMinEditor, &distanceMaxEditor },
+            // Tracking prediction editors
+            { &trackingHorizonEditor, &trackingMaxLeadEditor },
             // Attenuation + law dials (invisible ones auto-skipped)
             { &attenuationValueLabel, &delayLatencyValueLabel,
               &distanceAttenValueLabel, &distanceRatioValueLabel, &commonAttenValueLabel },
@@ -1399,6 +1401,54 @@ private:
         trackingSmoothUnitLabel.setJustificationType(juce::Justification::left);
         trackingSmoothUnitLabel.setMinimumHorizontalScale(1.0f);
 
+        // Tracking prediction mode (Off / Constant Velocity / Alpha-Beta)
+        addAndMakeVisible(trackingPredictLabel);
+        trackingPredictLabel.setText(LOC("inputs.labels.trackingPredict"), juce::dontSendNotification);
+        addAndMakeVisible(trackingPredictSelector);
+        trackingPredictSelector.addItem(LOC("inputs.trackingPredict.off"), 1);
+        trackingPredictSelector.addItem(LOC("inputs.trackingPredict.constantVelocity"), 2);
+        trackingPredictSelector.addItem(LOC("inputs.trackingPredict.alphaBeta"), 3);
+        trackingPredictSelector.setSelectedId(1, juce::dontSendNotification);
+        trackingPredictSelector.onChange = [this]() {
+            saveInputParam(WFSParameterIDs::inputTrackingPredict, trackingPredictSelector.getSelectedId() - 1);
+            // TTS: Announce selection change
+            TTSManager::getInstance().announceValueChange("Tracking Prediction", trackingPredictSelector.getText());
+        };
+
+        // Prediction horizon editor (ms)
+        addAndMakeVisible(trackingHorizonLabel);
+        trackingHorizonLabel.setText(LOC("inputs.labels.trackingHorizon"), juce::dontSendNotification);
+        addAndMakeVisible(trackingHorizonEditor);
+        trackingHorizonEditor.setText(juce::String(WFSParameterDefaults::inputTrackingPredictHorizonDefault), juce::dontSendNotification);
+        trackingHorizonEditor.setInputRestrictions(3, "0123456789");
+        trackingHorizonEditor.onReturnKey = [this]() {
+            int ms = juce::jlimit(WFSParameterDefaults::inputTrackingPredictHorizonMin,
+                                  WFSParameterDefaults::inputTrackingPredictHorizonMax,
+                                  trackingHorizonEditor.getText().getIntValue());
+            trackingHorizonEditor.setText(juce::String(ms), juce::dontSendNotification);
+            saveInputParam(WFSParameterIDs::inputTrackingPredictHorizon, ms);
+        };
+        trackingHorizonEditor.onFocusLost = trackingHorizonEditor.onReturnKey;
+        addAndMakeVisible(trackingHorizonUnitLabel);
+        trackingHorizonUnitLabel.setText(LOC("units.milliseconds"), juce::dontSendNotification);
+
+        // Prediction max lead editor (m)
+        addAndMakeVisible(trackingMaxLeadLabel);
+        trackingMaxLeadLabel.setText(LOC("inputs.labels.trackingMaxLead"), juce::dontSendNotification);
+        addAndMakeVisible(trackingMaxLeadEditor);
+        trackingMaxLeadEditor.setText(juce::String(WFSParameterDefaults::inputTrackingPredictMaxLeadDefault, 2), juce::dontSendNotification);
+        trackingMaxLeadEditor.setInputRestrictions(4, "0123456789.");
+        trackingMaxLeadEditor.onReturnKey = [this]() {
+            float lead = juce::jlimit(WFSParameterDefaults::inputTrackingPredictMaxLeadMin,
+                                      WFSParameterDefaults::inputTrackingPredictMaxLeadMax,
+                                      trackingMaxLeadEditor.getText().getFloatValue());
+            trackingMaxLeadEditor.setText(juce::String(lead, 2), juce::dontSendNotification);
+            saveInputParam(WFSParameterIDs::inputTrackingPredictMaxLead, lead);
+        };
+        trackingMaxLeadEditor.onFocusLost = trackingMaxLeadEditor.onReturnKey;
+        addAndMakeVisible(trackingMaxLeadUnitLabel);
+        trackingMaxLeadUnitLabel.setText(LOC("units.meters"), juce::dontSendNotification);
+
         // Max Speed
         addAndMakeVisible(maxSpeedActiveButton);
         maxSpeedActiveButton.setButtonText(LOC("inputs.toggles.maxSpeedOff"));
@@ -3360,6 +3410,9 @@ private:
         trackingActiveButton.setVisible(v);
         trackingIdLabel.setVisible(v); trackingIdSelector.setVisible(v);
         trackingSmoothLabel.setVisible(v); trackingSmoothDial.setVisible(v); trackingSmoothValueLabel.setVisible(v); trackingSmoothUnitLabel.setVisible(v);
+        trackingPredictLabel.setVisible(v); trackingPredictSelector.setVisible(v);
+        trackingHorizonLabel.setVisible(v); trackingHorizonEditor.setVisible(v); trackingHorizonUnitLabel.setVisible(v);
+        trackingMaxLeadLabel.setVisible(v); trackingMaxLeadEditor.setVisible(v); trackingMaxLeadUnitLabel.setVisible(v);
         maxSpeedActiveButton.setVisible(v);
         maxSpeedLabel.setVisible(v); maxSpeedDial.setVisible(v); maxSpeedValueLabel.setVisible(v); maxSpeedUnitLabel.setVisible(v);
         pathModeButton.setVisible(v);
@@ -3777,6 +3830,21 @@ private:
         trackingSmoothValueLabel.setBounds(rightCol.removeFromTop(rowHeight - 5));
         rightCol.removeFromTop(spacing);
 
+        // Tracking prediction: mode, then horizon and max lead
+        row = rightCol.removeFromTop(rowHeight);
+        trackingPredictLabel.setBounds(row.removeFromLeft(scaled(75)));
+        trackingPredictSelector.setBounds(row.removeFromLeft(scaled(130)));
+        rightCol.removeFromTop(spacing);
+
+        row = rightCol.removeFromTop(rowHeight);
+        trackingHorizonLabel.setBounds(row.removeFromLeft(scaled(60)));
+        trackingHorizonEditor.setBounds(row.removeFromLeft(scaled(45)));
+        trackingHorizonUnitLabel.setBounds(row.removeFromLeft(scaled(30)));
+        trackingMaxLeadLabel.setBounds(row.removeFromLeft(scaled(70)));
+        trackingMaxLeadEditor.setBounds(row.removeFromLeft(scaled(45)));
+        trackingMaxLeadUnitLabel.setBounds(row.removeFromLeft(scaled(20)));
+        rightCol.removeFromTop(spacing);
+
         // Max Speed section
         row = rightCol.removeFromTop(rowHeight);
         maxSpeedActiveButton.setBounds(row.removeFromLeft(scaled(150)));
@@ -4369,6 +4437,20 @@ private:
         heightCol.removeFromTop(dialSize);
         layoutDialValueUnit(heightFactorValueLabel, heightFactorUnitLabel, colCenterX, heightCol.getY(), rowHeight);
 
+        // Tracking prediction row below the four columns: mode, horizon, max lead
+        col1.removeFromTop(spacing);
+        row = col1.removeFromTop(rowHeight);
+        trackingPredictLabel.setBounds(row.removeFromLeft(scaled(75)));
+        trackingPredictSelector.setBounds(row.removeFromLeft(scaled(130)));
+        row.removeFromLeft(spacing * 2);
+        trackingHorizonLabel.setBounds(row.removeFromLeft(scaled(60)));
+        trackingHorizonEditor.setBounds(row.removeFromLeft(scaled(45)));
+        trackingHorizonUnitLabel.setBounds(row.removeFromLeft(scaled(30)));
+        row.removeFromLeft(spacing);
+        trackingMaxLeadLabel.setBounds(row.removeFromLeft(scaled(70)));
+        trackingMaxLeadEditor.setBounds(row.removeFromLeft(scaled(45)));
+        trackingMaxLeadUnitLabel.setBounds(row.removeFromLeft(scaled(20)));
+
         // ========== COLUMN 2: Sound + Mutes ==========
 
         // --- Top row: Attenuation Law, Distance Atten, Common Atten (tighter layout) ---
@@ -5361,6 +5443,16 @@ private:
         trackingSmoothDial.setValue(trackSmoothPct / 100.0f);
         trackingSmoothValueLabel.setText(juce::String(static_cast<int>(trackSmoothPct)), juce::dontSendNotification);
 
+        int trackPredict = juce::jlimit(WFSParameterDefaults::inputTrackingPredictMin, WFSParameterDefaults::inputTrackingPredictMax,
+                                        getIntParam(WFSParameterIDs::inputTrackingPredict, WFSParameterDefaults::inputTrackingPredictDefault));
+        trackingPredictSelector.setSelectedId(trackPredict + 1, juce::dontSendNotification);
+        trackingHorizonEditor.setText(juce::String(getIntParam(WFSParameterIDs::inputTrackingPredictHorizon,
+                                                               WFSParameterDefaults::inputTrackingPredictHorizonDefault)),
+                                      juce::dontSendNotification);
+        trackingMaxLeadEditor.setText(juce::String(getFloatParam(WFSParameterIDs::inputTrackingPredictMaxLead,
+                                                                 WFSParameterDefaults::inputTrackingPredictMaxLeadDefault), 2),
+                                      juce::dontSendNotification);
+
         bool maxSpeedActive = getIntParam(WFSParameterIDs::inputMaxSpeedActive, 0) != 0;
         maxSpeedActiveButton.setToggleState(maxSpeedActive, juce::dontSendNotification);
         maxSpeedActiveButton.setButtonText(maxSpeedActive ? LOC("inputs.toggles.maxSpeedOn") : LOC("inputs.toggles.maxSpeedOff"));
@@ -7276,6 +7368,9 @@ private:
         helpTextMap[&trackingActiveButton] = LOC("inputs.help.trackingActiveButton");
         helpTextMap[&trackingIdSelector] = LOC("inputs.help.trackingIdSelector");
         helpTextMap[&trackingSmoothDial] = LOC("inputs.help.trackingSmoothDial");
+        helpTextMap[&trackingPredictSelector] = LOC("inputs.help.trackingPredictSelector");
+        helpTextMap[&trackingHorizonEditor] = LOC("inputs.help.trackingHorizonEditor");
+        helpTextMap[&trackingMaxLeadEditor] = LOC("inputs.help.trackingMaxLeadEditor");
         helpTextMap[&maxSpeedActiveButton] = LOC("inputs.help.maxSpeedActiveButton");
         helpTextMap[&maxSpeedDial] = LOC("inputs.help.maxSpeedDial");
         helpTextMap[&pathModeButton] = LOC("inputs.help.pathModeButton");
@@ -7402,6 +7497,9 @@ private:
         oscMethodMap[&trackingActiveButton] = "/wfs/input/trackingActive <ID> <value>";
         oscMethodMap[&trackingIdSelector] = "/wfs/input/trackingID <ID> <value>";
         oscMethodMap[&trackingSmoothDial] = "/wfs/input/trackingSmooth <ID> <value>";
+        oscMethodMap[&trackingPredictSelector] = "/wfs/input/trackingPredict <ID> <value>";
+        oscMethodMap[&trackingHorizonEditor] = "/wfs/input/trackingPredictHorizon <ID> <value>";
+        oscMethodMap[&trackingMaxLeadEditor] = "/wfs/input/trackingPredictMaxLead <ID> <value>";
         oscMethodMap[&maxSpeedActiveButton] = "/wfs/input/maxSpeedActive <ID> <value>";
         oscMethodMap[&maxSpeedDial] = "/wfs/input/maxSpeed <ID> <value>";
         oscMethodMap[&pathModeButton] = "/wfs/input/pathModeActive <ID> <value>";
@@ -8178,6 +8276,11 @@ private:
     WfsBasicDial trackingSmoothDial;
     juce::Label trackingSmoothValueLabel;
     juce::Label trackingSmoothUnitLabel;
+    juce::Label trackingPredictLabel;
+    juce::ComboBox trackingPredictSelector;
+    juce::Label trackingHorizonLabel, trackingMaxLeadLabel;
+    juce::TextEditor trackingHorizonEditor, trackingMaxLeadEditor;
+    juce::Label trackingHorizonUnitLabel, trackingMaxLeadUnitLabel;
     juce::TextButton maxSpeedActiveButton;
     juce::Label maxSpeedLabel;
     WfsBasicDial maxSpeedDial;
@@ -3,6 +3,7 @@
 #include <JuceHeader.h>
 #include "../DSP/LevelMeteringManager.h"
 #include "../DSP/WFSCalculationEngine.h"
+#include "../DSP/MotionLatencyTracer.h"
 #include "../Parameters/WFSValueTreeState.h"
 #include "ColorScheme.h"
 #include "WindowUtils.h"
@@ -269,8 +270,10 @@ class LevelMeterWindowContent : public juce::Component,
 {
 public:
     LevelMeterWindowContent(LevelMeteringManager& manager, WFSValueTreeState& vts,
-                            WFSCalculationEngine* calcEngine = nullptr)
-        : levelManager(manager), valueTreeState(vts), calculationEngine(calcEngine)
+                            WFSCalculationEngine* calcEngine = nullptr,
+                            MotionLatencyTracer* latencyTracer = nullptr)
+        : levelManager(manager), valueTreeState(vts), calculationEngine(calcEngine),
+          motionLatency(latencyTracer)
     {
         // Input section label
         addAndMakeVisible(inputsLabel);
@@ -334,6 +337,12 @@ public:
             addChildComponent(gpuStripStatus);
         }
 
+        // Motion-to-sound latency line (right end of the controls row)
+        motionLatencyLabel.setJustificationType(juce::Justification::centredRight);
+        motionLatencyLabel.setFont(juce::FontOptions().withHeight(10.0f));
+        if (motionLatency != nullptr)
+            addAndMakeVisible(motionLatencyLabel);
+
         // Initialize button states
         updateSoloButtonStates();
         updateSoloButtonColors();
@@ -373,6 +382,9 @@ public:
         controlsArea.removeFromLeft(sc(10));  // Spacing
         soloModeButton.setBounds(controlsArea.removeFromLeft(sc(100)));
 
+        if (motionLatency != nullptr)
+            motionLatencyLabel.setBounds(controlsArea.removeFromRight(juce::jmin(sc(260), controlsArea.getWidth() / 2)));
+
         bounds.removeFromBottom(sc(10));  // Spacing
 
         // GPU pipeline strip: shares the controls row, to the RIGHT of the
@@ -616,12 +628,52 @@ private:
             }
         }
 
+        // Percentiles sort a few thousand samples: refresh at 2 Hz, not 20
+        if (motionLatency != nullptr && ++motionLatencyTick >= 10)
+        {
+            motionLatencyTick = 0;
+            updateMotionLatency();
+        }
+
         // Update solo button states and colors
         updateSoloButtonStates();
         updateSoloButtonColors();
         updateSoloModeButtonText();  // Keep in sync with changes from other tabs
     }
 
+    void updateMotionLatency()
+    {
+        const auto snap = motionLatency->getSnapshot();
+        const auto& total = snap.stages[MotionLatencyTracer::Total];
+        if (total.samples == 0)
+        {
+            motionLatencyLabel.setText(LOC("levelMeter.motionLatency.idle"), juce::dontSendNotification);
+            motionLatencyLabel.setTooltip({});
+            return;
+        }
+
+        auto ms = [](double v) { return juce::String(v, 1); };
+        motionLatencyLabel.setText(LOC("levelMeter.motionLatency.status")
+                                       .replace("{p50}", ms(total.p50Ms))
+                                       .replace("{p95}", ms(total.p95Ms))
+                                       .replace("{p99}", ms(total.p99Ms)),
+                                   juce::dontSendNotification);
+
+        juce::StringArray lines;
+        for (int s = 0; s < MotionLatencyTracer::NumStages; ++s)
+        {
+            const auto& st = snap.stages[static_cast<size_t>(s)];
+            lines.add(LOC("levelMeter.motionLatency.stage")
+                          .replace("{stage}", MotionLatencyTracer::getStageName(s))
+                          .replace("{p50}", ms(st.p50Ms))
+                          .replace("{p95}", ms(st.p95Ms))
+                          .replace("{p99}", ms(st.p99Ms))
+                          .replace("{max}", ms(st.maxMs))
+                          .replace("{n}", juce::String(st.samples)));
+        }
+        motionLatencyLabel.setTooltip(lines.joinIntoString("\n"));
+    }
+
     //==========================================================================
     // GPU pipeline strip (see constructor / resized / timerCallback)
     //==========================================================================
@@ -857,6 +909,7 @@ private:
     LevelMeteringManager& levelManager;
     WFSValueTreeState& valueTreeState;
     WFSCalculationEngine* calculationEngine = nullptr;
+    MotionLatencyTracer* motionLatency = nullptr;
 
     juce::Label inputsLabel;
     juce::Label outputsLabel;
@@ -883,6 +936,9 @@ private:
     juce::Label gpuStripStatus;
     bool gpuStripVisible = false;
 
+    juce::Label motionLatencyLabel;
+    int motionLatencyTick = 0;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LevelMeterWindowContent)
 };
 
@@ -895,7 +951,8 @@ class LevelMeterWindow : public juce::DocumentWindow,
 {
 public:
     LevelMeterWindow(LevelMeteringManager& manager, WFSValueTreeState& vts,
-                     WFSCalculationEngine* calcEngine = nullptr)
+                     WFSCalculationEngine* calcEngine = nullptr,
+                     MotionLatencyTracer* latencyTracer = nullptr)
         : DocumentWindow(LOC("levelMeter.windowTitle"),
                          ColorScheme::get().background,
                          DocumentWindow::allButtons),
@@ -904,7 +961,7 @@ public:
         setUsingNativeTitleBar(true);
         setResizable(true, true);
 
-        content = std::make_unique<LevelMeterWindowContent>(manager, vts, calcEngine);
+        content = std::make_unique<LevelMeterWindowContent>(manager, vts, calcEngine, latencyTracer);
         content->setName(LOC("levelMeter.windowTitle"));
         setContentOwned(content.get(), false);
 
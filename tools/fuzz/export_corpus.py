@@ -0,0 +1,153 @@
+"""Write the fuzz corpora to a flat text file for offline harnesses.
+
+osc_fuzz.py sends its packets to a live app. Benchmarks that drive the
+parsers directly (tools/validation/osc-route-bench) want the same traffic
+without a socket, so this dumps it as one message per line:
+
+    <address>\t<tag>:<value>\t<tag>:<value>...
+
+Tags: 'i' int32 (decimal), 'f' float32 (repr; nan/inf/-inf allowed),
+'s' string (UTF-8, hex), 'b' blob (hex). Messages carrying any other tag
+(T/F/N/d/h, raw 'X' bytes) are skipped, as are RAW_PACKETS: the bench
+builds juce::OSCMessage objects and those cannot be expressed as one.
+
+Layers:
+  1     corpus.CASES
+  2     addresses.ENTRIES x their edge-value pools
+  3     the osc_fuzz.py random walk (fixed seed), --random messages
+  feed  well-formed tracking/console traffic: positions on every channel
+        in both address forms, attenuation with fade times, output EQ
+
+Usage:
+  python export_corpus.py --out corpus.txt [--layers 1,2,3,feed]
+                          [--random 5000] [--channels 64]
+"""
+
+from __future__ import annotations
+
+import argparse
+import random
+import sys
+from typing import Iterable
+
+import addresses
+import corpus
+from osc_fuzz import RAND_PARAMS, RAND_PREFIXES, RAND_TAGS, _rand_value
+
+
+SUPPORTED_TAGS = {"i", "f", "s", "b"}
+
+
+def _encode_value(tag: str, value) -> str:
+    if tag == "i":
+        return str(int(value))
+    if tag == "f":
+        return repr(float(value))
+    if tag == "s":
+        return str(value).encode("utf-8", "surrogatepass").hex()
+    return bytes(value).hex()
+
+
+def _line(address: str, args: Iterable[tuple[str, object]]) -> str | None:
+    args = list(args)
+    if any(tag not in SUPPORTED_TAGS for tag, _ in args):
+        return None
+    if "\t" in address or "\n" in address:
+        return None
+    return "\t".join([address] + [f"{t}:{_encode_value(t, v)}" for t, v in args])
+
+
+def layer1() -> Iterable[tuple[str, list]]:
+    for case in corpus.CASES:
+        yield case.address, case.args
+
+
+def layer2(channel: int) -> Iterable[tuple[str, list]]:
+    for entry in addresses.ENTRIES:
+        if entry.value_kind == "name":
+            pool = addresses.STRING_EDGES
+        elif entry.value_kind == "bool" or entry.shape == "channel-int":
+            pool = addresses.ints_for_kind(entry.value_kind)
+        else:
+            pool = addresses.floats_for_kind(entry.value_kind)
+
+        for value in pool:
+            if entry.shape == "channel-float":
+                yield entry.address, [("i", channel), ("f", float(value))]
+            elif entry.shape == "channel-string":
+                yield entry.address, [("i", channel), ("s", str(value))]
+            elif entry.shape == "channel-int":
+                yield entry.address, [("i", channel), ("i", int(value))]
+            elif entry.shape == "config-float":
+                yield entry.address, [("f", float(value))]
+            elif entry.shape == "cluster-move":
+                yield entry.address, [("i", channel), ("f", float(value)), ("f", float(value))]
+            elif entry.shape == "cluster-scalar":
+                yield entry.address, [("i", channel), ("f", float(value))]
+
+
+def layer3(count: int) -> Iterable[tuple[str, list]]:
+    rng = random.Random(0xCAFEBABE)  # same seed as osc_fuzz.py layer 3
+    for _ in range(count):
+        address = rng.choice(RAND_PREFIXES) + rng.choice(RAND_PARAMS)
+        args = []
+        for _ in range(rng.randint(0, 6)):
+            tag = rng.choice(RAND_TAGS)
+            args.append((tag, _rand_value(tag, rng)))
+        yield address, args
+
+
+def feed(channels: int) -> Iterable[tuple[str, list]]:
+    rng = random.Random(7)
+    for ch in range(1, channels + 1):
+        x, y = rng.uniform(-8, 8), rng.uniform(-4, 4)
+        yield "/wfs/input/positionX", [("i", ch), ("f", x)]
+        yield "/wfs/input/positionY", [("i", ch), ("f", y)]
+        yield f"/wfs/input/{ch}/positionX", [("f", x)]
+        yield f"/wfs/input/{ch}/positionY", [("f", y)]
+        yield "/wfs/input/attenuation", [("i", ch), ("f", -6.0), ("f", 2.0)]
+        yield f"/wfs/input/{ch}/LFOamplitudeX", [("f", 1.5)]
+        yield "/wfs/output/EQgain", [("i", ch), ("i", 2), ("f", -3.0)]
+        yield f"/wfs/output/{ch}/delayLatency", [("f", 1.0)]
+    yield "/wfs/config/stage/width", [("f", 20.0)]
+
+
+def main() -> int:
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--out", required=True)
+    ap.add_argument("--layers", default="1,2,3,feed")
+    ap.add_argument("--random", type=int, default=5000,
+                    help="layer 3 message count")
+    ap.add_argument("--channels", type=int, default=64,
+                    help="channels covered by the feed layer")
+    ap.add_argument("--channel", type=int, default=corpus.CH,
+                    help="channel used by layer 2")
+    args = ap.parse_args()
+
+    sources = {
+        "1": lambda: layer1(),
+        "2": lambda: layer2(args.channel),
+        "3": lambda: layer3(args.random),
+        "feed": lambda: feed(args.channels),
+    }
+
+    written = skipped = 0
+    with open(args.out, "w", encoding="utf-8", newline="\n") as f:
+        for layer in args.layers.split(","):
+            if layer not in sources:
+                print(f"error: unknown layer {layer!r}", file=sys.stderr)
+                return 2
+            for address, msg_args in sources[layer]():
+                line = _line(address, msg_args)
+                if line is None:
+                    skipped += 1
+                    continue
+                f.write(line + "\n")
+                written += 1
+
+    print(f"wrote {written} messages to {args.out} ({skipped} skipped)")
+    return 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
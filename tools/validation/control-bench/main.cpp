@@ -0,0 +1,638 @@
+//==============================================================================
+// control-bench — cost of one control-rate tick, stage by stage.
+//
+// Everything the app does at control rate has to fit the tick (20 ms at the
+// default 50 Hz), not just the matrix recompute matrix-bench looks at. This
+// tool builds a synthetic WFSValueTreeState of the requested size, constructs
+// the real control-rate objects over it and runs them in MainComponent's
+// order, timing each stage per tick:
+//
+//   writes        state writes the scenario injects (tracking, snapshot recall)
+//   ramper        OSCParameterRamper::process
+//   lfo           LFOProcessor::process
+//   clusterLfo    ClusterLFOProcessor::process
+//   automotion    AutomOtionProcessor::setInputLevels + process
+//   offsets       setLFOOffset / setGyrophoneOffset for every input
+//   gradientMaps  GradientMapEvaluator::evaluate at the composite positions
+//                 (and the re-rasterisation on snapshot recall)
+//   lsTamer       LiveSourceTamerEngine::process
+//   ramps         WFSCalculationEngine::updateDelayModeRamps
+//   matrix        WFSCalculationEngine::recalculateMatrixIfDirty
+//   total         sum of the above
+//
+//   control-bench [--sizes 32x64,64x128] [--reverbs 4]
+//                 [--scenario static|moving|tracking|snapshot] [--ticks 1000]
+//                 [--warmup 50] [--workers 0] [--recall-every 50]
+//                 [--budget-ms 20] [--strict] [--json out.json]
+//
+// Scenarios:
+//   static    nothing moves; LFOs idle, gradient maps and LS Tamer enabled
+//   moving    every input LFO, all cluster LFOs and AutomOtion running, an
+//             attenuation ramp on every input, LS gain reduction varying
+//   tracking  every input's position written to the ValueTree each tick, the
+//             way tracking OSC lands (setInputParameter, listeners included)
+//   snapshot  static, plus every --recall-every ticks a bulk rewrite of the
+//             recalled input parameters and gradient map re-rasterisation
+//
+// Cluster LFO offsets are applied to the inputs assigned to a cluster as a
+// plain translation; the app's ClustersTab also rotates/scales around the
+// cluster reference, which this does not model.
+//
+// All times are in ns per tick. Per size it reports min/med/p99/p999/max/mean
+// for every stage and counts the ticks whose total exceeded --budget-ms;
+// --strict turns any such tick into exit code 1. Baselines for a reference
+// machine belong in tools/validation/baselines/.
+//==============================================================================
+
+#include <JuceHeader.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Parameters/WFSValueTreeState.h"
+#include "DSP/WFSCalculationEngine.h"
+#include "DSP/LiveSourceTamerEngine.h"
+#include "DSP/LFOProcessor.h"
+#include "DSP/ClusterLFOProcessor.h"
+#include "Automation/AutomOtionProcessor.h"
+#include "GradientMap/GradientMapEvaluator.h"
+#include "Network/OSCParameterRamper.h"
+
+namespace
+{
+
+using namespace WFSParameterIDs;
+
+//==============================================================================
+double nowNs()
+{
+    using namespace std::chrono;
+    return duration<double, std::nano> (steady_clock::now().time_since_epoch()).count();
+}
+
+//==============================================================================
+enum class Scenario { Static, Moving, Tracking, Snapshot };
+
+const char* scenarioName (Scenario s)
+{
+    switch (s)
+    {
+        case Scenario::Static:   return "static";
+        case Scenario::Moving:   return "moving";
+        case Scenario::Tracking: return "tracking";
+        case Scenario::Snapshot: return "snapshot";
+    }
+    return "?";
+}
+
+bool scenarioFromName (const std::string& n, Scenario& out)
+{
+    if (n == "static")   { out = Scenario::Static;   return true; }
+    if (n == "moving")   { out = Scenario::Moving;   return true; }
+    if (n == "tracking") { out = Scenario::Tracking; return true; }
+    if (n == "snapshot") { out = Scenario::Snapshot; return true; }
+    return false;
+}
+
+enum Stage
+{
+    stageWrites, stageRamper, stageLfo, stageClusterLfo, stageAutomotion, stageOffsets,
+    stageGradientMaps, stageLsTamer, stageRamps, stageMatrix, stageTotal, numStages
+};
+
+const char* const stageNames[numStages] =
+{
+    "writes", "ramper", "lfo", "clusterLfo", "automotion", "offsets",
+    "gradientMaps", "lsTamer", "ramps", "matrix", "total"
+};
+
+struct Size { int numIn = 0; int numOut = 0; };
+
+struct Config
+{
+    std::vector<Size> sizes { { 32, 64 }, { 64, 128 } };
+    int numReverbs = 4;
+    Scenario scenarioId = Scenario::Moving;
+    int ticks = 1000;
+    int warmup = 50;                 // ticks excluded from distributions
+    int workers = 0;
+    int recallEvery = 50;
+    double budgetMs = 20.0;
+    bool strict = false;
+    std::string jsonArg;
+};
+
+constexpr float tickSeconds = 0.02f;   // The app's nominal 50 Hz step
+
+//==============================================================================
+struct Dist
+{
+    bool valid = false;
+    double minV = 0, med = 0, p99 = 0, p999 = 0, maxV = 0, mean = 0;
+};
+
+Dist computeDist (std::vector<double> v)
+{
+    Dist d;
+    if (v.empty())
+        return d;
+    std::sort (v.begin(), v.end());
+    const size_t n = v.size();
+    auto at = [&] (double q) { return v[std::min (n - 1, (size_t) std::llround (q * (double) (n - 1)))]; };
+    d.valid = true;
+    d.minV = v.front();
+    d.maxV = v.back();
+    d.med  = at (0.5);
+    d.p99  = at (0.99);
+    d.p999 = at (0.999);
+    double sum = 0;
+    for (double x : v) sum += x;
+    d.mean = sum / (double) n;
+    return d;
+}
+
+//==============================================================================
+// Synthetic show: matrix-bench's stage layout (sources over a 20 x 10 m stage,
+// frontal line array plus an upstage row), with LFO, cluster, AutomOtion, LS
+// Tamer and gradient map parameters filled in so every stage has work.
+//==============================================================================
+void growChildren (juce::ValueTree parent, int target)
+{
+    const auto prototype = parent.getChild (0);
+    for (int i = parent.getNumChildren(); i < target; ++i)
+    {
+        auto copy = prototype.createCopy();
+        copy.setProperty (id, i + 1, nullptr);
+        parent.appendChild (copy, nullptr);
+    }
+}
+
+float baseX (int i, int numIn) { return -8.0f + 16.0f * (float) i / (float) numIn; }
+float baseY (int i, int numIn) { return -2.0f + 6.0f * std::fmod ((float) i / (float) numIn * 7.0f, 1.0f); }
+
+void buildState (WFSValueTreeState& state, const Config& cfg, const Size& size)
+{
+    state.setNumInputChannels (size.numIn);
+    state.setNumOutputChannels (size.numOut);
+    state.setNumReverbChannels (cfg.numReverbs);
+
+    // Past the app maxima: append copies of channel 0
+    growChildren (state.getInputsState(), size.numIn);
+    growChildren (state.getOutputsState(), size.numOut);
+
+    const bool moving = cfg.scenarioId == Scenario::Moving;
+
+    for (int i = 0; i < size.numIn; ++i)
+    {
+        auto pos = state.getInputPositionSection (i);
+        pos.setProperty (inputPositionX, baseX (i, size.numIn), nullptr);
+        pos.setProperty (inputPositionY, baseY (i, size.numIn), nullptr);
+        pos.setProperty (inputPositionZ, 1.5f, nullptr);
+
+        state.getInputAttenuationSection (i).setProperty (inputAttenuationLaw, i % 2, nullptr);
+        state.getInputChannelSection (i).setProperty (inputMinimalLatency, (i % 3) == 0 ? 1 : 0, nullptr);
+        state.getInputDirectivitySection (i).setProperty (inputDirectivity, 180, nullptr);
+        state.getInputHackousticsSection (i).setProperty (inputFRactive, (i % 2) == 0 ? 1 : 0, nullptr);
+        state.setInputParameter (i, inputCluster, (i % 10) + 1);
+
+        auto lfo = state.getInputLFOSection (i);
+        lfo.setProperty (inputLFOactive, moving ? 1 : 0, nullptr);
+        lfo.setProperty (inputLFOperiod, 4.0f + (float) (i % 5), nullptr);
+        lfo.setProperty (inputLFOshapeX, 1, nullptr);
+        lfo.setProperty (inputLFOshapeY, 1, nullptr);
+        lfo.setProperty (inputLFOamplitudeX, 1.0f, nullptr);
+        lfo.setProperty (inputLFOamplitudeY, 0.5f, nullptr);
+        lfo.setProperty (inputLFOphaseY, 90, nullptr);
+        lfo.setProperty (inputLFOgyrophone, (i % 4) == 0 ? 1 : 0, nullptr);
+
+        // Relative AutomOtion: a 2 m sweep, started by the moving scenario
+        auto otomo = state.getInputAutoMotionSection (i);
+        otomo.setProperty (inputOtomoAbsoluteRelative, 1, nullptr);
+        otomo.setProperty (inputOtomoStayReturn, 1, nullptr);
+        otomo.setProperty (inputOtomoDuration, 2.0f, nullptr);
+        otomo.setProperty (inputOtomoX, 2.0f, nullptr);
+        otomo.setProperty (inputOtomoY, 0.0f, nullptr);
+
+        auto ls = state.getInputLiveSourceSection (i);
+        ls.setProperty (inputLSactive, (i % 2) == 0 ? 1 : 0, nullptr);
+        ls.setProperty (inputLSradius, 4.0f, nullptr);
+        ls.setProperty (inputLSpeakEnable, 1, nullptr);
+        ls.setProperty (inputLSslowEnable, 1, nullptr);
+    }
+
+    for (int c = 0; c < ClusterLFOProcessor::maxClusters; ++c)
+    {
+        auto lfo = state.getClusterLFOSection (c + 1);
+        lfo.setProperty (clusterLFOactive, moving ? 1 : 0, nullptr);
+        lfo.setProperty (clusterLFOshapeX, 1, nullptr);
+        lfo.setProperty (clusterLFOshapeRot, 1, nullptr);
+    }
+
+    const int frontCount = (size.numOut * 3) / 4;
+    for (int o = 0; o < size.numOut; ++o)
+    {
+        const bool front = o < frontCount;
+        const int k = front ? o : o - frontCount;
+        const int n = front ? frontCount : size.numOut - frontCount;
+        auto pos = state.getOutputPositionSection (o);
+        pos.setProperty (outputPositionX, -12.0f + 24.0f * ((float) k + 0.5f) / (float) juce::jmax (1, n), nullptr);
+        pos.setProperty (outputPositionY, front ? -6.0f : 6.0f, nullptr);
+        pos.setProperty (outputPositionZ, front ? 0.5f : 4.0f, nullptr);
+        pos.setProperty (outputOrientation, front ? 0 : 180, nullptr);
+        state.getOutputChannelSection (o).setProperty (outputArray, front ? 1 : 2, nullptr);
+    }
+}
+
+// One blurred ellipse per layer: attenuation, height and HF shelf all active
+GradientMap::InputGradientMap makeGradientMap (int input, int variant)
+{
+    GradientMap::InputGradientMap map;
+    const GradientMap::TargetParam params[] = { GradientMap::TargetParam::Attenuation,
+                                                GradientMap::TargetParam::Height,
+                                                GradientMap::TargetParam::HFShelf };
+    for (size_t l = 0; l < map.layers.size(); ++l)
+    {
+        auto& layer = map.layers[l];
+        layer.enabled = true;
+        layer.param = params[l];
+        layer.whiteValue = 0.0f;
+        layer.blackValue = l == 1 ? 2.0f : -12.0f;
+
+        GradientMap::Shape shape;
+        shape.type = GradientMap::ShapeType::Ellipse;
+        shape.posX = -6.0f + (float) ((input + variant + (int) l) % 12);
+        shape.posY = 1.0f;
+        shape.scaleX = 3.0f;
+        shape.scaleY = 2.0f;
+        shape.fillType = GradientMap::FillType::RadialGradient;
+        shape.blur = 0.5f;
+        layer.shapes.push_back (shape);
+    }
+    return map;
+}
+
+//==============================================================================
+struct RunResult
+{
+    Size size;
+    int ticks = 0;
+    int workers = 0;
+    std::array<Dist, numStages> stages;
+    int overBudgetTicks = 0;
+};
+
+RunResult runOneSize (const Config& cfg, const Size& size)
+{
+    RunResult r;
+    r.size = size;
+
+    WFSValueTreeState state;
+    buildState (state, cfg, size);
+
+    WFSCalculationEngine engine (state, size.numIn, size.numOut, cfg.numReverbs);
+    engine.setRecalcWorkers (cfg.workers);
+    r.workers = engine.getRecalcWorkers();
+
+    WFSNetwork::OSCParameterRamper ramper (state);
+    LFOProcessor lfo (state, size.numIn);
+    ClusterLFOProcessor clusterLfo (state);
+    AutomOtionProcessor automOtion (state, size.numIn);
+    LiveSourceTamerEngine lsTamer (state, engine, size.numIn, size.numOut);
+
+    std::vector<std::unique_ptr<GradientMapEvaluator>> gradientMaps;
+    std::vector<int> clusterOf ((size_t) size.numIn);
+    for (int i = 0; i < size.numIn; ++i)
+    {
+        auto e = std::make_unique<GradientMapEvaluator>();
+        e->setStageBounds (-10.0f, 10.0f, -5.0f, 5.0f);
+        e->rasterizeAll (makeGradientMap (i, 0));
+        gradientMaps.push_back (std::move (e));
+        clusterOf[(size_t) i] = (int) state.getInputParameter (i, inputCluster) - 1;
+    }
+
+    std::vector<float> peakGRs ((size_t) size.numIn, 1.0f), slowGRs ((size_t) size.numIn, 1.0f);
+
+    std::array<std::vector<double>, numStages> samples;
+    for (auto& s : samples)
+        s.reserve ((size_t) cfg.ticks);
+
+    const double budgetNs = cfg.budgetMs * 1.0e6;
+
+    for (int tick = 0; tick < cfg.warmup + cfg.ticks; ++tick)
+    {
+        const float phase = (float) tick * tickSeconds;
+        const bool recall = cfg.scenarioId == Scenario::Snapshot && tick % cfg.recallEvery == 0;
+        std::array<double, numStages> t {};
+
+        // Scenario input that lands before the tick in the app (OSC, recall)
+        double s = nowNs();
+        if (cfg.scenarioId == Scenario::Tracking)
+        {
+            for (int i = 0; i < size.numIn; ++i)
+            {
+                state.setInputParameter (i, inputPositionX, baseX (i, size.numIn) + std::sin (phase * 3.0f + (float) i));
+                state.setInputParameter (i, inputPositionY, baseY (i, size.numIn) + std::cos (phase * 2.0f + (float) i));
+            }
+        }
+        else if (recall)
+        {
+            const int variant = tick / cfg.recallEvery;
+            for (int i = 0; i < size.numIn; ++i)
+            {
+                state.setInputParameter (i, inputPositionX, baseX (i, size.numIn) + (float) (variant % 3) - 1.0f);
+                state.setInputParameter (i, inputPositionY, baseY (i, size.numIn));
+                state.setInputParameter (i, inputAttenuation, -3.0f * (float) (variant % 2));
+                state.setInputParameter (i, inputDirectivity, 120 + 60 * (variant % 2));
+                state.setInputParameter (i, inputLSradius, 3.0f + (float) (variant % 2));
+            }
+        }
+        t[stageWrites] = nowNs() - s;
+
+        if (cfg.scenarioId == Scenario::Moving && tick % 50 == 0)
+            for (int i = 0; i < size.numIn; ++i)
+                ramper.startRamp (i, inputAttenuation, (tick / 50) % 2 == 0 ? -6.0 : 0.0, 0.5f);
+
+        s = nowNs();
+        ramper.process();
+        t[stageRamper] = nowNs() - s;
+
+        s = nowNs();
+        lfo.process (tickSeconds);
+        t[stageLfo] = nowNs() - s;
+
+        s = nowNs();
+        clusterLfo.process (tickSeconds);
+        t[stageClusterLfo] = nowNs() - s;
+
+        s = nowNs();
+        for (int i = 0; i < size.numIn; ++i)
+        {
+            const float level = cfg.scenarioId == Scenario::Moving ? -20.0f + 10.0f * std::sin (phase + (float) i) : -60.0f;
+            automOtion.setInputLevels (i, level, level - 6.0f);
+        }
+        if (cfg.scenarioId == Scenario::Moving)
+            for (int i = 0; i < size.numIn; ++i)
+                if (! automOtion.isMotionActive (i))
+                    automOtion.startMotion (i);
+        automOtion.process (tickSeconds);
+        t[stageAutomotion] = nowNs() - s;
+
+        s = nowNs();
+        for (int i = 0; i < size.numIn; ++i)
+        {
+            float x = lfo.getOffsetX (i), y = lfo.getOffsetY (i), z = lfo.getOffsetZ (i);
+            const int c = clusterOf[(size_t) i];
+            if (c >= 0 && c < ClusterLFOProcessor::maxClusters)
+            {
+                x += clusterLfo.getOffsetX (c);
+                y += clusterLfo.getOffsetY (c);
+                z += clusterLfo.getOffsetZ (c);
+            }
+            engine.setLFOOffset (i, x, y, z);
+            engine.setGyrophoneOffset (i, lfo.getGyrophoneOffsetRad (i));
+        }
+        t[stageOffsets] = nowNs() - s;
+
+        s = nowNs();
+        if (recall)
+            for (int i = 0; i < size.numIn; ++i)
+                gradientMaps[(size_t) i]->rasterizeAll (makeGradientMap (i, tick / cfg.recallEvery));
+        for (int i = 0; i < size.numIn; ++i)
+        {
+            const auto pos = engine.getCompositeInputPosition (i);
+            const auto o = gradientMaps[(size_t) i]->evaluate (pos.x, pos.y);
+            engine.setGradientMapOffsets (i, o.attenuationDb, o.heightMeters, o.hfShelfDb);
+        }
+        t[stageGradientMaps] = nowNs() - s;
+
+        if (cfg.scenarioId == Scenario::Moving)
+        {
+            for (int i = 0; i < size.numIn; ++i)
+            {
+                peakGRs[(size_t) i] = 0.75f + 0.25f * std::sin (phase * 5.0f + (float) i);
+                slowGRs[(size_t) i] = 0.85f + 0.15f * std::cos (phase + (float) i);
+            }
+        }
+
+        s = nowNs();
+        lsTamer.process (peakGRs, slowGRs);
+        for (int i = 0; i < size.numIn; ++i)
+        {
+            if (lsTamer.inputNeedsRecalculation (i))
+            {
+                engine.markLSGainsDirty();
+                break;
+            }
+        }
+        t[stageLsTamer] = nowNs() - s;
+
+        // The worker's stages, run inline here
+        s = nowNs();
+        engine.updateDelayModeRamps (tickSeconds);
+        t[stageRamps] = nowNs() - s;
+
+        s = nowNs();
+        engine.recalculateMatrixIfDirty (&lsTamer.getLSGainOverlay());
+        t[stageMatrix] = nowNs() - s;
+
+        for (int st = 0; st < stageTotal; ++st)
+            t[stageTotal] += t[(size_t) st];
+
+        if (tick >= cfg.warmup)
+        {
+            for (int st = 0; st < numStages; ++st)
+                samples[(size_t) st].push_back (t[(size_t) st]);
+            if (t[stageTotal] > budgetNs)
+                ++r.overBudgetTicks;
+        }
+    }
+
+    r.ticks = cfg.ticks;
+    for (int st = 0; st < numStages; ++st)
+        r.stages[(size_t) st] = computeDist (std::move (samples[(size_t) st]));
+    return r;
+}
+
+//==============================================================================
+void printResult (const RunResult& r, const Config& cfg)
+{
+    std::printf ("%d in x %d out (%d ticks, %d workers)\n",
+                 r.size.numIn, r.size.numOut, r.ticks, r.workers);
+    for (int st = 0; st < numStages; ++st)
+    {
+        const Dist& d = r.stages[(size_t) st];
+        if (! d.valid)
+            continue;
+        std::printf ("  %-13s min %10.0f  med %10.0f  p99 %10.0f  p999 %10.0f  max %10.0f  mean %10.0f ns\n",
+                     stageNames[st], d.minV, d.med, d.p99, d.p999, d.maxV, d.mean);
+    }
+    const Dist& total = r.stages[stageTotal];
+    std::printf ("  budget %.1f ms: p999 uses %.1f%%, %d/%d ticks over\n",
+                 cfg.budgetMs, total.valid ? 100.0 * total.p999 / (cfg.budgetMs * 1.0e6) : 0.0,
+                 r.overBudgetTicks, r.ticks);
+    std::fflush (stdout);
+}
+
+void appendDistJson (juce::String& s, const char* name, const Dist& d, bool first)
+{
+    if (! d.valid)
+        return;
+    s << (first ? "" : ", ") << "\"" << name << "\": { \"min\": " << juce::String (d.minV, 0)
+      << ", \"median\": " << juce::String (d.med, 0)
+      << ", \"p99\": " << juce::String (d.p99, 0)
+      << ", \"p999\": " << juce::String (d.p999, 0)
+      << ", \"max\": " << juce::String (d.maxV, 0)
+      << ", \"mean\": " << juce::String (d.mean, 0) << " }";
+}
+
+bool writeJson (const juce::File& f, const Config& cfg, const std::vector<RunResult>& runs)
+{
+    juce::String s;
+    s << "{\n"
+      << "  \"scenario\": \"" << scenarioName (cfg.scenarioId) << "\",\n"
+      << "  \"reverbs\": " << cfg.numReverbs
+      << ", \"ticks\": " << cfg.ticks
+      << ", \"warmup\": " << cfg.warmup
+      << ", \"budgetMs\": " << juce::String (cfg.budgetMs, 3)
+      << ", \"unit\": \"ns\",\n"
+      << "  \"runs\": [\n";
+
+    for (size_t i = 0; i < runs.size(); ++i)
+    {
+        const RunResult& r = runs[i];
+        s << "    { \"in\": " << r.size.numIn
+          << ", \"out\": " << r.size.numOut
+          << ", \"workers\": " << r.workers
+          << ", \"overBudgetTicks\": " << r.overBudgetTicks
+          << ",\n      \"stages\": { ";
+        for (int st = 0; st < numStages; ++st)
+            appendDistJson (s, stageNames[st], r.stages[(size_t) st], st == 0);
+        s << " } }" << (i + 1 < runs.size() ? "," : "") << "\n";
+    }
+    s << "  ]\n}\n";
+
+    f.getParentDirectory().createDirectory();
+    return f.replaceWithText (s);
+}
+
+bool parseSizes (const std::string& v, std::vector<Size>& out)
+{
+    out.clear();
+    for (const auto& tok : juce::StringArray::fromTokens (juce::String (v), ",", ""))
+    {
+        const int x = tok.indexOfChar ('x');
+        if (x <= 0)
+            return false;
+        Size sz { tok.substring (0, x).getIntValue(), tok.substring (x + 1).getIntValue() };
+        if (sz.numIn <= 0 || sz.numOut <= 0)
+            return false;
+        out.push_back (sz);
+    }
+    return ! out.empty();
+}
+
+void usage()
+{
+    std::fprintf (stderr,
+        "usage: control-bench [--sizes 32x64,64x128] [--reverbs 4]\n"
+        "                     [--scenario static|moving|tracking|snapshot] [--ticks 1000]\n"
+        "                     [--warmup 50] [--workers 0] [--recall-every 50]\n"
+        "                     [--budget-ms 20] [--strict] [--json out.json]\n"
+        "\n"
+        "Runs the control-rate stages (ramper, LFOs, AutomOtion, gradient maps,\n"
+        "LS Tamer, delay ramps, matrix) over a synthetic show in the app's order\n"
+        "and reports per-stage min/med/p99/p999/max/mean in ns per tick.\n"
+        "\n"
+        "exit codes: 0 ok, 1 --strict and a tick over budget, 2 usage\n");
+}
+
+} // namespace
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;   // ValueTree listeners assert on the message thread
+    Config cfg;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string a = argv[i];
+        auto next = [&] () -> std::string
+        {
+            if (i + 1 >= argc)
+            {
+                std::fprintf (stderr, "error: %s needs a value\n", a.c_str());
+                usage();
+                std::exit (2);
+            }
+            return argv[++i];
+        };
+
+        if      (a == "--reverbs")      cfg.numReverbs = std::atoi (next().c_str());
+        else if (a == "--ticks")        cfg.ticks = std::atoi (next().c_str());
+        else if (a == "--warmup")       cfg.warmup = std::atoi (next().c_str());
+        else if (a == "--workers")      cfg.workers = juce::jmax (0, std::atoi (next().c_str()));
+        else if (a == "--recall-every") cfg.recallEvery = std::atoi (next().c_str());
+        else if (a == "--budget-ms")    cfg.budgetMs = std::atof (next().c_str());
+        else if (a == "--strict")       cfg.strict = true;
+        else if (a == "--json")         cfg.jsonArg = next();
+        else if (a == "--sizes")
+        {
+            if (! parseSizes (next(), cfg.sizes))
+                { std::fprintf (stderr, "error: --sizes wants INxOUT[,INxOUT...]\n"); return 2; }
+        }
+        else if (a == "--scenario")
+        {
+            if (! scenarioFromName (next(), cfg.scenarioId))
+                { std::fprintf (stderr, "error: unknown scenario\n"); return 2; }
+        }
+        else if (a == "--help" || a == "-h") { usage(); return 0; }
+        else
+        {
+            std::fprintf (stderr, "error: unknown argument '%s'\n", a.c_str());
+            usage();
+            return 2;
+        }
+    }
+
+    if (cfg.ticks <= 0 || cfg.warmup < 0 || cfg.recallEvery <= 0 || cfg.budgetMs <= 0.0
+        || cfg.numReverbs < 1 || cfg.numReverbs > WFSParameterDefaults::maxReverbChannels)
+    {
+        std::fprintf (stderr, "error: invalid tick/reverb/budget arguments\n");
+        return 2;
+    }
+
+    std::fprintf (stderr, "control-bench: scenario=%s reverbs=%d ticks=%d warmup=%d budget=%.1fms\n",
+                  scenarioName (cfg.scenarioId), cfg.numReverbs, cfg.ticks, cfg.warmup, cfg.budgetMs);
+
+    std::vector<RunResult> runs;
+    bool overBudget = false;
+    for (const auto& size : cfg.sizes)
+    {
+        RunResult r = runOneSize (cfg, size);
+        printResult (r, cfg);
+        overBudget = overBudget || r.overBudgetTicks > 0;
+        runs.push_back (std::move (r));
+    }
+
+    if (! cfg.jsonArg.empty())
+    {
+        const auto f = juce::File::getCurrentWorkingDirectory()
+                           .getChildFile (juce::String (cfg.jsonArg));
+        if (writeJson (f, cfg, runs))
+            std::fprintf (stderr, "note: JSON written to %s\n",
+                          f.getFullPathName().toRawUTF8());
+        else
+            std::fprintf (stderr, "warning: could not write %s\n",
+                          f.getFullPathName().toRawUTF8());
+    }
+
+    return cfg.strict && overBudget ? 1 : 0;
+}
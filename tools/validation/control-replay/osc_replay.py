@@ -11,8 +11,15 @@ against a committed golden JSON.
 All write values are chosen binary-exact (x.25 / x.5) so float32 round-trip
 is bit-stable.
 
+With --latency-budget-ms, the driver first plays tracker stand-in: a
+50 Hz /wfs/input/positionX/Y stream on an input no read-back touches, then
+reads the motion-to-sound trace (MCP diagnostics_get_motion_latency) and
+fails if the total p99 exceeds the budget. Needs audio processing running
+in the launched app; a trace with no samples fails the same way.
+
 Usage:
   python osc_replay.py [--exe path] [--update] [--keep-temp]
+                       [--latency-budget-ms 40] [--latency-frames 250]
 
 Exit codes: 0 pass, 1 mismatch, 2 usage, 3 app failed to start.
 """
@@ -21,6 +28,7 @@ from __future__ import annotations
 
 import argparse
 import json
+import math
 import os
 import shutil
 import sys
@@ -73,6 +81,50 @@ READS = [
 ]
 
 
+# Latency stream target: not in WRITES/READS, so the golden is unaffected.
+LATENCY_CHANNEL = 8
+
+
+def _latency_stream(frames: int) -> None:
+    """Tracker stand-in: a circle at 50 Hz, one X and one Y write per frame."""
+    sender = common.OSCSender(delay=0.0)
+    period = 1.0 / 50.0
+    start = time.monotonic()
+    for n in range(frames):
+        a = 2.0 * math.pi * n / 100.0
+        sender.send("/wfs/input/positionX", [("i", LATENCY_CHANNEL), ("f", 2.0 * math.cos(a))])
+        sender.send("/wfs/input/positionY", [("i", LATENCY_CHANNEL), ("f", 2.0 * math.sin(a))])
+        delay = start + (n + 1) * period - time.monotonic()
+        if delay > 0:
+            time.sleep(delay)
+    sender.close()
+
+
+def _check_latency(app, budget_ms: float) -> bool:
+    trace = common.tool_payload(app.tool("diagnostics_get_motion_latency"))
+    if not isinstance(trace, dict) or "stages" not in trace:
+        print(f"[osc-replay] HARD FAIL: no latency trace: {trace}", file=sys.stderr)
+        return False
+
+    for name in ("queue", "engine", "render", "total"):
+        st = trace["stages"].get(name, {})
+        print(f"[osc-replay] latency {name:6s} p50 {st.get('p50_ms', 0):6.2f} "
+              f"p95 {st.get('p95_ms', 0):6.2f} p99 {st.get('p99_ms', 0):6.2f} "
+              f"max {st.get('max_ms', 0):6.2f} ms ({st.get('samples', 0)} samples)")
+
+    total = trace["stages"].get("total", {})
+    if not total.get("samples"):
+        print("[osc-replay] HARD FAIL: no traced frames reached the audio "
+              "callback (is audio processing running?)", file=sys.stderr)
+        return False
+    if total.get("p99_ms", 0.0) > budget_ms:
+        print(f"[osc-replay] HARD FAIL: motion-to-sound p99 "
+              f"{total['p99_ms']:.2f} ms exceeds budget {budget_ms} ms",
+              file=sys.stderr)
+        return False
+    return True
+
+
 def _round(v):
     if isinstance(v, float):
         return round(v, 6)
@@ -87,6 +139,11 @@ def main() -> int:
     p.add_argument("--update", action="store_true",
                    help="Rewrite the golden with this run's read-backs")
     p.add_argument("--keep-temp", action="store_true")
+    p.add_argument("--latency-budget-ms", type=float, default=None,
+                   help="Also stream tracker-rate positions and fail if the "
+                        "motion-to-sound p99 exceeds this")
+    p.add_argument("--latency-frames", type=int, default=250,
+                   help="Frames in the latency stream (50 Hz)")
     args = p.parse_args()
 
     exe = common.find_exe(args.exe)
@@ -101,6 +158,13 @@ def main() -> int:
         # OSC listening + OSCQuery both come up when network.xml is applied.
         app.wait_for_oscquery()
 
+        latency_ok = True
+        if args.latency_budget_ms is not None:
+            app.tool("diagnostics_get_motion_latency", {"reset": True})
+            _latency_stream(args.latency_frames)
+            time.sleep(0.5)   # Let the last frames reach the audio callback
+            latency_ok = _check_latency(app, args.latency_budget_ms)
+
         # The app's OSC ingest queue COALESCES rapid same-(address, channel)
         # updates (OSCIngestQueue) — two quick writes to one slot keep only
         # the newest. The scripted sequence relies on write ordering (an
@@ -132,7 +196,7 @@ def main() -> int:
 
     # Hard invariants independent of the golden: the rejected write must
     # not have landed, and the inc-delta must have applied exactly once.
-    ok = True
+    ok = latency_ok
     if readbacks.get("input1.positionX") != [-3.25]:
         print("[osc-replay] HARD FAIL: out-of-range write was not rejected "
               f"keep-current: {readbacks.get('input1.positionX')}",
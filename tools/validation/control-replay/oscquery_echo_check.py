@@ -79,6 +79,21 @@ def parse_osc(data: bytes):
     return address, values
 
 
+def parse_osc_packet(data: bytes) -> list:
+    """Messages of one binary frame: a bare message, or the bundle the
+    server sends when a flush holds more than one change."""
+    if not data.startswith(b"#bundle\x00"):
+        return [parse_osc(data)]
+    messages = []
+    pos = 16  # "#bundle\0" + time tag
+    while pos + 4 <= len(data):
+        size = struct.unpack(">i", data[pos:pos + 4])[0]
+        pos += 4
+        messages.extend(parse_osc_packet(data[pos:pos + size]))
+        pos += size
+    return messages
+
+
 # ---------------------------------------------------------------------------
 # Minimal RFC 6455 WebSocket client
 # ---------------------------------------------------------------------------
@@ -163,10 +178,9 @@ class WSClient:
                                     enumerate(self._recv_exact(length)))
                 else:
                     payload = self._recv_exact(length)
-                if opcode == 0x2:      # binary: OSC value push
-                    addr, values = parse_osc(payload)
+                if opcode == 0x2:      # binary: OSC value push (or bundle)
                     with self._lock:
-                        self.pushes.append((addr, values))
+                        self.pushes.extend(parse_osc_packet(payload))
                 elif opcode == 0x9:    # ping -> pong
                     self._send_frame(0xA, payload)
                 elif opcode == 0x8:    # close
@@ -0,0 +1,680 @@
+//==============================================================================
+// matrix-bench — control-rate cost of WFSCalculationEngine::recalculateMatrix.
+//
+// The matrix recompute runs once per control-rate tick (ControlRateWorker,
+// 50 Hz by default), so its cost bounds how fast positions can update. This tool builds a synthetic WFSValueTreeState of the
+// requested size (beyond the app's channel maxima by appending copies of
+// channel 0), constructs a real engine over it, and times recalculateMatrix()
+// per tick under a chosen dirty pattern.
+//
+//   matrix-bench [--sizes 64x128,128x512] [--reverbs 4]
+//                [--scenario moving|full|single|speaker] [--ticks 500] [--warmup 25]
+//                [--kernel auto|scalar] [--workers 0] [--check] [--ls-gains]
+//                [--legacy-lookups] [--json out.json]
+//
+// Scenarios:
+//   moving  every input moves each tick (inputs dirty; reverb->output skipped)
+//   full    outputs dirty each tick as well (every matrix recomputed)
+//   single  one input moves per tick (typical single-performer tracking)
+//   speaker one output moves per tick, inputs still (one matrix column)
+//
+// The engine only recomputes dirty rows and columns; the mean number of
+// pairs sent through the kernel and finalised per tick is reported from
+// getLastRecalcStats().
+//
+// --legacy-lookups additionally times the ValueTree accesses the kernel made
+// per input x output pair before the flat parameter mirror (section fetch +
+// getProperty for output options/position/angular/delay-latency and the
+// per-pair sideline stage reads), without the math. It is the "before"
+// reference for the mirror: run both and compare against recalcMs.
+//
+// --kernel scalar forces the scalar row kernel (default: AVX2/NEON when the
+// CPU has it, see DSP/WFSMatrixKernel.h). --check runs a second engine on the
+// scalar path over the same state, forced through a full recompute every tick,
+// and compares every delay/level/HF entry of both matrices each tick against
+// the tolerances documented in WFSMatrixKernel.h; any excess fails the run
+// (exit 1). It so covers the incremental recompute as well as the kernel.
+//
+// --workers N spreads the rows over N extra threads (setRecalcWorkers). With
+// --check, a third engine on the same kernel runs serially and every published
+// matrix must match it exactly: the row split may never change a result. Delay and HF are only
+// compared where both paths have the pair active (level > 0).
+// It also checks that each pass's readMatrices() generation is the next one
+// and holds exactly what the per-matrix getters return.
+//
+// Per size it reports the recalc-time distribution min/med/p99/p999/max/mean
+// in ms and the resulting pairs per microsecond. Baselines for a reference
+// machine belong in tools/validation/baselines/.
+//==============================================================================
+
+#include <JuceHeader.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Parameters/WFSValueTreeState.h"
+#include "DSP/WFSCalculationEngine.h"
+#include "DSP/WFSMatrixKernel.h"
+
+namespace
+{
+
+using namespace WFSParameterIDs;
+
+//==============================================================================
+double nowMs()
+{
+    using namespace std::chrono;
+    return duration<double, std::milli> (steady_clock::now().time_since_epoch()).count();
+}
+
+//==============================================================================
+enum class Scenario { Moving, Full, Single, Speaker };
+
+const char* scenarioName (Scenario s)
+{
+    switch (s)
+    {
+        case Scenario::Moving: return "moving";
+        case Scenario::Full:   return "full";
+        case Scenario::Single: return "single";
+        case Scenario::Speaker: return "speaker";
+    }
+    return "?";
+}
+
+bool scenarioFromName (const std::string& n, Scenario& out)
+{
+    if (n == "moving") { out = Scenario::Moving; return true; }
+    if (n == "full")   { out = Scenario::Full;   return true; }
+    if (n == "single") { out = Scenario::Single; return true; }
+    if (n == "speaker") { out = Scenario::Speaker; return true; }
+    return false;
+}
+
+struct Size { int numIn = 0; int numOut = 0; };
+
+struct Config
+{
+    std::vector<Size> sizes { { 64, 128 }, { 128, 512 } };
+    int numReverbs = 4;
+    Scenario scenarioId = Scenario::Moving;
+    int ticks = 500;
+    int warmup = 25;                 // ticks excluded from distributions
+    bool forceScalar = false;
+    int workers = 0;
+    bool check = false;
+    bool lsGains = false;
+    bool legacyLookups = false;
+    std::string jsonArg;
+};
+
+//==============================================================================
+struct Dist
+{
+    bool valid = false;
+    double minV = 0, med = 0, p99 = 0, p999 = 0, maxV = 0, mean = 0;
+};
+
+Dist computeDist (std::vector<double> v)
+{
+    Dist d;
+    if (v.empty())
+        return d;
+    std::sort (v.begin(), v.end());
+    const size_t n = v.size();
+    auto at = [&] (double q) { return v[std::min (n - 1, (size_t) std::llround (q * (double) (n - 1)))]; };
+    d.valid = true;
+    d.minV = v.front();
+    d.maxV = v.back();
+    d.med  = at (0.5);
+    d.p99  = at (0.99);
+    d.p999 = at (0.999);
+    double sum = 0;
+    for (double x : v) sum += x;
+    d.mean = sum / (double) n;
+    return d;
+}
+
+//==============================================================================
+// Synthetic show: sources spread over a 20 x 10 m stage, speakers on a
+// frontal line array with a second upstage row facing the audience, a few
+// varied per-channel parameters so every branch of the kernel is taken.
+//==============================================================================
+void growChildren (juce::ValueTree parent, int target)
+{
+    const auto prototype = parent.getChild (0);
+    for (int i = parent.getNumChildren(); i < target; ++i)
+    {
+        auto copy = prototype.createCopy();
+        copy.setProperty (id, i + 1, nullptr);
+        parent.appendChild (copy, nullptr);
+    }
+}
+
+void buildState (WFSValueTreeState& state, const Config& cfg, const Size& size)
+{
+    state.setNumInputChannels (size.numIn);
+    state.setNumOutputChannels (size.numOut);
+    state.setNumReverbChannels (cfg.numReverbs);
+
+    // Past the app maxima: append copies of channel 0
+    growChildren (state.getInputsState(), size.numIn);
+    growChildren (state.getOutputsState(), size.numOut);
+
+    for (int i = 0; i < size.numIn; ++i)
+    {
+        const float t = (float) i / (float) size.numIn;
+        auto pos = state.getInputPositionSection (i);
+        pos.setProperty (inputPositionX, -8.0f + 16.0f * t, nullptr);
+        pos.setProperty (inputPositionY, -2.0f + 6.0f * std::fmod (t * 7.0f, 1.0f), nullptr);
+        pos.setProperty (inputPositionZ, 1.5f, nullptr);
+
+        state.getInputAttenuationSection (i).setProperty (inputAttenuationLaw, i % 2, nullptr);
+        state.getInputAttenuationSection (i).setProperty (inputCommonAtten, 50, nullptr);
+        state.getInputChannelSection (i).setProperty (inputMinimalLatency, (i % 3) == 0 ? 1 : 0, nullptr);
+        state.getInputDirectivitySection (i).setProperty (inputDirectivity, 180, nullptr);
+        state.getInputDirectivitySection (i).setProperty (inputHFshelf, -6.0f, nullptr);
+        state.getInputMutesSection (i).setProperty (inputSidelinesActive, (i % 4) == 0 ? 1 : 0, nullptr);
+        state.getInputHackousticsSection (i).setProperty (inputFRactive, (i % 2) == 0 ? 1 : 0, nullptr);
+    }
+
+    const int frontCount = (size.numOut * 3) / 4;
+    for (int o = 0; o < size.numOut; ++o)
+    {
+        const bool front = o < frontCount;
+        const int k = front ? o : o - frontCount;
+        const int n = front ? frontCount : size.numOut - frontCount;
+        auto pos = state.getOutputPositionSection (o);
+        pos.setProperty (outputPositionX, -12.0f + 24.0f * ((float) k + 0.5f) / (float) juce::jmax (1, n), nullptr);
+        pos.setProperty (outputPositionY, front ? -6.0f : 6.0f, nullptr);
+        pos.setProperty (outputPositionZ, front ? 0.5f : 4.0f, nullptr);
+        pos.setProperty (outputOrientation, front ? 0 : 180, nullptr);
+        pos.setProperty (outputAngleOn, 60, nullptr);
+        pos.setProperty (outputAngleOff, 30, nullptr);
+        state.getOutputChannelSection (o).setProperty (outputArray, front ? 1 : 2, nullptr);
+    }
+}
+
+//==============================================================================
+// Pre-mirror access pattern: the per-pair ValueTree reads the input x output
+// loop used to make. Returns a checksum so the reads cannot be elided.
+//==============================================================================
+double legacyLookupPass (WFSValueTreeState& state, int numIn, int numOut)
+{
+    double sink = 0.0;
+    for (int in = 0; in < numIn; ++in)
+    {
+        for (int out = 0; out < numOut; ++out)
+        {
+            auto options = state.getOutputOptionsSection (out);
+            auto position = state.getOutputPositionSection (out);
+            sink += (int) options.getProperty (outputMiniLatencyEnable, 1);
+            sink += (float) options.getProperty (outputDistanceAttenPercent, 100.0f);
+            sink += (float) position.getProperty (outputHFdamping, 0.0f);
+
+            auto angular = state.getOutputPositionSection (out);
+            sink += (int) angular.getProperty (outputOrientation, 0);
+            sink += (int) angular.getProperty (outputPitch, 0);
+            sink += (int) angular.getProperty (outputAngleOn, 0);
+            sink += (int) angular.getProperty (outputAngleOff, 0);
+
+            sink += (float) state.getOutputChannelSection (out).getProperty (outputDelayLatency, 0.0f);
+
+            auto mutes = state.getInputMutesSection (in);
+            sink += (int) mutes.getProperty (inputSidelinesActive, 0);
+            auto stage = state.getStageState();
+            sink += (float) stage.getProperty (stageWidth, 20.0f);
+            sink += (float) stage.getProperty (stageDepth, 10.0f);
+            sink += (float) stage.getProperty (originWidth, 0.0f);
+            sink += (float) stage.getProperty (originDepth, 0.0f);
+        }
+    }
+    return sink;
+}
+
+//==============================================================================
+// Vector vs scalar tolerances (see WFSMatrixKernel.h)
+constexpr double delayToleranceMs = 1.0e-3;
+constexpr double levelTolerance = 1.0e-4;
+constexpr double hfToleranceDb = 0.05;
+
+struct CheckResult
+{
+    double maxDelayDiffMs = 0.0, maxLevelDiff = 0.0, maxHFDiffDb = 0.0;
+    long long pairsCompared = 0, failures = 0;
+    long long publishMismatches = 0;   // Passes not published as one full new generation
+    long long parallelMismatches = 0;  // Passes differing from the serial twin (--workers)
+};
+
+bool checkPassed (const CheckResult& c)
+{
+    return c.failures == 0 && c.publishMismatches == 0 && c.parallelMismatches == 0;
+}
+
+// Each pass must publish exactly one new, fully sized generation
+void checkPublishedSet (const WFSCalculationEngine& e, juce::uint64 expectedGeneration, CheckResult& c)
+{
+    const auto m = e.readMatrices();
+    const auto n = (size_t) e.getNumInputs() * (size_t) e.getNumOutputs();
+    const auto nRev = (size_t) e.getNumInputs() * (size_t) e.getNumReverbs();
+
+    const bool same = m->generation == expectedGeneration
+        && e.getMatrixGeneration() == expectedGeneration
+        && m->delayTimesMs.size() == n && m->delayRatesMsPerS.size() == n
+        && m->levels.size() == n && m->hfAttenuationDb.size() == n
+        && m->frLevels.size() == n && m->inputReverbLevels.size() == nRev;
+
+    if (! same)
+        ++c.publishMismatches;
+}
+
+// Parallel vs serial on the same kernel: every published entry must be equal
+void checkSerialTwin (const WFSCalculationEngine& parallel, const WFSCalculationEngine& serial, CheckResult& c)
+{
+    const auto a = parallel.readMatrices();
+    const auto b = serial.readMatrices();
+
+    const bool same = a->delayTimesMs == b->delayTimesMs
+        && a->levels == b->levels
+        && a->hfAttenuationDb == b->hfAttenuationDb
+        && a->frDelayTimesMs == b->frDelayTimesMs
+        && a->frLevels == b->frLevels
+        && a->frHFAttenuationDb == b->frHFAttenuationDb
+        && a->inputReverbDelayTimesMs == b->inputReverbDelayTimesMs
+        && a->inputReverbLevels == b->inputReverbLevels
+        && a->inputReverbHFAttenuationDb == b->inputReverbHFAttenuationDb
+        && a->reverbOutputDelayTimesMs == b->reverbOutputDelayTimesMs
+        && a->reverbOutputLevels == b->reverbOutputLevels
+        && a->reverbOutputHFAttenuationDb == b->reverbOutputHFAttenuationDb;
+
+    if (! same)
+        ++c.parallelMismatches;
+}
+
+void compareMatrices (const WFSCalculationEngine& a, const WFSCalculationEngine& b,
+                      int numIn, int numOut, CheckResult& c)
+{
+    for (int in = 0; in < numIn; ++in)
+    {
+        for (int out = 0; out < numOut; ++out)
+        {
+            const float levelA = a.getLevel (in, out);
+            const float levelB = b.getLevel (in, out);
+            const double levelDiff = std::abs ((double) levelA - (double) levelB);
+            c.maxLevelDiff = std::max (c.maxLevelDiff, levelDiff);
+            bool ok = levelDiff <= levelTolerance;
+
+            if (levelA > 0.0f && levelB > 0.0f)
+            {
+                const double delayDiff = std::abs ((double) a.getDelayMs (in, out) - (double) b.getDelayMs (in, out));
+                const double hfDiff = std::abs ((double) a.getHFAttenuation (in, out) - (double) b.getHFAttenuation (in, out));
+                c.maxDelayDiffMs = std::max (c.maxDelayDiffMs, delayDiff);
+                c.maxHFDiffDb = std::max (c.maxHFDiffDb, hfDiff);
+                ok = ok && delayDiff <= delayToleranceMs && hfDiff <= hfToleranceDb;
+            }
+
+            ++c.pairsCompared;
+            if (! ok)
+                ++c.failures;
+        }
+    }
+}
+
+//==============================================================================
+struct RunResult
+{
+    Size size;
+    int ticks = 0;
+    const char* kernel = "scalar";
+    int workers = 0;
+    Dist recalcMs, legacyLookupMs;
+    double pairsPerUs = 0.0;
+    double meanPairsKernel = 0.0, meanPairsFinalised = 0.0;   // Per tick
+    bool checked = false;
+    CheckResult check;
+};
+
+RunResult runOneSize (const Config& cfg, const Size& size)
+{
+    RunResult r;
+    r.size = size;
+
+    WFSValueTreeState state;
+    buildState (state, cfg, size);
+
+    WFSCalculationEngine engine (state, size.numIn, size.numOut, cfg.numReverbs);
+    engine.setVectorKernelEnabled (! cfg.forceScalar);
+    engine.setRecalcWorkers (cfg.workers);
+    r.kernel = WFSMatrixKernel::getRowFunctionName (! cfg.forceScalar);
+    r.workers = engine.getRecalcWorkers();
+
+    // --check: scalar reference engine fed the same moves
+    std::unique_ptr<WFSCalculationEngine> reference;
+    if (cfg.check)
+    {
+        reference = std::make_unique<WFSCalculationEngine> (state, size.numIn, size.numOut, cfg.numReverbs);
+        reference->setVectorKernelEnabled (false);
+        r.checked = true;
+    }
+
+    // --check --workers: same kernel, serial
+    std::unique_ptr<WFSCalculationEngine> serialTwin;
+    if (cfg.check && cfg.workers > 0)
+    {
+        serialTwin = std::make_unique<WFSCalculationEngine> (state, size.numIn, size.numOut, cfg.numReverbs);
+        serialTwin->setVectorKernelEnabled (! cfg.forceScalar);
+    }
+
+    // Every pair listed: the overlay's worst case
+    LSGainOverlay gains;
+    if (cfg.lsGains)
+    {
+        for (int in = 0; in < size.numIn; ++in)
+        {
+            for (int out = 0; out < size.numOut; ++out)
+                gains.add (out, 0.8f);
+            gains.endRow();
+        }
+    }
+    const LSGainOverlay* lsGains = cfg.lsGains ? &gains : nullptr;
+
+    std::vector<double> recalc, legacy;
+    recalc.reserve ((size_t) cfg.ticks);
+    double sink = 0.0;
+    double pairsKernelSum = 0.0, pairsFinalisedSum = 0.0;
+    juce::uint64 expectedGeneration = engine.getMatrixGeneration();   // Constructor's pass
+
+    for (int tick = 0; tick < cfg.warmup + cfg.ticks; ++tick)
+    {
+        // Dirty pattern for this tick (outside the timed region)
+        const float phase = (float) tick * 0.02f;
+        auto moveInput = [&] (int in)
+        {
+            const auto p = engine.getInputPosition (in);
+            const float x = p.x + 0.5f * std::sin (phase + (float) in);
+            const float y = p.y + 0.5f * std::cos (phase + (float) in);
+            engine.setSpeedLimitedPosition (in, x, y, p.z);
+            if (reference != nullptr)
+                reference->setSpeedLimitedPosition (in, x, y, p.z);
+            if (serialTwin != nullptr)
+                serialTwin->setSpeedLimitedPosition (in, x, y, p.z);
+        };
+
+        // Moves through the shared state, so both engines see it
+        auto moveOutput = [&] (int out)
+        {
+            auto pos = state.getOutputPositionSection (out);
+            const float x = (float) pos.getProperty (outputPositionX, 0.0f);
+            pos.setProperty (outputPositionX, x + 0.05f * std::sin (phase), nullptr);
+        };
+
+        if (cfg.scenarioId == Scenario::Single)
+            moveInput (tick % size.numIn);
+        else if (cfg.scenarioId == Scenario::Speaker)
+            moveOutput (tick % size.numOut);
+        else
+            for (int in = 0; in < size.numIn; ++in)
+                moveInput (in);
+
+        if (cfg.scenarioId == Scenario::Full)
+        {
+            engine.recalculateAllListenerPositions();
+            if (serialTwin != nullptr)
+                serialTwin->recalculateAllListenerPositions();
+        }
+
+        const double s = nowMs();
+        engine.recalculateMatrix (lsGains);
+        const double e = nowMs();
+
+        if (tick >= cfg.warmup)
+        {
+            recalc.push_back (e - s);
+            const auto stats = engine.getLastRecalcStats();
+            pairsKernelSum += stats.pairsKernel;
+            pairsFinalisedSum += stats.pairsFinalised;
+        }
+
+        if (reference != nullptr)
+        {
+            reference->recalculateAllListenerPositions();   // Every column dirty: full pass
+            reference->recalculateMatrix (lsGains);
+            compareMatrices (engine, *reference, size.numIn, size.numOut, r.check);
+            checkPublishedSet (engine, ++expectedGeneration, r.check);
+        }
+
+        if (serialTwin != nullptr)
+        {
+            serialTwin->recalculateMatrix (lsGains);
+            checkSerialTwin (engine, *serialTwin, r.check);
+        }
+
+        if (cfg.legacyLookups && tick >= cfg.warmup)
+        {
+            const double ls = nowMs();
+            sink += legacyLookupPass (state, size.numIn, size.numOut);
+            legacy.push_back (nowMs() - ls);
+        }
+    }
+
+    if (sink == 42.0)   // keep the lookup pass observable
+        std::fprintf (stderr, " ");
+
+    r.ticks = cfg.ticks;
+    r.recalcMs = computeDist (std::move (recalc));
+    r.legacyLookupMs = computeDist (std::move (legacy));
+    r.meanPairsKernel = cfg.ticks > 0 ? pairsKernelSum / cfg.ticks : 0.0;
+    r.meanPairsFinalised = cfg.ticks > 0 ? pairsFinalisedSum / cfg.ticks : 0.0;
+    if (r.recalcMs.valid && r.recalcMs.med > 0.0)
+        r.pairsPerUs = (double) size.numIn * (double) size.numOut / (r.recalcMs.med * 1000.0);
+    return r;
+}
+
+//==============================================================================
+void printDist (const char* name, const Dist& d)
+{
+    if (! d.valid)
+        return;
+    std::printf ("  %-16s min %8.4f  med %8.4f  p99 %8.4f  p999 %8.4f  max %8.4f  mean %8.4f ms\n",
+                 name, d.minV, d.med, d.p99, d.p999, d.maxV, d.mean);
+}
+
+void printResult (const RunResult& r)
+{
+    std::printf ("%d in x %d out (%d ticks, %s kernel, %d workers)\n",
+                 r.size.numIn, r.size.numOut, r.ticks, r.kernel, r.workers);
+    printDist ("recalcMs", r.recalcMs);
+    printDist ("legacyLookupMs", r.legacyLookupMs);
+    std::printf ("  pairs/us (median) %.2f\n", r.pairsPerUs);
+    std::printf ("  pairs/tick (mean) kernel %.1f  finalised %.1f  of %d\n",
+                 r.meanPairsKernel, r.meanPairsFinalised, r.size.numIn * r.size.numOut);
+    if (r.checked)
+        std::printf ("  check vs scalar: %s  max |d| delay %.3g ms  level %.3g  HF %.3g dB  (%lld/%lld pairs over, %lld publish mismatches, %lld parallel mismatches)\n",
+                     checkPassed (r.check) ? "PASS" : "FAIL",
+                     r.check.maxDelayDiffMs, r.check.maxLevelDiff, r.check.maxHFDiffDb,
+                     r.check.failures, r.check.pairsCompared, r.check.publishMismatches,
+                     r.check.parallelMismatches);
+    std::fflush (stdout);
+}
+
+void appendDistJson (juce::String& s, const char* name, const Dist& d)
+{
+    if (! d.valid)
+        return;
+    s << ", \"" << name << "\": { \"min\": " << juce::String (d.minV, 5)
+      << ", \"median\": " << juce::String (d.med, 5)
+      << ", \"p99\": " << juce::String (d.p99, 5)
+      << ", \"p999\": " << juce::String (d.p999, 5)
+      << ", \"max\": " << juce::String (d.maxV, 5)
+      << ", \"mean\": " << juce::String (d.mean, 5) << " }";
+}
+
+bool writeJson (const juce::File& f, const Config& cfg, const std::vector<RunResult>& runs)
+{
+    juce::String s;
+    s << "{\n"
+      << "  \"scenario\": \"" << scenarioName (cfg.scenarioId) << "\",\n"
+      << "  \"reverbs\": " << cfg.numReverbs
+      << ", \"ticks\": " << cfg.ticks
+      << ", \"warmup\": " << cfg.warmup
+      << ", \"lsGains\": " << (cfg.lsGains ? "true" : "false") << ",\n"
+      << "  \"runs\": [\n";
+
+    for (size_t i = 0; i < runs.size(); ++i)
+    {
+        const RunResult& r = runs[i];
+        s << "    { \"in\": " << r.size.numIn
+          << ", \"out\": " << r.size.numOut
+          << ", \"kernel\": \"" << r.kernel << "\""
+          << ", \"workers\": " << r.workers
+          << ", \"pairsPerUs\": " << juce::String (r.pairsPerUs, 3)
+          << ", \"pairsKernelPerTick\": " << juce::String (r.meanPairsKernel, 1)
+          << ", \"pairsFinalisedPerTick\": " << juce::String (r.meanPairsFinalised, 1);
+        appendDistJson (s, "recalcMs", r.recalcMs);
+        appendDistJson (s, "legacyLookupMs", r.legacyLookupMs);
+        if (r.checked)
+            s << ", \"check\": { \"maxDelayDiffMs\": " << juce::String (r.check.maxDelayDiffMs, 7)
+              << ", \"maxLevelDiff\": " << juce::String (r.check.maxLevelDiff, 7)
+              << ", \"maxHFDiffDb\": " << juce::String (r.check.maxHFDiffDb, 7)
+              << ", \"failures\": " << juce::String (r.check.failures)
+              << ", \"publishMismatches\": " << juce::String (r.check.publishMismatches)
+              << ", \"parallelMismatches\": " << juce::String (r.check.parallelMismatches) << " }";
+        s << " }" << (i + 1 < runs.size() ? "," : "") << "\n";
+    }
+    s << "  ]\n}\n";
+
+    f.getParentDirectory().createDirectory();
+    return f.replaceWithText (s);
+}
+
+bool parseSizes (const std::string& v, std::vector<Size>& out)
+{
+    out.clear();
+    for (const auto& tok : juce::StringArray::fromTokens (juce::String (v), ",", ""))
+    {
+        const int x = tok.indexOfChar ('x');
+        if (x <= 0)
+            return false;
+        Size sz { tok.substring (0, x).getIntValue(), tok.substring (x + 1).getIntValue() };
+        if (sz.numIn <= 0 || sz.numOut <= 0)
+            return false;
+        out.push_back (sz);
+    }
+    return ! out.empty();
+}
+
+void usage()
+{
+    std::fprintf (stderr,
+        "usage: matrix-bench [--sizes 64x128,128x512] [--reverbs 4]\n"
+        "                    [--scenario moving|full|single|speaker] [--ticks 500] [--warmup 25]\n"
+        "                    [--kernel auto|scalar] [--workers 0] [--check] [--ls-gains]\n"
+        "                    [--legacy-lookups] [--json out.json]\n"
+        "\n"
+        "Times WFSCalculationEngine::recalculateMatrix on a synthetic show per\n"
+        "size and reports min/med/p99/p999/max/mean in ms. --legacy-lookups also\n"
+        "times the per-pair ValueTree reads of the pre-mirror kernel. --check\n"
+        "compares the vector row kernel against a full scalar pass every tick,\n"
+        "and with --workers the parallel rows against a serial pass (exactly).\n"
+        "\n"
+        "exit codes: 0 ok, 1 --check over tolerance, 2 usage\n");
+}
+
+} // namespace
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;   // ValueTree listeners assert on the message thread
+    Config cfg;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string a = argv[i];
+        auto next = [&] () -> std::string
+        {
+            if (i + 1 >= argc)
+            {
+                std::fprintf (stderr, "error: %s needs a value\n", a.c_str());
+                usage();
+                std::exit (2);
+            }
+            return argv[++i];
+        };
+
+        if      (a == "--reverbs")        cfg.numReverbs = std::atoi (next().c_str());
+        else if (a == "--ticks")          cfg.ticks = std::atoi (next().c_str());
+        else if (a == "--warmup")         cfg.warmup = std::atoi (next().c_str());
+        else if (a == "--json")           cfg.jsonArg = next();
+        else if (a == "--workers")        cfg.workers = juce::jmax (0, std::atoi (next().c_str()));
+        else if (a == "--check")          cfg.check = true;
+        else if (a == "--ls-gains")       cfg.lsGains = true;
+        else if (a == "--legacy-lookups") cfg.legacyLookups = true;
+        else if (a == "--sizes")
+        {
+            if (! parseSizes (next(), cfg.sizes))
+                { std::fprintf (stderr, "error: --sizes wants INxOUT[,INxOUT...]\n"); return 2; }
+        }
+        else if (a == "--kernel")
+        {
+            const auto k = next();
+            if (k != "auto" && k != "scalar")
+                { std::fprintf (stderr, "error: --kernel wants auto or scalar\n"); return 2; }
+            cfg.forceScalar = (k == "scalar");
+        }
+        else if (a == "--scenario")
+        {
+            if (! scenarioFromName (next(), cfg.scenarioId))
+                { std::fprintf (stderr, "error: unknown scenario\n"); return 2; }
+        }
+        else if (a == "--help" || a == "-h") { usage(); return 0; }
+        else
+        {
+            std::fprintf (stderr, "error: unknown argument '%s'\n", a.c_str());
+            usage();
+            return 2;
+        }
+    }
+
+    if (cfg.ticks <= 0 || cfg.warmup < 0
+        || cfg.numReverbs < 1 || cfg.numReverbs > WFSParameterDefaults::maxReverbChannels)
+    {
+        std::fprintf (stderr, "error: invalid tick/reverb arguments\n");
+        return 2;
+    }
+
+    std::fprintf (stderr, "matrix-bench: scenario=%s reverbs=%d ticks=%d warmup=%d lsGains=%d\n",
+                  scenarioName (cfg.scenarioId), cfg.numReverbs, cfg.ticks, cfg.warmup,
+                  cfg.lsGains ? 1 : 0);
+
+    std::vector<RunResult> runs;
+    bool checkFailed = false;
+    for (const auto& size : cfg.sizes)
+    {
+        RunResult r = runOneSize (cfg, size);
+        printResult (r);
+        checkFailed = checkFailed || (r.checked && ! checkPassed (r.check));
+        runs.push_back (std::move (r));
+    }
+
+    if (! cfg.jsonArg.empty())
+    {
+        const auto f = juce::File::getCurrentWorkingDirectory()
+                           .getChildFile (juce::String (cfg.jsonArg));
+        if (writeJson (f, cfg, runs))
+            std::fprintf (stderr, "note: JSON written to %s\n",
+                          f.getFullPathName().toRawUTF8());
+        else
+            std::fprintf (stderr, "warning: could not write %s\n",
+                          f.getFullPathName().toRawUTF8());
+    }
+
+    return checkFailed ? 1 : 0;
+}
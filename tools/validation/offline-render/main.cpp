@@ -10,7 +10,8 @@
 //
 //   offline-render --path <cpu-gather|cpu-scatter|reverb-sdn|reverb-fdn|reverb-ir
 //                          |gpu-gather|gpu-scatter|gpu-reverb-sdn|gpu-reverb-fdn
-//                          |gpu-reverb-ir|cpu|gpu|all>
+//                          |gpu-reverb-ir|binaural-legacy|binaural-legacy-scalar
+//                          |cpu|gpu|binaural|all>
 //                  --scenario <static|moving|fr-toggle|all>
 //                  [--blocks N] [--block 512] [--sr 48000] [--in 8] [--out 16]
 //                  [--device cuda:0] [--plugin-dir <dir with wfs_cuda.dll>]
@@ -29,6 +30,24 @@
 // and launch stats. Hashes still print; only the default baseline shape is
 // baselined — bench shapes (e.g. 96k/128/64x128) are NOT meant for --check.
 //
+// --artifacts renders the CPU WFS paths (scenario moving unless --scenario
+// is given) three times with different delay timelines: stepped at the 50 Hz
+// tick (what the hashes cover), extrapolated along each pair's delay rate per
+// block (what MainComponent does between control ticks), and a continuous
+// reference interpolated between ticks. It prints each against the reference:
+// residual energy and the worst spectral spur of the residual, in dB. Not a
+// gate; nothing is hashed.
+//
+// binaural-legacy renders the headphone preview's legacy virtual-speaker path
+// (BinauralLegacyRenderer, the batched kernel BinauralProcessor runs in render
+// mode 0) with the scenario's per-input L/R ear parameters; -scalar forces
+// its per-sample reference loop. Both must hash identically (the batched
+// kernel is bit-exact by design); --path binaural renders the pair and exits
+// 1 if any scenario's two hashes differ, baseline or not. No machine baseline
+// carries their entries yet (see ../baselines/open-measurements.md); each
+// machine adds them with --path binaural --scenario all --check
+// baselines/<machine>.json --update, after which they join cpu/all.
+//
 // The harness compiles the app's DSP headers in place and drives them exactly
 // as the app does (drain-pull below the async algorithm wrappers) — no
 // production-code changes.
@@ -68,6 +87,7 @@
 #include "../../../spatcore/reverb/ReverbSDNAlgorithm.h"
 #include "../../../spatcore/reverb/ReverbFDNAlgorithm.h"
 #include "../../../spatcore/reverb/ReverbIRAlgorithm.h"
+#include "DSP/BinauralLegacyRenderer.h"                      // Headphone preview, render mode 0
 
 #if WFS_GPU_NATIVE
  #include "../../../spatcore/gpu/GpuDeviceManager.h"   // device enumeration ("cuda:0", ...)
@@ -85,8 +105,17 @@
 namespace
 {
 
+/** How the WFS delay matrix moves between 50 Hz ticks (see WfsTimeline). */
+enum class DelayTimeline
+{
+    Stepped,        // Rewritten at tick boundaries only (hashed, baselined)
+    Extrapolated,   // Tick value + backward-difference rate * time since the tick
+    Continuous      // Linear between this tick and the next (--artifacts reference)
+};
+
 struct Config
 {
+    DelayTimeline delayTimeline = DelayTimeline::Stepped;
     double sr = 48000.0;
     int block = 512;
     int blocks = 200;
@@ -107,6 +136,8 @@ enum class Path
     GpuReverbSdn,
     GpuReverbFdn,
     GpuReverbIr,
+    BinauralLegacy,
+    BinauralLegacyScalar,
 };
 
 const char* pathName (Path p)
@@ -123,6 +154,8 @@ const char* pathName (Path p)
         case Path::GpuReverbSdn: return "gpu-reverb-sdn";
         case Path::GpuReverbFdn: return "gpu-reverb-fdn";
         case Path::GpuReverbIr:  return "gpu-reverb-ir";
+        case Path::BinauralLegacy:       return "binaural-legacy";
+        case Path::BinauralLegacyScalar: return "binaural-legacy-scalar";
     }
     return "?";
 }
@@ -139,6 +172,8 @@ bool pathFromName (const std::string& s, Path& out)
     if (s == "gpu-reverb-sdn") { out = Path::GpuReverbSdn; return true; }
     if (s == "gpu-reverb-fdn") { out = Path::GpuReverbFdn; return true; }
     if (s == "gpu-reverb-ir")  { out = Path::GpuReverbIr;  return true; }
+    if (s == "binaural-legacy")        { out = Path::BinauralLegacy;       return true; }
+    if (s == "binaural-legacy-scalar") { out = Path::BinauralLegacyScalar; return true; }
     return false;
 }
 
@@ -164,6 +199,12 @@ const std::vector<Path>& gpuPaths()
     return v;
 }
 
+const std::vector<Path>& binauralPaths()
+{
+    static const std::vector<Path> v { Path::BinauralLegacy, Path::BinauralLegacyScalar };
+    return v;
+}
+
 using ChannelData = std::vector<std::vector<float>>;   // [channel][sample]
 
 //==============================================================================
@@ -356,6 +397,71 @@ int tickForSample (int64_t sampleIndex, int srInt)
     return static_cast<int> ((sampleIndex * 50) / srInt);
 }
 
+/**
+ * Drives the WFS matrices the CPU renderers read. Called between blocks only
+ * (workers idle), so rewriting the arrays in place is safe. Levels, HF and
+ * FR always step at the tick; only the delays follow cfg.delayTimeline.
+ * Stepped reproduces the original tick loop exactly.
+ */
+class WfsTimeline
+{
+public:
+    WfsTimeline (scenario::Id scenarioId, const Config& config, scenario::WfsMatrices& matrices)
+        : id (scenarioId), cfg (config), m (matrices), srInt (static_cast<int> (config.sr))
+    {
+        if (cfg.delayTimeline != DelayTimeline::Stepped)
+        {
+            other.allocate (cfg.numIn, cfg.numOut);
+            tickDelays.resize (m.delayMs.size());
+        }
+        applyTick (0);
+    }
+
+    void advance (int64_t startSample)
+    {
+        const int tick = tickForSample (startSample, srInt);
+        if (tick != lastTick)
+        {
+            applyTick (tick);
+            lastTick = tick;
+        }
+        if (cfg.delayTimeline == DelayTimeline::Stepped)
+            return;
+
+        // Position within the tick, 0..1
+        const float frac = juce::jlimit (0.0f, 1.0f, static_cast<float> (
+                               static_cast<double> (startSample) * 50.0 / cfg.sr - tick));
+
+        for (size_t i = 0; i < tickDelays.size(); ++i)
+        {
+            const float towards = other.delayMs[i] - tickDelays[i];
+            m.delayMs[i] = cfg.delayTimeline == DelayTimeline::Continuous
+                               ? tickDelays[i] + towards * frac     // other = next tick
+                               : tickDelays[i] - towards * frac;    // other = previous tick
+        }
+    }
+
+private:
+    void applyTick (int tick)
+    {
+        scenario::applyWfsTick (id, tick, cfg.numIn, cfg.numOut, m);
+        if (cfg.delayTimeline == DelayTimeline::Stepped)
+            return;
+
+        tickDelays = m.delayMs;
+        const int otherTick = cfg.delayTimeline == DelayTimeline::Continuous ? tick + 1 : tick - 1;
+        scenario::applyWfsTick (id, otherTick, cfg.numIn, cfg.numOut, other);
+    }
+
+    const scenario::Id id;
+    const Config& cfg;
+    scenario::WfsMatrices& m;
+    const int srInt;
+    scenario::WfsMatrices other;
+    std::vector<float> tickDelays;
+    int lastTick = 0;
+};
+
 //==============================================================================
 // CPU gather: one InputBufferProcessor per input. Drive pattern mirrors
 // InputBufferAlgorithm::prepare/processBlock (InputBufferAlgorithm.h:49-79 and
@@ -365,10 +471,9 @@ int tickForSample (int64_t sampleIndex, int srInt)
 //==============================================================================
 ChannelData renderCpuGather (scenario::Id id, const Config& cfg)
 {
-    const int srInt = static_cast<int> (cfg.sr);
     scenario::WfsMatrices m;
     m.allocate (cfg.numIn, cfg.numOut);
-    scenario::applyWfsTick (id, 0, cfg.numIn, cfg.numOut, m);
+    WfsTimeline timeline (id, cfg, m);
 
     std::vector<std::unique_ptr<InputBufferProcessor>> procs;
     for (int i = 0; i < cfg.numIn; ++i)
@@ -410,21 +515,15 @@ ChannelData renderCpuGather (scenario::Id id, const Config& cfg)
 
     std::vector<float> inChan (static_cast<size_t> (cfg.block));
     std::vector<float> tmp (static_cast<size_t> (cfg.block));
-    int lastTick = 0;   // tick 0 already applied
 
     for (int b = 0; b < cfg.blocks; ++b)
     {
         gBench.blockBegin (b);
         const int64_t startSample = static_cast<int64_t> (b) * cfg.block;
 
-        // Matrix timeline: re-write the arrays at tick boundaries, between
-        // blocks only (all pushed samples are fully drained => workers idle).
-        const int tick = tickForSample (startSample, srInt);
-        if (tick != lastTick)
-        {
-            scenario::applyWfsTick (id, tick, cfg.numIn, cfg.numOut, m);
-            lastTick = tick;
-        }
+        // Matrix timeline: re-write the arrays between blocks only (all
+        // pushed samples are fully drained => workers idle).
+        timeline.advance (startSample);
 
         for (int in = 0; in < cfg.numIn; ++in)
         {
@@ -468,10 +567,9 @@ ChannelData renderCpuGather (scenario::Id id, const Config& cfg)
 //==============================================================================
 ChannelData renderCpuScatter (scenario::Id id, const Config& cfg)
 {
-    const int srInt = static_cast<int> (cfg.sr);
     scenario::WfsMatrices m;
     m.allocate (cfg.numIn, cfg.numOut);
-    scenario::applyWfsTick (id, 0, cfg.numIn, cfg.numOut, m);
+    WfsTimeline timeline (id, cfg, m);
 
     // Shared input ring buffers (one per input, read by all output threads) —
     // OutputBufferAlgorithm.h:214-221.
@@ -522,19 +620,13 @@ ChannelData renderCpuScatter (scenario::Id id, const Config& cfg)
                      std::vector<float> (static_cast<size_t> (total), 0.0f));
 
     std::vector<float> inChan (static_cast<size_t> (cfg.block));
-    int lastTick = 0;
 
     for (int b = 0; b < cfg.blocks; ++b)
     {
         gBench.blockBegin (b);
         const int64_t startSample = static_cast<int64_t> (b) * cfg.block;
 
-        const int tick = tickForSample (startSample, srInt);
-        if (tick != lastTick)
-        {
-            scenario::applyWfsTick (id, tick, cfg.numIn, cfg.numOut, m);
-            lastTick = tick;
-        }
+        timeline.advance (startSample);
 
         // Write input once to the shared rings, then notify all output threads
         // (OutputBufferAlgorithm.h:329-339).
@@ -709,6 +801,69 @@ ChannelData renderReverb (Path path, scenario::Id id, const Config& cfg)
     return out;
 }
 
+//==============================================================================
+// Binaural legacy (headphone preview, render mode 0): BinauralLegacyRenderer
+// driven synchronously, as BinauralProcessor's worker does per block. Ear
+// parameters come from the WFS scenario timeline with two outputs (0 = left
+// ear, 1 = right ear), stepped at the 50 Hz tick like the app's
+// BinauralCalculationEngine snapshot. Output: 2 channels (L, R).
+//==============================================================================
+ChannelData renderBinauralLegacy (Path path, scenario::Id id, const Config& cfg)
+{
+    const int srInt = static_cast<int> (cfg.sr);
+    constexpr int numEars = 2;
+
+    BinauralLegacyRenderer renderer;
+    renderer.prepare (cfg.sr, cfg.block, cfg.numIn);
+    renderer.setUseReferenceKernel (path == Path::BinauralLegacyScalar);
+
+    scenario::WfsMatrices m;
+    m.allocate (cfg.numIn, numEars);
+    scenario::applyWfsTick (id, 0, cfg.numIn, numEars, m);
+    int lastTick = 0;
+
+    const int64_t total = static_cast<int64_t> (cfg.blocks) * cfg.block;
+    ChannelData out (static_cast<size_t> (numEars),
+                     std::vector<float> (static_cast<size_t> (total), 0.0f));
+
+    std::vector<float> in (static_cast<size_t> (cfg.block));
+    std::vector<float> outL (static_cast<size_t> (cfg.block));
+    std::vector<float> outR (static_cast<size_t> (cfg.block));
+
+    for (int b = 0; b < cfg.blocks; ++b)
+    {
+        gBench.blockBegin (b);
+        const int64_t startSample = static_cast<int64_t> (b) * cfg.block;
+
+        const int tick = tickForSample (startSample, srInt);
+        if (tick != lastTick)
+        {
+            scenario::applyWfsTick (id, tick, cfg.numIn, numEars, m);
+            lastTick = tick;
+        }
+
+        std::fill (outL.begin(), outL.end(), 0.0f);
+        std::fill (outR.begin(), outR.end(), 0.0f);
+
+        for (int n = 0; n < cfg.numIn; ++n)
+        {
+            for (int s = 0; s < cfg.block; ++s)
+                in[static_cast<size_t> (s)] = scenario::inputSample (id, n, startSample + s, cfg.sr);
+
+            const size_t l = static_cast<size_t> (n) * numEars;
+            const BinauralLegacyRenderer::EarParams left  { m.delayMs[l],     m.levels[l],     m.hfDb[l] };
+            const BinauralLegacyRenderer::EarParams right { m.delayMs[l + 1], m.levels[l + 1], m.hfDb[l + 1] };
+            renderer.processInput (n, in.data(), cfg.block, left, right, outL.data(), outR.data());
+        }
+
+        std::memcpy (out[0].data() + startSample, outL.data(), static_cast<size_t> (cfg.block) * sizeof (float));
+        std::memcpy (out[1].data() + startSample, outR.data(), static_cast<size_t> (cfg.block) * sizeof (float));
+        gBench.blockEnd (b, -1.0);
+    }
+
+    return out;
+}
+
 //==============================================================================
 // GPU gather / scatter (milestone 2): synchronous backend drive per the design
 // doc — makeWfsBackend/makeObBackend(deviceId) -> prepare(..., latency 0, ...)
@@ -1097,6 +1252,8 @@ ChannelData renderOne (Path path, scenario::Id id, const Config& cfg,
         case Path::ReverbSdn:
         case Path::ReverbFdn:
         case Path::ReverbIr:   return renderReverb (path, id, cfg);
+        case Path::BinauralLegacy:
+        case Path::BinauralLegacyScalar: return renderBinauralLegacy (path, id, cfg);
         case Path::GpuGather:
         case Path::GpuScatter:
 #if WFS_GPU_NATIVE
@@ -1174,18 +1331,125 @@ juce::File taggedFile (const juce::File& base, const std::string& tag)
                                 + "." + juce::String (tag) + base.getFileExtension());
 }
 
+//==============================================================================
+// --artifacts: delay-timeline comparison against the continuous reference
+//==============================================================================
+struct ArtifactStats
+{
+    double residualDb = 0.0;    // Residual energy / reference energy
+    double worstSpurDb = 0.0;   // Strongest residual bin / strongest reference bin
+};
+
+/** Hann-windowed power spectrum, averaged over half-overlapping frames and
+    summed over channels. */
+std::vector<double> averagePowerSpectrum (const ChannelData& chans)
+{
+    constexpr int order = 12;
+    constexpr int size = 1 << order;
+    juce::dsp::FFT fft (order);
+    juce::dsp::WindowingFunction<float> window (size, juce::dsp::WindowingFunction<float>::hann, false);
+
+    std::vector<double> power (size / 2 + 1, 0.0);
+    std::vector<float> frame (2 * size);
+
+    for (const auto& c : chans)
+    {
+        for (size_t start = 0; start + size <= c.size(); start += size / 2)
+        {
+            std::fill (frame.begin(), frame.end(), 0.0f);
+            std::copy (c.begin() + static_cast<std::ptrdiff_t> (start),
+                       c.begin() + static_cast<std::ptrdiff_t> (start + size), frame.begin());
+            window.multiplyWithWindowingTable (frame.data(), size);
+            fft.performFrequencyOnlyForwardTransform (frame.data());
+            for (size_t k = 0; k < power.size(); ++k)
+                power[k] += static_cast<double> (frame[k]) * frame[k];
+        }
+    }
+    return power;
+}
+
+ArtifactStats compareToReference (const ChannelData& rendered, const ChannelData& reference)
+{
+    ChannelData residual (rendered.size());
+    double residualEnergy = 0.0, referenceEnergy = 0.0;
+    for (size_t ch = 0; ch < rendered.size(); ++ch)
+    {
+        residual[ch].resize (rendered[ch].size());
+        for (size_t i = 0; i < rendered[ch].size(); ++i)
+        {
+            const double d = static_cast<double> (rendered[ch][i]) - reference[ch][i];
+            residual[ch][i] = static_cast<float> (d);
+            residualEnergy += d * d;
+            referenceEnergy += static_cast<double> (reference[ch][i]) * reference[ch][i];
+        }
+    }
+
+    const auto residualPower = averagePowerSpectrum (residual);
+    const auto referencePower = averagePowerSpectrum (reference);
+    const double worstResidual = *std::max_element (residualPower.begin(), residualPower.end());
+    const double worstReference = *std::max_element (referencePower.begin(), referencePower.end());
+
+    auto toDb = [] (double num, double den)
+    {
+        return 10.0 * std::log10 (std::max (num, 1.0e-30) / std::max (den, 1.0e-30));
+    };
+    return { toDb (residualEnergy, referenceEnergy), toDb (worstResidual, worstReference) };
+}
+
+int runArtifacts (const std::vector<Path>& paths, const std::vector<scenario::Id>& scenarios,
+                  const Config& cfg)
+{
+    int combos = 0;
+    for (const Path p : paths)
+    {
+        if (p != Path::CpuGather && p != Path::CpuScatter)
+            continue;
+
+        for (const scenario::Id s : scenarios)
+        {
+            auto render = [&] (DelayTimeline timeline)
+            {
+                Config c = cfg;
+                c.delayTimeline = timeline;
+                return renderOne (p, s, c, {});
+            };
+
+            const auto reference = render (DelayTimeline::Continuous);
+            const auto stepped = compareToReference (render (DelayTimeline::Stepped), reference);
+            const auto extrapolated = compareToReference (render (DelayTimeline::Extrapolated), reference);
+
+            std::printf ("%s/%s artifacts: stepped residual %.1f dB spur %.1f dB | "
+                         "extrapolated residual %.1f dB spur %.1f dB\n",
+                         pathName (p), scenario::name (s),
+                         stepped.residualDb, stepped.worstSpurDb,
+                         extrapolated.residualDb, extrapolated.worstSpurDb);
+            std::fflush (stdout);
+            ++combos;
+        }
+    }
+
+    if (combos == 0)
+    {
+        std::fprintf (stderr, "error: --artifacts needs cpu-gather or cpu-scatter in --path\n");
+        return 2;
+    }
+    return 0;
+}
+
 void usage()
 {
     std::fprintf (stderr,
         "usage: offline-render --path <cpu-gather|cpu-scatter|reverb-sdn|reverb-fdn|reverb-ir\n"
         "                              |gpu-gather|gpu-scatter|gpu-reverb-sdn|gpu-reverb-fdn\n"
-        "                              |gpu-reverb-ir|cpu|gpu|all>\n"
+        "                              |gpu-reverb-ir|binaural-legacy|binaural-legacy-scalar\n"
+        "                              |cpu|gpu|binaural|all>\n"
         "                      --scenario <static|moving|fr-toggle|all>\n"
         "                      [--blocks N] [--block 512] [--sr 48000] [--in 8] [--out 16]\n"
         "                      [--device cuda:0] [--plugin-dir <dir with wfs_cuda.dll>]\n"
         "                      [--wav out.wav] [--raw out.f32]\n"
         "                      [--check baselines/<machine>.json] [--update]\n"
         "                      [--bench] [--warmup 16] [--bench-json <file>]\n"
+        "                      [--artifacts]\n"
         "\n"
         "GPU baselines are per device+driver: keep them in a separate file and check\n"
         "them in a separate invocation, e.g.\n"
@@ -1196,6 +1460,13 @@ void usage()
         "launchMs min/med/p99/max/mean distribution on GPU paths), excluding the first\n"
         "--warmup blocks. Bench shapes other than the default are not baselined.\n"
         "\n"
+        "--path binaural renders the legacy headphone-preview kernel and its per-sample\n"
+        "reference; exits 1 if the two hashes differ.\n"
+        "\n"
+        "--artifacts compares stepped and per-block extrapolated delay timelines on\n"
+        "the CPU WFS paths against a continuous reference (residual and worst\n"
+        "spectral spur, dB). Scenario defaults to moving; nothing is hashed.\n"
+        "\n"
         "exit codes: 0 ok, 1 baseline mismatch, 2 usage, 3 drain timeout,\n"
         "            4 IR-load timeout, 5 self-test, 6 GPU/plugin unavailable,\n"
         "            7 GPU runtime failure\n");
@@ -1221,6 +1492,7 @@ int main (int argc, char* argv[])
     std::string pathArg = "all", scenarioArg = "all";
     std::string wavArg, rawArg, checkArg, deviceArg, pluginDirArg, benchJsonArg;
     bool update = false;
+    bool artifacts = false;
 
     for (int i = 1; i < argc; ++i)
     {
@@ -1253,6 +1525,7 @@ int main (int argc, char* argv[])
         else if (a == "--bench")    gBench.enabled = true;
         else if (a == "--warmup")   gBench.warmup = std::atoi (next().c_str());
         else if (a == "--bench-json") { benchJsonArg = next(); gBench.enabled = true; }
+        else if (a == "--artifacts") artifacts = true;
         else if (a == "--help" || a == "-h") { usage(); return 0; }
         else
         {
@@ -1287,6 +1560,8 @@ int main (int argc, char* argv[])
         paths = cpuPaths();
     else if (pathArg == "gpu")
         paths = gpuPaths();
+    else if (pathArg == "binaural")
+        paths = binauralPaths();
     else
     {
         Path p;
@@ -1299,7 +1574,9 @@ int main (int argc, char* argv[])
     }
 
     std::vector<scenario::Id> scenarios;
-    if (scenarioArg == "all")
+    if (artifacts && scenarioArg == "all")
+        scenarios.push_back (scenario::Id::Moving);
+    else if (scenarioArg == "all")
         scenarios = scenario::allScenarios();
     else
     {
@@ -1322,6 +1599,9 @@ int main (int argc, char* argv[])
         return 2;
     }
 
+    if (artifacts)
+        return runArtifacts (paths, scenarios, cfg);
+
     //==========================================================================
     // GPU availability: resolve the device and plugin BEFORE rendering so
     // --path all can skip cleanly on GPU-less machines (the CPU baseline gate
@@ -1416,6 +1696,28 @@ int main (int argc, char* argv[])
         }
     }
 
+    // The batched binaural kernel must match its reference loop bit for bit;
+    // this holds with or without a baseline, and a divergent pair is never
+    // written by --update.
+    {
+        const std::string batched = pathName (Path::BinauralLegacy);
+        const std::string scalar = pathName (Path::BinauralLegacyScalar);
+        bool pairOk = true;
+        for (const scenario::Id s : scenarios)
+        {
+            const auto a = results.find (batched + "/" + scenario::name (s));
+            const auto b = results.find (scalar + "/" + scenario::name (s));
+            if (a != results.end() && b != results.end() && a->second != b->second)
+            {
+                std::printf ("PAIR MISMATCH  %s/%s != %s/%s\n",
+                             batched.c_str(), scenario::name (s), scalar.c_str(), scenario::name (s));
+                pairOk = false;
+            }
+        }
+        if (! pairOk)
+            return 1;
+    }
+
     if (! benchJsonArg.empty())
     {
         const auto f = juce::File::getCurrentWorkingDirectory()
@@ -0,0 +1,454 @@
+//==============================================================================
+// onset-trigger-bench — AutomOtion audio-trigger latency and miss rate.
+//
+// A click train from TestSignalGenerator (Dirac pulse, over optional noise)
+// is played block by block through a simulated audio callback into the
+// real AudioOnsetDetector, while a simulated 50 Hz message tick (with timer
+// jitter) drives the real AutomOtionProcessor on one input set to a short
+// relative move with audio trigger on. Each triggered move is matched to
+// the click that caused it.
+//
+// For comparison, the previous trigger is modelled alongside: at each tick,
+// fire if the peak over the last --legacy-window-ms exceeds the threshold
+// (the app's short-peak meter lives in spatcore; the default window of one
+// tick is the most favourable case for it).
+//
+//   onset-trigger-bench [--seconds 60] [--rate 48000] [--block 256]
+//                       [--level-db -6] [--noise-db -70] [--threshold-db -20]
+//                       [--reset-db -60] [--tick-jitter-ms 3]
+//                       [--legacy-window-ms 20] [--json out.json]
+//
+// Per path it reports clicks that could trigger (not during a move or its
+// re-arm), how many did, the detection latency (tick time - click) and the
+// start error (where the move's elapsed time puts its start - click). The
+// onset path backdates, so its start error should stay within a block or
+// so; the legacy path starts at the tick.
+//==============================================================================
+
+#include <JuceHeader.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "Parameters/WFSValueTreeState.h"
+#include "Automation/AutomOtionProcessor.h"
+#include "DSP/TestSignalGenerator.h"
+
+namespace
+{
+
+struct Config
+{
+    double seconds = 60.0;
+    double rate = 48000.0;
+    int block = 256;
+    float levelDb = -6.0f;
+    float noiseDb = -70.0f;
+    float thresholdDb = -20.0f;
+    float resetDb = -60.0f;
+    double tickJitterMs = 3.0;
+    double legacyWindowMs = 20.0;
+    std::string jsonArg;
+};
+
+constexpr double tickSeconds = 0.02;
+constexpr float moveSeconds = 0.1f;
+
+struct Percentiles
+{
+    double p50 = 0.0, p99 = 0.0, max = 0.0;
+};
+
+Percentiles percentiles (std::vector<double> v)
+{
+    Percentiles p;
+    if (v.empty())
+        return p;
+    std::sort (v.begin(), v.end());
+    auto at = [&] (double q) { return v[static_cast<size_t> (q * static_cast<double> (v.size() - 1))]; };
+    p.p50 = at (0.50);
+    p.p99 = at (0.99);
+    p.max = v.back();
+    return p;
+}
+
+/** One trigger path's view of the click train */
+struct Path
+{
+    const char* name = "";
+
+    bool active = false;                  // A move is running
+    juce::int64 readyAt = 0;              // Sample from which clicks count (after re-arm)
+    juce::int64 moveEnd = 0;              // Legacy model only
+    bool armed = true;                    // Legacy model only
+    bool waitingForRearm = false;         // Legacy model only
+
+    std::vector<bool> eligible, detected;
+    std::vector<double> latencyMs, startErrorMs;
+
+    int numEligible() const { return static_cast<int> (std::count (eligible.begin(), eligible.end(), true)); }
+    int numDetected() const { return static_cast<int> (latencyMs.size()); }
+};
+
+struct Result
+{
+    int clicks = 0;
+    int ticks = 0;
+    Path onset, legacy;
+};
+
+/** Match a move started at tickSample to the oldest eligible, unmatched click
+    no older than maxAge samples. */
+void recordTrigger (Path& path, const std::vector<juce::int64>& clicks, juce::int64 tickSample,
+                    juce::int64 maxAge, double elapsedSeconds, double rate)
+{
+    for (size_t c = 0; c < clicks.size(); ++c)
+    {
+        if (clicks[c] > tickSample)
+            break;
+        if (! path.eligible[c] || path.detected[c] || tickSample - clicks[c] > maxAge)
+            continue;
+
+        path.detected[c] = true;
+        path.latencyMs.push_back (1000.0 * static_cast<double> (tickSample - clicks[c]) / rate);
+        const double impliedStart = static_cast<double> (tickSample) - elapsedSeconds * rate;
+        path.startErrorMs.push_back (1000.0 * (impliedStart - static_cast<double> (clicks[c])) / rate);
+        return;
+    }
+}
+
+void setUpInput (WFSValueTreeState& state, const Config& cfg)
+{
+    using namespace WFSParameterIDs;
+
+    state.setNumInputChannels (1);
+
+    auto pos = state.getInputPositionSection (0);
+    pos.setProperty (inputPositionX, 0.0f, nullptr);
+    pos.setProperty (inputPositionY, 0.0f, nullptr);
+    pos.setProperty (inputPositionZ, 0.0f, nullptr);
+
+    // Relative + Stay: every trigger is a real move from wherever it is
+    auto otomo = state.getInputAutoMotionSection (0);
+    otomo.setProperty (inputOtomoTrigger, 1, nullptr);
+    otomo.setProperty (inputOtomoThreshold, cfg.thresholdDb, nullptr);
+    otomo.setProperty (inputOtomoReset, cfg.resetDb, nullptr);
+    otomo.setProperty (inputOtomoAbsoluteRelative, 1, nullptr);
+    otomo.setProperty (inputOtomoStayReturn, 0, nullptr);
+    otomo.setProperty (inputOtomoDuration, moveSeconds, nullptr);
+    otomo.setProperty (inputOtomoX, 0.5f, nullptr);
+    otomo.setProperty (inputOtomoY, 0.0f, nullptr);
+    otomo.setProperty (inputOtomoZ, 0.0f, nullptr);
+}
+
+Result run (const Config& cfg)
+{
+    Result r;
+    r.onset.name = "onset";
+    r.legacy.name = "legacy";
+
+    WFSValueTreeState state;
+    setUpInput (state, cfg);
+    AutomOtionProcessor automOtion (state, 1);
+    auto& detector = automOtion.getOnsetDetector();
+    detector.prepare (cfg.rate);
+
+    TestSignalGenerator generator;
+    generator.prepare (cfg.rate, cfg.block);
+    generator.setOutputChannel (0);
+    generator.setSignalType (TestSignalGenerator::SignalType::DiracPulse);
+    generator.setLevel (cfg.levelDb);
+    generator.setHoldEnabled (true);
+
+    juce::AudioBuffer<float> buffer (1, cfg.block);
+    juce::Random rng (1234);
+    const float noiseGain = juce::Decibels::decibelsToGain (cfg.noiseDb, -200.0f);
+    const float thresholdGain = juce::Decibels::decibelsToGain (cfg.thresholdDb);
+    const auto holdSamples = static_cast<juce::int64> (AudioOnsetDetector::holdMs * 0.001 * cfg.rate);
+    const auto tickSamples = tickSeconds * cfg.rate;
+    const auto legacyWindow = static_cast<juce::int64> (cfg.legacyWindowMs * 0.001 * cfg.rate);
+    const auto totalSamples = static_cast<juce::int64> (cfg.seconds * cfg.rate);
+    const auto maxMatchAge = static_cast<juce::int64> ((cfg.legacyWindowMs * 0.001 + 3.0 * tickSeconds) * cfg.rate);
+
+    std::vector<juce::int64> clicks;
+    juce::int64 lastAbove = -holdSamples - 1;
+    std::deque<std::pair<juce::int64, float>> blockPeaks;   // (block end, peak) for the legacy window
+    double sumSquares = 0.0;
+    int rmsSamples = 0;
+
+    auto nextTickAt = [&] (double nominal)
+    {
+        return nominal + (rng.nextDouble() * 2.0 - 1.0) * cfg.tickJitterMs * 0.001 * cfg.rate;
+    };
+    double nominalTick = tickSamples;
+    double tickAt = nextTickAt (nominalTick);
+
+    // A click counts for a path if it lands while that path is idle and armed
+    auto markEligible = [&] (Path& path, juce::int64 click)
+    {
+        path.eligible.push_back (! path.active && click >= path.readyAt);
+        path.detected.push_back (false);
+    };
+
+    juce::int64 sample = 0;
+    while (sample < totalSamples)
+    {
+        const int n = static_cast<int> (std::min<juce::int64> (cfg.block, totalSamples - sample));
+
+        // Audio callback
+        buffer.clear();
+        generator.renderNextBlock (buffer, 0, n);
+        auto* data = buffer.getWritePointer (0);
+        for (int s = 0; s < n; ++s)
+        {
+            data[s] += noiseGain * (rng.nextFloat() * 2.0f - 1.0f);
+            sumSquares += static_cast<double> (data[s]) * data[s];
+
+            if (std::abs (data[s]) > thresholdGain)
+            {
+                const auto at = sample + s;
+                if (at - lastAbove > holdSamples)
+                {
+                    clicks.push_back (at);
+                    markEligible (r.onset, at);
+                    markEligible (r.legacy, at);
+                }
+                lastAbove = at;
+            }
+        }
+        rmsSamples += n;
+
+        detector.process (buffer, 0, n);
+        blockPeaks.emplace_back (sample + n, buffer.getMagnitude (0, 0, n));
+        sample += n;
+
+        // Message ticks that fall before the end of this block
+        while (tickAt <= static_cast<double> (sample))
+        {
+            const auto tickSample = static_cast<juce::int64> (tickAt);
+            ++r.ticks;
+
+            const float rmsDb = juce::Decibels::gainToDecibels (
+                static_cast<float> (std::sqrt (sumSquares / juce::jmax (1, rmsSamples))), -200.0f);
+            sumSquares = 0.0;
+            rmsSamples = 0;
+
+            while (! blockPeaks.empty() && blockPeaks.front().first <= tickSample - legacyWindow)
+                blockPeaks.pop_front();
+            float windowPeak = 0.0f;
+            for (const auto& bp : blockPeaks)
+                windowPeak = std::max (windowPeak, bp.second);
+            const float peakDb = juce::Decibels::gainToDecibels (windowPeak, -200.0f);
+
+            // Onset path: the real processor
+            const bool wasActive = automOtion.isActive (0);
+            automOtion.setInputLevels (0, peakDb, rmsDb);
+            automOtion.process (static_cast<float> (tickSeconds));
+            const bool nowActive = automOtion.isActive (0);
+            if (! wasActive && nowActive)
+                recordTrigger (r.onset, clicks, tickSample, maxMatchAge, automOtion.getProgress (0) * moveSeconds, cfg.rate);
+            if (wasActive && ! nowActive)
+                r.onset.readyAt = tickSample + static_cast<juce::int64> (2.0 * tickSamples);   // Re-arm tick
+            r.onset.active = nowActive;
+
+            // Legacy path: same arming rules, tick-sampled peak, no backdating
+            auto& lg = r.legacy;
+            if (lg.active && tickSample >= lg.moveEnd)
+            {
+                lg.active = false;
+                lg.waitingForRearm = true;
+                lg.readyAt = tickSample + static_cast<juce::int64> (2.0 * tickSamples);
+            }
+            if (! lg.active)
+            {
+                if (lg.waitingForRearm && rmsDb < cfg.resetDb)
+                {
+                    lg.armed = true;
+                    lg.waitingForRearm = false;
+                }
+                if (lg.armed && peakDb > cfg.thresholdDb)
+                {
+                    lg.armed = false;
+                    lg.active = true;
+                    lg.moveEnd = tickSample + static_cast<juce::int64> (moveSeconds * cfg.rate);
+                    recordTrigger (lg, clicks, tickSample, maxMatchAge, tickSeconds, cfg.rate);
+                }
+            }
+
+            nominalTick += tickSamples;
+            tickAt = nextTickAt (nominalTick);
+        }
+    }
+
+    // Clicks in the last move length can't have been matched yet
+    const auto cutoff = totalSamples - static_cast<juce::int64> ((moveSeconds + 2.0 * tickSeconds) * cfg.rate);
+    for (size_t c = 0; c < clicks.size(); ++c)
+    {
+        if (clicks[c] < cutoff)
+            continue;
+        r.onset.eligible[c] = r.onset.detected[c];
+        r.legacy.eligible[c] = r.legacy.detected[c];
+    }
+
+    r.clicks = static_cast<int> (clicks.size());
+    return r;
+}
+
+void printPath (const Path& p)
+{
+    const int eligible = p.numEligible();
+    const int missed = eligible - p.numDetected();
+    const auto lat = percentiles (p.latencyMs);
+
+    std::vector<double> absErr;
+    double meanErr = 0.0;
+    for (double e : p.startErrorMs)
+    {
+        absErr.push_back (std::abs (e));
+        meanErr += e;
+    }
+    if (! p.startErrorMs.empty())
+        meanErr /= static_cast<double> (p.startErrorMs.size());
+    const auto err = percentiles (absErr);
+
+    std::printf ("%-7s eligible %d  triggered %d  missed %d (%.2f%%)\n"
+                 "        latency ms p50 %.2f  p99 %.2f  max %.2f\n"
+                 "        start error ms mean %+.2f  |p50| %.2f  |p99| %.2f  |max| %.2f\n",
+                 p.name, eligible, p.numDetected(), missed,
+                 eligible > 0 ? 100.0 * missed / eligible : 0.0,
+                 lat.p50, lat.p99, lat.max, meanErr, err.p50, err.p99, err.max);
+}
+
+void appendPathJson (juce::String& s, const Path& p)
+{
+    const auto lat = percentiles (p.latencyMs);
+    std::vector<double> absErr;
+    for (double e : p.startErrorMs)
+        absErr.push_back (std::abs (e));
+    const auto err = percentiles (absErr);
+
+    s << "  \"" << p.name << "\": { \"eligible\": " << p.numEligible()
+      << ", \"triggered\": " << p.numDetected()
+      << ", \"latencyMs\": { \"p50\": " << juce::String (lat.p50, 3)
+      << ", \"p99\": " << juce::String (lat.p99, 3)
+      << ", \"max\": " << juce::String (lat.max, 3) << " }"
+      << ", \"absStartErrorMs\": { \"p50\": " << juce::String (err.p50, 3)
+      << ", \"p99\": " << juce::String (err.p99, 3)
+      << ", \"max\": " << juce::String (err.max, 3) << " } }";
+}
+
+bool writeJson (const juce::File& f, const Config& cfg, const Result& r)
+{
+    juce::String s;
+    s << "{\n"
+      << "  \"seconds\": " << juce::String (cfg.seconds, 1)
+      << ", \"rate\": " << juce::String (cfg.rate, 1)
+      << ", \"block\": " << cfg.block
+      << ", \"levelDb\": " << juce::String (cfg.levelDb, 1)
+      << ", \"noiseDb\": " << juce::String (cfg.noiseDb, 1)
+      << ", \"thresholdDb\": " << juce::String (cfg.thresholdDb, 1)
+      << ", \"resetDb\": " << juce::String (cfg.resetDb, 1)
+      << ", \"tickJitterMs\": " << juce::String (cfg.tickJitterMs, 2)
+      << ", \"legacyWindowMs\": " << juce::String (cfg.legacyWindowMs, 2) << ",\n"
+      << "  \"clicks\": " << r.clicks << ", \"ticks\": " << r.ticks << ",\n";
+    appendPathJson (s, r.onset);
+    s << ",\n";
+    appendPathJson (s, r.legacy);
+    s << "\n}\n";
+    return f.replaceWithText (s);
+}
+
+void usage()
+{
+    std::fprintf (stderr,
+        "usage: onset-trigger-bench [--seconds 60] [--rate 48000] [--block 256]\n"
+        "                           [--level-db -6] [--noise-db -70] [--threshold-db -20]\n"
+        "                           [--reset-db -60] [--tick-jitter-ms 3]\n"
+        "                           [--legacy-window-ms 20] [--json out.json]\n"
+        "\n"
+        "Plays a TestSignalGenerator click train through the AutomOtion onset\n"
+        "detector and a model of the tick-sampled peak trigger, and reports\n"
+        "trigger latency, start error and missed clicks for both.\n"
+        "\n"
+        "exit codes: 0 ok, 1 the onset path missed a click or saw none, 2 usage\n");
+}
+
+} // namespace
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;   // ValueTree listeners assert on the message thread
+    Config cfg;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string a = argv[i];
+        auto next = [&]() -> std::string
+        {
+            if (i + 1 >= argc)
+            {
+                std::fprintf (stderr, "error: %s needs a value\n", a.c_str());
+                std::exit (2);
+            }
+            return argv[++i];
+        };
+
+        if      (a == "--seconds")          cfg.seconds = std::atof (next().c_str());
+        else if (a == "--rate")             cfg.rate = std::atof (next().c_str());
+        else if (a == "--block")            cfg.block = std::atoi (next().c_str());
+        else if (a == "--level-db")         cfg.levelDb = static_cast<float> (std::atof (next().c_str()));
+        else if (a == "--noise-db")         cfg.noiseDb = static_cast<float> (std::atof (next().c_str()));
+        else if (a == "--threshold-db")     cfg.thresholdDb = static_cast<float> (std::atof (next().c_str()));
+        else if (a == "--reset-db")         cfg.resetDb = static_cast<float> (std::atof (next().c_str()));
+        else if (a == "--tick-jitter-ms")   cfg.tickJitterMs = std::atof (next().c_str());
+        else if (a == "--legacy-window-ms") cfg.legacyWindowMs = std::atof (next().c_str());
+        else if (a == "--json")             cfg.jsonArg = next();
+        else if (a == "--help" || a == "-h") { usage(); return 0; }
+        else
+        {
+            std::fprintf (stderr, "error: unknown argument '%s'\n", a.c_str());
+            usage();
+            return 2;
+        }
+    }
+
+    if (cfg.seconds <= 0.0 || cfg.rate <= 0.0 || cfg.block <= 0 || cfg.tickJitterMs < 0.0
+        || cfg.tickJitterMs >= 1000.0 * tickSeconds * 0.5 || cfg.legacyWindowMs <= 0.0
+        || cfg.resetDb >= cfg.thresholdDb || cfg.levelDb <= cfg.thresholdDb)
+    {
+        std::fprintf (stderr, "error: invalid arguments\n");
+        usage();
+        return 2;
+    }
+
+    std::printf ("click train %.1f dB over %.1f dB noise, threshold %.1f dB, reset %.1f dB,"
+                 " %.0f s at %d-sample blocks, tick jitter +-%.1f ms\n",
+                 cfg.levelDb, cfg.noiseDb, cfg.thresholdDb, cfg.resetDb, cfg.seconds, cfg.block,
+                 cfg.tickJitterMs);
+
+    const auto r = run (cfg);
+
+    std::printf ("clicks %d  ticks %d\n", r.clicks, r.ticks);
+    printPath (r.onset);
+    printPath (r.legacy);
+
+    if (! cfg.jsonArg.empty())
+    {
+        const auto f = juce::File::getCurrentWorkingDirectory().getChildFile (juce::String (cfg.jsonArg));
+        if (! writeJson (f, cfg, r))
+            std::fprintf (stderr, "warning: could not write %s\n", f.getFullPathName().toRawUTF8());
+    }
+
+    if (r.clicks == 0)
+    {
+        std::fprintf (stderr, "error: the generator produced no click above the threshold\n");
+        return 1;
+    }
+    return r.onset.numDetected() < r.onset.numEligible() ? 1 : 0;
+}
@@ -0,0 +1,344 @@
+//==============================================================================
+// osc-route-bench — OSCMessageRouter throughput, address trie vs String path.
+//
+// Tracking systems and consoles push thousands of OSC messages per second,
+// and every one goes through OSCMessageRouter before it reaches a parameter.
+// This tool loads a corpus exported from the OSC fuzzer
+// (tools/fuzz/export_corpus.py), builds the juce::OSCMessages once, and then
+// routes the whole corpus repeatedly the way OSCManager does (finite-float
+// gate, family test, parse*Message), once through the original String path
+// and once through the precompiled address trie
+// (OSCMessageRouter::setAddressTrieEnabled).
+//
+//   osc-route-bench --corpus corpus.txt [--passes 200] [--reps 5]
+//                   [--no-check] [--json out.json]
+//
+// Per mode it reports the best and median messages/sec over --reps runs of
+// --passes corpus passes. Unless --no-check is given, every message is also
+// parsed in both modes and the results compared field by field (valid,
+// paramId, channel, band, value, fade, rejection reason); any difference
+// fails the run (exit 1).
+//
+// Corpus lines the bench cannot build (addresses juce::OSCAddressPattern
+// rejects) are counted and skipped: the app's receiver drops them too.
+//==============================================================================
+
+#include <JuceHeader.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "Network/OSCMessageRouter.h"
+
+namespace
+{
+
+using Router = WFSNetwork::OSCMessageRouter;
+
+//==============================================================================
+double nowSec()
+{
+    using namespace std::chrono;
+    return duration<double> (steady_clock::now().time_since_epoch()).count();
+}
+
+struct Config
+{
+    std::string corpusArg;
+    int passes = 200;
+    int reps = 5;
+    bool check = true;
+    std::string jsonArg;
+};
+
+//==============================================================================
+// Corpus: <address>\t<tag>:<value>... (see tools/fuzz/export_corpus.py)
+//==============================================================================
+juce::MemoryBlock fromHex (const juce::String& hex)
+{
+    juce::MemoryBlock mb;
+    mb.loadFromHexString (hex);
+    return mb;
+}
+
+bool parseArgument (const juce::String& token, juce::OSCMessage& msg)
+{
+    if (token.length() < 2 || token[1] != ':')
+        return false;
+
+    const auto value = token.substring (2);
+    switch (token[0])
+    {
+        case 'i': msg.addInt32 ((juce::int32) std::strtoll (value.toRawUTF8(), nullptr, 10)); return true;
+        case 'f': msg.addFloat32 ((float) std::strtod (value.toRawUTF8(), nullptr)); return true;
+        case 's':
+        {
+            const auto mb = fromHex (value);
+            msg.addString (juce::String::fromUTF8 (static_cast<const char*> (mb.getData()), (int) mb.getSize()));
+            return true;
+        }
+        case 'b': msg.addBlob (fromHex (value)); return true;
+        default:  return false;
+    }
+}
+
+std::vector<juce::OSCMessage> loadCorpus (const juce::File& f, int& skipped)
+{
+    std::vector<juce::OSCMessage> messages;
+    juce::StringArray lines;
+    f.readLines (lines);
+
+    for (const auto& line : lines)
+    {
+        if (line.isEmpty())
+            continue;
+
+        const auto tokens = juce::StringArray::fromTokens (line, "\t", "");
+        try
+        {
+            juce::OSCMessage msg { juce::OSCAddressPattern (tokens[0]) };
+            bool ok = true;
+            for (int i = 1; i < tokens.size() && ok; ++i)
+                ok = parseArgument (tokens[i], msg);
+            if (ok)
+                messages.push_back (std::move (msg));
+            else
+                ++skipped;
+        }
+        catch (const juce::OSCFormatError&)
+        {
+            ++skipped;
+        }
+    }
+    return messages;
+}
+
+//==============================================================================
+// OSCManager's routing order for the parameter families
+//==============================================================================
+int routeOne (const juce::OSCMessage& message)
+{
+    juce::String rejectReason;
+    if (! Router::hasOnlyFiniteFloats (message, rejectReason))
+        return 0;
+
+    const auto& address = message.getAddressPattern().toString();
+    if (Router::isInputAddress (address))
+        return Router::parseInputMessage (message).valid ? 1 : 0;
+    if (Router::isOutputAddress (address))
+        return Router::parseOutputMessage (message).valid ? 1 : 0;
+    if (Router::isReverbAddress (address))
+        return Router::parseReverbMessage (message).valid ? 1 : 0;
+    if (Router::isConfigAddress (address))
+        return Router::parseConfigMessage (message).valid ? 1 : 0;
+    return 0;
+}
+
+struct ModeResult
+{
+    double bestPerSec = 0.0, medianPerSec = 0.0;
+    long long validPerPass = 0;
+};
+
+ModeResult timeMode (const std::vector<juce::OSCMessage>& messages, const Config& cfg, bool trie)
+{
+    Router::setAddressTrieEnabled (trie);
+
+    ModeResult r;
+    for (const auto& m : messages)   // Warm the static maps and the trie
+        r.validPerPass += routeOne (m);
+
+    std::vector<double> rates;
+    long long sink = 0;
+    for (int rep = 0; rep < cfg.reps; ++rep)
+    {
+        const double s = nowSec();
+        for (int pass = 0; pass < cfg.passes; ++pass)
+            for (const auto& m : messages)
+                sink += routeOne (m);
+        const double e = nowSec();
+        rates.push_back ((double) messages.size() * cfg.passes / juce::jmax (1.0e-9, e - s));
+    }
+
+    if (sink == -1)   // keep the parses observable
+        std::fprintf (stderr, " ");
+
+    std::sort (rates.begin(), rates.end());
+    r.bestPerSec = rates.back();
+    r.medianPerSec = rates[rates.size() / 2];
+    return r;
+}
+
+//==============================================================================
+// Equivalence: both modes must parse every message identically
+//==============================================================================
+template <typename Parsed>
+bool sameCommon (const Parsed& a, const Parsed& b)
+{
+    return a.valid == b.valid && a.paramId == b.paramId
+        && a.value.equalsWithSameType (b.value) && a.invalidReason == b.invalidReason;
+}
+
+template <typename Parsed>
+bool sameBand (const Parsed& a, const Parsed& b)
+{
+    return sameCommon (a, b) && a.channelId == b.channelId
+        && a.bandIndex == b.bandIndex && a.isEQparam == b.isEQparam;
+}
+
+bool sameInput (const Router::ParsedInputMessage& a, const Router::ParsedInputMessage& b)
+{
+    return sameCommon (a, b) && a.channelId == b.channelId && a.rampTimeSec == b.rampTimeSec
+        && a.rampTimeSecRequested == b.rampTimeSecRequested && a.rampArgIgnored == b.rampArgIgnored;
+}
+
+template <typename Parsed, typename ParseFn, typename SameFn>
+bool compareModes (const juce::OSCMessage& m, ParseFn parse, SameFn same)
+{
+    Router::setAddressTrieEnabled (false);
+    const Parsed legacy = parse (m);
+    Router::setAddressTrieEnabled (true);
+    const Parsed trie = parse (m);
+    return same (legacy, trie);
+}
+
+int checkModes (const std::vector<juce::OSCMessage>& messages)
+{
+    int mismatches = 0;
+    for (const auto& m : messages)
+    {
+        const bool ok = compareModes<Router::ParsedInputMessage> (m, Router::parseInputMessage, sameInput)
+            && compareModes<Router::ParsedOutputMessage> (m, Router::parseOutputMessage, sameBand<Router::ParsedOutputMessage>)
+            && compareModes<Router::ParsedReverbMessage> (m, Router::parseReverbMessage, sameBand<Router::ParsedReverbMessage>)
+            && compareModes<Router::ParsedConfigMessage> (m, Router::parseConfigMessage, sameCommon<Router::ParsedConfigMessage>);
+
+        if (! ok)
+        {
+            if (mismatches < 10)
+                std::fprintf (stderr, "mismatch: %s (%d args)\n",
+                              m.getAddressPattern().toString().toRawUTF8(), m.size());
+            ++mismatches;
+        }
+    }
+    return mismatches;
+}
+
+//==============================================================================
+bool writeJson (const juce::File& f, const Config& cfg, int numMessages,
+                const ModeResult& legacy, const ModeResult& trie, int mismatches)
+{
+    juce::String s;
+    s << "{\n"
+      << "  \"corpus\": \"" << juce::File (cfg.corpusArg).getFileName() << "\""
+      << ", \"messages\": " << numMessages
+      << ", \"passes\": " << cfg.passes
+      << ", \"reps\": " << cfg.reps << ",\n"
+      << "  \"string\": { \"bestPerSec\": " << juce::String (legacy.bestPerSec, 0)
+      << ", \"medianPerSec\": " << juce::String (legacy.medianPerSec, 0)
+      << ", \"validPerPass\": " << juce::String (legacy.validPerPass) << " },\n"
+      << "  \"trie\": { \"bestPerSec\": " << juce::String (trie.bestPerSec, 0)
+      << ", \"medianPerSec\": " << juce::String (trie.medianPerSec, 0)
+      << ", \"validPerPass\": " << juce::String (trie.validPerPass) << " }";
+    if (cfg.check)
+        s << ",\n  \"mismatches\": " << mismatches;
+    s << "\n}\n";
+
+    f.getParentDirectory().createDirectory();
+    return f.replaceWithText (s);
+}
+
+void usage()
+{
+    std::fprintf (stderr,
+        "usage: osc-route-bench --corpus corpus.txt [--passes 200] [--reps 5]\n"
+        "                       [--no-check] [--json out.json]\n"
+        "\n"
+        "Routes an exported fuzz corpus (tools/fuzz/export_corpus.py) through\n"
+        "OSCMessageRouter with the String path and with the address trie and\n"
+        "reports messages/sec for each. Checks both parse every message alike.\n"
+        "\n"
+        "exit codes: 0 ok, 1 parse mismatch, 2 usage\n");
+}
+
+} // namespace
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    Config cfg;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string a = argv[i];
+        auto next = [&] () -> std::string
+        {
+            if (i + 1 >= argc)
+            {
+                std::fprintf (stderr, "error: %s needs a value\n", a.c_str());
+                usage();
+                std::exit (2);
+            }
+            return argv[++i];
+        };
+
+        if      (a == "--corpus")   cfg.corpusArg = next();
+        else if (a == "--passes")   cfg.passes = std::atoi (next().c_str());
+        else if (a == "--reps")     cfg.reps = std::atoi (next().c_str());
+        else if (a == "--no-check") cfg.check = false;
+        else if (a == "--json")     cfg.jsonArg = next();
+        else if (a == "--help" || a == "-h") { usage(); return 0; }
+        else
+        {
+            std::fprintf (stderr, "error: unknown argument '%s'\n", a.c_str());
+            usage();
+            return 2;
+        }
+    }
+
+    if (cfg.corpusArg.empty() || cfg.passes <= 0 || cfg.reps <= 0)
+    {
+        usage();
+        return 2;
+    }
+
+    const auto corpusFile = juce::File::getCurrentWorkingDirectory().getChildFile (juce::String (cfg.corpusArg));
+    int skipped = 0;
+    const auto messages = loadCorpus (corpusFile, skipped);
+    if (messages.empty())
+    {
+        std::fprintf (stderr, "error: no usable messages in %s\n", corpusFile.getFullPathName().toRawUTF8());
+        return 2;
+    }
+
+    std::fprintf (stderr, "osc-route-bench: %d messages (%d skipped), passes=%d reps=%d\n",
+                  (int) messages.size(), skipped, cfg.passes, cfg.reps);
+
+    const int mismatches = cfg.check ? checkModes (messages) : 0;
+    const auto legacy = timeMode (messages, cfg, false);
+    const auto trie = timeMode (messages, cfg, true);
+    Router::setAddressTrieEnabled (true);
+
+    std::printf ("  string  best %12.0f  median %12.0f msg/s  (%lld valid/pass)\n",
+                 legacy.bestPerSec, legacy.medianPerSec, legacy.validPerPass);
+    std::printf ("  trie    best %12.0f  median %12.0f msg/s  (%lld valid/pass)\n",
+                 trie.bestPerSec, trie.medianPerSec, trie.validPerPass);
+    std::printf ("  speedup (median) %.2fx\n", trie.medianPerSec / juce::jmax (1.0, legacy.medianPerSec));
+    if (cfg.check)
+        std::printf ("  check: %s (%d mismatches)\n", mismatches == 0 ? "PASS" : "FAIL", mismatches);
+
+    if (! cfg.jsonArg.empty())
+    {
+        const auto f = juce::File::getCurrentWorkingDirectory().getChildFile (juce::String (cfg.jsonArg));
+        if (writeJson (f, cfg, (int) messages.size(), legacy, trie, mismatches))
+            std::fprintf (stderr, "note: JSON written to %s\n", f.getFullPathName().toRawUTF8());
+        else
+            std::fprintf (stderr, "warning: could not write %s\n", f.getFullPathName().toRawUTF8());
+    }
+
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,411 @@
+//==============================================================================
+// sampler-cache-bench — load time and resident memory of a full Sampler grid.
+//
+// Every input with the Sampler enabled loads its 36 cells when a project
+// opens. The old loader (SamplerFileOps::loadFromProject) decoded each cell
+// into its own RAM buffer on the message thread, so a bank shared by 32
+// inputs sat in memory 32 times. SampleCache decodes each distinct file once
+// to a float32 cache file at the session rate and maps it; cells share the
+// mapping, and only the pinned head of each sample is private RAM.
+//
+//   legacy   SamplerFileOps::loadFromProject per cell, buffers kept
+//   cold     SampleCache with an empty cache folder (decode + write + map)
+//   warm     SampleCache with the cache folder left by a cold run (map only)
+//
+// For each mode: wall time until every cell has audio, and resident set size
+// after loading and again after reading every sample once (mapped pages only
+// count once touched, and are clean file pages the OS may drop under
+// pressure, unlike the legacy heap buffers).
+//
+//   sampler-cache-bench [--mode legacy|cold|warm|all] [--inputs 32]
+//                       [--folder dir | --files 72 --seconds 20]
+//                       [--file-rate 44100] [--session-rate 48000]
+//                       [--pin-ms 100] [--json out.json]
+//
+// Without --folder, --files stereo WAVs of --seconds noise are written to a
+// temp folder. Cell k of every input uses file k % files, so inputs share
+// banks as they do in a real grid. RSS falls back slowly after a free, so
+// for clean figures run one mode per process (--mode all runs them in the
+// order cold, warm, legacy).
+//==============================================================================
+
+#include <JuceHeader.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "Sampler/SampleCache.h"
+#include "Sampler/SamplerFileOps.h"
+
+#if JUCE_WINDOWS
+ #include <windows.h>
+ #include <psapi.h>
+#elif JUCE_MAC
+ #include <mach/mach.h>
+#endif
+
+namespace
+{
+
+constexpr int cellsPerInput = 36;
+
+struct Config
+{
+    std::string mode = "all";
+    int inputs = 32;
+    std::string folderArg;
+    int files = 72;
+    double seconds = 20.0;
+    double fileRate = 44100.0;
+    double sessionRate = 48000.0;
+    double pinMs = 100.0;
+    std::string jsonArg;
+};
+
+struct Result
+{
+    std::string mode;
+    int cells = 0;
+    int failed = 0;
+    int distinct = 0;
+    double loadMs = 0.0;
+    double rssLoadedMb = 0.0;
+    double rssTouchedMb = 0.0;
+    double rssBaseMb = 0.0;
+};
+
+double residentMb()
+{
+   #if JUCE_WINDOWS
+    PROCESS_MEMORY_COUNTERS pmc {};
+    if (GetProcessMemoryInfo (GetCurrentProcess(), &pmc, sizeof (pmc)))
+        return static_cast<double> (pmc.WorkingSetSize) / (1024.0 * 1024.0);
+    return 0.0;
+   #elif JUCE_MAC
+    mach_task_basic_info info {};
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info (mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t> (&info), &count) == KERN_SUCCESS)
+        return static_cast<double> (info.resident_size) / (1024.0 * 1024.0);
+    return 0.0;
+   #else
+    long pages = 0, resident = 0;
+    if (auto* f = std::fopen ("/proc/self/statm", "r"))
+    {
+        if (std::fscanf (f, "%ld %ld", &pages, &resident) != 2)
+            resident = 0;
+        std::fclose (f);
+    }
+    return static_cast<double> (resident) * 4096.0 / (1024.0 * 1024.0);
+   #endif
+}
+
+double nowMs()
+{
+    return juce::Time::getMillisecondCounterHiRes();
+}
+
+bool writeTestFiles (const Config& cfg, const juce::File& folder, std::vector<juce::File>& out)
+{
+    folder.createDirectory();
+    juce::WavAudioFormat wav;
+    juce::Random rng (1234);
+    const int length = static_cast<int> (cfg.seconds * cfg.fileRate);
+    juce::AudioBuffer<float> buffer (2, length);
+
+    for (int f = 0; f < cfg.files; ++f)
+    {
+        for (int ch = 0; ch < 2; ++ch)
+            for (int s = 0; s < length; ++s)
+                buffer.setSample (ch, s, (rng.nextFloat() * 2.0f - 1.0f) * 0.25f);
+
+        auto file = folder.getChildFile ("bench_" + juce::String (f).paddedLeft ('0', 3) + ".wav");
+        file.deleteFile();
+        auto os = std::make_unique<juce::FileOutputStream> (file);
+        if (! os->openedOk())
+            return false;
+        std::unique_ptr<juce::AudioFormatWriter> writer (
+            wav.createWriterFor (os.get(), cfg.fileRate, 2, 24, {}, 0));
+        if (writer == nullptr)
+            return false;
+        os.release();   // writer owns the stream now
+        if (! writer->writeFromAudioSampleBuffer (buffer, 0, length))
+            return false;
+        out.push_back (file);
+    }
+    return true;
+}
+
+// Reads every sample once, as playback eventually does.
+template <typename ReadFn>
+float touchAll (int numSamples, ReadFn&& read)
+{
+    float acc = 0.0f;
+    for (int i = 0; i < numSamples; ++i)
+        acc += read (i);
+    return acc;
+}
+
+Result runLegacy (const std::vector<juce::File>& files, int inputs)
+{
+    Result r;
+    r.mode = "legacy";
+    r.rssBaseMb = residentMb();
+
+    SamplerFileOps fileOps;
+    std::vector<std::shared_ptr<juce::AudioBuffer<float>>> cells;
+    const double t0 = nowMs();
+    for (int in = 0; in < inputs; ++in)
+    {
+        for (int c = 0; c < cellsPerInput; ++c)
+        {
+            const auto& file = files[static_cast<size_t> (c) % files.size()];
+            double sr = 0.0;
+            int n = 0;
+            auto buffer = fileOps.loadFromProject (file.getParentDirectory(), file.getFileName(), sr, n);
+            if (buffer == nullptr)
+                ++r.failed;
+            cells.push_back (std::move (buffer));
+            ++r.cells;
+        }
+    }
+    r.loadMs = nowMs() - t0;
+    r.distinct = r.cells - r.failed;   // No sharing
+    r.rssLoadedMb = residentMb();
+
+    volatile float sink = 0.0f;
+    for (auto& b : cells)
+        if (b != nullptr)
+            sink = sink + touchAll (b->getNumSamples(), [&] (int i) { return b->getSample (0, i); });
+    r.rssTouchedMb = residentMb();
+    return r;
+}
+
+Result runCache (const char* name, const std::vector<juce::File>& files, int inputs,
+                 const juce::File& cacheFolder, const Config& cfg)
+{
+    Result r;
+    r.mode = name;
+    r.rssBaseMb = residentMb();
+
+    SampleCache cache;
+    cache.setSessionSampleRate (cfg.sessionRate);
+    cache.setPinnedHeadMs (cfg.pinMs);
+
+    // Same flow as SamplerManager::loadChannelCells + applyPendingAudioLoads.
+    std::vector<SampleCache::SamplePtr> cells (static_cast<size_t> (inputs * cellsPerInput));
+    const double t0 = nowMs();
+    for (int in = 0; in < inputs; ++in)
+    {
+        for (int c = 0; c < cellsPerInput; ++c)
+        {
+            const auto slot = static_cast<size_t> (in * cellsPerInput + c);
+            const auto& file = files[static_cast<size_t> (c) % files.size()];
+            if (auto hit = cache.findLoaded (file))
+                cells[slot] = std::move (hit);
+            else
+                cache.request (file, cacheFolder, static_cast<juce::int64> (slot));
+        }
+    }
+    while (cache.getNumPending() > 0)
+    {
+        for (auto& done : cache.takeCompleted())
+            cells[static_cast<size_t> (done.tag)] = std::move (done.sample);
+        juce::Thread::sleep (1);
+    }
+    for (auto& done : cache.takeCompleted())
+        cells[static_cast<size_t> (done.tag)] = std::move (done.sample);
+    r.loadMs = nowMs() - t0;
+    r.rssLoadedMb = residentMb();
+
+    std::vector<const SampleCache::Sample*> distinct;
+    for (auto& s : cells)
+    {
+        ++r.cells;
+        if (s == nullptr)
+            ++r.failed;
+        else if (std::find (distinct.begin(), distinct.end(), s.get()) == distinct.end())
+            distinct.push_back (s.get());
+    }
+    r.distinct = static_cast<int> (distinct.size());
+
+    volatile float sink = 0.0f;
+    for (auto* s : distinct)
+        sink = sink + touchAll (s->getNumSamples(), [&] (int i) { return s->getSample (i); });
+    r.rssTouchedMb = residentMb();
+    return r;
+}
+
+void print (const Result& r)
+{
+    std::printf ("%-6s cells %5d  failed %3d  distinct %4d  load %9.1f ms"
+                 "  rss MB: base %8.1f  loaded %8.1f  touched %8.1f\n",
+                 r.mode.c_str(), r.cells, r.failed, r.distinct, r.loadMs,
+                 r.rssBaseMb, r.rssLoadedMb, r.rssTouchedMb);
+}
+
+bool writeJson (const juce::File& f, const Config& cfg, int numFiles, const std::vector<Result>& results)
+{
+    juce::String s;
+    s << "{\n"
+      << "  \"inputs\": " << cfg.inputs
+      << ", \"cellsPerInput\": " << cellsPerInput
+      << ", \"files\": " << numFiles
+      << ", \"sessionRate\": " << juce::String (cfg.sessionRate, 1)
+      << ", \"pinMs\": " << juce::String (cfg.pinMs, 1)
+      << ", \"unit\": { \"load\": \"ms\", \"rss\": \"MB\" },\n"
+      << "  \"modes\": [\n";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const auto& r = results[i];
+        s << "    { \"name\": \"" << juce::String (r.mode) << "\""
+          << ", \"cells\": " << r.cells << ", \"failed\": " << r.failed
+          << ", \"distinct\": " << r.distinct
+          << ", \"load\": " << juce::String (r.loadMs, 2)
+          << ", \"rssBase\": " << juce::String (r.rssBaseMb, 2)
+          << ", \"rssLoaded\": " << juce::String (r.rssLoadedMb, 2)
+          << ", \"rssTouched\": " << juce::String (r.rssTouchedMb, 2) << " }"
+          << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    s << "  ]\n}\n";
+    return f.replaceWithText (s);
+}
+
+void usage()
+{
+    std::fprintf (stderr,
+        "usage: sampler-cache-bench [--mode legacy|cold|warm|all] [--inputs 32]\n"
+        "                           [--folder dir | --files 72 --seconds 20]\n"
+        "                           [--file-rate 44100] [--session-rate 48000]\n"
+        "                           [--pin-ms 100] [--json out.json]\n"
+        "\n"
+        "Loads inputs x 36 Sampler cells with the old per-cell loader and through\n"
+        "the memory-mapped SampleCache (cold: empty cache folder, warm: existing\n"
+        "cache files), and reports load time and resident memory per mode. warm\n"
+        "alone expects the cache folder of an earlier cold run.\n"
+        "\n"
+        "exit codes: 0 ok, 1 no audio files or a cell failed to load, 2 usage\n");
+}
+
+} // namespace
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    Config cfg;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string a = argv[i];
+        auto next = [&]() -> std::string
+        {
+            if (i + 1 >= argc)
+            {
+                std::fprintf (stderr, "error: %s needs a value\n", a.c_str());
+                std::exit (2);
+            }
+            return argv[++i];
+        };
+
+        if      (a == "--mode")          cfg.mode = next();
+        else if (a == "--inputs")        cfg.inputs = std::atoi (next().c_str());
+        else if (a == "--folder")        cfg.folderArg = next();
+        else if (a == "--files")         cfg.files = std::atoi (next().c_str());
+        else if (a == "--seconds")       cfg.seconds = std::atof (next().c_str());
+        else if (a == "--file-rate")     cfg.fileRate = std::atof (next().c_str());
+        else if (a == "--session-rate")  cfg.sessionRate = std::atof (next().c_str());
+        else if (a == "--pin-ms")        cfg.pinMs = std::atof (next().c_str());
+        else if (a == "--json")          cfg.jsonArg = next();
+        else if (a == "--help" || a == "-h") { usage(); return 0; }
+        else
+        {
+            std::fprintf (stderr, "error: unknown argument '%s'\n", a.c_str());
+            usage();
+            return 2;
+        }
+    }
+
+    if ((cfg.mode != "legacy" && cfg.mode != "cold" && cfg.mode != "warm" && cfg.mode != "all")
+        || cfg.inputs <= 0 || cfg.files <= 0 || cfg.seconds <= 0.0
+        || cfg.fileRate <= 0.0 || cfg.sessionRate <= 0.0 || cfg.pinMs < 0.0)
+    {
+        std::fprintf (stderr, "error: invalid arguments\n");
+        usage();
+        return 2;
+    }
+
+    juce::File folder;
+    std::vector<juce::File> files;
+    if (! cfg.folderArg.empty())
+    {
+        folder = juce::File::getCurrentWorkingDirectory().getChildFile (juce::String (cfg.folderArg));
+        SamplerFileOps fileOps;
+        for (const auto& entry : juce::RangedDirectoryIterator (folder, false, fileOps.getWildcardFilter()))
+            files.push_back (entry.getFile());
+        std::sort (files.begin(), files.end());
+    }
+    else
+    {
+        folder = juce::File::getSpecialLocation (juce::File::tempDirectory).getChildFile ("sampler-cache-bench");
+        std::printf ("writing %d x %.1f s stereo WAVs at %.0f Hz to %s\n", cfg.files, cfg.seconds,
+                     cfg.fileRate, folder.getFullPathName().toRawUTF8());
+        if (! writeTestFiles (cfg, folder, files))
+        {
+            std::fprintf (stderr, "error: could not write test files\n");
+            return 1;
+        }
+    }
+
+    if (files.empty())
+    {
+        std::fprintf (stderr, "error: no audio files in %s\n", folder.getFullPathName().toRawUTF8());
+        return 1;
+    }
+
+    const auto cacheFolder = SampleCache::getCacheFolderFor (folder);
+    std::printf ("%d inputs x %d cells over %d files, session %.0f Hz, %.0f ms pinned, cache %s\n",
+                 cfg.inputs, cellsPerInput, static_cast<int> (files.size()), cfg.sessionRate, cfg.pinMs,
+                 cacheFolder.getFullPathName().toRawUTF8());
+
+    std::vector<Result> results;
+    auto run = [&] (const std::string& mode)
+    {
+        Result r;
+        if (mode == "legacy")
+            r = runLegacy (files, cfg.inputs);
+        else
+        {
+            if (mode == "cold")
+                cacheFolder.deleteRecursively();
+            r = runCache (mode.c_str(), files, cfg.inputs, cacheFolder, cfg);
+        }
+        print (r);
+        results.push_back (r);
+    };
+
+    if (cfg.mode == "all")
+    {
+        run ("cold");
+        run ("warm");
+        run ("legacy");
+    }
+    else
+    {
+        run (cfg.mode);
+    }
+
+    if (! cfg.jsonArg.empty())
+    {
+        const auto f = juce::File::getCurrentWorkingDirectory().getChildFile (juce::String (cfg.jsonArg));
+        if (! writeJson (f, cfg, static_cast<int> (files.size()), results))
+            std::fprintf (stderr, "warning: could not write %s\n", f.getFullPathName().toRawUTF8());
+    }
+
+    for (const auto& r : results)
+        if (r.failed > 0)
+            return 1;
+    return 0;
+}
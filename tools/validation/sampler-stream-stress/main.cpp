@@ -0,0 +1,381 @@
+//==============================================================================
+// sampler-stream-stress — many long Sampler cells triggered at once, played
+// through the streaming path.
+//
+// Every voice is a SamplerEngine whose cells are above the stream threshold,
+// so after the pinned head its audio comes from the SampleStreamBuffer the
+// SamplerStreamer thread refills from the mapped cache file. All voices are
+// triggered in the same block (and again every --retrigger-ms, to exercise
+// restarts), and a simulated audio callback processes them block by block,
+// at real-time pace or, with --fast, back to back (the streamer then has
+// the least time per segment).
+//
+// A second, identical set of engines with streaming disabled reads the same
+// cells straight from the mapping. The two outputs must match sample for
+// sample, except where an underrun played silence (the test content is
+// noise, so a real sample is never exactly zero).
+//
+//   sampler-stream-stress [--voices 64] [--files 8] [--file-seconds 120]
+//                         [--play-seconds 30] [--rate 48000] [--block 256]
+//                         [--pin-ms 100] [--retrigger-ms 0] [--fast]
+//                         [--json out.json]
+//
+// Reports underruns (segments that were not ready when the playhead reached
+// them), voices affected, samples played as silence, callback time
+// percentiles for the streamed set, and mismatching samples.
+//
+// The cache files are written just before the run, so they are usually in
+// the OS page cache; for a cold-disk figure, make --files x --file-seconds
+// larger than free RAM.
+//==============================================================================
+
+#include <JuceHeader.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "Sampler/SamplerStreamer.h"
+
+namespace
+{
+
+struct Config
+{
+    int voices = 64;
+    int files = 8;
+    double fileSeconds = 120.0;
+    double playSeconds = 30.0;
+    double rate = 48000.0;
+    int block = 256;
+    double pinMs = 100.0;
+    double retriggerMs = 0.0;
+    bool fast = false;
+    std::string jsonArg;
+};
+
+struct Percentiles
+{
+    double p50 = 0.0, p99 = 0.0, max = 0.0;
+};
+
+struct Result
+{
+    int blocks = 0;
+    int triggers = 0;
+    int underruns = 0;
+    int voicesWithUnderruns = 0;
+    juce::int64 silencedSamples = 0;
+    juce::int64 mismatchedSamples = 0;
+    Percentiles callbackUs;
+};
+
+Percentiles percentiles (std::vector<double> v)
+{
+    Percentiles p;
+    if (v.empty())
+        return p;
+    std::sort (v.begin(), v.end());
+    auto at = [&] (double q) { return v[static_cast<size_t> (q * static_cast<double> (v.size() - 1))]; };
+    p.p50 = at (0.50);
+    p.p99 = at (0.99);
+    p.max = v.back();
+    return p;
+}
+
+double ticksToUs (juce::int64 ticks)
+{
+    return juce::Time::highResolutionTicksToSeconds (ticks) * 1.0e6;
+}
+
+bool writeTestFiles (const Config& cfg, const juce::File& folder, std::vector<juce::File>& out)
+{
+    folder.createDirectory();
+    juce::WavAudioFormat wav;
+    juce::Random rng (4321);
+    const int length = static_cast<int> (cfg.fileSeconds * cfg.rate);
+    const int chunk = 1 << 16;
+    juce::AudioBuffer<float> buffer (1, chunk);
+
+    for (int f = 0; f < cfg.files; ++f)
+    {
+        auto file = folder.getChildFile ("stream_" + juce::String (f).paddedLeft ('0', 3) + ".wav");
+        out.push_back (file);
+        if (file.getSize() > 0)
+            continue;   // Kept from an earlier run: same content, cache hit
+
+        auto os = std::make_unique<juce::FileOutputStream> (file);
+        if (! os->openedOk())
+            return false;
+        std::unique_ptr<juce::AudioFormatWriter> writer (
+            wav.createWriterFor (os.get(), cfg.rate, 1, 24, {}, 0));
+        if (writer == nullptr)
+            return false;
+        os.release();   // writer owns the stream now
+
+        for (int start = 0; start < length; start += chunk)
+        {
+            const int n = std::min (chunk, length - start);
+            for (int s = 0; s < n; ++s)
+                buffer.setSample (0, s, (rng.nextFloat() * 2.0f - 1.0f) * 0.25f);
+            if (! writer->writeFromAudioSampleBuffer (buffer, 0, n))
+                return false;
+        }
+    }
+    return true;
+}
+
+std::vector<std::unique_ptr<SamplerEngine>> makeEngines (const Config& cfg,
+                                                         const std::vector<SampleCache::SamplePtr>& samples,
+                                                         bool streamed)
+{
+    std::vector<SamplerData::SampleCell> cells (static_cast<size_t> (WFSParameterDefaults::samplerGridCells));
+    for (size_t i = 0; i < samples.size() && i < cells.size(); ++i)
+    {
+        cells[i].relativeFilePath = "stream";
+        cells[i].setAudio (samples[i]);
+    }
+
+    std::vector<std::unique_ptr<SamplerEngine>> engines;
+    for (int v = 0; v < cfg.voices; ++v)
+    {
+        auto engine = std::make_unique<SamplerEngine>();
+        engine->prepare (cfg.rate, cfg.block);
+        engine->setStreamThreshold (streamed ? 1 : 0);
+        engine->loadCells (cells);
+        engines.push_back (std::move (engine));
+    }
+    return engines;
+}
+
+void triggerAll (std::vector<std::unique_ptr<SamplerEngine>>& engines, int numCells, int round)
+{
+    for (size_t v = 0; v < engines.size(); ++v)
+    {
+        SamplerEngine::TouchEvent evt;
+        evt.type = SamplerEngine::TouchEvent::NoteOn;
+        evt.cellIndex = static_cast<int> ((v + static_cast<size_t> (round)) % static_cast<size_t> (numCells));
+        evt.pressure = 1.0f;
+        engines[v]->pushEvent (evt);
+    }
+}
+
+Result run (const Config& cfg, const std::vector<SampleCache::SamplePtr>& samples)
+{
+    Result r;
+    auto streamed = makeEngines (cfg, samples, true);
+    auto reference = makeEngines (cfg, samples, false);
+
+    std::vector<SamplerEngine*> voices;
+    for (auto& e : streamed)
+        voices.push_back (e.get());
+    SamplerStreamer streamer;
+    streamer.setEngines (voices);
+
+    const int numCells = static_cast<int> (samples.size());
+    const int totalBlocks = static_cast<int> (cfg.playSeconds * cfg.rate / cfg.block);
+    const int retriggerBlocks = cfg.retriggerMs > 0.0
+                                    ? std::max (1, static_cast<int> (cfg.retriggerMs * 0.001 * cfg.rate / cfg.block))
+                                    : 0;
+    const double blockMs = 1000.0 * cfg.block / cfg.rate;
+
+    std::vector<float> outR (static_cast<size_t> (cfg.block));
+    std::vector<std::vector<float>> outS (static_cast<size_t> (cfg.voices), std::vector<float> (static_cast<size_t> (cfg.block)));
+    std::vector<int> underrunsPerVoice (static_cast<size_t> (cfg.voices), 0);
+    std::vector<double> callbackUs;
+    callbackUs.reserve (static_cast<size_t> (totalBlocks));
+
+    double deadline = juce::Time::getMillisecondCounterHiRes();
+    for (int b = 0; b < totalBlocks; ++b)
+    {
+        if (b == 0 || (retriggerBlocks > 0 && b % retriggerBlocks == 0))
+        {
+            triggerAll (streamed, numCells, r.triggers);
+            triggerAll (reference, numCells, r.triggers);
+            ++r.triggers;
+        }
+
+        // Streamed set: timed as the audio callback would be
+        const auto t0 = juce::Time::getHighResolutionTicks();
+        for (size_t v = 0; v < streamed.size(); ++v)
+            streamed[v]->processBlock (outS[v].data(), cfg.block);
+        callbackUs.push_back (ticksToUs (juce::Time::getHighResolutionTicks() - t0));
+
+        for (size_t v = 0; v < reference.size(); ++v)
+        {
+            reference[v]->processBlock (outR.data(), cfg.block);
+
+            const int underruns = streamed[v]->fetchAndClearStreamUnderruns();
+            underrunsPerVoice[v] += underruns;
+            r.underruns += underruns;
+
+            for (size_t i = 0; i < outR.size(); ++i)
+            {
+                const float s = outS[v][i];
+                if (s == outR[i])
+                    continue;
+                if (s == 0.0f)
+                    ++r.silencedSamples;
+                else
+                    ++r.mismatchedSamples;
+            }
+        }
+
+        ++r.blocks;
+        if (! cfg.fast)
+        {
+            deadline += blockMs;
+            const double wait = deadline - juce::Time::getMillisecondCounterHiRes();
+            if (wait > 1.0)
+                juce::Thread::sleep (static_cast<int> (wait));
+        }
+    }
+
+    streamer.stop();
+    r.voicesWithUnderruns = static_cast<int> (std::count_if (underrunsPerVoice.begin(), underrunsPerVoice.end(),
+                                                             [] (int n) { return n > 0; }));
+    r.callbackUs = percentiles (std::move (callbackUs));
+    return r;
+}
+
+bool writeJson (const juce::File& f, const Config& cfg, const Result& r)
+{
+    juce::String s;
+    s << "{\n"
+      << "  \"voices\": " << cfg.voices
+      << ", \"files\": " << cfg.files
+      << ", \"fileSeconds\": " << juce::String (cfg.fileSeconds, 1)
+      << ", \"playSeconds\": " << juce::String (cfg.playSeconds, 1)
+      << ", \"rate\": " << juce::String (cfg.rate, 1)
+      << ", \"block\": " << cfg.block
+      << ", \"pinMs\": " << juce::String (cfg.pinMs, 1)
+      << ", \"retriggerMs\": " << juce::String (cfg.retriggerMs, 1)
+      << ", \"fast\": " << (cfg.fast ? "true" : "false") << ",\n"
+      << "  \"blocks\": " << r.blocks
+      << ", \"triggers\": " << r.triggers
+      << ", \"underruns\": " << r.underruns
+      << ", \"voicesWithUnderruns\": " << r.voicesWithUnderruns
+      << ", \"silencedSamples\": " << r.silencedSamples
+      << ", \"mismatchedSamples\": " << r.mismatchedSamples << ",\n"
+      << "  \"callbackUs\": { \"p50\": " << juce::String (r.callbackUs.p50, 2)
+      << ", \"p99\": " << juce::String (r.callbackUs.p99, 2)
+      << ", \"max\": " << juce::String (r.callbackUs.max, 2) << " }\n"
+      << "}\n";
+    return f.replaceWithText (s);
+}
+
+void usage()
+{
+    std::fprintf (stderr,
+        "usage: sampler-stream-stress [--voices 64] [--files 8] [--file-seconds 120]\n"
+        "                             [--play-seconds 30] [--rate 48000] [--block 256]\n"
+        "                             [--pin-ms 100] [--retrigger-ms 0] [--fast]\n"
+        "                             [--json out.json]\n"
+        "\n"
+        "Triggers every voice at once on a long streamed cell, plays them for\n"
+        "--play-seconds through the read-ahead streamer and reports underruns,\n"
+        "callback time and any sample that differs from reading the mapping.\n"
+        "\n"
+        "exit codes: 0 ok, 1 underruns, mismatches or setup failure, 2 usage\n");
+}
+
+} // namespace
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    Config cfg;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string a = argv[i];
+        auto next = [&]() -> std::string
+        {
+            if (i + 1 >= argc)
+            {
+                std::fprintf (stderr, "error: %s needs a value\n", a.c_str());
+                std::exit (2);
+            }
+            return argv[++i];
+        };
+
+        if      (a == "--voices")        cfg.voices = std::atoi (next().c_str());
+        else if (a == "--files")         cfg.files = std::atoi (next().c_str());
+        else if (a == "--file-seconds")  cfg.fileSeconds = std::atof (next().c_str());
+        else if (a == "--play-seconds")  cfg.playSeconds = std::atof (next().c_str());
+        else if (a == "--rate")          cfg.rate = std::atof (next().c_str());
+        else if (a == "--block")         cfg.block = std::atoi (next().c_str());
+        else if (a == "--pin-ms")        cfg.pinMs = std::atof (next().c_str());
+        else if (a == "--retrigger-ms")  cfg.retriggerMs = std::atof (next().c_str());
+        else if (a == "--fast")          cfg.fast = true;
+        else if (a == "--json")          cfg.jsonArg = next();
+        else if (a == "--help" || a == "-h") { usage(); return 0; }
+        else
+        {
+            std::fprintf (stderr, "error: unknown argument '%s'\n", a.c_str());
+            usage();
+            return 2;
+        }
+    }
+
+    if (cfg.voices <= 0 || cfg.files <= 0 || cfg.files > WFSParameterDefaults::samplerGridCells
+        || cfg.fileSeconds <= 0.0 || cfg.playSeconds <= 0.0 || cfg.rate <= 0.0
+        || cfg.block <= 0 || cfg.pinMs < 0.0 || cfg.retriggerMs < 0.0)
+    {
+        std::fprintf (stderr, "error: invalid arguments (at most %d files)\n", WFSParameterDefaults::samplerGridCells);
+        usage();
+        return 2;
+    }
+
+    const auto folder = juce::File::getSpecialLocation (juce::File::tempDirectory).getChildFile ("sampler-stream-stress");
+    std::vector<juce::File> files;
+    std::printf ("preparing %d x %.0f s mono WAVs at %.0f Hz in %s\n", cfg.files, cfg.fileSeconds, cfg.rate,
+                 folder.getFullPathName().toRawUTF8());
+    if (! writeTestFiles (cfg, folder, files))
+    {
+        std::fprintf (stderr, "error: could not write test files\n");
+        return 1;
+    }
+
+    SampleCache cache;
+    const auto cacheFolder = SampleCache::getCacheFolderFor (folder);
+    std::vector<SampleCache::SamplePtr> samples;
+    for (const auto& file : files)
+    {
+        juce::String error;
+        auto sample = cache.loadNow (file, cacheFolder, cfg.rate, cfg.pinMs, error);
+        if (sample == nullptr || ! sample->isMapped())
+        {
+            std::fprintf (stderr, "error: %s did not load as a mapped cache file (%s)\n",
+                          file.getFullPathName().toRawUTF8(), error.toRawUTF8());
+            return 1;
+        }
+        samples.push_back (std::move (sample));
+    }
+
+    std::printf ("%d voices triggered at once%s, %.0f s at %d-sample blocks%s\n", cfg.voices,
+                 cfg.retriggerMs > 0.0 ? (" and every " + juce::String (cfg.retriggerMs, 0) + " ms").toRawUTF8() : "",
+                 cfg.playSeconds, cfg.block, cfg.fast ? " (back to back)" : " (real time)");
+
+    const auto r = run (cfg, samples);
+
+    std::printf ("blocks %d  triggers %d  underruns %d on %d voices  silenced samples %lld"
+                 "  mismatched samples %lld\n"
+                 "callback us (streamed set) p50 %.1f  p99 %.1f  max %.1f\n",
+                 r.blocks, r.triggers, r.underruns, r.voicesWithUnderruns,
+                 static_cast<long long> (r.silencedSamples),
+                 static_cast<long long> (r.mismatchedSamples),
+                 r.callbackUs.p50, r.callbackUs.p99, r.callbackUs.max);
+
+    if (! cfg.jsonArg.empty())
+    {
+        const auto f = juce::File::getCurrentWorkingDirectory().getChildFile (juce::String (cfg.jsonArg));
+        if (! writeJson (f, cfg, r))
+            std::fprintf (stderr, "warning: could not write %s\n", f.getFullPathName().toRawUTF8());
+    }
+
+    return (r.underruns > 0 || r.mismatchedSamples > 0) ? 1 : 0;
+}
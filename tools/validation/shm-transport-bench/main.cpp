@@ -0,0 +1,409 @@
+//==============================================================================
+// shm-transport-bench — UDP loopback vs the shared-memory ring for Master
+// plugin automation sent to an app on the same computer.
+//
+// A Master plugin forwards every automated track's rate-limited values to the
+// app. Over UDP each value costs an OSC encode, a mutex and a sendto on the
+// plugin side and a recvfrom + parse on the app side; through
+// LocalControlRing it is a 24-byte record in a mapped ring. This tool drives
+// both with the same load and measures:
+//
+//   send      time spent in the plugin-side call (OSCSender::send vs
+//             findParamHandle + Producer::push, as MasterProcessor does)
+//   latency   send call -> the value in the receiving thread's hands
+//   lost      values that never arrived
+//
+// Load: --tracks tracks x positionX/Y/Z, all updated every 1/--rate s (the
+// plugin rate limiter's default window is 50 Hz). The UDP receiver is a
+// juce::OSCReceiver realtime thread; the ring consumer polls every
+// 1/--drain-hz s like the app's drain timer (0 = spin), so ring latency is
+// bounded below by that period, not by the transport. Neither path includes
+// the app's message-thread hop, which both share.
+//
+//   shm-transport-bench [--mode udp|ring|both] [--tracks 64] [--rate 50]
+//                       [--seconds 10] [--drain-hz 500] [--port 19797]
+//                       [--json out.json]
+//
+// Values carry their own sequence number (exact in a float below 2^24), so
+// the receiver can match each one to its send time.
+//==============================================================================
+
+#include <JuceHeader.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Shared/LocalControlRing.h"
+
+namespace
+{
+
+struct Config
+{
+    std::string mode = "both";
+    int tracks = 64;
+    double rateHz = 50.0;
+    double seconds = 10.0;
+    double drainHz = 500.0;
+    int port = 19797;
+    std::string jsonArg;
+};
+
+struct Percentiles
+{
+    double p50 = 0.0, p95 = 0.0, p99 = 0.0, max = 0.0;
+};
+
+struct Result
+{
+    std::string transport;
+    int sent = 0;
+    int lost = 0;
+    Percentiles sendUs, latencyUs;
+};
+
+const char* const axisPaths[3] = { "/wfs/input/positionX", "/wfs/input/positionY", "/wfs/input/positionZ" };
+
+double ticksToUs (juce::int64 ticks)
+{
+    return juce::Time::highResolutionTicksToSeconds (ticks) * 1.0e6;
+}
+
+Percentiles percentiles (std::vector<double> v)
+{
+    Percentiles p;
+    if (v.empty())
+        return p;
+    std::sort (v.begin(), v.end());
+    auto at = [&] (double q) { return v[std::min (v.size() - 1, static_cast<size_t> (q * static_cast<double> (v.size())))]; };
+    p.p50 = at (0.50);
+    p.p95 = at (0.95);
+    p.p99 = at (0.99);
+    p.max = v.back();
+    return p;
+}
+
+//==============================================================================
+/** Per-value bookkeeping shared by both transports. Each slot is written by
+    exactly one thread and read after that thread has been joined. */
+struct Ledger
+{
+    explicit Ledger (int total)
+        : sendTicks (static_cast<size_t> (total), 0),
+          sendCost (static_cast<size_t> (total), 0),
+          recvTicks (static_cast<size_t> (total), 0) {}
+
+    void received (float value)
+    {
+        const auto seq = static_cast<int> (value);
+        if (seq >= 0 && seq < static_cast<int> (recvTicks.size()))
+            recvTicks[static_cast<size_t> (seq)] = juce::Time::getHighResolutionTicks();
+    }
+
+    Result summarise (const std::string& name, int sent) const
+    {
+        Result r;
+        r.transport = name;
+        r.sent = sent;
+        std::vector<double> cost, lat;
+        cost.reserve (static_cast<size_t> (sent));
+        lat.reserve (static_cast<size_t> (sent));
+        for (size_t i = 0; i < static_cast<size_t> (sent); ++i)
+        {
+            cost.push_back (ticksToUs (sendCost[i]));
+            if (recvTicks[i] == 0)
+                ++r.lost;
+            else
+                lat.push_back (ticksToUs (recvTicks[i] - sendTicks[i]));
+        }
+        r.sendUs = percentiles (std::move (cost));
+        r.latencyUs = percentiles (std::move (lat));
+        return r;
+    }
+
+    std::vector<juce::int64> sendTicks, sendCost, recvTicks;
+};
+
+/** Paces cfg.tracks x XYZ sends at cfg.rateHz for cfg.seconds; send (path,
+    channelId, value) does the transport-specific part. Returns values sent. */
+template <typename SendFn>
+int drive (const Config& cfg, Ledger& ledger, SendFn&& send)
+{
+    const int ticks = static_cast<int> (cfg.rateHz * cfg.seconds);
+    const double start = juce::Time::getMillisecondCounterHiRes();
+    int seq = 0;
+
+    for (int k = 0; k < ticks; ++k)
+    {
+        const double due = start + 1000.0 * k / cfg.rateHz;
+        while (juce::Time::getMillisecondCounterHiRes() < due)
+            juce::Thread::sleep (juce::jmax (0, static_cast<int> (due - juce::Time::getMillisecondCounterHiRes()) - 1));
+
+        for (int t = 1; t <= cfg.tracks; ++t)
+        {
+            for (const char* path : axisPaths)
+            {
+                const auto before = juce::Time::getHighResolutionTicks();
+                send (juce::String (path), t, static_cast<float> (seq));
+                const auto after = juce::Time::getHighResolutionTicks();
+                ledger.sendTicks[static_cast<size_t> (seq)] = before;
+                ledger.sendCost[static_cast<size_t> (seq)] = after - before;
+                ++seq;
+            }
+        }
+    }
+    return seq;
+}
+
+//==============================================================================
+class UdpSink  : private juce::OSCReceiver::Listener<juce::OSCReceiver::RealtimeCallback>
+{
+public:
+    explicit UdpSink (Ledger& l) : ledger (l) {}
+    ~UdpSink() override { receiver.disconnect(); }
+
+    bool connect (int port)
+    {
+        receiver.addListener (this);
+        return receiver.connect (port);
+    }
+
+    void disconnect() { receiver.disconnect(); }
+
+private:
+    void oscMessageReceived (const juce::OSCMessage& m) override
+    {
+        if (m.size() >= 2 && m[1].isFloat32())
+            ledger.received (m[1].getFloat32());
+    }
+
+    Ledger& ledger;
+    juce::OSCReceiver receiver;
+};
+
+bool runUdp (const Config& cfg, int total, Result& out)
+{
+    Ledger ledger (total);
+    UdpSink sink (ledger);
+    if (! sink.connect (cfg.port))
+    {
+        std::fprintf (stderr, "error: cannot bind UDP port %d\n", cfg.port);
+        return false;
+    }
+
+    juce::OSCSender sender;
+    std::mutex lock;   // OscTransport holds one around every send
+    if (! sender.connect ("127.0.0.1", cfg.port))
+    {
+        std::fprintf (stderr, "error: cannot open UDP sender\n");
+        return false;
+    }
+
+    const int sent = drive (cfg, ledger, [&] (const juce::String& path, int chan, float value)
+    {
+        std::lock_guard<std::mutex> sl (lock);
+        sender.send (juce::OSCAddressPattern (path), chan, value);
+    });
+
+    juce::Thread::sleep (200);
+    sink.disconnect();
+    out = ledger.summarise ("udp", sent);
+    return true;
+}
+
+bool runRing (const Config& cfg, int total, Result& out)
+{
+    Ledger ledger (total);
+    const auto segmentFile = juce::File::getSpecialLocation (juce::File::tempDirectory)
+                                 .getChildFile ("shm-transport-bench.shm");
+
+    LocalControlRing::Consumer consumer;
+    LocalControlRing::Producer producer;
+    if (! consumer.create (segmentFile) || ! producer.open (segmentFile, consumer.getSession()))
+    {
+        std::fprintf (stderr, "error: cannot map %s\n", segmentFile.getFullPathName().toRawUTF8());
+        return false;
+    }
+
+    std::atomic<bool> stop { false };
+    std::thread drainer ([&]
+    {
+        const double periodMs = cfg.drainHz > 0.0 ? 1000.0 / cfg.drainHz : 0.0;
+        double next = juce::Time::getMillisecondCounterHiRes();
+        while (! stop.load())
+        {
+            consumer.drain ([&] (const LocalControlRing::Record& r) { ledger.received (r.value); },
+                            static_cast<int> (LocalControlRing::ringCapacity));
+            if (periodMs <= 0.0)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            next += periodMs;
+            const double wait = next - juce::Time::getMillisecondCounterHiRes();
+            if (wait > 0.0)
+                juce::Thread::sleep (static_cast<int> (wait));
+            else
+                next = juce::Time::getMillisecondCounterHiRes();
+        }
+        consumer.drain ([&] (const LocalControlRing::Record& r) { ledger.received (r.value); },
+                        static_cast<int> (LocalControlRing::ringCapacity));
+    });
+
+    int spilled = 0;
+    const int sent = drive (cfg, ledger, [&] (const juce::String& path, int chan, float value)
+    {
+        // A full ring falls back to UDP in the plugin; here it counts as lost.
+        if (! producer.push (chan, LocalControlRing::findParamHandle (path), value))
+            ++spilled;
+    });
+
+    juce::Thread::sleep (200);
+    stop = true;
+    drainer.join();
+    producer.close();
+    consumer.close();
+
+    out = ledger.summarise ("ring", sent);
+    if (spilled > 0)
+        std::printf ("ring: %d values found the ring full (the plugin would send them over UDP)\n", spilled);
+    return true;
+}
+
+//==============================================================================
+void print (const Result& r)
+{
+    std::printf ("%-5s sent %8d  lost %6d  send us p50 %7.2f p99 %7.2f max %8.1f"
+                 "  latency us p50 %8.1f p95 %8.1f p99 %8.1f max %9.1f\n",
+                 r.transport.c_str(), r.sent, r.lost,
+                 r.sendUs.p50, r.sendUs.p99, r.sendUs.max,
+                 r.latencyUs.p50, r.latencyUs.p95, r.latencyUs.p99, r.latencyUs.max);
+}
+
+bool writeJson (const juce::File& f, const Config& cfg, const std::vector<Result>& results)
+{
+    auto pct = [] (const Percentiles& p)
+    {
+        return "{ \"p50\": " + juce::String (p.p50, 2) + ", \"p95\": " + juce::String (p.p95, 2)
+             + ", \"p99\": " + juce::String (p.p99, 2) + ", \"max\": " + juce::String (p.max, 2) + " }";
+    };
+
+    juce::String s;
+    s << "{\n"
+      << "  \"tracks\": " << cfg.tracks
+      << ", \"rateHz\": " << juce::String (cfg.rateHz, 3)
+      << ", \"seconds\": " << juce::String (cfg.seconds, 3)
+      << ", \"drainHz\": " << juce::String (cfg.drainHz, 3)
+      << ", \"unit\": \"us\",\n"
+      << "  \"transports\": [\n";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const auto& r = results[i];
+        s << "    { \"name\": \"" << juce::String (r.transport) << "\""
+          << ", \"sent\": " << r.sent << ", \"lost\": " << r.lost
+          << ", \"send\": " << pct (r.sendUs)
+          << ", \"latency\": " << pct (r.latencyUs) << " }"
+          << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    s << "  ]\n}\n";
+    return f.replaceWithText (s);
+}
+
+void usage()
+{
+    std::fprintf (stderr,
+        "usage: shm-transport-bench [--mode udp|ring|both] [--tracks 64] [--rate 50]\n"
+        "                           [--seconds 10] [--drain-hz 500] [--port 19797]\n"
+        "                           [--json out.json]\n"
+        "\n"
+        "Sends tracks x positionX/Y/Z every 1/rate s over UDP loopback and through\n"
+        "the shared-memory ring, and reports the send-call cost, send -> receive\n"
+        "latency and lost values per transport. --drain-hz 0 spins the ring consumer.\n"
+        "\n"
+        "exit codes: 0 ok, 1 a transport could not be opened, 2 usage\n");
+}
+
+} // namespace
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    Config cfg;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string a = argv[i];
+        auto next = [&]() -> std::string
+        {
+            if (i + 1 >= argc)
+            {
+                std::fprintf (stderr, "error: %s needs a value\n", a.c_str());
+                std::exit (2);
+            }
+            return argv[++i];
+        };
+
+        if      (a == "--mode")      cfg.mode = next();
+        else if (a == "--tracks")    cfg.tracks = std::atoi (next().c_str());
+        else if (a == "--rate")      cfg.rateHz = std::atof (next().c_str());
+        else if (a == "--seconds")   cfg.seconds = std::atof (next().c_str());
+        else if (a == "--drain-hz")  cfg.drainHz = std::atof (next().c_str());
+        else if (a == "--port")      cfg.port = std::atoi (next().c_str());
+        else if (a == "--json")      cfg.jsonArg = next();
+        else if (a == "--help" || a == "-h") { usage(); return 0; }
+        else
+        {
+            std::fprintf (stderr, "error: unknown argument '%s'\n", a.c_str());
+            usage();
+            return 2;
+        }
+    }
+
+    const double total = cfg.tracks * 3.0 * cfg.rateHz * cfg.seconds;
+    if ((cfg.mode != "udp" && cfg.mode != "ring" && cfg.mode != "both")
+        || cfg.tracks <= 0 || cfg.rateHz <= 0.0 || cfg.seconds <= 0.0 || cfg.drainHz < 0.0
+        || cfg.port <= 0 || total >= 16777216.0)
+    {
+        std::fprintf (stderr, "error: invalid arguments (at most 2^24 values per run)\n");
+        usage();
+        return 2;
+    }
+
+    std::printf ("%d tracks x XYZ at %.1f Hz for %.1f s (%d values), ring drained at %.0f Hz\n",
+                 cfg.tracks, cfg.rateHz, cfg.seconds, static_cast<int> (total), cfg.drainHz);
+
+    std::vector<Result> results;
+    Result r;
+    if (cfg.mode != "ring")
+    {
+        if (! runUdp (cfg, static_cast<int> (total), r))
+            return 1;
+        print (r);
+        results.push_back (r);
+    }
+    if (cfg.mode != "udp")
+    {
+        if (! runRing (cfg, static_cast<int> (total), r))
+            return 1;
+        print (r);
+        results.push_back (r);
+    }
+
+    if (! cfg.jsonArg.empty())
+    {
+        const auto f = juce::File::getCurrentWorkingDirectory().getChildFile (juce::String (cfg.jsonArg));
+        if (! writeJson (f, cfg, results))
+        {
+            std::fprintf (stderr, "error: cannot write %s\n", cfg.jsonArg.c_str());
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,544 @@
+//==============================================================================
+// tracking-predict-bench — TrackingPredictor positional error vs ground truth.
+//
+// A tracked position is rendered a control tick or two after it arrived, so
+// without prediction a moving performer is heard where they were. This tool
+// replays tracker streams through WFSNetwork::TrackingPredictor (the object
+// the tracking receivers call after TrackingPositionFilter) and measures, for
+// every frame, the distance between what would be rendered and where the
+// source really is at render time:
+//
+//   arrival   = frame time + uniform network jitter
+//   render    = arrival + --latency-ms
+//   error     = | predicted position - truth(render) |
+//
+// Variants compared per stream:
+//   off       no prediction (the lag the predictor is meant to hide)
+//   cv        constant velocity, velocity from the last step
+//   ab        alpha-beta
+//   cv+vel    constant velocity with the stream's reported velocity
+//   ab+vel    alpha-beta fusing the stream's reported velocity
+// (the +vel variants only when the stream carries velocity: PSN speed /
+// RTTrP centroid acc-vel recordings, or any synthetic path).
+//
+//   tracking-predict-bench [--stream rec.csv]... [--scenario walk|circle|pace|still|all]
+//                          [--rate 60] [--duration 60] [--latency-ms 30]
+//                          [--horizon-ms <latency>] [--max-lead 0.3]
+//                          [--noise-mm 0] [--jitter-ms 2] [--seed 1]
+//                          [--strict] [--json out.json]
+//
+// Recorded streams are CSV, one frame per line, '#' for comments:
+//   t_ms,id,x,y,z[,vx,vy,vz]
+// in metres (and m/s), already in stage coordinates. Every id is replayed as
+// its own stream; its samples are also its ground truth (linearly
+// interpolated), so --noise-mm is what separates measurement from truth there.
+// Synthetic scenarios are sampled at --rate from an analytic path:
+//   walk    1.4 m/s around a 4.2 m square (sharp corners every 3 s)
+//   circle  3 m/s on a 3 m radius
+//   pace    sinusoidal back-and-forth over 6 m, 6 s period (reversals)
+//   still   standing, noise only (prediction must not amplify it)
+//
+// The app's TrackingPositionFilter smoothing is not applied: this isolates the
+// predictor. Errors are in mm; per variant it reports mean/p50/p95/max.
+// --strict exits 1 when no predictive variant beats "off" on p95 for a
+// moving stream.
+//==============================================================================
+
+#include <JuceHeader.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Network/TrackingPredictor.h"
+
+namespace
+{
+
+using WFSNetwork::TrackingPredictor;
+using WFSNetwork::TrackingMotionHint;
+
+//==============================================================================
+struct Frame
+{
+    double t = 0.0;                      // Seconds
+    float x = 0.0f, y = 0.0f, z = 0.0f;
+    float vx = 0.0f, vy = 0.0f, vz = 0.0f;
+};
+
+struct Stream
+{
+    std::string name;
+    int id = 1;
+    std::vector<Frame> frames;           // Ground truth, time-ordered
+    double sampleRateHz = 0.0;           // Synthetic: measurement rate (0 = every truth frame)
+    bool hasVelocity = false;
+    bool moving = true;
+};
+
+struct Config
+{
+    std::vector<std::string> streamFiles;
+    std::vector<std::string> scenarios;
+    double rateHz = 60.0;
+    double durationS = 60.0;
+    double latencyMs = 30.0;
+    double horizonMs = -1.0;             // < 0: same as latency
+    float maxLead = 0.3f;
+    double noiseMm = 0.0;
+    double jitterMs = 2.0;
+    unsigned seed = 1;
+    bool strict = false;
+    std::string jsonArg;
+};
+
+struct Variant
+{
+    const char* name;
+    int mode;
+    bool useVelocity;
+};
+
+const Variant variants[] =
+{
+    { "off",    TrackingPredictor::Off,              false },
+    { "cv",     TrackingPredictor::ConstantVelocity, false },
+    { "ab",     TrackingPredictor::AlphaBeta,        false },
+    { "cv+vel", TrackingPredictor::ConstantVelocity, true  },
+    { "ab+vel", TrackingPredictor::AlphaBeta,        true  },
+};
+
+struct ErrorStats
+{
+    std::string variant;
+    int frames = 0;
+    double meanMm = 0.0, p50Mm = 0.0, p95Mm = 0.0, maxMm = 0.0;
+};
+
+struct StreamResult
+{
+    std::string name;
+    bool moving = true;
+    std::vector<ErrorStats> variants;
+};
+
+//==============================================================================
+Frame truthAt (const Stream& s, double t)
+{
+    const auto& f = s.frames;
+    if (t <= f.front().t) return f.front();
+    if (t >= f.back().t)  return f.back();
+
+    const auto it = std::lower_bound (f.begin(), f.end(), t,
+                                      [] (const Frame& a, double v) { return a.t < v; });
+    const Frame& b = *it;
+    const Frame& a = *(it - 1);
+    const auto k = static_cast<float> ((t - a.t) / (b.t - a.t));
+
+    Frame r;
+    r.t = t;
+    r.x = a.x + (b.x - a.x) * k;
+    r.y = a.y + (b.y - a.y) * k;
+    r.z = a.z + (b.z - a.z) * k;
+    r.vx = a.vx + (b.vx - a.vx) * k;
+    r.vy = a.vy + (b.vy - a.vy) * k;
+    r.vz = a.vz + (b.vz - a.vz) * k;
+    return r;
+}
+
+//==============================================================================
+// Synthetic paths, tabulated at 1 kHz
+//==============================================================================
+
+bool makeScenario (const std::string& name, const Config& cfg, Stream& out)
+{
+    constexpr double tableRate = 1000.0;
+    const double twoPi = juce::MathConstants<double>::twoPi;
+
+    out = {};
+    out.name = name;
+    out.sampleRateHz = cfg.rateHz;
+    out.hasVelocity = true;
+    out.moving = name != "still";
+
+    const int n = static_cast<int> (cfg.durationS * tableRate) + 1;
+    out.frames.reserve (static_cast<size_t> (n));
+
+    for (int i = 0; i < n; ++i)
+    {
+        const double t = i / tableRate;
+        Frame f;
+        f.t = t;
+        f.z = 1.7f;
+
+        if (name == "walk")
+        {
+            const double side = 4.2, speed = 1.4, legS = side / speed;
+            const int leg = static_cast<int> (t / legS) % 4;
+            const double d = std::fmod (t, legS) * speed;
+            const double dirs[4][2] = { { 1, 0 }, { 0, 1 }, { -1, 0 }, { 0, -1 } };
+            const double starts[4][2] = { { -2.1, -2.1 }, { 2.1, -2.1 }, { 2.1, 2.1 }, { -2.1, 2.1 } };
+            f.x = static_cast<float> (starts[leg][0] + dirs[leg][0] * d);
+            f.y = static_cast<float> (starts[leg][1] + dirs[leg][1] * d);
+            f.vx = static_cast<float> (dirs[leg][0] * speed);
+            f.vy = static_cast<float> (dirs[leg][1] * speed);
+        }
+        else if (name == "circle")
+        {
+            const double r = 3.0, w = 3.0 / r;
+            f.x = static_cast<float> (r * std::cos (w * t));
+            f.y = static_cast<float> (r * std::sin (w * t));
+            f.vx = static_cast<float> (-r * w * std::sin (w * t));
+            f.vy = static_cast<float> ( r * w * std::cos (w * t));
+        }
+        else if (name == "pace")
+        {
+            const double a = 3.0, w = twoPi / 6.0;
+            f.x = static_cast<float> (a * std::sin (w * t));
+            f.y = 1.0f;
+            f.vx = static_cast<float> (a * w * std::cos (w * t));
+        }
+        else if (name == "still")
+        {
+            f.x = 0.5f;
+            f.y = 2.0f;
+        }
+        else
+        {
+            return false;
+        }
+
+        out.frames.push_back (f);
+    }
+    return true;
+}
+
+//==============================================================================
+// Recorded streams
+//==============================================================================
+
+bool loadStreams (const std::string& path, std::vector<Stream>& out)
+{
+    std::ifstream in (path);
+    if (! in)
+        return false;
+
+    std::map<int, Stream> byId;
+    std::string line;
+    while (std::getline (in, line))
+    {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::replace (line.begin(), line.end(), ',', ' ');
+        std::istringstream ls (line);
+        double tMs = 0.0;
+        int id = 0;
+        Frame f;
+        if (! (ls >> tMs >> id >> f.x >> f.y >> f.z))
+            continue;   // Header or malformed line
+
+        f.t = tMs * 0.001;
+        auto& s = byId[id];
+        if (ls >> f.vx >> f.vy >> f.vz)
+            s.hasVelocity = true;
+        s.frames.push_back (f);
+    }
+
+    const auto base = juce::File (juce::String (path)).getFileNameWithoutExtension().toStdString();
+    for (auto& [id, s] : byId)
+    {
+        std::stable_sort (s.frames.begin(), s.frames.end(),
+                          [] (const Frame& a, const Frame& b) { return a.t < b.t; });
+        if (s.frames.size() < 2)
+            continue;
+        s.name = base + "#" + std::to_string (id);
+        s.id = id;
+        out.push_back (std::move (s));
+    }
+    return true;
+}
+
+//==============================================================================
+ErrorStats summarise (const char* variant, std::vector<double>& errorsMm)
+{
+    ErrorStats st;
+    st.variant = variant;
+    st.frames = static_cast<int> (errorsMm.size());
+    if (errorsMm.empty())
+        return st;
+
+    std::sort (errorsMm.begin(), errorsMm.end());
+    double sum = 0.0;
+    for (double e : errorsMm)
+        sum += e;
+    auto pct = [&errorsMm] (double p)
+    {
+        return errorsMm[static_cast<size_t> (p * static_cast<double> (errorsMm.size() - 1) + 0.5)];
+    };
+    st.meanMm = sum / static_cast<double> (errorsMm.size());
+    st.p50Mm = pct (0.50);
+    st.p95Mm = pct (0.95);
+    st.maxMm = errorsMm.back();
+    return st;
+}
+
+ErrorStats runVariant (const Stream& s, const Variant& v, const Config& cfg)
+{
+    std::mt19937 rng (cfg.seed);
+    std::normal_distribution<float> noise (0.0f, static_cast<float> (cfg.noiseMm * 0.001));
+    std::uniform_real_distribution<double> jitter (0.0, cfg.jitterMs * 0.001);
+
+    TrackingPredictor predictor;
+    TrackingPredictor::Settings settings;
+    settings.mode = v.mode;
+    settings.horizonSeconds = static_cast<float> ((cfg.horizonMs >= 0.0 ? cfg.horizonMs : cfg.latencyMs) * 0.001);
+    settings.maxLead = cfg.maxLead;
+
+    const double latencyS = cfg.latencyMs * 0.001;
+    const double endT = s.frames.back().t;
+    const double step = s.sampleRateHz > 0.0 ? 1.0 / s.sampleRateHz : 0.0;
+
+    std::vector<double> errorsMm;
+    double lastArrival = -1.0;
+    size_t next = 0;
+
+    for (double t = s.frames.front().t; t <= endT; )
+    {
+        const Frame f = step > 0.0 ? truthAt (s, t) : s.frames[next];
+
+        float x = f.x + (cfg.noiseMm > 0.0 ? noise (rng) : 0.0f);
+        float y = f.y + (cfg.noiseMm > 0.0 ? noise (rng) : 0.0f);
+        float z = f.z + (cfg.noiseMm > 0.0 ? noise (rng) : 0.0f);
+
+        TrackingMotionHint hint;
+        hint.vx = f.vx;
+        hint.vy = f.vy;
+        hint.vz = f.vz;
+        hint.hasVelocity = true;
+
+        const double arrival = std::max (lastArrival, f.t + (cfg.jitterMs > 0.0 ? jitter (rng) : 0.0));
+        lastArrival = arrival;
+
+        predictor.process (0, s.id, settings, x, y, z, arrival, v.useVelocity ? &hint : nullptr);
+
+        const double render = arrival + latencyS;
+        if (render <= endT)
+        {
+            const Frame truth = truthAt (s, render);
+            const double dx = x - truth.x, dy = y - truth.y, dz = z - truth.z;
+            errorsMm.push_back (std::sqrt (dx * dx + dy * dy + dz * dz) * 1000.0);
+        }
+
+        if (step > 0.0)
+            t += step;
+        else if (++next < s.frames.size())
+            t = s.frames[next].t;
+        else
+            break;
+    }
+
+    return summarise (v.name, errorsMm);
+}
+
+StreamResult runStream (const Stream& s, const Config& cfg)
+{
+    StreamResult r;
+    r.name = s.name;
+    r.moving = s.moving;
+    for (const auto& v : variants)
+    {
+        if (v.useVelocity && ! s.hasVelocity)
+            continue;
+        r.variants.push_back (runVariant (s, v, cfg));
+    }
+    return r;
+}
+
+//==============================================================================
+void printResult (const StreamResult& r)
+{
+    std::printf ("\n%s\n", r.name.c_str());
+    std::printf ("  %-8s %8s %10s %10s %10s %10s\n", "variant", "frames", "mean mm", "p50 mm", "p95 mm", "max mm");
+    for (const auto& v : r.variants)
+        std::printf ("  %-8s %8d %10.1f %10.1f %10.1f %10.1f\n",
+                     v.variant.c_str(), v.frames, v.meanMm, v.p50Mm, v.p95Mm, v.maxMm);
+}
+
+bool predictionHelps (const StreamResult& r)
+{
+    if (! r.moving || r.variants.empty())
+        return true;
+    const double offP95 = r.variants.front().p95Mm;
+    for (size_t i = 1; i < r.variants.size(); ++i)
+        if (r.variants[i].p95Mm < offP95)
+            return true;
+    return false;
+}
+
+bool writeJson (const juce::File& f, const Config& cfg, const std::vector<StreamResult>& results)
+{
+    juce::String s;
+    s << "{\n"
+      << "  \"latencyMs\": " << juce::String (cfg.latencyMs, 3)
+      << ", \"horizonMs\": " << juce::String (cfg.horizonMs >= 0.0 ? cfg.horizonMs : cfg.latencyMs, 3)
+      << ", \"maxLead\": " << juce::String (cfg.maxLead, 3)
+      << ", \"noiseMm\": " << juce::String (cfg.noiseMm, 3)
+      << ", \"jitterMs\": " << juce::String (cfg.jitterMs, 3)
+      << ", \"rateHz\": " << juce::String (cfg.rateHz, 3)
+      << ", \"unit\": \"mm\",\n"
+      << "  \"streams\": [\n";
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const auto& r = results[i];
+        s << "    { \"name\": \"" << juce::String (r.name) << "\", \"variants\": { ";
+        for (size_t k = 0; k < r.variants.size(); ++k)
+        {
+            const auto& v = r.variants[k];
+            s << (k == 0 ? "" : ", ") << "\"" << juce::String (v.variant) << "\": { "
+              << "\"frames\": " << v.frames
+              << ", \"mean\": " << juce::String (v.meanMm, 2)
+              << ", \"p50\": " << juce::String (v.p50Mm, 2)
+              << ", \"p95\": " << juce::String (v.p95Mm, 2)
+              << ", \"max\": " << juce::String (v.maxMm, 2) << " }";
+        }
+        s << " } }" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    s << "  ]\n}\n";
+
+    return f.replaceWithText (s);
+}
+
+void usage()
+{
+    std::fprintf (stderr,
+        "usage: tracking-predict-bench [--stream rec.csv]... [--scenario walk|circle|pace|still|all]\n"
+        "                              [--rate 60] [--duration 60] [--latency-ms 30]\n"
+        "                              [--horizon-ms <latency>] [--max-lead 0.3]\n"
+        "                              [--noise-mm 0] [--jitter-ms 2] [--seed 1]\n"
+        "                              [--strict] [--json out.json]\n"
+        "\n"
+        "Replays tracker streams (CSV: t_ms,id,x,y,z[,vx,vy,vz]) or synthetic paths\n"
+        "through TrackingPredictor and reports the distance between the rendered\n"
+        "and the true position at render time, per variant (off, cv, ab, +vel).\n"
+        "Without --stream or --scenario, runs every synthetic scenario.\n"
+        "\n"
+        "exit codes: 0 ok, 1 --strict and prediction never beat off on a moving\n"
+        "stream, 2 usage or unreadable stream\n");
+}
+
+} // namespace
+
+//==============================================================================
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    Config cfg;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string a = argv[i];
+        auto next = [&]() -> std::string
+        {
+            if (i + 1 >= argc)
+            {
+                std::fprintf (stderr, "error: %s needs a value\n", a.c_str());
+                std::exit (2);
+            }
+            return argv[++i];
+        };
+
+        if      (a == "--stream")      cfg.streamFiles.push_back (next());
+        else if (a == "--scenario")    cfg.scenarios.push_back (next());
+        else if (a == "--rate")        cfg.rateHz = std::atof (next().c_str());
+        else if (a == "--duration")    cfg.durationS = std::atof (next().c_str());
+        else if (a == "--latency-ms")  cfg.latencyMs = std::atof (next().c_str());
+        else if (a == "--horizon-ms")  cfg.horizonMs = std::atof (next().c_str());
+        else if (a == "--max-lead")    cfg.maxLead = static_cast<float> (std::atof (next().c_str()));
+        else if (a == "--noise-mm")    cfg.noiseMm = std::atof (next().c_str());
+        else if (a == "--jitter-ms")   cfg.jitterMs = std::atof (next().c_str());
+        else if (a == "--seed")        cfg.seed = static_cast<unsigned> (std::atoi (next().c_str()));
+        else if (a == "--strict")      cfg.strict = true;
+        else if (a == "--json")        cfg.jsonArg = next();
+        else if (a == "--help" || a == "-h") { usage(); return 0; }
+        else
+        {
+            std::fprintf (stderr, "error: unknown argument '%s'\n", a.c_str());
+            usage();
+            return 2;
+        }
+    }
+
+    if (cfg.rateHz <= 0.0 || cfg.durationS <= 0.0 || cfg.latencyMs < 0.0
+        || cfg.noiseMm < 0.0 || cfg.jitterMs < 0.0 || cfg.maxLead < 0.0f)
+    {
+        std::fprintf (stderr, "error: invalid rate/duration/latency/noise/jitter/lead arguments\n");
+        return 2;
+    }
+
+    std::vector<Stream> streams;
+    for (const auto& path : cfg.streamFiles)
+    {
+        if (! loadStreams (path, streams))
+        {
+            std::fprintf (stderr, "error: cannot read %s\n", path.c_str());
+            return 2;
+        }
+    }
+
+    if (cfg.streamFiles.empty() && cfg.scenarios.empty())
+        cfg.scenarios.push_back ("all");
+
+    for (const auto& name : cfg.scenarios)
+    {
+        const std::vector<std::string> names = name == "all"
+            ? std::vector<std::string> { "walk", "circle", "pace", "still" }
+            : std::vector<std::string> { name };
+        for (const auto& n : names)
+        {
+            Stream s;
+            if (! makeScenario (n, cfg, s))
+            {
+                std::fprintf (stderr, "error: unknown scenario '%s'\n", n.c_str());
+                return 2;
+            }
+            streams.push_back (std::move (s));
+        }
+    }
+
+    std::fprintf (stderr, "tracking-predict-bench: latency=%.1fms horizon=%.1fms max-lead=%.2fm noise=%.1fmm jitter=%.1fms\n",
+                  cfg.latencyMs, cfg.horizonMs >= 0.0 ? cfg.horizonMs : cfg.latencyMs,
+                  static_cast<double> (cfg.maxLead), cfg.noiseMm, cfg.jitterMs);
+
+    std::vector<StreamResult> results;
+    bool allHelped = true;
+    for (const auto& s : streams)
+    {
+        auto r = runStream (s, cfg);
+        printResult (r);
+        allHelped = allHelped && predictionHelps (r);
+        results.push_back (std::move (r));
+    }
+
+    if (! cfg.jsonArg.empty())
+    {
+        const auto f = juce::File::getCurrentWorkingDirectory()
+                           .getChildFile (juce::String (cfg.jsonArg));
+        if (writeJson (f, cfg, results))
+            std::fprintf (stderr, "note: JSON written to %s\n",
+                          f.getFullPathName().toRawUTF8());
+        else
+            std::fprintf (stderr, "warning: could not write %s\n",
+                          f.getFullPathName().toRawUTF8());
+    }
+
+    return cfg.strict && ! allHelped ? 1 : 0;
+}